@@ -28,6 +28,9 @@
 #    define HG_TEST_ALLOC(size) malloc(size)
 #endif
 
+/* Number of transfers used to gather bulk data in batch */
+#define HG_TEST_BULK_BATCH_COUNT (16)
+
 #ifdef HG_TEST_HAS_THREAD_POOL
 #    define HG_TEST_RPC_CB(func_name, handle)                                  \
         static hg_return_t func_name##_thread_cb(hg_handle_t handle)
@@ -88,6 +91,8 @@ struct hg_test_bulk_args {
     hg_size_t transfer_size;
     hg_size_t origin_offset;
     hg_size_t target_offset;
+    hg_bulk_t origin_bulk_handle;
+    hg_bulk_t local_bulk_handle;
 };
 
 struct hg_test_bulk_fwd_args {
@@ -109,6 +114,12 @@ hg_test_bulk_bind_transfer_cb(const struct hg_cb_info *hg_cb_info);
 static hg_return_t
 hg_test_bulk_bind_forward_fwd_cb(const struct hg_cb_info *hg_cb_info);
 
+static hg_return_t
+hg_test_bulk_batch_transfer_cb(const struct hg_cb_info *hg_cb_info);
+
+static hg_return_t
+hg_test_bulk_checksum_transfer_cb(const struct hg_cb_info *hg_cb_info);
+
 static hg_return_t
 hg_test_perf_bulk_transfer_cb(const struct hg_cb_info *hg_cb_info);
 
@@ -546,6 +557,195 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_bulk_batch_write, handle)
+{
+    const struct hg_info *hg_info = NULL;
+    struct hg_test_bulk_args *bulk_args = NULL;
+    struct hg_bulk_transfer_desc descs[HG_TEST_BULK_BATCH_COUNT];
+    bulk_write_in_t in_struct;
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    bulk_args =
+        (struct hg_test_bulk_args *) malloc(sizeof(struct hg_test_bulk_args));
+    HG_TEST_CHECK_ERROR(bulk_args == NULL, error, ret, HG_NOMEM_ERROR,
+        "Could not allocate bulk_args");
+
+    /* Keep handle to pass to callback */
+    bulk_args->handle = handle;
+
+    /* Get info from handle */
+    hg_info = HG_Get_info(handle);
+
+    /* Get input parameters and data */
+    ret = HG_Get_input(handle, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Get_input() failed (%s)", HG_Error_to_string(ret));
+
+    /* Get parameters */
+    bulk_args->origin_bulk_handle = in_struct.bulk_handle;
+    bulk_args->nbytes = HG_Bulk_get_size(bulk_args->origin_bulk_handle);
+    bulk_args->transfer_size = in_struct.transfer_size;
+    bulk_args->origin_offset = in_struct.origin_offset;
+    bulk_args->target_offset = in_struct.target_offset;
+    bulk_args->fildes = in_struct.fildes;
+
+    ret = HG_Bulk_ref_incr(bulk_args->origin_bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_ref_incr() failed (%s)", HG_Error_to_string(ret));
+
+    /* Free input */
+    ret = HG_Free_input(handle, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Free_input() failed (%s)", HG_Error_to_string(ret));
+
+    /* Create a new block handle to read the data */
+    ret = HG_Bulk_create(hg_info->hg_class, 1, NULL,
+        (hg_size_t *) &bulk_args->nbytes, HG_BULK_READWRITE,
+        &bulk_args->local_bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+    /* Gather bulk data in pieces (some of them may be empty) */
+    for (i = 0; i < HG_TEST_BULK_BATCH_COUNT; i++) {
+        hg_size_t start =
+            i * bulk_args->transfer_size / HG_TEST_BULK_BATCH_COUNT;
+        hg_size_t end =
+            (i + 1) * bulk_args->transfer_size / HG_TEST_BULK_BATCH_COUNT;
+
+        descs[i].origin_addr = hg_info->addr;
+        descs[i].origin_id = hg_info->context_id;
+        descs[i].origin_handle = bulk_args->origin_bulk_handle;
+        descs[i].origin_offset = bulk_args->origin_offset + start;
+        descs[i].local_handle = bulk_args->local_bulk_handle;
+        descs[i].local_offset = bulk_args->target_offset + start;
+        descs[i].size = end - start;
+    }
+
+    HG_TEST_LOG_DEBUG("Requesting transfer_size=%zu, origin_offset=%zu, "
+                      "target_offset=%zu in %d transfers",
+        bulk_args->transfer_size, bulk_args->origin_offset,
+        bulk_args->target_offset, HG_TEST_BULK_BATCH_COUNT);
+    ret = HG_Bulk_transfer_batch(hg_info->context,
+        hg_test_bulk_batch_transfer_cb, bulk_args, HG_BULK_PULL, descs,
+        HG_TEST_BULK_BATCH_COUNT, HG_OP_ID_IGNORE);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_transfer_batch() failed (%s)",
+        HG_Error_to_string(ret));
+
+    return ret;
+
+error:
+    ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(
+        ret != HG_SUCCESS, "HG_Destroy() failed (%s)", HG_Error_to_string(ret));
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_bulk_read_respond, handle)
+{
+    const struct hg_info *hg_info = NULL;
+    struct hg_test_info *hg_test_info = NULL;
+    bulk_write_in_t in_struct;
+    bulk_write_out_t out_struct;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Get info from handle */
+    hg_info = HG_Get_info(handle);
+
+    /* Get test info */
+    hg_test_info = (struct hg_test_info *) HG_Class_get_data(hg_info->hg_class);
+    HG_TEST_CHECK_ERROR(
+        hg_test_info == NULL, done, ret, HG_INVALID_ARG, "NULL hg_test_info");
+
+    /* Get input struct */
+    ret = HG_Get_input(handle, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Get_input() failed (%s)", HG_Error_to_string(ret));
+
+    /* Push data and respond without waiting for the push to complete */
+    out_struct.ret = in_struct.transfer_size;
+#ifdef HG_TEST_HAS_THREAD_POOL
+    hg_thread_mutex_lock(&hg_test_info->bulk_handle_mutex);
+#endif
+    ret = HG_Respond_with_bulk(handle, NULL, NULL, &out_struct,
+        in_struct.bulk_handle, in_struct.origin_offset,
+        hg_test_info->bulk_handle, in_struct.target_offset,
+        in_struct.transfer_size);
+#ifdef HG_TEST_HAS_THREAD_POOL
+    hg_thread_mutex_unlock(&hg_test_info->bulk_handle_mutex);
+#endif
+    HG_TEST_CHECK_ERROR_DONE(ret != HG_SUCCESS,
+        "HG_Respond_with_bulk() failed (%s)", HG_Error_to_string(ret));
+
+    /* Push holds its own reference to the bulk handle */
+    ret = HG_Free_input(handle, &in_struct);
+    HG_TEST_CHECK_ERROR_DONE(ret != HG_SUCCESS, "HG_Free_input() failed (%s)",
+        HG_Error_to_string(ret));
+
+done:
+    ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(
+        ret != HG_SUCCESS, "HG_Destroy() failed (%s)", HG_Error_to_string(ret));
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_bulk_checksum, handle)
+{
+    const struct hg_info *hg_info = NULL;
+    hg_bulk_t origin_bulk_handle = HG_BULK_NULL;
+    hg_bulk_t local_bulk_handle = HG_BULK_NULL;
+    bulk_write_in_t in_struct;
+    hg_size_t nbytes;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Get info from handle */
+    hg_info = HG_Get_info(handle);
+
+    /* Get input parameters and data */
+    ret = HG_Get_input(handle, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Get_input() failed (%s)", HG_Error_to_string(ret));
+
+    origin_bulk_handle = in_struct.bulk_handle;
+    nbytes = HG_Bulk_get_size(origin_bulk_handle);
+
+    ret = HG_Bulk_ref_incr(origin_bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_ref_incr() failed (%s)", HG_Error_to_string(ret));
+
+    /* Free input */
+    ret = HG_Free_input(handle, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Free_input() failed (%s)", HG_Error_to_string(ret));
+
+    /* Create a new block handle to read the data */
+    ret = HG_Bulk_create(hg_info->hg_class, 1, NULL, &nbytes,
+        HG_BULK_READWRITE, &local_bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+    /* Pull bulk data, result of verification is returned to origin */
+    ret = HG_Bulk_transfer(hg_info->context, hg_test_bulk_checksum_transfer_cb,
+        handle, HG_BULK_PULL, hg_info->addr, origin_bulk_handle, 0,
+        local_bulk_handle, 0, nbytes, HG_OP_ID_IGNORE);
+    HG_TEST_CHECK_HG_ERROR(error, ret, "HG_Bulk_transfer() failed (%s)",
+        HG_Error_to_string(ret));
+
+    return ret;
+
+error:
+    ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(
+        ret != HG_SUCCESS, "HG_Destroy() failed (%s)", HG_Error_to_string(ret));
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_bulk_bind_forward_fwd_cb(const struct hg_cb_info *hg_cb_info)
@@ -652,6 +852,53 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_batch_transfer_cb(const struct hg_cb_info *hg_cb_info)
+{
+    struct hg_test_bulk_args *bulk_args =
+        (struct hg_test_bulk_args *) hg_cb_info->arg;
+    struct hg_cb_info bulk_cb_info = *hg_cb_info;
+
+    /* Handles are not passed back by batched transfers */
+    bulk_cb_info.info.bulk.origin_handle = bulk_args->origin_bulk_handle;
+    bulk_cb_info.info.bulk.local_handle = bulk_args->local_bulk_handle;
+
+    return hg_test_bulk_transfer_cb(&bulk_cb_info);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_checksum_transfer_cb(const struct hg_cb_info *hg_cb_info)
+{
+    hg_handle_t handle = (hg_handle_t) hg_cb_info->arg;
+    bulk_write_out_t out_struct;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Return status of transfer instead of number of bytes */
+    out_struct.ret = (hg_size_t) hg_cb_info->ret;
+
+    /* Free block handles */
+    ret = HG_Bulk_free(hg_cb_info->info.bulk.local_handle);
+    HG_TEST_CHECK_ERROR_DONE(ret != HG_SUCCESS, "HG_Bulk_free() failed (%s)",
+        HG_Error_to_string(ret));
+
+    ret = HG_Bulk_free(hg_cb_info->info.bulk.origin_handle);
+    HG_TEST_CHECK_ERROR_DONE(ret != HG_SUCCESS, "HG_Bulk_free() failed (%s)",
+        HG_Error_to_string(ret));
+
+    /* Send response back */
+    ret = HG_Respond(handle, NULL, NULL, &out_struct);
+    HG_TEST_CHECK_ERROR_DONE(
+        ret != HG_SUCCESS, "HG_Respond() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(
+        ret != HG_SUCCESS, "HG_Destroy() failed (%s)", HG_Error_to_string(ret));
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_bulk_bind_transfer_cb(const struct hg_cb_info *hg_cb_info)
@@ -906,6 +1153,76 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+HG_TEST_RPC_CB(hg_test_perf_bulk_read_pipelined, handle)
+{
+    hg_return_t ret = HG_SUCCESS;
+    const struct hg_info *hg_info = NULL;
+    struct hg_test_info *hg_test_info = NULL;
+    hg_bulk_t origin_bulk_handle = HG_BULK_NULL;
+    hg_bulk_t local_bulk_handle = HG_BULK_NULL;
+    bulk_pipelined_in_t in_struct;
+    hg_size_t chunk_size;
+    unsigned int window;
+
+    /* Get info from handle */
+    hg_info = HG_Get_info(handle);
+
+    /* Get test info */
+    hg_test_info = (struct hg_test_info *) HG_Class_get_data(hg_info->hg_class);
+    HG_TEST_CHECK_ERROR(
+        hg_test_info == NULL, error, ret, HG_INVALID_ARG, "NULL hg_test_info");
+
+    /* Get input struct */
+    ret = HG_Get_input(handle, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Get_input() failed (%s)", HG_Error_to_string(ret));
+
+    origin_bulk_handle = in_struct.bulk_handle;
+    chunk_size = in_struct.chunk_size;
+    window = in_struct.window;
+
+#ifdef HG_TEST_HAS_THREAD_POOL
+    hg_thread_mutex_lock(&hg_test_info->bulk_handle_mutex);
+#endif
+    local_bulk_handle = hg_test_info->bulk_handle;
+
+    ret = HG_Bulk_ref_incr(origin_bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Bulk_ref_incr() failed (%s)", HG_Error_to_string(ret));
+
+    /* Free input */
+    ret = HG_Free_input(handle, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        error, ret, "HG_Free_input() failed (%s)", HG_Error_to_string(ret));
+
+    /* Push bulk data in chunks */
+    ret = HG_Bulk_transfer_pipelined(hg_info->context,
+        hg_test_perf_bulk_transfer_cb, NULL, handle, HG_BULK_PUSH,
+        hg_info->addr, hg_info->context_id, origin_bulk_handle, 0,
+        local_bulk_handle, 0, HG_Bulk_get_size(origin_bulk_handle), chunk_size,
+        window, HG_OP_ID_IGNORE);
+    HG_TEST_CHECK_HG_ERROR(error, ret,
+        "HG_Bulk_transfer_pipelined() failed (%s)", HG_Error_to_string(ret));
+
+#ifdef HG_TEST_HAS_THREAD_POOL
+    hg_thread_mutex_unlock(&hg_test_info->bulk_handle_mutex);
+#endif
+
+    return ret;
+
+error:
+#ifdef HG_TEST_HAS_THREAD_POOL
+    hg_thread_mutex_unlock(&hg_test_info->bulk_handle_mutex);
+#endif
+
+    ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(
+        ret != HG_SUCCESS, "HG_Destroy() failed (%s)", HG_Error_to_string(ret));
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_perf_bulk_transfer_cb(const struct hg_cb_info *hg_cb_info)
@@ -1040,6 +1357,9 @@ HG_TEST_THREAD_CB(hg_test_cancel_rpc)
 HG_TEST_THREAD_CB(hg_test_bulk_write)
 HG_TEST_THREAD_CB(hg_test_bulk_bind_write)
 HG_TEST_THREAD_CB(hg_test_bulk_bind_forward)
+HG_TEST_THREAD_CB(hg_test_bulk_batch_write)
+HG_TEST_THREAD_CB(hg_test_bulk_read_respond)
+HG_TEST_THREAD_CB(hg_test_bulk_checksum)
 
 HG_TEST_THREAD_CB(hg_test_killed_rpc)
 
@@ -1047,6 +1367,7 @@ HG_TEST_THREAD_CB(hg_test_perf_rpc)
 HG_TEST_THREAD_CB(hg_test_perf_rpc_lat)
 HG_TEST_THREAD_CB(hg_test_perf_bulk)
 HG_TEST_THREAD_CB(hg_test_perf_bulk_read)
+HG_TEST_THREAD_CB(hg_test_perf_bulk_read_pipelined)
 // HG_TEST_THREAD_CB(hg_test_nested1)
 // HG_TEST_THREAD_CB(hg_test_nested2)
 
@@ -34,6 +34,12 @@ hg_return_t
 hg_test_bulk_bind_write_cb(hg_handle_t handle);
 hg_return_t
 hg_test_bulk_bind_forward_cb(hg_handle_t handle);
+hg_return_t
+hg_test_bulk_batch_write_cb(hg_handle_t handle);
+hg_return_t
+hg_test_bulk_read_respond_cb(hg_handle_t handle);
+hg_return_t
+hg_test_bulk_checksum_cb(hg_handle_t handle);
 
 /**
  * test_kill
@@ -52,6 +58,8 @@ hg_return_t
 hg_test_perf_bulk_cb(hg_handle_t handle);
 hg_return_t
 hg_test_perf_bulk_read_cb(hg_handle_t handle);
+hg_return_t
+hg_test_perf_bulk_read_pipelined_cb(hg_handle_t handle);
 
 /**
  * test_nested
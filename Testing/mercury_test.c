@@ -89,6 +89,9 @@ hg_id_t hg_test_cancel_rpc_id_g = 0;
 hg_id_t hg_test_bulk_write_id_g = 0;
 hg_id_t hg_test_bulk_bind_write_id_g = 0;
 hg_id_t hg_test_bulk_bind_forward_id_g = 0;
+hg_id_t hg_test_bulk_batch_write_id_g = 0;
+hg_id_t hg_test_bulk_read_respond_id_g = 0;
+hg_id_t hg_test_bulk_checksum_id_g = 0;
 
 /* test_kill */
 hg_id_t hg_test_killed_rpc_id_g = 0;
@@ -99,6 +102,7 @@ hg_id_t hg_test_perf_rpc_lat_id_g = 0;
 hg_id_t hg_test_perf_bulk_id_g = 0;
 hg_id_t hg_test_perf_bulk_write_id_g = 0;
 hg_id_t hg_test_perf_bulk_read_id_g = 0;
+hg_id_t hg_test_perf_bulk_read_pipelined_id_g = 0;
 
 /* test_nested */
 hg_id_t hg_test_nested1_id_g = 0;
@@ -327,6 +331,15 @@ hg_test_register(hg_class_t *hg_class)
     HG_Registered_disable_response(
         hg_class, hg_test_rpc_open_id_no_resp_g, HG_TRUE);
 
+#ifndef HG_HAS_XDR
+    /* Decode path without copy */
+    HG_Registered_enable_decode_views(
+        hg_class, hg_test_rpc_open_id_no_resp_g, HG_TRUE);
+
+    /* Compact integer encoding */
+    HG_Registered_enable_varint(hg_class, hg_test_rpc_open_id_g, HG_TRUE);
+#endif
+
     hg_test_overflow_id_g = MERCURY_REGISTER(hg_class, "hg_test_overflow", void,
         overflow_out_t, hg_test_overflow_cb);
     hg_test_cancel_rpc_id_g = MERCURY_REGISTER(
@@ -341,6 +354,15 @@ hg_test_register(hg_class_t *hg_class)
     hg_test_bulk_bind_forward_id_g =
         MERCURY_REGISTER(hg_class, "hg_test_bulk_bind_forward", bulk_write_in_t,
             bulk_write_out_t, hg_test_bulk_bind_forward_cb);
+    hg_test_bulk_batch_write_id_g =
+        MERCURY_REGISTER(hg_class, "hg_test_bulk_batch_write", bulk_write_in_t,
+            bulk_write_out_t, hg_test_bulk_batch_write_cb);
+    hg_test_bulk_read_respond_id_g =
+        MERCURY_REGISTER(hg_class, "hg_test_bulk_read_respond",
+            bulk_write_in_t, bulk_write_out_t, hg_test_bulk_read_respond_cb);
+    hg_test_bulk_checksum_id_g =
+        MERCURY_REGISTER(hg_class, "hg_test_bulk_checksum",
+            bulk_checksum_in_t, bulk_write_out_t, hg_test_bulk_checksum_cb);
 
     /* test_kill */
     hg_test_killed_rpc_id_g = MERCURY_REGISTER(
@@ -352,12 +374,18 @@ hg_test_register(hg_class_t *hg_class)
     hg_test_perf_rpc_lat_id_g =
         MERCURY_REGISTER(hg_class, "hg_test_perf_rpc_lat", perf_rpc_lat_in_t,
             void, hg_test_perf_rpc_lat_cb);
+
+    /* Decode variable-length payload without malloc */
+    HG_Registered_enable_arena(hg_class, hg_test_perf_rpc_lat_id_g, HG_TRUE);
     hg_test_perf_bulk_id_g = MERCURY_REGISTER(hg_class, "hg_test_perf_bulk",
         bulk_write_in_t, void, hg_test_perf_bulk_cb);
     hg_test_perf_bulk_write_id_g = hg_test_perf_bulk_id_g;
     hg_test_perf_bulk_read_id_g =
         MERCURY_REGISTER(hg_class, "hg_test_perf_bulk_read", bulk_write_in_t,
             void, hg_test_perf_bulk_read_cb);
+    hg_test_perf_bulk_read_pipelined_id_g =
+        MERCURY_REGISTER(hg_class, "hg_test_perf_bulk_read_pipelined",
+            bulk_pipelined_in_t, void, hg_test_perf_bulk_read_pipelined_cb);
 
     /* test_nested */
     //    hg_test_nested1_id_g = MERCURY_REGISTER(hg_class, "hg_test_nested",
@@ -429,6 +457,21 @@ HG_Test_init(int argc, char *argv[], struct hg_test_info *hg_test_info)
     if (hg_test_info->auto_sm)
         hg_init_info.auto_sm = HG_TRUE;
 
+    /* Set bulk registration cache size */
+    hg_init_info.bulk_reg_cache_size = hg_test_info->bulk_reg_cache_size;
+
+    /* Set bulk descriptor cache size */
+    hg_init_info.bulk_desc_cache_count = hg_test_info->bulk_desc_cache_count;
+
+    /* Set max number of bulk op IDs per context */
+    hg_init_info.bulk_op_pool_max = hg_test_info->bulk_op_pool_max;
+
+    /* Compress large bulk data */
+    hg_init_info.bulk_compress = hg_test_info->bulk_compress;
+
+    /* Checksum bulk data pulled by targets */
+    hg_init_info.bulk_checksum = hg_test_info->bulk_checksum;
+
     /* Assign NA class */
     hg_init_info.na_class = hg_test_info->na_test_info.na_class;
 
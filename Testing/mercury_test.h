@@ -47,6 +47,9 @@ struct hg_test_info {
     hg_addr_t target_addr;
     hg_bulk_t bulk_handle;
     hg_size_t buf_size_max;
+    hg_size_t bulk_reg_cache_size;
+    hg_uint32_t bulk_desc_cache_count;
+    hg_uint32_t bulk_op_pool_max;
 #ifdef HG_TEST_HAS_CRAY_DRC
     uint32_t credential;
     uint32_t wlm_id;
@@ -57,6 +60,8 @@ struct hg_test_info {
     unsigned int thread_count;
     hg_bool_t auth;
     hg_bool_t auto_sm;
+    hg_bool_t bulk_compress;
+    hg_bool_t bulk_checksum;
 };
 
 struct hg_test_context_info {
@@ -427,6 +427,8 @@ NA_Test_init(int argc, char *argv[], struct na_test_info *na_test_info)
     }
     na_init_info.auth_key = na_test_info->key;
     na_init_info.max_contexts = na_test_info->max_contexts;
+    /* More buffers than fit in a single word of the na_sm bitmap */
+    na_init_info.msg_buf_count = 128;
 
     printf("# Using info string: %s\n", info_string);
     na_test_info->na_class =
@@ -15,6 +15,9 @@
 
 #include <stdlib.h>
 #include <string.h>
+#ifndef _WIN32
+#    include <sys/resource.h>
+#endif
 
 /****************/
 /* Local Macros */
@@ -60,6 +63,9 @@ na_test_target_lookup(struct na_test_lat_info *na_test_lat_info);
 static NA_INLINE int
 na_test_recv_expected_cb(const struct na_cb_info *na_cb_info);
 
+static double
+na_test_cpu_time(void);
+
 static na_return_t
 na_test_measure_latency(
     struct na_test_lat_info *na_test_lat_info, na_size_t size);
@@ -135,6 +141,27 @@ na_test_recv_expected_cb(const struct na_cb_info *na_cb_info)
     return NA_SUCCESS;
 }
 
+/*---------------------------------------------------------------------------*/
+static double
+na_test_cpu_time(void)
+{
+#ifdef _WIN32
+    return 0;
+#else
+    struct rusage usage;
+
+    /* User and system time consumed by the process, including the time
+     * spent in progress syscalls (e.g., notifications) */
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+        return 0;
+
+    return (double) usage.ru_utime.tv_sec +
+           (double) usage.ru_utime.tv_usec * 1.0e-6 +
+           (double) usage.ru_stime.tv_sec +
+           (double) usage.ru_stime.tv_usec * 1.0e-6;
+#endif
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_test_measure_latency(
@@ -153,6 +180,7 @@ na_test_measure_latency(
         size < unexpected_header_size ? unexpected_header_size : size;
     size_t avg_iter;
     double time_read = 0, read_lat;
+    double cpu_start, cpu_lat;
     na_return_t ret = NA_SUCCESS;
     size_t i;
 
@@ -211,6 +239,7 @@ again:
     NA_Test_barrier(&na_test_lat_info->na_test_info);
 
     /* Actual benchmark */
+    cpu_start = na_test_cpu_time();
     for (avg_iter = 0; avg_iter < loop; avg_iter++) {
         hg_time_t t1, t2;
 
@@ -277,9 +306,12 @@ again:
         time_read * 1.0e6 /
         (double) (loop * 2 *
                   (unsigned int) na_test_lat_info->na_test_info.mpi_comm_size);
-    if (na_test_lat_info->na_test_info.mpi_comm_rank == 0)
-        fprintf(stdout, "%-*d%*.*f", 10, (int) size, NWIDTH, NDIGITS, read_lat);
 #endif
+    /* CPU time of this process only, per msg */
+    cpu_lat = (na_test_cpu_time() - cpu_start) * 1.0e6 / (double) (loop * 2);
+    if (na_test_lat_info->na_test_info.mpi_comm_rank == 0)
+        fprintf(stdout, "%-*d%*.*f%*.*f", 10, (int) size, NWIDTH, NDIGITS,
+            read_lat, NWIDTH, NDIGITS, cpu_lat);
     if (na_test_lat_info->na_test_info.mpi_comm_rank == 0)
         fprintf(stdout, "\n");
 
@@ -385,7 +417,8 @@ main(int argc, char *argv[])
 #ifdef HG_TEST_HAS_VERIFY_DATA
         fprintf(stdout, "# WARNING verifying data, output will be slower\n");
 #endif
-        fprintf(stdout, "%-*s%*s\n", 10, "# Size", NWIDTH, "Latency (us)");
+        fprintf(stdout, "%-*s%*s%*s\n", 10, "# Size", NWIDTH, "Latency (us)",
+            NWIDTH, "CPU (us)");
         fflush(stdout);
     }
 
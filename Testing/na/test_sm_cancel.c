@@ -0,0 +1,271 @@
+/*
+ * Copyright (C) 2013-2020 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "na_test.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Max number of progress calls before giving up */
+#define NA_TEST_PROGRESS_MAX 1000
+
+#define NA_TEST_TAG_CANCELED 1
+#define NA_TEST_TAG_RESENT   2
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+struct na_test_op_info {
+    na_class_t *na_class;
+    na_return_t ret;
+    na_tag_t tag;
+    na_size_t actual_buf_size;
+    int completed;
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static int
+na_test_op_cb(const struct na_cb_info *callback_info);
+
+static na_return_t
+na_test_wait(na_class_t *na_class, na_context_t *context, const int *completed);
+
+static na_return_t
+na_test_rdv_cancel(na_class_t *na_class, na_context_t *context,
+    na_addr_t target_addr, na_size_t buf_size);
+
+/*---------------------------------------------------------------------------*/
+static int
+na_test_op_cb(const struct na_cb_info *callback_info)
+{
+    struct na_test_op_info *op_info =
+        (struct na_test_op_info *) callback_info->arg;
+
+    op_info->ret = callback_info->ret;
+    if (callback_info->type == NA_CB_RECV_UNEXPECTED &&
+        callback_info->ret == NA_SUCCESS) {
+        op_info->tag = callback_info->info.recv_unexpected.tag;
+        op_info->actual_buf_size =
+            callback_info->info.recv_unexpected.actual_buf_size;
+        NA_Addr_free(
+            op_info->na_class, callback_info->info.recv_unexpected.source);
+    }
+    op_info->completed = 1;
+
+    return NA_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_test_wait(na_class_t *na_class, na_context_t *context, const int *completed)
+{
+    int i;
+
+    for (i = 0; i < NA_TEST_PROGRESS_MAX; i++) {
+        unsigned int actual_count = 0;
+        na_return_t ret;
+
+        do {
+            ret = NA_Trigger(context, 0, 1, NULL, &actual_count);
+        } while ((ret == NA_SUCCESS) && actual_count);
+
+        if (*completed)
+            return NA_SUCCESS;
+
+        ret = NA_Progress(na_class, context, 100);
+        if (ret != NA_SUCCESS && ret != NA_TIMEOUT)
+            return ret;
+    }
+
+    return NA_TIMEOUT;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_test_rdv_cancel(na_class_t *na_class, na_context_t *context,
+    na_addr_t target_addr, na_size_t buf_size)
+{
+    struct na_test_op_info send_info = {na_class, NA_SUCCESS, 0, 0, 0};
+    struct na_test_op_info recv_info = {na_class, NA_SUCCESS, 0, 0, 0};
+    na_op_id_t *send_op_id = NULL, *recv_op_id = NULL;
+    char *send_buf = NULL, *recv_buf = NULL;
+    unsigned int actual_count = 0;
+    na_return_t ret = NA_SUCCESS;
+    na_size_t i;
+
+    send_buf = (char *) malloc(buf_size);
+    recv_buf = (char *) malloc(buf_size);
+    NA_TEST_CHECK_ERROR(send_buf == NULL || recv_buf == NULL, done, ret,
+        NA_NOMEM, "Could not allocate buffers");
+    memset(send_buf, 'a', buf_size);
+
+    send_op_id = NA_Op_create(na_class);
+    recv_op_id = NA_Op_create(na_class);
+    NA_TEST_CHECK_ERROR(send_op_id == NULL || recv_op_id == NULL, done, ret,
+        NA_NOMEM, "NA_Op_create() failed");
+
+    /* Msg is pulled by the receiver, cancel it once posted */
+    ret = NA_Msg_send_unexpected(na_class, context, na_test_op_cb, &send_info,
+        send_buf, buf_size, NULL, target_addr, 0, NA_TEST_TAG_CANCELED,
+        send_op_id);
+    NA_TEST_CHECK_ERROR(ret != NA_SUCCESS, done, ret, ret,
+        "NA_Msg_send_unexpected() failed (%s)", NA_Error_to_string(ret));
+
+    ret = NA_Cancel(na_class, context, send_op_id);
+    NA_TEST_CHECK_ERROR(ret != NA_SUCCESS, done, ret, ret,
+        "NA_Cancel() failed (%s)", NA_Error_to_string(ret));
+
+    /* Send buffer may still be read, op must not complete before the ack */
+    NA_Trigger(context, 0, 1, NULL, &actual_count);
+    NA_TEST_CHECK_ERROR(send_info.completed, done, ret, NA_PROTOCOL_ERROR,
+        "Canceled send completed before receiver acked it");
+
+    ret = na_test_wait(na_class, context, &send_info.completed);
+    NA_TEST_CHECK_ERROR(ret != NA_SUCCESS, done, ret, ret,
+        "Canceled send did not complete (%s)", NA_Error_to_string(ret));
+    NA_TEST_CHECK_ERROR(send_info.ret != NA_CANCELED, done, ret,
+        NA_PROTOCOL_ERROR, "Send completed with %s instead of NA_CANCELED",
+        NA_Error_to_string(send_info.ret));
+
+    /* Receiver pulled the canceled msg and kept it */
+    ret = NA_Msg_recv_unexpected(na_class, context, na_test_op_cb, &recv_info,
+        recv_buf, buf_size, NULL, recv_op_id);
+    NA_TEST_CHECK_ERROR(ret != NA_SUCCESS, done, ret, ret,
+        "NA_Msg_recv_unexpected() failed (%s)", NA_Error_to_string(ret));
+    ret = na_test_wait(na_class, context, &recv_info.completed);
+    NA_TEST_CHECK_ERROR(ret != NA_SUCCESS || recv_info.ret != NA_SUCCESS, done,
+        ret, NA_PROTOCOL_ERROR, "Could not receive canceled msg");
+    NA_TEST_CHECK_ERROR(recv_info.tag != NA_TEST_TAG_CANCELED ||
+                            recv_info.actual_buf_size != buf_size,
+        done, ret, NA_PROTOCOL_ERROR, "Received msg does not match");
+    for (i = 0; i < buf_size; i++)
+        NA_TEST_CHECK_ERROR(recv_buf[i] != 'a', done, ret, NA_PROTOCOL_ERROR,
+            "Error detected in canceled msg at offset %zu", (size_t) i);
+
+    /* Send again, buffer of canceled msg must not be mixed up with it */
+    memset(send_buf, 'b', buf_size);
+    memset(recv_buf, 0, buf_size);
+    send_info.completed = 0;
+    recv_info.completed = 0;
+
+    ret = NA_Msg_recv_unexpected(na_class, context, na_test_op_cb, &recv_info,
+        recv_buf, buf_size, NULL, recv_op_id);
+    NA_TEST_CHECK_ERROR(ret != NA_SUCCESS, done, ret, ret,
+        "NA_Msg_recv_unexpected() failed (%s)", NA_Error_to_string(ret));
+
+    ret = NA_Msg_send_unexpected(na_class, context, na_test_op_cb, &send_info,
+        send_buf, buf_size, NULL, target_addr, 0, NA_TEST_TAG_RESENT,
+        send_op_id);
+    NA_TEST_CHECK_ERROR(ret != NA_SUCCESS, done, ret, ret,
+        "NA_Msg_send_unexpected() failed (%s)", NA_Error_to_string(ret));
+
+    ret = na_test_wait(na_class, context, &recv_info.completed);
+    NA_TEST_CHECK_ERROR(ret != NA_SUCCESS || recv_info.ret != NA_SUCCESS, done,
+        ret, NA_PROTOCOL_ERROR, "Could not receive msg sent again");
+    ret = na_test_wait(na_class, context, &send_info.completed);
+    NA_TEST_CHECK_ERROR(ret != NA_SUCCESS || send_info.ret != NA_SUCCESS, done,
+        ret, NA_PROTOCOL_ERROR, "Could not send msg again");
+    NA_TEST_CHECK_ERROR(recv_info.tag != NA_TEST_TAG_RESENT ||
+                            recv_info.actual_buf_size != buf_size,
+        done, ret, NA_PROTOCOL_ERROR, "Received msg does not match");
+    for (i = 0; i < buf_size; i++)
+        NA_TEST_CHECK_ERROR(recv_buf[i] != 'b', done, ret, NA_PROTOCOL_ERROR,
+            "Error detected in msg sent again at offset %zu", (size_t) i);
+
+done:
+    if (send_op_id)
+        NA_Op_destroy(na_class, send_op_id);
+    if (recv_op_id)
+        NA_Op_destroy(na_class, recv_op_id);
+    free(send_buf);
+    free(recv_buf);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(void)
+{
+    char addr_string[NA_TEST_MAX_ADDR_NAME];
+    na_size_t addr_string_len = NA_TEST_MAX_ADDR_NAME;
+    na_class_t *na_class = NULL;
+    na_context_t *context = NULL;
+    na_addr_t self_addr = NA_ADDR_NULL, target_addr = NA_ADDR_NULL;
+    const char *log_level = getenv("NA_TEST_LOG_LEVEL");
+    na_size_t buf_size;
+    na_return_t na_ret;
+    int ret = EXIT_SUCCESS;
+
+    /* Set log level */
+    if (!log_level)
+        log_level = "warning";
+    NA_TEST_LOG_MASK = hg_log_name_to_type(log_level);
+    NA_Set_log_level(log_level);
+
+    na_class = NA_Initialize("na+sm", NA_TRUE);
+    NA_TEST_CHECK_ERROR(na_class == NULL, done, ret, EXIT_FAILURE,
+        "Could not initialize NA");
+
+    context = NA_Context_create(na_class);
+    NA_TEST_CHECK_ERROR(context == NULL, done, ret, EXIT_FAILURE,
+        "Could not create context");
+
+    /* Look up our own address so that msgs go through the shared region */
+    na_ret = NA_Addr_self(na_class, &self_addr);
+    NA_TEST_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, EXIT_FAILURE,
+        "NA_Addr_self() failed (%s)", NA_Error_to_string(na_ret));
+    na_ret =
+        NA_Addr_to_string(na_class, addr_string, &addr_string_len, self_addr);
+    NA_TEST_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, EXIT_FAILURE,
+        "NA_Addr_to_string() failed (%s)", NA_Error_to_string(na_ret));
+    na_ret = NA_Addr_lookup(na_class, addr_string, &target_addr);
+    NA_TEST_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, EXIT_FAILURE,
+        "NA_Addr_lookup() failed (%s)", NA_Error_to_string(na_ret));
+
+    /* Msgs larger than a copy buffer (a page by default) are pulled by the
+     * receiver, which is not supported if cross-memory attach is not */
+    buf_size = NA_Msg_get_max_unexpected_size(na_class);
+    if (buf_size <= (na_size_t) sysconf(_SC_PAGESIZE)) {
+        printf("# Rendezvous is not supported, skipping\n");
+        goto done;
+    }
+
+    NA_TEST("cancel posted sm msg and send again");
+    na_ret = na_test_rdv_cancel(na_class, context, target_addr, buf_size);
+    NA_TEST_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, EXIT_FAILURE,
+        "cancel posted sm msg failed");
+    NA_PASSED();
+
+done:
+    if (ret != EXIT_SUCCESS)
+        NA_FAILED();
+
+    if (target_addr != NA_ADDR_NULL)
+        NA_Addr_free(na_class, target_addr);
+    if (self_addr != NA_ADDR_NULL)
+        NA_Addr_free(na_class, self_addr);
+    if (context)
+        NA_Context_destroy(na_class, context);
+    if (na_class)
+        NA_Finalize(na_class);
+
+    return ret;
+}
@@ -12,11 +12,21 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 /****************/
 /* Local Macros */
 /****************/
 
+/* Size of bulk registration cache */
+#define HG_TEST_BULK_REG_CACHE_SIZE (1 << 22)
+
+/* Max number of cached bulk descriptors */
+#define HG_TEST_BULK_DESC_CACHE_COUNT 2
+
+/* Max number of bulk op IDs per context */
+#define HG_TEST_BULK_OP_POOL_MAX 4
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -27,6 +37,22 @@ struct forward_cb_args {
     hg_return_t ret;
 };
 
+struct op_pool_cb_args {
+    hg_request_t *request;
+    unsigned int expected_count;
+    unsigned int completed_count;
+    hg_return_t ret;
+};
+
+struct pipeline_cb_args {
+    hg_request_t *request;
+    hg_size_t size;
+    hg_size_t chunk_size;
+    hg_size_t transferred_bytes;
+    unsigned int chunk_count;
+    hg_return_t ret;
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -34,6 +60,70 @@ struct forward_cb_args {
 static hg_return_t
 hg_test_bulk_forward_cb(const struct hg_cb_info *callback_info);
 
+static hg_return_t
+hg_test_bulk_read_forward_cb(const struct hg_cb_info *callback_info);
+
+static hg_return_t
+hg_test_bulk_eager_write(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr, hg_size_t size);
+
+static hg_return_t
+hg_test_bulk_read_respond(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr, hg_size_t size);
+
+static hg_return_t
+hg_test_bulk_checksum(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr, hg_size_t size);
+
+static hg_return_t
+hg_test_bulk_compress_reuse(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr, hg_size_t size);
+
+static hg_return_t
+hg_test_bulk_strided(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_size_t block_len, hg_uint32_t vector_count,
+    const struct hg_bulk_vector *vectors);
+
+static hg_return_t
+hg_test_bulk_view(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_uint32_t segment_count, hg_size_t segment_len, hg_size_t view_offset,
+    hg_size_t view_size, hg_size_t origin_offset);
+
+static hg_return_t
+hg_test_bulk_pool(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_size_t block_size, hg_uint32_t count);
+
+static hg_return_t
+hg_test_bulk_reg_cache(hg_class_t *hg_class);
+
+static hg_return_t
+hg_test_bulk_desc_cache(hg_class_t *hg_class, hg_context_t *context);
+
+static hg_return_t
+hg_test_bulk_coalesce(hg_class_t *hg_class, hg_uint32_t count);
+
+static hg_return_t
+hg_test_bulk_op_pool_cb(const struct hg_cb_info *callback_info);
+
+static hg_return_t
+hg_test_bulk_op_pool(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, unsigned int count);
+
+static hg_return_t
+hg_test_bulk_pipeline_chunk_cb(
+    const struct hg_cb_info *callback_info, hg_size_t offset, hg_size_t size);
+
+static hg_return_t
+hg_test_bulk_pipeline_cb(const struct hg_cb_info *callback_info);
+
+static hg_return_t
+hg_test_bulk_pipelined(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_size_t size, hg_size_t chunk_size,
+    unsigned int window);
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -41,6 +131,10 @@ hg_test_bulk_forward_cb(const struct hg_cb_info *callback_info);
 extern hg_id_t hg_test_bulk_write_id_g;
 extern hg_id_t hg_test_bulk_bind_write_id_g;
 extern hg_id_t hg_test_bulk_bind_forward_id_g;
+extern hg_id_t hg_test_bulk_batch_write_id_g;
+extern hg_id_t hg_test_bulk_read_respond_id_g;
+extern hg_id_t hg_test_bulk_checksum_id_g;
+extern hg_id_t hg_test_perf_bulk_read_id_g;
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
@@ -78,6 +172,19 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_read_forward_cb(const struct hg_cb_info *callback_info)
+{
+    struct forward_cb_args *args =
+        (struct forward_cb_args *) callback_info->arg;
+
+    args->ret = callback_info->ret;
+    hg_request_complete(args->request);
+
+    return HG_SUCCESS;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_bulk_bind_forward_cb(const struct hg_cb_info *callback_info)
@@ -288,6 +395,10 @@ done:
     hg_request_destroy(request);
 
     /* Free bulk data */
+    cleanup_ret = HG_Bulk_reg_cache_invalidate(hg_class, bulk_buf, bulk_size);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_reg_cache_invalidate() failed (%s)",
+        HG_Error_to_string(cleanup_ret));
     free(bulk_buf);
 
     return ret;
@@ -296,7 +407,7 @@ done:
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_bulk_seg(hg_class_t *hg_class, hg_context_t *context,
-    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_request_class_t *request_class, hg_addr_t target_addr, hg_id_t rpc_id,
     hg_size_t bulk_size, hg_size_t transfer_size, hg_size_t origin_offset,
     hg_size_t target_offset, hg_uint32_t origin_segment_count)
 {
@@ -337,7 +448,7 @@ hg_test_bulk_seg(hg_class_t *hg_class, hg_context_t *context,
 
     request = hg_request_create(request_class);
 
-    ret = HG_Create(context, target_addr, hg_test_bulk_write_id_g, &handle);
+    ret = HG_Create(context, target_addr, rpc_id, &handle);
     HG_TEST_CHECK_HG_ERROR(
         done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
 
@@ -359,8 +470,7 @@ hg_test_bulk_seg(hg_class_t *hg_class, hg_context_t *context,
         bulk_write_in_struct.target_offset);
 
     /* Forward call to remote addr and get a new request */
-    HG_TEST_LOG_DEBUG(
-        "Forwarding call with op id: %u...", hg_test_bulk_write_id_g);
+    HG_TEST_LOG_DEBUG("Forwarding call with op id: %u...", rpc_id);
     forward_cb_args.request = request;
     forward_cb_args.expected_bytes = transfer_size;
     forward_cb_args.ret = HG_SUCCESS;
@@ -388,8 +498,14 @@ done:
 
     /* Free bulk data */
     if (buf_ptrs) {
-        for (i = 0; i < origin_segment_count; i++)
+        for (i = 0; i < origin_segment_count; i++) {
+            cleanup_ret = HG_Bulk_reg_cache_invalidate(
+                hg_class, buf_ptrs[i], buf_sizes[i]);
+            HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+                "HG_Bulk_reg_cache_invalidate() failed (%s)",
+                HG_Error_to_string(cleanup_ret));
             free(buf_ptrs[i]);
+        }
         free(buf_ptrs);
     }
     free(buf_sizes);
@@ -473,141 +589,1562 @@ done:
 
     hg_request_destroy(request);
 
+    /* Data is on the stack */
+    cleanup_ret = HG_Bulk_reg_cache_invalidate(hg_class, data, bulk_size);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_reg_cache_invalidate() failed (%s)",
+        HG_Error_to_string(cleanup_ret));
+
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-int
-main(int argc, char *argv[])
+static hg_return_t
+hg_test_bulk_strided(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_size_t block_len, hg_uint32_t vector_count,
+    const struct hg_bulk_vector *vectors)
 {
-    struct hg_test_info hg_test_info = {0};
-    hg_size_t buf_size;
-    hg_return_t hg_ret;
-    int ret = EXIT_SUCCESS;
+    hg_request_t *request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    struct forward_cb_args forward_cb_args;
+    bulk_write_in_t bulk_write_in_struct;
+    hg_uint32_t indices[HG_BULK_VECTOR_MAX] = {0};
+    hg_uint32_t block_count = 1, i;
+    hg_size_t buf_size = block_len, transfer_size, n = 0;
+    char *buf = NULL;
+
+    for (i = 0; i < vector_count; i++) {
+        block_count *= vectors[i].count;
+        buf_size += (vectors[i].count - 1) * vectors[i].stride;
+    }
+    transfer_size = block_count * block_len;
 
-    /* Initialize the interface */
-    hg_ret = HG_Test_init(argc, argv, &hg_test_info);
+    /* Prepare bulk buf so that blocks read in order contain (char) i */
+    buf = calloc(1, buf_size);
     HG_TEST_CHECK_ERROR(
-        hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE, "HG_Test_init() failed");
-    buf_size = hg_test_info.buf_size_max;
+        buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buf");
+
+    for (i = 0; i < block_count; i++) {
+        char *block = buf;
+        hg_uint32_t j;
+        hg_size_t k;
+
+        for (j = 0; j < vector_count; j++)
+            block += indices[j] * vectors[j].stride;
+        for (k = 0; k < block_len; k++, n++)
+            block[k] = (char) n;
+
+        for (j = vector_count; j > 0; j--) {
+            if (++indices[j - 1] < vectors[j - 1].count)
+                break;
+            indices[j - 1] = 0;
+        }
+    }
 
-    /* Zero size RPC bulk test */
-    HG_TEST("null RPC bulk");
-    hg_ret = hg_test_bulk_null(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, hg_test_info.target_addr);
-    HG_TEST_CHECK_ERROR(
-        hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE, "null RPC bulk failed");
-    HG_PASSED();
+    /* Empty and overlapping blocks are rejected */
+    ret = HG_Bulk_create_strided(hg_class, buf, 0, vector_count, vectors,
+        HG_BULK_READ_ONLY, &bulk_handle);
+    HG_TEST_CHECK_ERROR(ret != HG_INVALID_ARG, done, ret, HG_FAULT,
+        "Empty blocks were not rejected (%s)", HG_Error_to_string(ret));
+    ret = HG_Bulk_create_strided(hg_class, buf, vectors[0].stride + 1,
+        vector_count, vectors, HG_BULK_READ_ONLY, &bulk_handle);
+    HG_TEST_CHECK_ERROR(ret != HG_INVALID_ARG, done, ret, HG_FAULT,
+        "Overlapping blocks were not rejected (%s)", HG_Error_to_string(ret));
 
-    /* Zero size RPC bulk test */
-    HG_TEST("zero size RPC bulk (size 0, offsets 0, 0)");
-    hg_ret = hg_test_bulk_contig(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, 0, 0, hg_test_info.target_addr, buf_size, 0,
-        0, 0);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "zero size RPC bulk failed");
-    HG_PASSED();
+    request = hg_request_create(request_class);
 
-    /* Simple RPC bulk test */
-    HG_TEST("contiguous RPC bulk (size BUFSIZE, offsets 0, 0)");
-    hg_ret = hg_test_bulk_contig(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, 0, 0, hg_test_info.target_addr, buf_size,
-        buf_size, 0, 0);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "contiguous RPC bulk failed");
-    HG_PASSED();
+    ret = HG_Create(context, target_addr, hg_test_bulk_write_id_g, &handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
 
-    HG_TEST("contiguous RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
-    hg_ret = hg_test_bulk_contig(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, 0, 0, hg_test_info.target_addr, buf_size,
-        buf_size / 4, buf_size / 2 + 1, 0);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "contiguous RPC bulk failed");
-    HG_PASSED();
+    /* Register memory */
+    ret = HG_Bulk_create_strided(hg_class, buf, block_len, vector_count,
+        vectors, HG_BULK_READ_ONLY, &bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_create_strided() failed (%s)",
+        HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(HG_Bulk_get_size(bulk_handle) != transfer_size, done,
+        ret, HG_FAULT, "Unexpected bulk size (%zu)",
+        HG_Bulk_get_size(bulk_handle));
 
-    HG_TEST("contiguous RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + 1, "
-            "BUFSIZE/4)");
-    hg_ret = hg_test_bulk_contig(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, 0, 0, hg_test_info.target_addr, buf_size,
-        buf_size / 8, buf_size / 2 + 1, buf_size / 4);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "contiguous RPC bulk failed");
-    HG_PASSED();
+    /* Fill input structure */
+    bulk_write_in_struct.fildes = 0;
+    bulk_write_in_struct.transfer_size = transfer_size;
+    bulk_write_in_struct.origin_offset = 0;
+    bulk_write_in_struct.target_offset = 0;
+    bulk_write_in_struct.bulk_handle = bulk_handle;
 
-    /* small bulk test */
-    HG_TEST("small segmented RPC bulk (size 8, offsets 0, 0)");
-    hg_ret = hg_test_bulk_small(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, hg_test_info.target_addr, 8, 0, 0);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "small segmented RPC bulk failed");
-    HG_PASSED();
+    /* Forward call to remote addr and get a new request */
+    forward_cb_args.request = request;
+    forward_cb_args.expected_bytes = transfer_size;
+    forward_cb_args.ret = HG_SUCCESS;
+    ret = HG_Forward(handle, hg_test_bulk_forward_cb, &forward_cb_args,
+        &bulk_write_in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
 
-    HG_TEST("small segmented RPC bulk (size 4, offsets 8, 0)");
-    hg_ret = hg_test_bulk_small(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, hg_test_info.target_addr, 4, 8, 0);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "small segmented RPC bulk failed");
-    HG_PASSED();
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
 
-    HG_TEST("small segmented RPC bulk (size 8, offsets 4, 2)");
-    hg_ret = hg_test_bulk_small(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, hg_test_info.target_addr, 8, 4, 2);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "small segmented RPC bulk failed");
-    HG_PASSED();
+    /* Assign ret from CB */
+    ret = forward_cb_args.ret;
 
-    HG_TEST("segmented RPC bulk (size BUFSIZE, offsets 0, 0)");
-    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, hg_test_info.target_addr, buf_size,
-        buf_size, 0, 0, 16);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "segmented RPC bulk failed");
-    HG_PASSED();
+done:
+    /* Free memory handle */
+    cleanup_ret = HG_Bulk_free(bulk_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
 
-    HG_TEST("segmented RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
-    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, hg_test_info.target_addr, buf_size,
-        buf_size / 4, buf_size / 2 + 1, 0, 16);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "segmented RPC bulk failed");
-    HG_PASSED();
+    cleanup_ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Destroy() failed (%s)", HG_Error_to_string(cleanup_ret));
 
-    HG_TEST("segmented RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + 1, "
-            "BUFSIZE/4)");
-    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, hg_test_info.target_addr, buf_size,
-        buf_size / 8, buf_size / 2 + 1, buf_size / 4, 16);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "segmented RPC bulk failed");
-    HG_PASSED();
+    hg_request_destroy(request);
 
-#ifndef HG_HAS_XDR
-    HG_TEST("over-segmented RPC bulk (size BUFSIZE, offsets 0, 0)");
-    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, hg_test_info.target_addr, buf_size,
-        buf_size, 0, 0, 1024);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "over-segmented RPC bulk failed");
-    HG_PASSED();
+    /* Free bulk data */
+    cleanup_ret = HG_Bulk_reg_cache_invalidate(hg_class, buf, buf_size);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_reg_cache_invalidate() failed (%s)",
+        HG_Error_to_string(cleanup_ret));
+    free(buf);
 
-    HG_TEST(
-        "over-segmented RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
-    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, hg_test_info.target_addr, buf_size,
-        buf_size / 4, buf_size / 2 + 1, 0, 1024);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "over-segmented RPC bulk failed");
-    HG_PASSED();
+    return ret;
+}
 
-    HG_TEST("over-segmented RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + 1, "
-            "BUFSIZE/4)");
-    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
-        hg_test_info.request_class, hg_test_info.target_addr, buf_size,
-        buf_size / 8, buf_size / 2 + 1, buf_size / 4, 1024);
-    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
-        "over-segmented RPC bulk failed");
-    HG_PASSED();
-#endif
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_view(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_uint32_t segment_count, hg_size_t segment_len, hg_size_t view_offset,
+    hg_size_t view_size, hg_size_t origin_offset)
+{
+    hg_request_t *request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_bulk_t bulk_handle = HG_BULK_NULL, outer_view = HG_BULK_NULL,
+              view = HG_BULK_NULL;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    struct forward_cb_args forward_cb_args;
+    bulk_write_in_t bulk_write_in_struct;
+    hg_size_t segment_stride = segment_len + 64, buf_size, j;
+    void **buf_ptrs = NULL;
+    hg_size_t *buf_sizes = NULL;
+    char *buf = NULL, *view_buf;
+    hg_uint32_t i;
+
+    /* Segments are not contiguous so that they are registered separately */
+    buf_size = segment_count * segment_stride;
+    buf = (char *) malloc(buf_size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buf");
+    buf_ptrs = (void **) malloc(segment_count * sizeof(void *));
+    HG_TEST_CHECK_ERROR(buf_ptrs == NULL, done, ret, HG_NOMEM_ERROR,
+        "Could not allocate buf_ptrs");
+    buf_sizes = (hg_size_t *) malloc(segment_count * sizeof(hg_size_t));
+    HG_TEST_CHECK_ERROR(buf_sizes == NULL, done, ret, HG_NOMEM_ERROR,
+        "Could not allocate buf_sizes");
+
+    for (i = 0; i < segment_count; i++) {
+        buf_ptrs[i] = buf + i * segment_stride;
+        buf_sizes[i] = segment_len;
+        for (j = 0; j < segment_len; j++)
+            ((char *) buf_ptrs[i])[j] = (char) (i * segment_len + j);
+    }
+
+    ret = HG_Bulk_create(hg_class, segment_count, buf_ptrs, buf_sizes,
+        HG_BULK_READ_ONLY, &bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+    /* Create view of view, parent handle is no longer needed */
+    ret = HG_Bulk_create_view(
+        bulk_handle, 1, segment_count * segment_len - 2, &outer_view);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_create_view() failed (%s)",
+        HG_Error_to_string(ret));
+    ret = HG_Bulk_create_view(outer_view, view_offset - 1, view_size, &view);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_create_view() failed (%s)",
+        HG_Error_to_string(ret));
+    ret = HG_Bulk_free(bulk_handle);
+    bulk_handle = HG_BULK_NULL;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_free() failed (%s)", HG_Error_to_string(ret));
+    ret = HG_Bulk_free(outer_view);
+    outer_view = HG_BULK_NULL;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_free() failed (%s)", HG_Error_to_string(ret));
+
+    HG_TEST_CHECK_ERROR(HG_Bulk_get_size(view) != view_size, done, ret,
+        HG_FAULT, "Unexpected view size (%zu)", HG_Bulk_get_size(view));
+    ret = HG_Bulk_access(view, 0, 1, HG_BULK_READ_ONLY, 1, (void **) &view_buf,
+        NULL, NULL);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_access() failed (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(view_buf[0] != (char) view_offset, done, ret, HG_FAULT,
+        "Unexpected view data (%d)", view_buf[0]);
+
+    request = hg_request_create(request_class);
+
+    ret = HG_Create(context, target_addr, hg_test_bulk_write_id_g, &handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
+
+    /* Fill input structure (data of view starts at (char) 0) */
+    bulk_write_in_struct.fildes = 0;
+    bulk_write_in_struct.transfer_size = view_size - origin_offset;
+    bulk_write_in_struct.origin_offset = origin_offset;
+    bulk_write_in_struct.target_offset = 0;
+    bulk_write_in_struct.bulk_handle = view;
+
+    /* Forward call to remote addr and get a new request */
+    forward_cb_args.request = request;
+    forward_cb_args.expected_bytes = view_size - origin_offset;
+    forward_cb_args.ret = HG_SUCCESS;
+    ret = HG_Forward(handle, hg_test_bulk_forward_cb, &forward_cb_args,
+        &bulk_write_in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
+
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    /* Assign ret from CB */
+    ret = forward_cb_args.ret;
+
+done:
+    cleanup_ret = HG_Bulk_free(view);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+    cleanup_ret = HG_Bulk_free(outer_view);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+    cleanup_ret = HG_Bulk_free(bulk_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    cleanup_ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Destroy() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    hg_request_destroy(request);
+
+    /* Free bulk data */
+    if (buf) {
+        cleanup_ret = HG_Bulk_reg_cache_invalidate(hg_class, buf, buf_size);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_reg_cache_invalidate() failed (%s)",
+            HG_Error_to_string(cleanup_ret));
+    }
+    free(buf);
+    free(buf_ptrs);
+    free(buf_sizes);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_pool(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr,
+    hg_size_t block_size, hg_uint32_t count)
+{
+    hg_request_t *request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_bulk_pool_t pool = HG_BULK_POOL_NULL;
+    hg_bulk_t *bulk_handles = NULL, bulk_handle = HG_BULK_NULL;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    struct forward_cb_args forward_cb_args;
+    bulk_write_in_t bulk_write_in_struct;
+    hg_uint32_t i, n = 0;
+    hg_size_t j;
+    char *buf;
+
+    bulk_handles = (hg_bulk_t *) calloc(count, sizeof(hg_bulk_t));
+    HG_TEST_CHECK_ERROR(bulk_handles == NULL, done, ret, HG_NOMEM_ERROR,
+        "Could not allocate handles");
+
+    ret = HG_Bulk_pool_create(
+        hg_class, block_size, count, HG_BULK_READWRITE, &pool);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_pool_create() failed (%s)",
+        HG_Error_to_string(ret));
+
+    /* Drain pool */
+    for (n = 0; n < count; n++) {
+        ret = HG_Bulk_pool_get(pool, &bulk_handles[n]);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_pool_get() failed (%s)",
+            HG_Error_to_string(ret));
+        HG_TEST_CHECK_ERROR(HG_Bulk_get_size(bulk_handles[n]) != block_size,
+            done, ret, HG_FAULT, "Unexpected bulk size (%zu)",
+            HG_Bulk_get_size(bulk_handles[n]));
+    }
+    ret = HG_Bulk_pool_get(pool, &bulk_handle);
+    HG_TEST_CHECK_ERROR(ret != HG_AGAIN, done, ret, HG_FAULT,
+        "HG_Bulk_pool_get() did not return HG_AGAIN (%s)",
+        HG_Error_to_string(ret));
+    ret = HG_SUCCESS;
+
+    /* Returning a handle twice is rejected even if the pool is not full */
+    ret = HG_Bulk_pool_put(pool, bulk_handles[0]);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_pool_put() failed (%s)",
+        HG_Error_to_string(ret));
+    ret = HG_Bulk_pool_put(pool, bulk_handles[0]);
+    HG_TEST_CHECK_ERROR(ret != HG_INVALID_ARG, done, ret, HG_FAULT,
+        "Handle was returned twice (%s)", HG_Error_to_string(ret));
+    ret = HG_Bulk_pool_get(pool, &bulk_handles[0]);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_pool_get() failed (%s)",
+        HG_Error_to_string(ret));
+
+    /* Use last buffer so that data is not at the start of the registration */
+    bulk_handle = bulk_handles[count - 1];
+    ret = HG_Bulk_access(bulk_handle, 0, block_size, HG_BULK_READWRITE, 1,
+        (void **) &buf, NULL, NULL);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_access() failed (%s)", HG_Error_to_string(ret));
+    for (j = 0; j < block_size; j++)
+        buf[j] = (char) j;
+
+    request = hg_request_create(request_class);
+
+    ret = HG_Create(context, target_addr, hg_test_bulk_write_id_g, &handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
+
+    /* Fill input structure */
+    bulk_write_in_struct.fildes = 0;
+    bulk_write_in_struct.transfer_size = block_size;
+    bulk_write_in_struct.origin_offset = 0;
+    bulk_write_in_struct.target_offset = 0;
+    bulk_write_in_struct.bulk_handle = bulk_handle;
+
+    /* Forward call to remote addr and get a new request */
+    forward_cb_args.request = request;
+    forward_cb_args.expected_bytes = block_size;
+    forward_cb_args.ret = HG_SUCCESS;
+    ret = HG_Forward(handle, hg_test_bulk_forward_cb, &forward_cb_args,
+        &bulk_write_in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
+
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    /* Assign ret from CB */
+    ret = forward_cb_args.ret;
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Error in forward callback (%s)",
+        HG_Error_to_string(ret));
+
+done:
+    cleanup_ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Destroy() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    hg_request_destroy(request);
+
+    /* Return handles to pool */
+    for (i = 0; i < n; i++) {
+        cleanup_ret = HG_Bulk_pool_put(pool, bulk_handles[i]);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_pool_put() failed (%s)", HG_Error_to_string(cleanup_ret));
+    }
+
+    cleanup_ret = HG_Bulk_pool_destroy(pool);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_pool_destroy() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    free(bulk_handles);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_reg_cache(hg_class_t *hg_class)
+{
+    struct hg_bulk_reg_cache_stats stats0, stats;
+    hg_bulk_t bulk_handles[3] = {HG_BULK_NULL, HG_BULK_NULL, HG_BULK_NULL};
+    void *bufs[3] = {NULL, NULL, NULL};
+    hg_size_t buf_size = HG_TEST_BULK_REG_CACHE_SIZE / 2;
+    hg_size_t half_size = buf_size / 2;
+    hg_uint64_t n; /* Number of caches used per registration */
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    unsigned int i;
+
+    for (i = 0; i < 3; i++) {
+        bufs[i] = malloc(buf_size);
+        HG_TEST_CHECK_ERROR(bufs[i] == NULL, done, ret, HG_NOMEM_ERROR,
+            "Could not allocate buffer");
+    }
+
+    ret = HG_Bulk_reg_cache_get_stats(hg_class, &stats0);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_reg_cache_get_stats() failed (%s)", HG_Error_to_string(ret));
+
+    /* First registration is a miss and stays cached once freed */
+    ret = HG_Bulk_create(hg_class, 1, &bufs[0], &buf_size, HG_BULK_READ_ONLY,
+        &bulk_handles[0]);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    ret = HG_Bulk_free(bulk_handles[0]);
+    bulk_handles[0] = HG_BULK_NULL;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_free() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_reg_cache_get_stats(hg_class, &stats);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_reg_cache_get_stats() failed (%s)", HG_Error_to_string(ret));
+    n = stats.misses - stats0.misses;
+    HG_TEST_CHECK_ERROR(n == 0 || stats.hits != stats0.hits ||
+                            stats.count != stats0.count + n,
+        done, ret, HG_FAULT, "Registration was not cached");
+
+    /* Same range with same permissions is a hit, a sub-range or other
+     * permissions are misses */
+    ret = HG_Bulk_create(hg_class, 1, &bufs[0], &buf_size, HG_BULK_READ_ONLY,
+        &bulk_handles[0]);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    ret = HG_Bulk_create(hg_class, 1, &bufs[0], &half_size, HG_BULK_READ_ONLY,
+        &bulk_handles[1]);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    ret = HG_Bulk_create(hg_class, 1, &bufs[0], &buf_size, HG_BULK_READWRITE,
+        &bulk_handles[2]);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_reg_cache_get_stats(hg_class, &stats);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_reg_cache_get_stats() failed (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(stats.hits != stats0.hits + n ||
+                            stats.misses != stats0.misses + 3 * n,
+        done, ret, HG_FAULT, "Unexpected number of cache hits or misses");
+
+    /* Invalidating memory in use defers release until handles are freed */
+    ret = HG_Bulk_reg_cache_invalidate(hg_class, bufs[0], buf_size);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_reg_cache_invalidate() failed (%s)", HG_Error_to_string(ret));
+    for (i = 0; i < 3; i++) {
+        ret = HG_Bulk_free(bulk_handles[i]);
+        bulk_handles[i] = HG_BULK_NULL;
+        HG_TEST_CHECK_HG_ERROR(
+            done, ret, "HG_Bulk_free() failed (%s)", HG_Error_to_string(ret));
+    }
+
+    ret = HG_Bulk_reg_cache_get_stats(hg_class, &stats);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_reg_cache_get_stats() failed (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(stats.invalidations != stats0.invalidations + 3 * n ||
+                            stats.count != stats0.count,
+        done, ret, HG_FAULT, "Registrations were not invalidated");
+
+    /* Exceeding the size of the cache evicts least recently used entries */
+    for (i = 0; i < 3; i++) {
+        ret = HG_Bulk_create(hg_class, 1, &bufs[i], &buf_size,
+            HG_BULK_READ_ONLY, &bulk_handles[i]);
+        HG_TEST_CHECK_HG_ERROR(
+            done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+        ret = HG_Bulk_free(bulk_handles[i]);
+        bulk_handles[i] = HG_BULK_NULL;
+        HG_TEST_CHECK_HG_ERROR(
+            done, ret, "HG_Bulk_free() failed (%s)", HG_Error_to_string(ret));
+    }
+
+    ret = HG_Bulk_reg_cache_get_stats(hg_class, &stats);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_reg_cache_get_stats() failed (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(stats.size > HG_TEST_BULK_REG_CACHE_SIZE * n, done,
+        ret, HG_FAULT, "Cache exceeds its size limit (%zu)", stats.size);
+    HG_TEST_CHECK_ERROR(stats.evictions < stats0.evictions + n, done, ret,
+        HG_FAULT, "Least recently used registration was not evicted");
+
+done:
+    for (i = 0; i < 3; i++) {
+        cleanup_ret = HG_Bulk_free(bulk_handles[i]);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+        cleanup_ret = HG_Bulk_reg_cache_invalidate(hg_class, bufs[i], buf_size);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_reg_cache_invalidate() failed (%s)",
+            HG_Error_to_string(cleanup_ret));
+        free(bufs[i]);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_desc_cache(hg_class_t *hg_class, hg_context_t *context)
+{
+    struct hg_bulk_desc_cache_stats stats0, stats;
+    hg_bulk_t bulk_handles[3] = {HG_BULK_NULL, HG_BULK_NULL, HG_BULK_NULL};
+    hg_bulk_t remote_handles[3] = {HG_BULK_NULL, HG_BULK_NULL, HG_BULK_NULL};
+    hg_bulk_t remote_handle = HG_BULK_NULL;
+    char bufs[3][64];
+    void *descs[3] = {NULL, NULL, NULL};
+    hg_size_t buf_size = sizeof(bufs[0]), desc_sizes[3];
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    unsigned int i;
+
+    /* Serialize descriptors of distinct buffers */
+    for (i = 0; i < 3; i++) {
+        void *buf_ptr = bufs[i];
+
+        ret = HG_Bulk_create(hg_class, 1, &buf_ptr, &buf_size,
+            HG_BULK_READ_ONLY, &bulk_handles[i]);
+        HG_TEST_CHECK_HG_ERROR(
+            done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+        desc_sizes[i] = HG_Bulk_get_serialize_size(bulk_handles[i], 0);
+        descs[i] = malloc(desc_sizes[i]);
+        HG_TEST_CHECK_ERROR(descs[i] == NULL, done, ret, HG_NOMEM_ERROR,
+            "Could not allocate descriptor");
+
+        ret = HG_Bulk_serialize(descs[i], desc_sizes[i], 0, bulk_handles[i]);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_serialize() failed (%s)",
+            HG_Error_to_string(ret));
+    }
+
+    ret = HG_Bulk_desc_cache_get_stats(hg_class, &stats0);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_desc_cache_get_stats() failed (%s)", HG_Error_to_string(ret));
+
+    /* Same descriptor resolves to the same handle, also once freed */
+    ret = HG_Bulk_deserialize(
+        hg_class, &remote_handles[0], descs[0], desc_sizes[0]);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_deserialize() failed (%s)",
+        HG_Error_to_string(ret));
+    ret =
+        HG_Bulk_deserialize(hg_class, &remote_handle, descs[0], desc_sizes[0]);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_deserialize() failed (%s)",
+        HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(remote_handle != remote_handles[0], done, ret,
+        HG_FAULT, "Descriptor was not resolved to cached handle");
+    ret = HG_Bulk_free(remote_handle);
+    remote_handle = HG_BULK_NULL;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_free() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_desc_cache_get_stats(hg_class, &stats);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_desc_cache_get_stats() failed (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(stats.hits != stats0.hits + 1 ||
+                            stats.misses != stats0.misses + 1,
+        done, ret, HG_FAULT, "Unexpected number of cache hits or misses");
+
+    /* Exceeding the number of entries evicts least recently used entries,
+     * handles still in use remain valid */
+    for (i = 1; i < 3; i++) {
+        ret = HG_Bulk_deserialize(
+            hg_class, &remote_handles[i], descs[i], desc_sizes[i]);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_deserialize() failed (%s)",
+            HG_Error_to_string(ret));
+    }
+
+    ret = HG_Bulk_desc_cache_get_stats(hg_class, &stats);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_desc_cache_get_stats() failed (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(stats.count > HG_TEST_BULK_DESC_CACHE_COUNT, done, ret,
+        HG_FAULT, "Cache exceeds its count limit (%u)", stats.count);
+    HG_TEST_CHECK_ERROR(stats.evictions < stats0.evictions + 1, done, ret,
+        HG_FAULT, "Least recently used descriptor was not evicted");
+    HG_TEST_CHECK_ERROR(HG_Bulk_get_size(remote_handles[0]) != buf_size, done,
+        ret, HG_FAULT, "Evicted handle is no longer valid");
+
+    /* Shared handles cannot be bound, once no longer shared they are removed
+     * from the cache */
+    ret =
+        HG_Bulk_deserialize(hg_class, &remote_handle, descs[2], desc_sizes[2]);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_deserialize() failed (%s)",
+        HG_Error_to_string(ret));
+    ret = HG_Bulk_bind(remote_handles[2], context);
+    HG_TEST_CHECK_ERROR(ret != HG_PERMISSION, done, ret, HG_FAULT,
+        "Shared handle was bound (%s)", HG_Error_to_string(ret));
+    ret = HG_Bulk_free(remote_handle);
+    remote_handle = HG_BULK_NULL;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_free() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_bind(remote_handles[2], context);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_bind() failed (%s)", HG_Error_to_string(ret));
+    ret =
+        HG_Bulk_deserialize(hg_class, &remote_handle, descs[2], desc_sizes[2]);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_deserialize() failed (%s)",
+        HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(remote_handle == remote_handles[2], done, ret,
+        HG_FAULT, "Bound handle is still cached");
+
+done:
+    cleanup_ret = HG_Bulk_free(remote_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    for (i = 0; i < 3; i++) {
+        cleanup_ret = HG_Bulk_free(remote_handles[i]);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+        cleanup_ret = HG_Bulk_free(bulk_handles[i]);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+        cleanup_ret =
+            HG_Bulk_reg_cache_invalidate(hg_class, bufs[i], sizeof(bufs[i]));
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_reg_cache_invalidate() failed (%s)",
+            HG_Error_to_string(cleanup_ret));
+        free(descs[i]);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_coalesce(hg_class_t *hg_class, hg_uint32_t count)
+{
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    void **buf_ptrs = NULL;
+    hg_size_t *buf_sizes = NULL;
+    char *buf = NULL;
+    hg_size_t seg_size = 64;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    hg_uint32_t i;
+
+    buf = malloc(2 * count * seg_size);
+    buf_ptrs = (void **) malloc(2 * count * sizeof(void *));
+    buf_sizes = (hg_size_t *) malloc(2 * count * sizeof(hg_size_t));
+    HG_TEST_CHECK_ERROR(buf == NULL || buf_ptrs == NULL || buf_sizes == NULL,
+        done, ret, HG_NOMEM_ERROR, "Could not allocate buffers");
+
+    /* Adjacent segments interleaved with empty segments make a single one */
+    for (i = 0; i < 2 * count; i++) {
+        buf_ptrs[i] = buf + (i / 2) * seg_size;
+        buf_sizes[i] = (i % 2) ? 0 : seg_size;
+    }
+    ret = HG_Bulk_create(hg_class, 2 * count, buf_ptrs, buf_sizes,
+        HG_BULK_READ_ONLY, &bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(HG_Bulk_get_segment_count(bulk_handle) != 1 ||
+                            HG_Bulk_get_size(bulk_handle) != count * seg_size,
+        done, ret, HG_FAULT, "Segments were not coalesced (%u segments)",
+        HG_Bulk_get_segment_count(bulk_handle));
+    ret = HG_Bulk_free(bulk_handle);
+    bulk_handle = HG_BULK_NULL;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_free() failed (%s)", HG_Error_to_string(ret));
+
+    /* Segments separated by gaps are kept and looked up by offset */
+    for (i = 0; i < count; i++) {
+        buf_ptrs[i] = buf + 2 * i * seg_size;
+        buf_sizes[i] = seg_size;
+    }
+    ret = HG_Bulk_create(hg_class, count, buf_ptrs, buf_sizes,
+        HG_BULK_READ_ONLY, &bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(HG_Bulk_get_segment_count(bulk_handle) != count, done,
+        ret, HG_FAULT, "Unexpected number of segments (%u)",
+        HG_Bulk_get_segment_count(bulk_handle));
+
+    for (i = 0; i < count * seg_size; i += seg_size / 2 + 1) {
+        void *ptr = NULL;
+        hg_uint32_t actual_count = 0;
+
+        ret = HG_Bulk_access(bulk_handle, i, 1, HG_BULK_READ_ONLY, 1, &ptr,
+            NULL, &actual_count);
+        HG_TEST_CHECK_HG_ERROR(
+            done, ret, "HG_Bulk_access() failed (%s)", HG_Error_to_string(ret));
+        HG_TEST_CHECK_ERROR(actual_count != 1 ||
+                                ptr != buf + 2 * (i / seg_size) * seg_size +
+                                           i % seg_size,
+            done, ret, HG_FAULT, "Wrong address for offset %u", i);
+    }
+
+done:
+    cleanup_ret = HG_Bulk_free(bulk_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    if (buf) {
+        cleanup_ret =
+            HG_Bulk_reg_cache_invalidate(hg_class, buf, 2 * count * seg_size);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_reg_cache_invalidate() failed (%s)",
+            HG_Error_to_string(cleanup_ret));
+    }
+    free(buf);
+    free(buf_ptrs);
+    free(buf_sizes);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_op_pool_cb(const struct hg_cb_info *callback_info)
+{
+    struct op_pool_cb_args *args =
+        (struct op_pool_cb_args *) callback_info->arg;
+
+    if (args->ret == HG_SUCCESS)
+        args->ret = callback_info->ret;
+    if (++args->completed_count == args->expected_count)
+        hg_request_complete(args->request);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_op_pool(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, unsigned int count)
+{
+    hg_request_t *request = NULL;
+    hg_addr_t self_addr = HG_ADDR_NULL;
+    hg_bulk_t bulk_handles[2] = {HG_BULK_NULL, HG_BULK_NULL};
+    char bufs[2][64];
+    hg_size_t size = sizeof(bufs[0]);
+    struct op_pool_cb_args op_pool_cb_args;
+    struct hg_bulk_op_pool_stats stats0, stats;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    unsigned int i;
+
+    for (i = 0; i < 2; i++) {
+        void *buf_ptr = bufs[i];
+
+        memset(bufs[i], (int) i, size);
+        ret = HG_Bulk_create(hg_class, 1, &buf_ptr, &size, HG_BULK_READWRITE,
+            &bulk_handles[i]);
+        HG_TEST_CHECK_HG_ERROR(
+            done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    }
+
+    ret = HG_Addr_self(hg_class, &self_addr);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Addr_self() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_op_pool_get_stats(context, &stats0);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_op_pool_get_stats() failed (%s)",
+        HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(stats0.count > HG_TEST_BULK_OP_POOL_MAX ||
+                            stats0.free_count > stats0.count,
+        done, ret, HG_FAULT, "Unexpected pool size (%u, %u free)",
+        stats0.count, stats0.free_count);
+
+    request = hg_request_create(request_class);
+
+    op_pool_cb_args.request = request;
+    op_pool_cb_args.expected_count = count;
+    op_pool_cb_args.completed_count = 0;
+    op_pool_cb_args.ret = HG_SUCCESS;
+
+    /* Op IDs are held until callbacks are triggered */
+    for (i = 0; i < count; i++) {
+        ret = HG_Bulk_transfer(context, hg_test_bulk_op_pool_cb,
+            &op_pool_cb_args, HG_BULK_PULL, self_addr, bulk_handles[0], 0,
+            bulk_handles[1], 0, size, HG_OP_ID_IGNORE);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_transfer() failed (%s)",
+            HG_Error_to_string(ret));
+    }
+
+    /* Op IDs past the max size of the pool are not kept */
+    ret = HG_Bulk_op_pool_get_stats(context, &stats);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_op_pool_get_stats() failed (%s)",
+        HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(stats.count < count || stats.free_count != 0 ||
+                            stats.size == 0,
+        done, ret, HG_FAULT, "Unexpected pool size (%u, %u free)", stats.count,
+        stats.free_count);
+
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    ret = op_pool_cb_args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "Error in bulk transfer (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(memcmp(bufs[0], bufs[1], size) != 0, done, ret,
+        HG_FAULT, "Error detected in bulk transfer");
+
+    ret = HG_Bulk_op_pool_get_stats(context, &stats);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "HG_Bulk_op_pool_get_stats() failed (%s)",
+        HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(stats.count != HG_TEST_BULK_OP_POOL_MAX ||
+                            stats.free_count != stats.count,
+        done, ret, HG_FAULT, "Unexpected pool size (%u, %u free)", stats.count,
+        stats.free_count);
+
+done:
+    for (i = 0; i < 2; i++) {
+        cleanup_ret = HG_Bulk_free(bulk_handles[i]);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+        cleanup_ret = HG_Bulk_reg_cache_invalidate(hg_class, bufs[i], size);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_reg_cache_invalidate() failed (%s)",
+            HG_Error_to_string(cleanup_ret));
+    }
+
+    cleanup_ret = HG_Addr_free(hg_class, self_addr);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Addr_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    if (request)
+        hg_request_destroy(request);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_pipeline_chunk_cb(
+    const struct hg_cb_info *callback_info, hg_size_t offset, hg_size_t size)
+{
+    struct pipeline_cb_args *args =
+        (struct pipeline_cb_args *) callback_info->arg;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_TEST_CHECK_ERROR(offset % args->chunk_size != 0 ||
+                            size > args->chunk_size ||
+                            offset + size > args->size,
+        done, args->ret, HG_FAULT,
+        "Unexpected chunk (offset %zu, size %zu)", offset, size);
+
+    args->transferred_bytes += size;
+    args->chunk_count++;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_pipeline_cb(const struct hg_cb_info *callback_info)
+{
+    struct pipeline_cb_args *args =
+        (struct pipeline_cb_args *) callback_info->arg;
+
+    if (args->ret == HG_SUCCESS)
+        args->ret = callback_info->ret;
+    hg_request_complete(args->request);
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_pipelined(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_size_t size, hg_size_t chunk_size,
+    unsigned int window)
+{
+    hg_request_t *request = NULL;
+    hg_addr_t self_addr = HG_ADDR_NULL;
+    hg_bulk_t bulk_handles[2] = {HG_BULK_NULL, HG_BULK_NULL};
+    char *bufs[2] = {NULL, NULL};
+    struct pipeline_cb_args pipeline_cb_args;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    hg_size_t i;
+
+    for (i = 0; i < 2; i++) {
+        bufs[i] = malloc(size);
+        HG_TEST_CHECK_ERROR(bufs[i] == NULL, done, ret, HG_NOMEM_ERROR,
+            "Could not allocate buffer");
+        memset(bufs[i], 0, size);
+
+        ret = HG_Bulk_create(hg_class, 1, (void **) &bufs[i], &size,
+            HG_BULK_READWRITE, &bulk_handles[i]);
+        HG_TEST_CHECK_HG_ERROR(
+            done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+    }
+    for (i = 0; i < size; i++)
+        bufs[0][i] = (char) i;
+
+    ret = HG_Addr_self(hg_class, &self_addr);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Addr_self() failed (%s)", HG_Error_to_string(ret));
+
+    request = hg_request_create(request_class);
+
+    pipeline_cb_args.request = request;
+    pipeline_cb_args.size = size;
+    pipeline_cb_args.chunk_size = chunk_size;
+    pipeline_cb_args.transferred_bytes = 0;
+    pipeline_cb_args.chunk_count = 0;
+    pipeline_cb_args.ret = HG_SUCCESS;
+
+    /* Pull data from first buffer into second buffer */
+    ret = HG_Bulk_transfer_pipelined(context, hg_test_bulk_pipeline_cb,
+        hg_test_bulk_pipeline_chunk_cb, &pipeline_cb_args, HG_BULK_PULL,
+        self_addr, 0, bulk_handles[0], 0, bulk_handles[1], 0, size, chunk_size,
+        window, HG_OP_ID_IGNORE);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Bulk_transfer_pipelined() failed (%s)", HG_Error_to_string(ret));
+
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    ret = pipeline_cb_args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "Error in pipelined transfer (%s)", HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(
+        pipeline_cb_args.chunk_count != (size + chunk_size - 1) / chunk_size ||
+            pipeline_cb_args.transferred_bytes != size,
+        done, ret, HG_FAULT, "Transferred %zu bytes in %u chunk(s)",
+        pipeline_cb_args.transferred_bytes, pipeline_cb_args.chunk_count);
+    HG_TEST_CHECK_ERROR(memcmp(bufs[0], bufs[1], size) != 0, done, ret,
+        HG_FAULT, "Error detected in pipelined transfer");
+
+done:
+    for (i = 0; i < 2; i++) {
+        cleanup_ret = HG_Bulk_free(bulk_handles[i]);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+        cleanup_ret = HG_Bulk_reg_cache_invalidate(hg_class, bufs[i], size);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_reg_cache_invalidate() failed (%s)",
+            HG_Error_to_string(cleanup_ret));
+        free(bufs[i]);
+    }
+
+    cleanup_ret = HG_Addr_free(hg_class, self_addr);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Addr_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    if (request)
+        hg_request_destroy(request);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_eager_write(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr, hg_size_t size)
+{
+    hg_request_t *request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    struct hg_bulk_eager_stats stats_before, stats_after;
+    struct forward_cb_args forward_cb_args;
+    bulk_write_in_t in_struct;
+    char *buf = NULL;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    hg_size_t i;
+
+    buf = malloc(size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buffer");
+    memset(buf, 0, size);
+
+    ret = HG_Class_get_bulk_eager_stats(hg_class, &stats_before);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Class_get_bulk_eager_stats() failed (%s)",
+        HG_Error_to_string(ret));
+
+    request = hg_request_create(request_class);
+
+    ret = HG_Create(context, target_addr, hg_test_perf_bulk_read_id_g, &handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
+
+    /* Target pushes into a small write-only buffer */
+    ret = HG_Bulk_create(
+        hg_class, 1, (void **) &buf, &size, HG_BULK_WRITE_ONLY, &bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+    in_struct.fildes = 0;
+    in_struct.transfer_size = size;
+    in_struct.origin_offset = 0;
+    in_struct.target_offset = 0;
+    in_struct.bulk_handle = bulk_handle;
+
+    forward_cb_args.request = request;
+    forward_cb_args.expected_bytes = size;
+    forward_cb_args.ret = HG_SUCCESS;
+    ret = HG_Forward(
+        handle, hg_test_bulk_read_forward_cb, &forward_cb_args, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
+
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    ret = forward_cb_args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "Error in HG callback (%s)", HG_Error_to_string(ret));
+
+    for (i = 0; i < size; i++)
+        HG_TEST_CHECK_ERROR(buf[i] != (char) i, done, ret, HG_FAULT,
+            "Error detected in returned data at offset %zu", i);
+
+    /* Either inlined or transferred, but accounted for once */
+    ret = HG_Class_get_bulk_eager_stats(hg_class, &stats_after);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Class_get_bulk_eager_stats() failed (%s)",
+        HG_Error_to_string(ret));
+    HG_TEST_CHECK_ERROR(stats_after.inlined + stats_after.rma !=
+                            stats_before.inlined + stats_before.rma + 1,
+        done, ret, HG_FAULT, "Bulk handle not accounted for");
+
+done:
+    cleanup_ret = HG_Bulk_free(bulk_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    cleanup_ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Destroy() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    if (request)
+        hg_request_destroy(request);
+
+    if (buf) {
+        cleanup_ret = HG_Bulk_reg_cache_invalidate(hg_class, buf, size);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_reg_cache_invalidate() failed (%s)",
+            HG_Error_to_string(cleanup_ret));
+        free(buf);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_read_respond(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr, hg_size_t size)
+{
+    hg_request_t *request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    struct forward_cb_args forward_cb_args;
+    bulk_write_in_t in_struct;
+    char *buf = NULL;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    hg_size_t i;
+
+    buf = malloc(size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buffer");
+    memset(buf, 0, size);
+
+    request = hg_request_create(request_class);
+
+    ret = HG_Create(
+        context, target_addr, hg_test_bulk_read_respond_id_g, &handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_create(
+        hg_class, 1, (void **) &buf, &size, HG_BULK_WRITE_ONLY, &bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+    in_struct.fildes = 0;
+    in_struct.transfer_size = size;
+    in_struct.origin_offset = 0;
+    in_struct.target_offset = 0;
+    in_struct.bulk_handle = bulk_handle;
+
+    /* Response must not arrive before the data */
+    forward_cb_args.request = request;
+    forward_cb_args.expected_bytes = size;
+    forward_cb_args.ret = HG_SUCCESS;
+    ret = HG_Forward(
+        handle, hg_test_bulk_forward_cb, &forward_cb_args, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
+
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    ret = forward_cb_args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "Error in HG callback (%s)", HG_Error_to_string(ret));
+
+    for (i = 0; i < size; i++)
+        HG_TEST_CHECK_ERROR(buf[i] != (char) i, done, ret, HG_FAULT,
+            "Error detected in returned data at offset %zu", i);
+
+done:
+    cleanup_ret = HG_Bulk_free(bulk_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    cleanup_ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Destroy() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    if (request)
+        hg_request_destroy(request);
+
+    if (buf) {
+        cleanup_ret = HG_Bulk_reg_cache_invalidate(hg_class, buf, size);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_reg_cache_invalidate() failed (%s)",
+            HG_Error_to_string(cleanup_ret));
+        free(buf);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_checksum(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr, hg_size_t size)
+{
+    hg_request_t *request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    struct forward_cb_args forward_cb_args;
+    bulk_checksum_in_t in_struct;
+    char *buf = NULL;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    hg_size_t i;
+
+    buf = malloc(size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buffer");
+
+    /* Data that does not compress so that origin buffer is pulled as is */
+    srand(42);
+    for (i = 0; i < size; i++)
+        buf[i] = (char) rand();
+
+    request = hg_request_create(request_class);
+
+    ret = HG_Create(context, target_addr, hg_test_bulk_checksum_id_g, &handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_create(
+        hg_class, 1, (void **) &buf, &size, HG_BULK_READ_ONLY, &bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+    in_struct.fildes = 0;
+    in_struct.transfer_size = size;
+    in_struct.origin_offset = 0;
+    in_struct.target_offset = 0;
+    in_struct.bulk_handle = bulk_handle;
+
+    /* Input proc modifies the first byte after encoding checksums, target
+     * returns the status of its pull */
+    forward_cb_args.request = request;
+    forward_cb_args.expected_bytes = (size_t) HG_CHECKSUM_ERROR;
+    forward_cb_args.ret = HG_SUCCESS;
+    ret = HG_Forward(
+        handle, hg_test_bulk_forward_cb, &forward_cb_args, &in_struct);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
+
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    ret = forward_cb_args.ret;
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "Checksum mismatch not detected (%s)",
+        HG_Error_to_string(ret));
+
+done:
+    cleanup_ret = HG_Bulk_free(bulk_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    cleanup_ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Destroy() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    if (request)
+        hg_request_destroy(request);
+
+    if (buf) {
+        cleanup_ret = HG_Bulk_reg_cache_invalidate(hg_class, buf, size);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_reg_cache_invalidate() failed (%s)",
+            HG_Error_to_string(cleanup_ret));
+        free(buf);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_bulk_compress_reuse(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t target_addr, hg_size_t size)
+{
+    hg_request_t *request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_bulk_t bulk_handle = HG_BULK_NULL;
+    struct forward_cb_args forward_cb_args;
+    bulk_write_in_t in_struct;
+    char *buf = NULL;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+    hg_size_t half = size / 2, i;
+    int round;
+
+    buf = calloc(1, size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buffer");
+
+    /* Only the first half is valid for the first RPC */
+    for (i = 0; i < half; i++)
+        buf[i] = (char) i;
+
+    request = hg_request_create(request_class);
+
+    ret = HG_Create(context, target_addr, hg_test_bulk_write_id_g, &handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
+
+    ret = HG_Bulk_create(
+        hg_class, 1, (void **) &buf, &size, HG_BULK_READ_ONLY, &bulk_handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
+
+    /* Compressed copy of the handle is reused by the second RPC, which must
+     * see the data written in between */
+    for (round = 0; round < 2; round++) {
+        in_struct.fildes = 0;
+        in_struct.transfer_size = half;
+        in_struct.origin_offset = round * half;
+        in_struct.target_offset = round * half;
+        in_struct.bulk_handle = bulk_handle;
+
+        forward_cb_args.request = request;
+        forward_cb_args.expected_bytes = half;
+        forward_cb_args.ret = HG_SUCCESS;
+        ret = HG_Forward(
+            handle, hg_test_bulk_forward_cb, &forward_cb_args, &in_struct);
+        HG_TEST_CHECK_HG_ERROR(
+            done, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
+
+        hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+        hg_request_reset(request);
+
+        ret = forward_cb_args.ret;
+        HG_TEST_CHECK_HG_ERROR(done, ret, "RPC %d failed (%s)", round,
+            HG_Error_to_string(ret));
+
+        for (i = half; i < size; i++)
+            buf[i] = (char) i;
+    }
+
+done:
+    cleanup_ret = HG_Bulk_free(bulk_handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Bulk_free() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    cleanup_ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Destroy() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    if (request)
+        hg_request_destroy(request);
+
+    if (buf) {
+        cleanup_ret = HG_Bulk_reg_cache_invalidate(hg_class, buf, size);
+        HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+            "HG_Bulk_reg_cache_invalidate() failed (%s)",
+            HG_Error_to_string(cleanup_ret));
+        free(buf);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(int argc, char *argv[])
+{
+    struct hg_test_info hg_test_info = {0};
+    hg_size_t buf_size;
+    hg_return_t hg_ret;
+    int ret = EXIT_SUCCESS;
+
+    /* Re-use registrations of bulk buffers and handles of descriptors */
+    hg_test_info.bulk_reg_cache_size = HG_TEST_BULK_REG_CACHE_SIZE;
+    hg_test_info.bulk_desc_cache_count = HG_TEST_BULK_DESC_CACHE_COUNT;
+
+    /* Keep a small number of bulk op IDs per context */
+    hg_test_info.bulk_op_pool_max = HG_TEST_BULK_OP_POOL_MAX;
+
+    /* Compress large bulk data pulled by the server */
+    hg_test_info.bulk_compress = HG_TRUE;
+
+    /* Let the server verify bulk data it pulls */
+    hg_test_info.bulk_checksum = HG_TRUE;
+
+    /* Initialize the interface */
+    hg_ret = HG_Test_init(argc, argv, &hg_test_info);
+    HG_TEST_CHECK_ERROR(
+        hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE, "HG_Test_init() failed");
+    buf_size = hg_test_info.buf_size_max;
+
+    /* Zero size RPC bulk test */
+    HG_TEST("null RPC bulk");
+    hg_ret = hg_test_bulk_null(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr);
+    HG_TEST_CHECK_ERROR(
+        hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE, "null RPC bulk failed");
+    HG_PASSED();
+
+    /* Zero size RPC bulk test */
+    HG_TEST("zero size RPC bulk (size 0, offsets 0, 0)");
+    hg_ret = hg_test_bulk_contig(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, 0, 0, hg_test_info.target_addr, buf_size, 0,
+        0, 0);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "zero size RPC bulk failed");
+    HG_PASSED();
+
+    /* Simple RPC bulk test */
+    HG_TEST("contiguous RPC bulk (size BUFSIZE, offsets 0, 0)");
+    hg_ret = hg_test_bulk_contig(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, 0, 0, hg_test_info.target_addr, buf_size,
+        buf_size, 0, 0);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "contiguous RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("contiguous RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
+    hg_ret = hg_test_bulk_contig(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, 0, 0, hg_test_info.target_addr, buf_size,
+        buf_size / 4, buf_size / 2 + 1, 0);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "contiguous RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("contiguous RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + 1, "
+            "BUFSIZE/4)");
+    hg_ret = hg_test_bulk_contig(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, 0, 0, hg_test_info.target_addr, buf_size,
+        buf_size / 8, buf_size / 2 + 1, buf_size / 4);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "contiguous RPC bulk failed");
+    HG_PASSED();
+
+    /* small bulk test */
+    HG_TEST("small segmented RPC bulk (size 8, offsets 0, 0)");
+    hg_ret = hg_test_bulk_small(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 8, 0, 0);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "small segmented RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("small segmented RPC bulk (size 4, offsets 8, 0)");
+    hg_ret = hg_test_bulk_small(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 4, 8, 0);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "small segmented RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("small segmented RPC bulk (size 8, offsets 4, 2)");
+    hg_ret = hg_test_bulk_small(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 8, 4, 2);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "small segmented RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("segmented RPC bulk (size BUFSIZE, offsets 0, 0)");
+    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_bulk_write_id_g, buf_size,
+        buf_size, 0, 0, 16);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "segmented RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("segmented RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
+    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_bulk_write_id_g, buf_size,
+        buf_size / 4, buf_size / 2 + 1, 0, 16);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "segmented RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("segmented RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + 1, "
+            "BUFSIZE/4)");
+    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_bulk_write_id_g, buf_size,
+        buf_size / 8, buf_size / 2 + 1, buf_size / 4, 16);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "segmented RPC bulk failed");
+    HG_PASSED();
+
+#ifndef HG_HAS_XDR
+    HG_TEST("over-segmented RPC bulk (size BUFSIZE, offsets 0, 0)");
+    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_bulk_write_id_g, buf_size,
+        buf_size, 0, 0, 1024);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "over-segmented RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST(
+        "over-segmented RPC bulk (size BUFSIZE/4, offsets BUFSIZE/2 + 1, 0)");
+    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_bulk_write_id_g, buf_size,
+        buf_size / 4, buf_size / 2 + 1, 0, 1024);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "over-segmented RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("over-segmented RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + 1, "
+            "BUFSIZE/4)");
+    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_bulk_write_id_g, buf_size,
+        buf_size / 8, buf_size / 2 + 1, buf_size / 4, 1024);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "over-segmented RPC bulk failed");
+    HG_PASSED();
+#endif
+
+    HG_TEST("batched RPC bulk (size BUFSIZE, offsets 0, 0)");
+    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_bulk_batch_write_id_g, buf_size, buf_size, 0, 0, 1);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "batched RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("batched segmented RPC bulk (size BUFSIZE/8, offsets BUFSIZE/2 + "
+            "1, BUFSIZE/4)");
+    hg_ret = hg_test_bulk_seg(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr,
+        hg_test_bulk_batch_write_id_g, buf_size, buf_size / 8,
+        buf_size / 2 + 1, buf_size / 4, 16);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "batched segmented RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("strided RPC bulk (column of 64 blocks of 16 bytes)");
+    {
+        struct hg_bulk_vector vectors[1] = {{64, 256}};
+
+        hg_ret = hg_test_bulk_strided(hg_test_info.hg_class,
+            hg_test_info.context, hg_test_info.request_class,
+            hg_test_info.target_addr, 16, 1, vectors);
+    }
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "strided RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("strided RPC bulk (4x8 sub-array of blocks of 12 bytes)");
+    {
+        struct hg_bulk_vector vectors[2] = {{4, 1024}, {8, 64}};
+
+        hg_ret = hg_test_bulk_strided(hg_test_info.hg_class,
+            hg_test_info.context, hg_test_info.request_class,
+            hg_test_info.target_addr, 12, 2, vectors);
+    }
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "strided RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("bulk view RPC bulk (16 segments, view offset 2560, size 10000)");
+    hg_ret = hg_test_bulk_view(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 16, 1000, 2560,
+        10000, 1000);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "bulk view RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("bulk view RPC bulk (16 segments, view offset 2560, size 100)");
+    hg_ret = hg_test_bulk_view(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, 16, 1000, 2560,
+        100, 0);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "bulk view RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("bulk pool RPC bulk (8 blocks of BUFSIZE/16)");
+    hg_ret = hg_test_bulk_pool(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, hg_test_info.target_addr, buf_size / 16, 8);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "bulk pool RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("bulk registration cache");
+    hg_ret = hg_test_bulk_reg_cache(hg_test_info.hg_class);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "bulk registration cache failed");
+    HG_PASSED();
+
+    HG_TEST("bulk descriptor cache");
+    hg_ret =
+        hg_test_bulk_desc_cache(hg_test_info.hg_class, hg_test_info.context);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "bulk descriptor cache failed");
+    HG_PASSED();
+
+    HG_TEST("bulk segment coalescing (1024 segments)");
+    hg_ret = hg_test_bulk_coalesce(hg_test_info.hg_class, 1024);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "bulk segment coalescing failed");
+    HG_PASSED();
+
+    HG_TEST("bulk op ID pool (16 transfers, max 4 op IDs)");
+    hg_ret = hg_test_bulk_op_pool(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, 16);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "bulk op ID pool failed");
+    HG_PASSED();
+
+    HG_TEST("pipelined bulk (size BUFSIZE + 3, chunk BUFSIZE/16, window 4)");
+    hg_ret = hg_test_bulk_pipelined(hg_test_info.hg_class, hg_test_info.context,
+        hg_test_info.request_class, buf_size + 3, buf_size / 16, 4);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "pipelined bulk failed");
+    HG_PASSED();
+
+    HG_TEST("eager write-only RPC bulk (size 256)");
+    hg_ret = hg_test_bulk_eager_write(hg_test_info.hg_class,
+        hg_test_info.context, hg_test_info.request_class,
+        hg_test_info.target_addr, 256);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "eager write-only RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("push and respond RPC bulk (size 256)");
+    hg_ret = hg_test_bulk_read_respond(hg_test_info.hg_class,
+        hg_test_info.context, hg_test_info.request_class,
+        hg_test_info.target_addr, 256);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "push and respond RPC bulk failed");
+    HG_PASSED();
+
+    HG_TEST("push and respond RPC bulk (size BUFSIZE)");
+    hg_ret = hg_test_bulk_read_respond(hg_test_info.hg_class,
+        hg_test_info.context, hg_test_info.request_class,
+        hg_test_info.target_addr, buf_size);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "push and respond RPC bulk failed");
+    HG_PASSED();
+
+    /* Checksums are only verified when pulling from a remote origin */
+    if (!hg_test_info.na_test_info.self_send) {
+        HG_TEST("checksum mismatch RPC bulk (size BUFSIZE)");
+        hg_ret = hg_test_bulk_checksum(hg_test_info.hg_class,
+            hg_test_info.context, hg_test_info.request_class,
+            hg_test_info.target_addr, buf_size);
+        HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+            "checksum mismatch RPC bulk failed");
+        HG_PASSED();
+    }
+
+    HG_TEST("compressed RPC bulk sent twice (size BUFSIZE)");
+    hg_ret = hg_test_bulk_compress_reuse(hg_test_info.hg_class,
+        hg_test_info.context, hg_test_info.request_class,
+        hg_test_info.target_addr, buf_size);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "compressed RPC bulk sent twice failed");
+    HG_PASSED();
 
     if (strcmp(HG_Class_get_name(hg_test_info.hg_class), "ofi") == 0) {
         HG_TEST("bind contiguous RPC bulk (size BUFSIZE, offsets 0, 0)");
@@ -24,6 +24,8 @@ MERCURY_GEN_PROC(bulk_write_in_t,
     ((hg_int32_t)(fildes))((hg_size_t)(transfer_size))((hg_size_t)(
         origin_offset))((hg_size_t)(target_offset))((hg_bulk_t)(bulk_handle)))
 MERCURY_GEN_PROC(bulk_write_out_t, ((hg_size_t)(ret)))
+MERCURY_GEN_PROC(bulk_pipelined_in_t,
+    ((hg_size_t)(chunk_size))((hg_uint32_t)(window))((hg_bulk_t)(bulk_handle)))
 #else
 /* Define bulk_write_in_t */
 typedef struct {
@@ -82,6 +84,62 @@ hg_proc_bulk_write_out_t(hg_proc_t proc, void *data)
 
     return ret;
 }
+
+/* Define bulk_pipelined_in_t */
+typedef struct {
+    hg_size_t chunk_size;
+    hg_uint32_t window;
+    hg_bulk_t bulk_handle;
+} bulk_pipelined_in_t;
+
+/* Define hg_proc_bulk_pipelined_in_t */
+static HG_INLINE hg_return_t
+hg_proc_bulk_pipelined_in_t(hg_proc_t proc, void *data)
+{
+    hg_return_t ret = HG_SUCCESS;
+    bulk_pipelined_in_t *struct_data = (bulk_pipelined_in_t *) data;
+
+    ret = hg_proc_hg_size_t(proc, &struct_data->chunk_size);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    ret = hg_proc_hg_uint32_t(proc, &struct_data->window);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    ret = hg_proc_hg_bulk_t(proc, &struct_data->bulk_handle);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    return ret;
+}
 #endif
 
+/* Same input as bulk_write_in_t but origin data is modified once its
+ * checksums have been encoded so that the target fails to verify it */
+typedef bulk_write_in_t bulk_checksum_in_t;
+
+/* Define hg_proc_bulk_checksum_in_t */
+static HG_INLINE hg_return_t
+hg_proc_bulk_checksum_in_t(hg_proc_t proc, void *data)
+{
+    bulk_checksum_in_t *struct_data = (bulk_checksum_in_t *) data;
+    hg_return_t ret = HG_SUCCESS;
+    void *buf = NULL;
+
+    ret = hg_proc_bulk_write_in_t(proc, data);
+    if (ret != HG_SUCCESS || hg_proc_get_op(proc) != HG_ENCODE)
+        return ret;
+
+    ret = HG_Bulk_access(struct_data->bulk_handle, 0, 1, HG_BULK_READ_ONLY, 1,
+        &buf, NULL, NULL);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    /* Increment so that data still differs if encoded more than once */
+    ((char *) buf)[0]++;
+
+    return ret;
+}
+
 #endif /* TEST_BULK_H */
@@ -0,0 +1,144 @@
+/*
+ * Copyright (C) 2013-2020 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_test.h"
+
+#include "mercury_mem.h"
+#include "mercury_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/****************/
+/* Local Macros */
+/****************/
+
+#define BENCHMARK_NAME "Local memory copy bandwidth"
+#define STRING(s)      #s
+#define XSTRING(s)     STRING(s)
+#define VERSION_NAME                                                           \
+    XSTRING(HG_VERSION_MAJOR)                                                  \
+    "." XSTRING(HG_VERSION_MINOR) "." XSTRING(HG_VERSION_PATCH)
+
+#define MIN_SIZE (1 << 12)
+#define MAX_SIZE (1 << 26)
+#define MIN_LOOP 4
+#define NBYTES   (1 << 29) /* Bytes copied per size and method */
+
+#define THREAD_COUNT 4
+
+#define NDIGITS 2
+#define NWIDTH  16
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static void
+hg_test_copy_memcpy(void *dest, const void *src, size_t n);
+
+static hg_return_t
+measure_copy(void (*copy)(void *, const void *, size_t), char *dest,
+    const char *src, size_t size, double *bw);
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_test_copy_memcpy(void *dest, const void *src, size_t n)
+{
+    memcpy(dest, src, n);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+measure_copy(void (*copy)(void *, const void *, size_t), char *dest,
+    const char *src, size_t size, double *bw)
+{
+    size_t loop = NBYTES / size, i;
+    hg_time_t t1, t2;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (loop < MIN_LOOP)
+        loop = MIN_LOOP;
+
+    /* Warm up */
+    memset(dest, 0, size);
+    copy(dest, src, size);
+    HG_TEST_CHECK_ERROR(memcmp(dest, src, size) != 0, done, ret,
+        HG_PROTOCOL_ERROR, "Copied data differs (%zu bytes)", size);
+
+    hg_time_get_current(&t1);
+    for (i = 0; i < loop; i++)
+        copy(dest, src, size);
+    hg_time_get_current(&t2);
+
+    *bw = (double) (size * loop) / (1024 * 1024) / hg_time_diff(t2, t1);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(void)
+{
+    char *src = NULL, *dest = NULL;
+    size_t size, i;
+    hg_return_t hg_ret;
+    int ret = EXIT_SUCCESS;
+
+    /* Offset buffers so that the unaligned head is also exercised */
+    src = (char *) malloc(MAX_SIZE + 1);
+    HG_TEST_CHECK_ERROR(
+        src == NULL, done, ret, EXIT_FAILURE, "Could not allocate buffer");
+    dest = (char *) malloc(MAX_SIZE + 1);
+    HG_TEST_CHECK_ERROR(
+        dest == NULL, done, ret, EXIT_FAILURE, "Could not allocate buffer");
+    for (i = 0; i < MAX_SIZE + 1; i++)
+        src[i] = (char) i;
+
+    fprintf(stdout, "# %s v%s\n", BENCHMARK_NAME, VERSION_NAME);
+    fprintf(stdout, "# Copying %d MB per size, %d helper thread(s)\n",
+        NBYTES / (1024 * 1024), THREAD_COUNT);
+    fprintf(stdout, "%-*s%*s%*s%*s\n", 10, "# Size", NWIDTH, "memcpy (MB/s)",
+        NWIDTH, "copy (MB/s)", NWIDTH, "threads (MB/s)");
+    fflush(stdout);
+
+    for (size = MIN_SIZE; size <= MAX_SIZE; size *= 4) {
+        double bw_memcpy = 0, bw_copy = 0, bw_threads = 0;
+
+        hg_ret = measure_copy(
+            hg_test_copy_memcpy, dest + 1, src + 1, size, &bw_memcpy);
+        HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+            "measure_copy() failed");
+
+        hg_ret = measure_copy(hg_mem_copy, dest + 1, src + 1, size, &bw_copy);
+        HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+            "measure_copy() failed");
+
+        HG_TEST_CHECK_ERROR(hg_mem_copy_init(THREAD_COUNT) != HG_UTIL_SUCCESS,
+            done, ret, EXIT_FAILURE, "hg_mem_copy_init() failed");
+        hg_ret =
+            measure_copy(hg_mem_copy, dest + 1, src + 1, size, &bw_threads);
+        HG_TEST_CHECK_ERROR(hg_mem_copy_finalize() != HG_UTIL_SUCCESS, done,
+            ret, EXIT_FAILURE, "hg_mem_copy_finalize() failed");
+        HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+            "measure_copy() failed");
+
+        fprintf(stdout, "%-*zu%*.*f%*.*f%*.*f\n", 10, size, NWIDTH, NDIGITS,
+            bw_memcpy, NWIDTH, NDIGITS, bw_copy, NWIDTH, NDIGITS, bw_threads);
+    }
+
+done:
+    free(src);
+    free(dest);
+
+    return ret;
+}
@@ -8,6 +8,7 @@
  * found at the root of the source code distribution tree.
  */
 
+#include "mercury_macros.h"
 #include "mercury_proc.h"
 #include "mercury_test.h"
 
@@ -17,6 +18,11 @@
 /* Local Macros */
 /****************/
 
+#define HG_TEST_PROC_POD_COUNT 4
+
+/* Odd count so that vectorized kernels also process a tail */
+#define HG_TEST_PROC_ARRAY_COUNT 37
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -32,6 +38,22 @@ typedef struct {
     hg_const_string_t string;
 } hg_test_proc_string_t;
 
+typedef struct {
+    hg_const_string_t string;
+    void *bytes;
+    hg_uint32_t bytes_size;
+} hg_test_proc_view_t;
+
+#ifdef HG_HAS_BOOST
+/* Struct without padding copied at once */
+MERCURY_GEN_PROC(hg_test_proc_pod_t,
+    ((hg_uint32_t)(val32))((hg_int32_t)(sval32))((hg_uint64_t)(val64)))
+
+/* Struct with padding processed field by field */
+MERCURY_GEN_PROC(
+    hg_test_proc_padded_t, ((hg_uint32_t)(val32))((hg_uint64_t)(val64)))
+#endif
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -74,6 +96,88 @@ hg_proc_hg_test_proc_string_t(hg_proc_t proc, void *data)
     return ret;
 }
 
+static hg_return_t
+hg_proc_hg_test_proc_view_t(hg_proc_t proc, void *data)
+{
+    hg_test_proc_view_t *struct_data = (hg_test_proc_view_t *) data;
+    hg_return_t ret = HG_SUCCESS;
+
+    ret = hg_proc_hg_const_string_t(proc, &struct_data->string);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    ret = hg_proc_hg_uint32_t(proc, &struct_data->bytes_size);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    ret = hg_proc_bytes_view(
+        proc, &struct_data->bytes, (hg_size_t) struct_data->bytes_size);
+    if (ret != HG_SUCCESS)
+        return ret;
+
+    return ret;
+}
+
+#ifdef HG_HAS_BOOST
+static hg_return_t
+hg_proc_hg_test_proc_pod_array(hg_proc_t proc, void *data)
+{
+    return hg_proc_array_of_hg_test_proc_pod_t(
+        proc, data, HG_TEST_PROC_POD_COUNT);
+}
+
+static hg_return_t
+hg_proc_hg_test_proc_pod_fields(hg_proc_t proc, void *data)
+{
+    hg_test_proc_pod_t *struct_data = (hg_test_proc_pod_t *) data;
+    hg_return_t ret = HG_SUCCESS;
+    int i;
+
+    for (i = 0; i < HG_TEST_PROC_POD_COUNT; i++) {
+        ret = hg_proc_hg_uint32_t(proc, &struct_data[i].val32);
+        if (ret != HG_SUCCESS)
+            return ret;
+
+        ret = hg_proc_hg_int32_t(proc, &struct_data[i].sval32);
+        if (ret != HG_SUCCESS)
+            return ret;
+
+        ret = hg_proc_hg_uint64_t(proc, &struct_data[i].val64);
+        if (ret != HG_SUCCESS)
+            return ret;
+    }
+
+    return ret;
+}
+
+static hg_return_t
+hg_proc_hg_test_proc_padded_array(hg_proc_t proc, void *data)
+{
+    return hg_proc_array_of_hg_test_proc_padded_t(
+        proc, data, HG_TEST_PROC_POD_COUNT);
+}
+
+static hg_return_t
+hg_proc_hg_test_proc_padded_fields(hg_proc_t proc, void *data)
+{
+    hg_test_proc_padded_t *struct_data = (hg_test_proc_padded_t *) data;
+    hg_return_t ret = HG_SUCCESS;
+    int i;
+
+    for (i = 0; i < HG_TEST_PROC_POD_COUNT; i++) {
+        ret = hg_proc_hg_uint32_t(proc, &struct_data[i].val32);
+        if (ret != HG_SUCCESS)
+            return ret;
+
+        ret = hg_proc_hg_uint64_t(proc, &struct_data[i].val64);
+        if (ret != HG_SUCCESS)
+            return ret;
+    }
+
+    return ret;
+}
+#endif
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -184,6 +288,32 @@ done:
     return ret;
 }
 
+static hg_return_t
+hg_test_proc_encode(hg_return_t (*proc_cb)(hg_proc_t proc, void *data),
+    void *data, hg_uint8_t flags, void *buf, size_t buf_size, hg_size_t *size)
+{
+    hg_proc_t proc = HG_PROC_NULL;
+    hg_return_t ret;
+
+    ret = hg_proc_create((hg_class_t *) 1, HG_NOHASH, &proc);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Cannot create HG proc");
+
+    ret = hg_proc_reset(proc, buf, buf_size, HG_ENCODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, flags);
+
+    ret = proc_cb(proc, data);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not encode data");
+
+    *size = hg_proc_get_size_used(proc);
+
+done:
+    if (proc != HG_PROC_NULL)
+        hg_proc_free(proc);
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_test_proc_uint(void)
@@ -228,6 +358,514 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_proc_view(hg_uint8_t flags)
+{
+    char bytes[] = {0, 1, 2, 3, 4, 5, 6, 7};
+    hg_test_proc_view_t in = {"Hello", bytes, sizeof(bytes)},
+                        out = {NULL, NULL, 0};
+    hg_proc_t proc = HG_PROC_NULL;
+    char *buf = NULL;
+    size_t buf_size = (size_t) hg_mem_get_page_size();
+    hg_bool_t in_buf;
+    hg_return_t ret;
+
+    ret = hg_proc_create((hg_class_t *) 1, HG_CRC32, &proc);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Cannot create HG proc");
+
+    buf = calloc(1, buf_size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buf");
+
+    ret = hg_proc_reset(proc, buf, buf_size, HG_ENCODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+
+    ret = hg_proc_hg_test_proc_view_t(proc, &in);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc view_t struct");
+
+    ret = hg_proc_reset(proc, buf, buf_size, HG_DECODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, flags);
+
+    ret = hg_proc_hg_test_proc_view_t(proc, &out);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc view_t struct");
+
+    HG_TEST_CHECK_ERROR(strcmp(in.string, out.string) != 0, done, ret,
+        HG_PROTOCOL_ERROR,
+        "Encoded and decoded strings do not match (%s != %s)", in.string,
+        out.string);
+    HG_TEST_CHECK_ERROR(in.bytes_size != out.bytes_size ||
+                            memcmp(in.bytes, out.bytes, in.bytes_size) != 0,
+        done, ret, HG_PROTOCOL_ERROR,
+        "Encoded and decoded bytes do not match");
+
+    /* Views must point into the proc buffer, copies must not */
+    in_buf = (out.string >= buf && out.string < buf + buf_size) &&
+             ((char *) out.bytes >= buf && (char *) out.bytes < buf + buf_size);
+    HG_TEST_CHECK_ERROR(in_buf != ((flags & HG_PROC_VIEW) != 0), done, ret,
+        HG_PROTOCOL_ERROR, "Decoded data is not located where expected");
+
+    /* Arena-aware procs do not need to be called with HG_FREE */
+    if (flags & HG_PROC_ARENA) {
+        ret = hg_proc_arena_reset(proc);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc arena");
+        goto done;
+    }
+
+    ret = hg_proc_reset(proc, buf, buf_size, HG_FREE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, flags);
+
+    ret = hg_proc_hg_test_proc_view_t(proc, &out);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc view_t struct");
+
+done:
+    if (proc != HG_PROC_NULL)
+        hg_proc_free(proc);
+    free(buf);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+#ifdef HG_HAS_BOOST
+static hg_return_t
+hg_test_proc_pod(hg_return_t (*array_proc_cb)(hg_proc_t proc, void *data),
+    hg_return_t (*fields_proc_cb)(hg_proc_t proc, void *data), void *in,
+    void *out, hg_uint8_t flags)
+{
+    char *array_buf = NULL, *fields_buf = NULL;
+    size_t buf_size = (size_t) hg_mem_get_page_size();
+    hg_size_t array_size = 0, fields_size = 0;
+    hg_return_t ret;
+
+    array_buf = calloc(1, buf_size);
+    HG_TEST_CHECK_ERROR(array_buf == NULL, done, ret, HG_NOMEM_ERROR,
+        "Could not allocate buf");
+
+    fields_buf = calloc(1, buf_size);
+    HG_TEST_CHECK_ERROR(fields_buf == NULL, done, ret, HG_NOMEM_ERROR,
+        "Could not allocate buf");
+
+    /* Generated procs must be wire compatible with field by field procs */
+    ret = hg_test_proc_encode(
+        array_proc_cb, in, flags, array_buf, buf_size, &array_size);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "hg_test_proc_encode() failed");
+
+    ret = hg_test_proc_encode(
+        fields_proc_cb, in, flags, fields_buf, buf_size, &fields_size);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "hg_test_proc_encode() failed");
+
+    HG_TEST_CHECK_ERROR(array_size != fields_size ||
+                            memcmp(array_buf, fields_buf, array_size) != 0,
+        done, ret, HG_PROTOCOL_ERROR,
+        "Array and field encodings do not match");
+
+    /* Decoding is only checked with default encoding */
+    if (flags)
+        goto done;
+
+    ret = hg_test_proc_generic(array_proc_cb, in, out);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "hg_test_proc_generic() failed");
+
+    ret = hg_test_proc_free(array_proc_cb, out);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "hg_test_proc_free() failed");
+
+done:
+    free(array_buf);
+    free(fields_buf);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_proc_pod_structs(void)
+{
+    hg_test_proc_pod_t in[HG_TEST_PROC_POD_COUNT] = {{1, -1, 1ULL << 40},
+                           {2, -2, 2}, {3, -3, 3}, {4, -4, 4}},
+                       out[HG_TEST_PROC_POD_COUNT];
+    hg_test_proc_padded_t padded_in[HG_TEST_PROC_POD_COUNT] = {{1, 1},
+                              {2, 2}, {3, 3}, {4, 1ULL << 40}},
+                          padded_out[HG_TEST_PROC_POD_COUNT];
+    int i;
+    hg_return_t ret;
+
+    memset(out, 0, sizeof(out));
+    ret = hg_test_proc_pod(hg_proc_hg_test_proc_pod_array,
+        hg_proc_hg_test_proc_pod_fields, in, out, 0);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "hg_test_proc_pod() failed");
+
+    HG_TEST_CHECK_ERROR(memcmp(in, out, sizeof(in)) != 0, done, ret,
+        HG_PROTOCOL_ERROR, "Encoded and decoded values do not match");
+
+    memset(padded_out, 0, sizeof(padded_out));
+    ret = hg_test_proc_pod(hg_proc_hg_test_proc_padded_array,
+        hg_proc_hg_test_proc_padded_fields, padded_in, padded_out, 0);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "hg_test_proc_pod() failed");
+
+    for (i = 0; i < HG_TEST_PROC_POD_COUNT; i++)
+        HG_TEST_CHECK_ERROR(padded_in[i].val32 != padded_out[i].val32 ||
+                                padded_in[i].val64 != padded_out[i].val64,
+            done, ret, HG_PROTOCOL_ERROR,
+            "Encoded and decoded values do not match");
+
+#ifndef HG_HAS_XDR
+    /* Structs must be processed field by field when using varints */
+    ret = hg_test_proc_pod(hg_proc_hg_test_proc_pod_array,
+        hg_proc_hg_test_proc_pod_fields, in, out, HG_PROC_VARINT);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "hg_test_proc_pod() failed");
+#endif
+
+done:
+    return ret;
+}
+#endif
+
+/*---------------------------------------------------------------------------*/
+#ifndef HG_HAS_XDR
+static hg_return_t
+hg_test_proc_varint(void)
+{
+    hg_test_proc_uint_t in = {1, 2, 3, 4}, out = {0, 0, 0, 0};
+    hg_uint64_t in64[] = {0, 1, 127, 128, 16383, 16384, 1ULL << 35,
+        ~(hg_uint64_t) 0},
+                out64[sizeof(in64) / sizeof(in64[0])];
+    hg_int32_t in32[] = {0, -1, 1, -64, 64, INT32_MIN, INT32_MAX},
+               out32[sizeof(in32) / sizeof(in32[0])];
+    hg_uint8_t malformed[HG_PROC_VARINT_MAX_SIZE + 1];
+    hg_proc_t proc = HG_PROC_NULL;
+    char *buf = NULL, *ref_buf = NULL;
+    size_t buf_size = (size_t) hg_mem_get_page_size();
+    hg_size_t size, ref_size;
+    unsigned int i;
+    hg_return_t ret;
+
+    ret = hg_proc_create((hg_class_t *) 1, HG_CRC32, &proc);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Cannot create HG proc");
+
+    buf = calloc(1, buf_size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buf");
+
+    ref_buf = calloc(1, buf_size);
+    HG_TEST_CHECK_ERROR(
+        ref_buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buf");
+
+    /* Small values must take less space than their fixed width */
+    ret = hg_proc_reset(proc, buf, buf_size, HG_ENCODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, HG_PROC_VARINT);
+
+    ret = hg_proc_hg_test_proc_uint_t(proc, &in);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc uint_t struct");
+
+    size = hg_proc_get_size_used(proc);
+    HG_TEST_CHECK_ERROR(size != 1 + 2 + 1 + 1, done, ret, HG_PROTOCOL_ERROR,
+        "Unexpected encoded size (%zu)", (size_t) size);
+
+    ret = hg_proc_reset(proc, buf, buf_size, HG_DECODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, HG_PROC_VARINT);
+
+    ret = hg_proc_hg_test_proc_uint_t(proc, &out);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc uint_t struct");
+
+    HG_TEST_CHECK_ERROR(in.val8 != out.val8 || in.val16 != out.val16 ||
+                            in.val32 != out.val32 || in.val64 != out.val64,
+        done, ret, HG_PROTOCOL_ERROR,
+        "Encoded and decoded values do not match");
+
+    /* Batch encoding must match element by element encoding */
+    ret = hg_proc_reset(proc, ref_buf, buf_size, HG_ENCODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, HG_PROC_VARINT);
+
+    for (i = 0; i < sizeof(in64) / sizeof(in64[0]); i++) {
+        ret = hg_proc_hg_uint64_t(proc, &in64[i]);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc uint64_t");
+    }
+    for (i = 0; i < sizeof(in32) / sizeof(in32[0]); i++) {
+        ret = hg_proc_hg_int32_t(proc, &in32[i]);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc int32_t");
+    }
+    ref_size = hg_proc_get_size_used(proc);
+
+    /* Exact size does not fit the worst case, encoded size is computed */
+    ret = hg_proc_reset(proc, buf, (hg_size_t) ref_size, HG_ENCODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, HG_PROC_VARINT);
+
+    ret = hg_proc_array_of_int(proc, in64, sizeof(in64) / sizeof(in64[0]),
+        sizeof(in64[0]), HG_FALSE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc uint64_t array");
+
+    ret = hg_proc_array_of_int(proc, in32, sizeof(in32) / sizeof(in32[0]),
+        sizeof(in32[0]), HG_TRUE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc int32_t array");
+
+    size = hg_proc_get_size_used(proc);
+    HG_TEST_CHECK_ERROR(size != ref_size || memcmp(buf, ref_buf, size) != 0 ||
+                            hg_proc_get_extra_buf(proc) != NULL,
+        done, ret, HG_PROTOCOL_ERROR,
+        "Batch and element encodings do not match");
+
+    ret = hg_proc_reset(proc, buf, buf_size, HG_DECODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, HG_PROC_VARINT);
+
+    ret = hg_proc_array_of_int(proc, out64, sizeof(out64) / sizeof(out64[0]),
+        sizeof(out64[0]), HG_FALSE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc uint64_t array");
+
+    ret = hg_proc_array_of_int(proc, out32, sizeof(out32) / sizeof(out32[0]),
+        sizeof(out32[0]), HG_TRUE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc int32_t array");
+
+    HG_TEST_CHECK_ERROR(memcmp(in64, out64, sizeof(in64)) != 0 ||
+                            memcmp(in32, out32, sizeof(in32)) != 0,
+        done, ret, HG_PROTOCOL_ERROR,
+        "Encoded and decoded values do not match");
+
+    /* Malformed values must be rejected */
+    memset(malformed, 0xff, sizeof(malformed));
+    ret = hg_proc_reset(proc, malformed, sizeof(malformed), HG_DECODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, HG_PROC_VARINT);
+
+    ret = hg_proc_hg_uint64_t(proc, &out64[0]);
+    HG_TEST_CHECK_ERROR(ret == HG_SUCCESS, done, ret, HG_PROTOCOL_ERROR,
+        "Malformed varint was decoded");
+    ret = HG_SUCCESS;
+
+done:
+    if (proc != HG_PROC_NULL)
+        hg_proc_free(proc);
+    free(buf);
+    free(ref_buf);
+
+    return ret;
+}
+#endif
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_proc_array_swap(void)
+{
+    unsigned char src[8 * HG_TEST_PROC_ARRAY_COUNT + 8],
+        dst[8 * HG_TEST_PROC_ARRAY_COUNT + 8];
+    hg_size_t elt_sizes[] = {4, 8};
+    unsigned int i, j, k, count, offset;
+    hg_return_t ret = HG_SUCCESS;
+
+    for (i = 0; i < sizeof(src); i++)
+        src[i] = (unsigned char) i;
+
+    for (i = 0; i < sizeof(elt_sizes) / sizeof(elt_sizes[0]); i++) {
+        hg_size_t elt_size = elt_sizes[i];
+
+        for (count = 0; count <= HG_TEST_PROC_ARRAY_COUNT; count++) {
+            for (offset = 0; offset < 4; offset++) {
+                memset(dst, 0, sizeof(dst));
+                hg_proc_array_swap(dst + offset, src + offset, count, elt_size);
+
+                for (j = 0; j < count; j++) {
+                    for (k = 0; k < elt_size; k++) {
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+                        size_t src_idx = offset + j * elt_size + k;
+#else
+                        size_t src_idx =
+                            offset + j * elt_size + (elt_size - 1 - k);
+#endif
+                        HG_TEST_CHECK_ERROR(
+                            dst[offset + j * elt_size + k] != src[src_idx],
+                            done, ret, HG_PROTOCOL_ERROR,
+                            "Swapped bytes do not match (count=%u, "
+                            "elt_size=%zu, offset=%u)",
+                            count, (size_t) elt_size, offset);
+                    }
+                }
+            }
+        }
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_proc_array(void)
+{
+    hg_uint32_t head = 1, in32[HG_TEST_PROC_ARRAY_COUNT],
+                out32[HG_TEST_PROC_ARRAY_COUNT];
+    hg_int64_t in64[HG_TEST_PROC_ARRAY_COUNT], out64[HG_TEST_PROC_ARRAY_COUNT];
+    float inf[HG_TEST_PROC_ARRAY_COUNT], outf[HG_TEST_PROC_ARRAY_COUNT];
+    double ind[HG_TEST_PROC_ARRAY_COUNT], outd[HG_TEST_PROC_ARRAY_COUNT];
+    hg_proc_t proc = HG_PROC_NULL;
+    char *buf = NULL, *ref_buf = NULL;
+    size_t buf_size = (size_t) hg_mem_get_page_size();
+    hg_size_t size, ref_size;
+#ifdef HG_HAS_XDR
+    XDR xdr;
+#endif
+    unsigned int i;
+    hg_return_t ret;
+
+    for (i = 0; i < HG_TEST_PROC_ARRAY_COUNT; i++) {
+        in32[i] = 0x01020304U * (i + 1);
+        in64[i] = -(hg_int64_t) 0x0102030405060708LL * (i + 1);
+        inf[i] = 1.5f * (float) i;
+        ind[i] = -2.25 * (double) i;
+    }
+
+    ret = hg_proc_create((hg_class_t *) 1, HG_CRC32, &proc);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Cannot create HG proc");
+
+    buf = calloc(1, buf_size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buf");
+
+    ref_buf = calloc(1, buf_size);
+    HG_TEST_CHECK_ERROR(
+        ref_buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buf");
+
+    /* Reference encoding, element by element */
+    ret = hg_proc_reset(proc, ref_buf, buf_size, HG_ENCODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+
+    /* Leading 32-bit value so that 64-bit values are not 8-byte aligned */
+    ret = hg_proc_hg_uint32_t(proc, &head);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc uint32_t");
+    for (i = 0; i < HG_TEST_PROC_ARRAY_COUNT; i++) {
+        ret = hg_proc_hg_uint32_t(proc, &in32[i]);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc uint32_t");
+    }
+    for (i = 0; i < HG_TEST_PROC_ARRAY_COUNT; i++) {
+        ret = hg_proc_hg_int64_t(proc, &in64[i]);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc int64_t");
+    }
+    size = hg_proc_get_size_used(proc);
+#ifdef HG_HAS_XDR
+    xdrmem_create(&xdr, ref_buf + size, (u_int)(buf_size - size), XDR_ENCODE);
+    for (i = 0; i < HG_TEST_PROC_ARRAY_COUNT; i++)
+        HG_TEST_CHECK_ERROR(xdr_float(&xdr, &inf[i]) == 0, done, ret,
+            HG_PROTOCOL_ERROR, "Could not encode float");
+    for (i = 0; i < HG_TEST_PROC_ARRAY_COUNT; i++)
+        HG_TEST_CHECK_ERROR(xdr_double(&xdr, &ind[i]) == 0, done, ret,
+            HG_PROTOCOL_ERROR, "Could not encode double");
+    xdr_destroy(&xdr);
+#else
+    memcpy(ref_buf + size, inf, sizeof(inf));
+    memcpy(ref_buf + size + sizeof(inf), ind, sizeof(ind));
+#endif
+    ref_size = size + sizeof(inf) + sizeof(ind);
+
+    /* Array encoding */
+    ret = hg_proc_reset(proc, buf, buf_size, HG_ENCODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+
+    ret = hg_proc_hg_uint32_t(proc, &head);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc uint32_t");
+    ret = hg_proc_array_of_int(
+        proc, in32, HG_TEST_PROC_ARRAY_COUNT, sizeof(in32[0]), HG_FALSE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc uint32_t array");
+    ret = hg_proc_array_of_int(
+        proc, in64, HG_TEST_PROC_ARRAY_COUNT, sizeof(in64[0]), HG_TRUE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc int64_t array");
+    ret = hg_proc_array_of_float(
+        proc, inf, HG_TEST_PROC_ARRAY_COUNT, sizeof(inf[0]));
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc float array");
+    ret = hg_proc_array_of_float(
+        proc, ind, HG_TEST_PROC_ARRAY_COUNT, sizeof(ind[0]));
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc double array");
+
+    size = hg_proc_get_size_used(proc);
+    HG_TEST_CHECK_ERROR(size != ref_size || memcmp(buf, ref_buf, size) != 0,
+        done, ret, HG_PROTOCOL_ERROR,
+        "Array and element encodings do not match");
+
+    /* Array decoding */
+    ret = hg_proc_reset(proc, buf, buf_size, HG_DECODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+
+    ret = hg_proc_hg_uint32_t(proc, &head);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc uint32_t");
+    ret = hg_proc_array_of_int(
+        proc, out32, HG_TEST_PROC_ARRAY_COUNT, sizeof(out32[0]), HG_FALSE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc uint32_t array");
+    ret = hg_proc_array_of_int(
+        proc, out64, HG_TEST_PROC_ARRAY_COUNT, sizeof(out64[0]), HG_TRUE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc int64_t array");
+    ret = hg_proc_array_of_float(
+        proc, outf, HG_TEST_PROC_ARRAY_COUNT, sizeof(outf[0]));
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc float array");
+    ret = hg_proc_array_of_float(
+        proc, outd, HG_TEST_PROC_ARRAY_COUNT, sizeof(outd[0]));
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not proc double array");
+
+    HG_TEST_CHECK_ERROR(memcmp(in32, out32, sizeof(in32)) != 0 ||
+                            memcmp(in64, out64, sizeof(in64)) != 0 ||
+                            memcmp(inf, outf, sizeof(inf)) != 0 ||
+                            memcmp(ind, outd, sizeof(ind)) != 0,
+        done, ret, HG_PROTOCOL_ERROR,
+        "Encoded and decoded values do not match");
+
+    /* Count whose total size wraps around must be rejected */
+    ret = hg_proc_reset(proc, buf, buf_size, HG_DECODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+
+    ret = hg_proc_array_of_pod(proc, outd,
+        (hg_size_t) SIZE_MAX / sizeof(outd[0]) + 2, sizeof(outd[0]), NULL);
+    HG_TEST_CHECK_ERROR(ret != HG_OVERFLOW, done, ret, HG_PROTOCOL_ERROR,
+        "Overflowing array size was not detected");
+    ret = HG_SUCCESS;
+
+done:
+    if (proc != HG_PROC_NULL)
+        hg_proc_free(proc);
+    free(buf);
+    free(ref_buf);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_proc_arena(void)
+{
+    hg_proc_t proc = HG_PROC_NULL;
+    hg_size_t sizes[] = {1, 7, 16, 33, 4096, 10000};
+    unsigned int i, j;
+    hg_return_t ret;
+
+    ret = hg_proc_create((hg_class_t *) 1, HG_NOHASH, &proc);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Cannot create HG proc");
+
+    /* Second pass reuses the arena after reset */
+    for (i = 0; i < 2; i++) {
+        for (j = 0; j < sizeof(sizes) / sizeof(sizes[0]); j++) {
+            char *ptr = (char *) hg_proc_alloc(proc, sizes[j]);
+
+            HG_TEST_CHECK_ERROR(ptr == NULL, done, ret, HG_NOMEM,
+                "Could not allocate from proc arena");
+            HG_TEST_CHECK_ERROR(((size_t) ptr % sizeof(void *)) != 0, done,
+                ret, HG_FAULT, "Arena allocation is not aligned");
+            memset(ptr, (int) j, (size_t) sizes[j]);
+        }
+
+        ret = hg_proc_arena_reset(proc);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc arena");
+    }
+
+done:
+    if (proc != HG_PROC_NULL)
+        hg_proc_free(proc);
+
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 int
 main(void)
@@ -249,6 +887,58 @@ main(void)
         "string proc test failed");
     HG_PASSED();
 
+    /* byte array proc test */
+    HG_TEST("byte array proc");
+    hg_ret = hg_test_proc_view(0);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "byte array proc test failed");
+    HG_PASSED();
+
+    /* arena proc test */
+    HG_TEST("arena proc");
+    hg_ret = hg_test_proc_arena();
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "arena proc test failed");
+    hg_ret = hg_test_proc_view(HG_PROC_ARENA);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "arena proc test failed");
+    HG_PASSED();
+
+    /* array proc test */
+    HG_TEST("array proc");
+    hg_ret = hg_test_proc_array_swap();
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "array proc test failed");
+    hg_ret = hg_test_proc_array();
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "array proc test failed");
+    HG_PASSED();
+
+#ifdef HG_HAS_BOOST
+    /* POD proc test */
+    HG_TEST("POD proc");
+    hg_ret = hg_test_proc_pod_structs();
+    HG_TEST_CHECK_ERROR(
+        hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE, "POD proc test failed");
+    HG_PASSED();
+#endif
+
+#ifndef HG_HAS_XDR
+    /* varint proc test */
+    HG_TEST("varint proc");
+    hg_ret = hg_test_proc_varint();
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "varint proc test failed");
+    HG_PASSED();
+
+    /* view proc test */
+    HG_TEST("view proc");
+    hg_ret = hg_test_proc_view(HG_PROC_VIEW);
+    HG_TEST_CHECK_ERROR(
+        hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE, "view proc test failed");
+    HG_PASSED();
+#endif
+
 done:
     if (ret != EXIT_SUCCESS)
         HG_FAILED();
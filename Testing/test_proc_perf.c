@@ -0,0 +1,240 @@
+/*
+ * Copyright (C) 2013-2020 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_proc.h"
+#include "mercury_test.h"
+
+#include "mercury_time.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+
+/****************/
+/* Local Macros */
+/****************/
+
+#define BENCHMARK_NAME "Integer encoding (fixed-width vs. varint)"
+#define STRING(s)      #s
+#define XSTRING(s)     STRING(s)
+#define VERSION_NAME                                                           \
+    XSTRING(HG_VERSION_MAJOR)                                                  \
+    "." XSTRING(HG_VERSION_MINOR) "." XSTRING(HG_VERSION_PATCH)
+
+#define NVALUES 1024
+#define LOOP    10000
+
+#define NDIGITS 2
+#define NWIDTH  16
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+struct hg_test_proc_perf_dist {
+    const char *name;
+    unsigned int bits; /* Number of significant bits of values */
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+static hg_return_t
+hg_test_proc_perf_encode(hg_proc_t proc, hg_uint64_t *values, void *buf,
+    size_t buf_size, hg_uint8_t flags, hg_bool_t batch);
+
+static hg_return_t
+hg_test_proc_perf_decode(hg_proc_t proc, hg_uint64_t *values, void *buf,
+    size_t buf_size, hg_uint8_t flags, hg_bool_t batch);
+
+static hg_return_t
+measure_proc(hg_proc_t proc, const struct hg_test_proc_perf_dist *dist,
+    hg_uint8_t flags, hg_bool_t batch);
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+static const struct hg_test_proc_perf_dist hg_test_proc_perf_dists_g[] = {
+    {"ids (7 bits)", 7}, {"sizes (21 bits)", 21}, {"offsets (40 bits)", 40},
+    {"hashes (64 bits)", 64}};
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_proc_perf_encode(hg_proc_t proc, hg_uint64_t *values, void *buf,
+    size_t buf_size, hg_uint8_t flags, hg_bool_t batch)
+{
+    hg_return_t ret;
+    unsigned int i;
+
+    ret = hg_proc_reset(proc, buf, buf_size, HG_ENCODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, flags);
+
+    if (batch) {
+        ret = hg_proc_array_of_int(
+            proc, values, NVALUES, sizeof(hg_uint64_t), HG_FALSE);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "Could not encode values");
+    } else {
+        for (i = 0; i < NVALUES; i++) {
+            ret = hg_proc_hg_uint64_t(proc, &values[i]);
+            HG_TEST_CHECK_HG_ERROR(done, ret, "Could not encode values");
+        }
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_proc_perf_decode(hg_proc_t proc, hg_uint64_t *values, void *buf,
+    size_t buf_size, hg_uint8_t flags, hg_bool_t batch)
+{
+    hg_return_t ret;
+    unsigned int i;
+
+    ret = hg_proc_reset(proc, buf, buf_size, HG_DECODE);
+    HG_TEST_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    hg_proc_set_flags(proc, flags);
+
+    if (batch) {
+        ret = hg_proc_array_of_int(
+            proc, values, NVALUES, sizeof(hg_uint64_t), HG_FALSE);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "Could not decode values");
+    } else {
+        for (i = 0; i < NVALUES; i++) {
+            ret = hg_proc_hg_uint64_t(proc, &values[i]);
+            HG_TEST_CHECK_HG_ERROR(done, ret, "Could not decode values");
+        }
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+measure_proc(hg_proc_t proc, const struct hg_test_proc_perf_dist *dist,
+    hg_uint8_t flags, hg_bool_t batch)
+{
+    hg_uint64_t *in = NULL, *out = NULL;
+    size_t buf_size = 2 * NVALUES * sizeof(hg_uint64_t);
+    void *buf = NULL;
+    hg_size_t encoded_size = 0;
+    hg_time_t t1, t2;
+    double encode_time = 0, decode_time = 0, nmbytes;
+    unsigned int i;
+    hg_return_t ret = HG_SUCCESS;
+
+    in = (hg_uint64_t *) malloc(NVALUES * sizeof(hg_uint64_t));
+    HG_TEST_CHECK_ERROR(
+        in == NULL, done, ret, HG_NOMEM, "Could not allocate values");
+    out = (hg_uint64_t *) malloc(NVALUES * sizeof(hg_uint64_t));
+    HG_TEST_CHECK_ERROR(
+        out == NULL, done, ret, HG_NOMEM, "Could not allocate values");
+    buf = malloc(buf_size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, done, ret, HG_NOMEM, "Could not allocate buffer");
+
+    /* Values of up to dist->bits significant bits */
+    for (i = 0; i < NVALUES; i++) {
+        hg_uint64_t value = ((hg_uint64_t) rand() << 42) ^
+                            ((hg_uint64_t) rand() << 21) ^ (hg_uint64_t) rand();
+
+        in[i] = (dist->bits < 64) ? value & ((1ULL << dist->bits) - 1) : value;
+    }
+
+    hg_time_get_current(&t1);
+    for (i = 0; i < LOOP; i++) {
+        ret = hg_test_proc_perf_encode(proc, in, buf, buf_size, flags, batch);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "hg_test_proc_perf_encode() failed");
+    }
+    hg_time_get_current(&t2);
+    encode_time = hg_time_diff(t2, t1);
+    encoded_size = hg_proc_get_size_used(proc);
+
+    hg_time_get_current(&t1);
+    for (i = 0; i < LOOP; i++) {
+        ret = hg_test_proc_perf_decode(proc, out, buf, buf_size, flags, batch);
+        HG_TEST_CHECK_HG_ERROR(done, ret, "hg_test_proc_perf_decode() failed");
+    }
+    hg_time_get_current(&t2);
+    decode_time = hg_time_diff(t2, t1);
+
+    HG_TEST_CHECK_ERROR(memcmp(in, out, NVALUES * sizeof(hg_uint64_t)) != 0,
+        done, ret, HG_PROTOCOL_ERROR, "Encoded and decoded values differ");
+
+    /* Throughput is expressed in terms of native data */
+    nmbytes = (double) (NVALUES * sizeof(hg_uint64_t)) / (1024 * 1024);
+    fprintf(stdout, "%-*s%-*s%*zu%*.*f%*.*f\n", 20, dist->name, 16,
+        (flags & HG_PROC_VARINT) ? (batch ? "varint/batch" : "varint")
+                                 : (batch ? "fixed/batch" : "fixed"),
+        NWIDTH, (size_t) encoded_size, NWIDTH, NDIGITS,
+        nmbytes * LOOP / encode_time, NWIDTH, NDIGITS,
+        nmbytes * LOOP / decode_time);
+
+done:
+    free(in);
+    free(out);
+    free(buf);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+main(void)
+{
+    hg_proc_t proc = HG_PROC_NULL;
+    unsigned int i;
+    hg_return_t hg_ret;
+    int ret = EXIT_SUCCESS;
+
+    hg_ret = hg_proc_create((hg_class_t *) 1, HG_NOHASH, &proc);
+    HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+        "hg_proc_create() failed");
+
+    fprintf(stdout, "# %s v%s\n", BENCHMARK_NAME, VERSION_NAME);
+    fprintf(stdout, "# Loop %d times over %d uint64 value(s)\n", LOOP, NVALUES);
+    fprintf(stdout, "%-*s%-*s%*s%*s%*s\n", 20, "# Values", 16, "Encoding",
+        NWIDTH, "Size (bytes)", NWIDTH, "Encode (MB/s)", NWIDTH,
+        "Decode (MB/s)");
+    fflush(stdout);
+
+    for (i = 0; i < sizeof(hg_test_proc_perf_dists_g) /
+                        sizeof(hg_test_proc_perf_dists_g[0]);
+         i++) {
+        const struct hg_test_proc_perf_dist *dist =
+            &hg_test_proc_perf_dists_g[i];
+
+        hg_ret = measure_proc(proc, dist, 0, HG_FALSE);
+        HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+            "measure_proc() failed");
+        hg_ret = measure_proc(proc, dist, 0, HG_TRUE);
+        HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+            "measure_proc() failed");
+#ifndef HG_HAS_XDR
+        hg_ret = measure_proc(proc, dist, HG_PROC_VARINT, HG_FALSE);
+        HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+            "measure_proc() failed");
+        hg_ret = measure_proc(proc, dist, HG_PROC_VARINT, HG_TRUE);
+        HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+            "measure_proc() failed");
+#endif
+        fprintf(stdout, "\n");
+    }
+
+done:
+    if (proc != HG_PROC_NULL)
+        hg_proc_free(proc);
+
+    return ret;
+}
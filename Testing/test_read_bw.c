@@ -33,6 +33,11 @@
 #define NDIGITS 2
 #define NWIDTH  20
 
+/* Pipelined transfers of BUFSIZE use chunks from BUFSIZE/64 to BUFSIZE
+ * and windows from 1 to PIPELINE_WINDOW_MAX */
+#define PIPELINE_CHUNK_DIV  64
+#define PIPELINE_WINDOW_MAX 16
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -49,15 +54,19 @@ struct hg_test_perf_args {
 
 static hg_return_t
 hg_test_perf_forward_cb(const struct hg_cb_info *callback_info);
+static void
+print_bandwidth(size_t nbytes, hg_size_t chunk_size, unsigned int window,
+    double bandwidth);
 static hg_return_t
 measure_bulk_transfer(struct hg_test_info *hg_test_info, size_t total_size,
-    unsigned int nhandles);
+    unsigned int nhandles, hg_size_t chunk_size, unsigned int window);
 
 /*******************/
 /* Local Variables */
 /*******************/
 
 extern hg_id_t hg_test_perf_bulk_read_id_g;
+extern hg_id_t hg_test_perf_bulk_read_pipelined_id_g;
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
@@ -73,12 +82,28 @@ hg_test_perf_forward_cb(const struct hg_cb_info *callback_info)
     return HG_SUCCESS;
 }
 
+/*---------------------------------------------------------------------------*/
+static void
+print_bandwidth(size_t nbytes, hg_size_t chunk_size, unsigned int window,
+    double bandwidth)
+{
+    if (chunk_size > 0)
+        fprintf(stdout, "%-*d%*d%*u%*.*f", 10, (int) nbytes, 12,
+            (int) chunk_size, 8, window, NWIDTH, NDIGITS, bandwidth);
+    else
+        fprintf(stdout, "%-*d%*.*f", 10, (int) nbytes, NWIDTH, NDIGITS,
+            bandwidth);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-measure_bulk_transfer(
-    struct hg_test_info *hg_test_info, size_t total_size, unsigned int nhandles)
+measure_bulk_transfer(struct hg_test_info *hg_test_info, size_t total_size,
+    unsigned int nhandles, hg_size_t chunk_size, unsigned int window)
 {
     bulk_write_in_t in_struct;
+    bulk_pipelined_in_t pipelined_in_struct;
+    void *in_struct_ptr;
+    hg_id_t rpc_id;
     char *bulk_buf;
     void **buf_ptrs;
     size_t *buf_sizes;
@@ -111,9 +136,13 @@ measure_bulk_transfer(
     HG_TEST_CHECK_ERROR(handles == NULL, done, ret, HG_NOMEM_ERROR,
         "Could not allocate handles");
 
+    /* Use pipelined transfers when a chunk size is given */
+    rpc_id = (chunk_size > 0) ? hg_test_perf_bulk_read_pipelined_id_g
+                              : hg_test_perf_bulk_read_id_g;
+
     for (i = 0; i < nhandles; i++) {
         ret = HG_Create(hg_test_info->context, hg_test_info->target_addr,
-            hg_test_perf_bulk_read_id_g, &handles[i]);
+            rpc_id, &handles[i]);
         HG_TEST_CHECK_HG_ERROR(
             done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
     }
@@ -130,8 +159,16 @@ measure_bulk_transfer(
         done, ret, "HG_Bulk_create() failed (%s)", HG_Error_to_string(ret));
 
     /* Fill input structure */
-    in_struct.fildes = 0;
-    in_struct.bulk_handle = bulk_handle;
+    if (chunk_size > 0) {
+        pipelined_in_struct.chunk_size = chunk_size;
+        pipelined_in_struct.window = window;
+        pipelined_in_struct.bulk_handle = bulk_handle;
+        in_struct_ptr = &pipelined_in_struct;
+    } else {
+        in_struct.fildes = 0;
+        in_struct.bulk_handle = bulk_handle;
+        in_struct_ptr = &in_struct;
+    }
 
     /* Warm up for bulk data */
     for (i = 0; i < skip; i++) {
@@ -139,7 +176,7 @@ measure_bulk_transfer(
 
         for (j = 0; j < nhandles; j++) {
             ret = HG_Forward(
-                handles[j], hg_test_perf_forward_cb, &args, &in_struct);
+                handles[j], hg_test_perf_forward_cb, &args, in_struct_ptr);
             HG_TEST_CHECK_HG_ERROR(
                 done, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
         }
@@ -160,7 +197,7 @@ measure_bulk_transfer(
 
         for (j = 0; j < nhandles; j++) {
             ret = HG_Forward(
-                handles[j], hg_test_perf_forward_cb, &args, &in_struct);
+                handles[j], hg_test_perf_forward_cb, &args, in_struct_ptr);
             HG_TEST_CHECK_HG_ERROR(
                 done, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
         }
@@ -182,9 +219,10 @@ measure_bulk_transfer(
 
         /* At this point we have received everything so work out the bandwidth
          */
-        if (hg_test_info->na_test_info.mpi_comm_rank == 0)
-            fprintf(stdout, "%-*d%*.*f\r", 10, (int) nbytes, NWIDTH, NDIGITS,
-                read_bandwidth);
+        if (hg_test_info->na_test_info.mpi_comm_rank == 0) {
+            print_bandwidth(nbytes, chunk_size, window, read_bandwidth);
+            fprintf(stdout, "\r");
+        }
 #endif
 #ifdef HG_TEST_HAS_VERIFY_DATA
         for (i = 0; i < nbytes; i++) {
@@ -206,8 +244,7 @@ measure_bulk_transfer(
 
     /* At this point we have received everything so work out the bandwidth */
     if (hg_test_info->na_test_info.mpi_comm_rank == 0)
-        fprintf(stdout, "%-*d%*.*f", 10, (int) nbytes, NWIDTH, NDIGITS,
-            read_bandwidth);
+        print_bandwidth(nbytes, chunk_size, window, read_bandwidth);
 #endif
     if (hg_test_info->na_test_info.mpi_comm_rank == 0)
         fprintf(stdout, "\n");
@@ -236,8 +273,8 @@ int
 main(int argc, char *argv[])
 {
     struct hg_test_info hg_test_info = {0};
-    unsigned int nhandles;
-    size_t size;
+    unsigned int nhandles, window;
+    size_t size, chunk_size;
     hg_return_t hg_ret;
     int ret = EXIT_SUCCESS;
 
@@ -263,7 +300,8 @@ main(int argc, char *argv[])
         }
 
         for (size = 1; size <= hg_test_info.buf_size_max; size *= 2) {
-            hg_ret = measure_bulk_transfer(&hg_test_info, size, nhandles);
+            hg_ret =
+                measure_bulk_transfer(&hg_test_info, size, nhandles, 0, 0);
             HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
                 "measure_bulk_transfer() failed");
         }
@@ -272,6 +310,31 @@ main(int argc, char *argv[])
             fprintf(stdout, "\n");
     }
 
+    /* Compare chunk sizes and window depths of pipelined transfers */
+    size = hg_test_info.buf_size_max;
+    if (hg_test_info.na_test_info.mpi_comm_rank == 0) {
+        fprintf(stdout, "# %s v%s\n", BENCHMARK_NAME, VERSION_NAME);
+        fprintf(stdout,
+            "# Loop %d times pipelined transfers of %zu byte(s) with "
+            "1 handle\n",
+            hg_test_info.na_test_info.loop, size);
+        fprintf(stdout, "%-*s%*s%*s%*s\n", 10, "# Size", 12, "Chunk", 8,
+            "Window", NWIDTH, "Bandwidth (MB/s)");
+        fflush(stdout);
+    }
+
+    chunk_size = size / PIPELINE_CHUNK_DIV;
+    if (chunk_size == 0)
+        chunk_size = 1;
+    for (; chunk_size <= size; chunk_size *= 4) {
+        for (window = 1; window <= PIPELINE_WINDOW_MAX; window *= 4) {
+            hg_ret = measure_bulk_transfer(
+                &hg_test_info, size, 1, chunk_size, window);
+            HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+                "measure_bulk_transfer() failed");
+        }
+    }
+
 done:
     hg_ret = HG_Test_finalize(&hg_test_info);
     HG_TEST_CHECK_ERROR_DONE(hg_ret != HG_SUCCESS, "HG_Test_finalize() failed");
@@ -12,6 +12,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 /****************/
 /* Local Macros */
@@ -34,6 +35,12 @@ struct lookup_cb_args {
     hg_addr_t *addr_ptr;
 };
 
+struct overflow_cb_args {
+    hg_request_t *request;
+    hg_bool_t pulled;
+    hg_return_t ret;
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
@@ -51,6 +58,9 @@ hg_test_rpc_forward_reset_cb(const struct hg_cb_info *callback_info);
 #ifndef HG_HAS_XDR
 static hg_return_t
 hg_test_rpc_forward_overflow_cb(const struct hg_cb_info *callback_info);
+static hg_return_t
+hg_test_rpc_forward_overflow_landing_cb(
+    const struct hg_cb_info *callback_info);
 #endif
 
 static hg_return_t
@@ -72,6 +82,10 @@ hg_test_rpc_multiple(hg_context_t *context, hg_request_class_t *request_class,
 static hg_return_t
 hg_test_overflow(hg_context_t *context, hg_request_class_t *request_class,
     hg_addr_t addr, hg_id_t rpc_id, hg_cb_t callback);
+static hg_return_t
+hg_test_overflow_landing(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t addr, hg_id_t rpc_id,
+    hg_bool_t *pulled);
 #endif
 static hg_return_t
 hg_test_cancel_rpc(hg_context_t *context, hg_request_class_t *request_class,
@@ -233,6 +247,51 @@ done:
     hg_request_complete(request);
     return ret;
 }
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_rpc_forward_overflow_landing_cb(const struct hg_cb_info *callback_info)
+{
+    hg_handle_t handle = callback_info->info.forward.handle;
+    struct overflow_cb_args *args =
+        (struct overflow_cb_args *) callback_info->arg;
+    overflow_out_t out_struct;
+    void *extra_buf = NULL;
+    hg_uint64_t i;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_TEST_CHECK_ERROR(callback_info->ret != HG_SUCCESS, done, args->ret,
+        callback_info->ret, "Error in HG callback (%s)",
+        HG_Error_to_string(callback_info->ret));
+
+    /* Get output */
+    ret = HG_Get_output(handle, &out_struct);
+    HG_TEST_CHECK_ERROR(ret != HG_SUCCESS, done, args->ret, ret,
+        "HG_Get_output() failed (%s)", HG_Error_to_string(ret));
+
+    /* Output is only pulled into an extra buffer if it did not land */
+    ret = HG_Get_output_extra_buf(handle, &extra_buf, NULL);
+    HG_TEST_CHECK_ERROR(ret != HG_SUCCESS, free, args->ret, ret,
+        "HG_Get_output_extra_buf() failed (%s)", HG_Error_to_string(ret));
+    args->pulled = (extra_buf != NULL);
+
+    HG_TEST_CHECK_ERROR(strlen(out_struct.string) != out_struct.string_len,
+        free, args->ret, HG_FAULT,
+        "Returned string has length %zu, expected %zu",
+        strlen(out_struct.string), (size_t) out_struct.string_len);
+    for (i = 0; i < out_struct.string_len; i++)
+        HG_TEST_CHECK_ERROR(out_struct.string[i] != 'h', free, args->ret,
+            HG_FAULT, "Error detected in returned string");
+
+free:
+    ret = HG_Free_output(handle, &out_struct);
+    HG_TEST_CHECK_ERROR_DONE(ret != HG_SUCCESS, "HG_Free_output() failed (%s)",
+        HG_Error_to_string(ret));
+
+done:
+    hg_request_complete(args->request);
+    return HG_SUCCESS;
+}
 #endif
 
 /*---------------------------------------------------------------------------*/
@@ -695,6 +754,63 @@ done:
 
     return ret;
 }
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_test_overflow_landing(hg_class_t *hg_class, hg_context_t *context,
+    hg_request_class_t *request_class, hg_addr_t addr, hg_id_t rpc_id,
+    hg_bool_t *pulled)
+{
+    hg_request_t *request = NULL;
+    hg_handle_t handle = HG_HANDLE_NULL;
+    hg_size_t buf_size = 4 * HG_Class_get_output_eager_size(hg_class);
+    struct overflow_cb_args overflow_cb_args;
+    void *buf = NULL;
+    hg_return_t ret = HG_SUCCESS, cleanup_ret;
+
+    buf = malloc(buf_size);
+    HG_TEST_CHECK_ERROR(
+        buf == NULL, done, ret, HG_NOMEM_ERROR, "Could not allocate buffer");
+
+    request = hg_request_create(request_class);
+
+    /* Create RPC request */
+    ret = HG_Create(context, addr, rpc_id, &handle);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Create() failed (%s)", HG_Error_to_string(ret));
+
+    /* Large output is pushed directly into buf */
+    ret = HG_Set_output_landing_buf(handle, buf, buf_size);
+    HG_TEST_CHECK_HG_ERROR(done, ret,
+        "HG_Set_output_landing_buf() failed (%s)", HG_Error_to_string(ret));
+
+    /* Forward call to remote addr and get a new request */
+    HG_TEST_LOG_DEBUG("Forwarding RPC, op id: %u...", rpc_id);
+    overflow_cb_args.request = request;
+    overflow_cb_args.pulled = HG_FALSE;
+    overflow_cb_args.ret = HG_SUCCESS;
+    ret = HG_Forward(handle, hg_test_rpc_forward_overflow_landing_cb,
+        &overflow_cb_args, NULL);
+    HG_TEST_CHECK_HG_ERROR(
+        done, ret, "HG_Forward() failed (%s)", HG_Error_to_string(ret));
+
+    hg_request_wait(request, HG_MAX_IDLE_TIME, NULL);
+
+    ret = overflow_cb_args.ret;
+    *pulled = overflow_cb_args.pulled;
+
+done:
+    cleanup_ret = HG_Destroy(handle);
+    HG_TEST_CHECK_ERROR_DONE(cleanup_ret != HG_SUCCESS,
+        "HG_Destroy() failed (%s)", HG_Error_to_string(cleanup_ret));
+
+    if (request)
+        hg_request_destroy(request);
+
+    free(buf);
+
+    return ret;
+}
 #endif
 
 /*---------------------------------------------------------------------------*/
@@ -908,6 +1024,22 @@ main(int argc, char *argv[])
     HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
         "overflow RPC test failed");
     HG_PASSED();
+
+    HG_TEST("overflow RPC with output landing buffer");
+    {
+        hg_bool_t pulled = HG_FALSE;
+
+        hg_ret = hg_test_overflow_landing(hg_test_info.hg_class,
+            hg_test_info.context, hg_test_info.request_class,
+            hg_test_info.target_addr, hg_test_overflow_id_g, &pulled);
+        HG_TEST_CHECK_ERROR(hg_ret != HG_SUCCESS, done, ret, EXIT_FAILURE,
+            "overflow RPC with output landing buffer test failed");
+
+        /* Forwarding to ourself does not go through the landing buffer */
+        HG_TEST_CHECK_ERROR(pulled && !hg_test_info.na_test_info.self_send,
+            done, ret, EXIT_FAILURE, "Output was not pushed to landing buffer");
+    }
+    HG_PASSED();
 #endif
 
     /* Cancel RPC test (self cancelation is not supported) */
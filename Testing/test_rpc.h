@@ -118,23 +118,11 @@ hg_proc_perf_rpc_lat_in_t(hg_proc_t proc, void *data)
         return ret;
 
     if (struct_data->buf_size) {
-        switch (hg_proc_get_op(proc)) {
-            case HG_DECODE:
-                struct_data->buf = malloc(struct_data->buf_size);
-                HG_FALLTHROUGH();
-            case HG_ENCODE:
-                ret =
-                    hg_proc_raw(proc, struct_data->buf, struct_data->buf_size);
-                if (ret != HG_SUCCESS)
-                    return ret;
-                break;
-            case HG_FREE:
-                free(struct_data->buf);
-                break;
-            default:
-                ret = HG_INVALID_ARG;
-                return ret;
-        }
+        /* Allocated from arena or malloc'd depending on proc flags */
+        ret = hg_proc_bytes_view(
+            proc, &struct_data->buf, (hg_size_t) struct_data->buf_size);
+        if (ret != HG_SUCCESS)
+            return ret;
 
 #ifdef HG_TEST_HAS_VERIFY_DATA
         if (hg_proc_get_op(proc) == HG_DECODE) {
@@ -20,6 +20,9 @@
 #define HG_TEST_PROGRESS_TIMEOUT 100
 #define HG_TEST_TRIGGER_TIMEOUT  HG_MAX_IDLE_TIME
 
+/* Max number of cached bulk descriptors */
+#define HG_TEST_BULK_DESC_CACHE_COUNT 64
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -131,6 +134,13 @@ main(int argc, char *argv[])
 
     /* Force to listen */
     hg_test_info.na_test_info.listen = NA_TRUE;
+
+    /* Re-use handles of bulk descriptors sent repeatedly by clients */
+    hg_test_info.bulk_desc_cache_count = HG_TEST_BULK_DESC_CACHE_COUNT;
+
+    /* Accept compressed bulk data from clients */
+    hg_test_info.bulk_compress = HG_TRUE;
+
     ret = HG_Test_init(argc, argv, &hg_test_info);
     HG_TEST_CHECK_ERROR(
         ret != HG_SUCCESS, done, rc, EXIT_FAILURE, "HG_Test_init() failed");
@@ -0,0 +1,114 @@
+#include "mercury_compress.h"
+
+#include "mercury_test_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BUF_SIZE (1 << 18)
+
+static int
+compress_round_trip(const char *name, const char *src, size_t size,
+    char *cbuf, char *dbuf, size_t *csize)
+{
+    *csize = hg_compress(src, size, cbuf, HG_COMPRESS_BOUND(size));
+    if (*csize == 0) {
+        fprintf(stderr, "Error: could not compress %s data\n", name);
+        return EXIT_FAILURE;
+    }
+    memset(dbuf, 0, size);
+    if (hg_decompress(cbuf, *csize, dbuf, size) != HG_UTIL_SUCCESS) {
+        fprintf(stderr, "Error: could not decompress %s data\n", name);
+        return EXIT_FAILURE;
+    }
+    if (memcmp(src, dbuf, size) != 0) {
+        fprintf(stderr, "Error: decompressed %s data differs\n", name);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main(int argc, char *argv[])
+{
+    char *src = NULL, *cbuf = NULL, *dbuf = NULL;
+    size_t csize, size, i;
+    unsigned int seed = 42;
+    int ret = EXIT_SUCCESS;
+
+    (void) argc;
+    (void) argv;
+
+    src = malloc(BUF_SIZE);
+    cbuf = malloc(HG_COMPRESS_BOUND(BUF_SIZE));
+    dbuf = malloc(BUF_SIZE);
+    if (!src || !cbuf || !dbuf) {
+        fprintf(stderr, "Error: could not allocate buffers\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    /* Text-like data must shrink */
+    for (i = 0; i < BUF_SIZE; i++)
+        src[i] = "mercury bulk data "[i % 18] + (char) ((i / 4096) % 4);
+    ret = compress_round_trip("text", src, BUF_SIZE, cbuf, dbuf, &csize);
+    if (ret != EXIT_SUCCESS)
+        goto done;
+    if (csize >= BUF_SIZE / 4) {
+        fprintf(stderr, "Error: text data compressed to %zu bytes\n", csize);
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    /* Runs shorter than the match offset */
+    memset(src, 'a', BUF_SIZE);
+    ret = compress_round_trip("run", src, BUF_SIZE, cbuf, dbuf, &csize);
+    if (ret != EXIT_SUCCESS)
+        goto done;
+
+    /* Random data must not exceed the bound */
+    for (i = 0; i < BUF_SIZE; i++) {
+        seed = seed * 1103515245 + 12345;
+        src[i] = (char) (seed >> 16);
+    }
+    ret = compress_round_trip("random", src, BUF_SIZE, cbuf, dbuf, &csize);
+    if (ret != EXIT_SUCCESS)
+        goto done;
+
+    /* Compression gives up when the destination is too small */
+    if (hg_compress(src, BUF_SIZE, cbuf, BUF_SIZE / 2) != 0) {
+        fprintf(stderr, "Error: random data fits into half its size\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    /* Small sizes */
+    for (size = 0; size < 64; size++) {
+        ret = compress_round_trip("small", src, size, cbuf, dbuf, &csize);
+        if (ret != EXIT_SUCCESS)
+            goto done;
+    }
+
+    /* Truncated data or wrong size must be detected */
+    for (i = 0; i < BUF_SIZE; i++)
+        src[i] = (char) (i % 251);
+    csize = hg_compress(src, BUF_SIZE, cbuf, HG_COMPRESS_BOUND(BUF_SIZE));
+    if (hg_decompress(cbuf, csize - 1, dbuf, BUF_SIZE) == HG_UTIL_SUCCESS ||
+        hg_decompress(cbuf, csize, dbuf, BUF_SIZE - 1) == HG_UTIL_SUCCESS ||
+        hg_decompress(cbuf, csize, dbuf, BUF_SIZE) != HG_UTIL_SUCCESS) {
+        fprintf(stderr, "Error: invalid compressed data not detected\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+done:
+    free(src);
+    free(cbuf);
+    free(dbuf);
+
+    return ret;
+}
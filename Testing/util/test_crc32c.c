@@ -0,0 +1,88 @@
+#include "mercury_crc32c.h"
+
+#include "mercury_test_config.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BUF_SIZE (1 << 16)
+
+/* Table-driven reference */
+static hg_util_uint32_t
+crc32c_ref(const unsigned char *buf, size_t size)
+{
+    hg_util_uint32_t crc = 0xffffffff;
+    size_t i;
+    int k;
+
+    for (i = 0; i < size; i++) {
+        crc ^= buf[i];
+        for (k = 0; k < 8; k++)
+            crc = (crc >> 1) ^ (0x82F63B78 & (0U - (crc & 1)));
+    }
+
+    return ~crc;
+}
+
+/*---------------------------------------------------------------------------*/
+
+int
+main(int argc, char *argv[])
+{
+    unsigned char *buf = NULL;
+    hg_util_uint32_t crc;
+    unsigned int seed = 42;
+    size_t i, size;
+    int ret = EXIT_SUCCESS;
+
+    (void) argc;
+    (void) argv;
+
+    /* Check value of the standard test vector */
+    crc = hg_crc32c(0, "123456789", 9);
+    if (crc != 0xe3069283) {
+        fprintf(stderr, "Error: checksum is 0x%08x, expected 0xe3069283\n",
+            (unsigned int) crc);
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+    buf = malloc(BUF_SIZE + 8);
+    if (!buf) {
+        fprintf(stderr, "Error: could not allocate buffer\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+    for (i = 0; i < BUF_SIZE + 8; i++) {
+        seed = seed * 1103515245 + 12345;
+        buf[i] = (unsigned char) (seed >> 16);
+    }
+
+    /* Unaligned data of various sizes */
+    for (size = 0; size < 64; size++) {
+        for (i = 0; i < 8; i++) {
+            if (hg_crc32c(0, buf + i, size) != crc32c_ref(buf + i, size)) {
+                fprintf(stderr, "Error: wrong checksum of %zu bytes at %zu\n",
+                    size, i);
+                ret = EXIT_FAILURE;
+                goto done;
+            }
+        }
+    }
+
+    /* Incremental updates match a single pass */
+    crc = hg_crc32c(0, buf, 1000);
+    crc = hg_crc32c(crc, buf + 1000, 3);
+    crc = hg_crc32c(crc, buf + 1003, BUF_SIZE - 1003);
+    if (crc != crc32c_ref(buf, BUF_SIZE)) {
+        fprintf(stderr, "Error: incremental checksum differs\n");
+        ret = EXIT_FAILURE;
+        goto done;
+    }
+
+done:
+    free(buf);
+
+    return ret;
+}
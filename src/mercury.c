@@ -10,13 +10,16 @@
 
 #include "mercury.h"
 #include "mercury_bulk.h"
+#include "mercury_bulk_proc.h"
 #include "mercury_error.h"
+#include "mercury_private.h"
 #include "mercury_proc.h"
 #include "mercury_proc_bulk.h"
 
 #include "mercury_hash_string.h"
 #include "mercury_mem.h"
 #include "mercury_thread_spin.h"
+#include "mercury_time.h"
 
 #include <assert.h>
 #include <stdlib.h>
@@ -32,6 +35,13 @@
 #define HG_HANDLE_CLASS(handle)                                                \
     ((struct hg_private_class *) ((handle)->info.hg_class))
 
+/* Inlining bulk data saves an RMA round-trip but copies data along with the
+ * RPC, the inline threshold is the amount of data that can be copied within
+ * one round-trip at this nominal rate (bytes/us) */
+#define HG_BULK_EAGER_RATE          (1024)
+#define HG_BULK_EAGER_THRESHOLD_MIN (512)
+#define HG_BULK_EAGER_THRESHOLD_MAX (1 << 30)
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -42,7 +52,10 @@ struct hg_private_class {
     hg_return_t (*handle_create)(hg_handle_t, void *); /* handle_create */
     void *handle_create_arg;                           /* handle_create arg */
     hg_thread_spin_t register_lock;                    /* Register lock */
+    struct hg_bulk_eager_class bulk_eager_class;       /* Eager bulk state */
     hg_bool_t bulk_eager;                              /* Eager bulk proc */
+    hg_bool_t bulk_compress;                           /* Compressed bulk */
+    hg_bool_t bulk_checksum;                           /* Checksummed bulk */
 };
 
 /* Info for function map */
@@ -53,6 +66,9 @@ struct hg_proc_info {
     void *data;                    /* User data */
     void (*free_callback)(void *); /* User data free callback */
     hg_bool_t no_response;         /* RPC response not expected */
+    hg_bool_t decode_views;        /* Decode byte arrays as buffer views */
+    hg_bool_t arena;               /* Decode allocations from proc arena */
+    hg_bool_t varint;              /* Encode integers as varints */
 };
 
 /* HG handle */
@@ -73,6 +89,18 @@ struct hg_private_handle {
     hg_bulk_t out_extra_bulk;     /* Extra output bulk handle */
     hg_size_t in_extra_buf_size;  /* Extra input buffer size */
     hg_size_t out_extra_buf_size; /* Extra output buffer size */
+    void *out_landing_buf;        /* Output landing buffer (origin) */
+    hg_size_t out_landing_buf_size;       /* Output landing buffer size */
+    hg_bulk_t out_landing_bulk;           /* Output landing bulk handle */
+    hg_bulk_t landing_bulk;               /* Origin landing handle (target) */
+    hg_size_t landing_push_size;          /* Output pushed to landing */
+    struct hg_bulk_eager_info bulk_eager; /* Eager bulk state */
+    hg_time_t forward_time;               /* Time of forward */
+    hg_bool_t rtt_sample;                 /* Sample round-trip time */
+    hg_atomic_int32_t respond_pending;    /* Pending push and encode */
+    hg_return_t respond_ret;              /* Push/encode return code */
+    hg_size_t respond_payload_size;       /* Encoded output size */
+    hg_uint8_t respond_flags;             /* Core respond flags */
 };
 
 /* HG op id */
@@ -165,6 +193,12 @@ static hg_return_t
 hg_free_struct(struct hg_private_handle *hg_handle,
     const struct hg_proc_info *hg_proc_info, hg_op_t op, void *struct_ptr);
 
+/**
+ * Get landing buffer advertised by the origin for oversized output.
+ */
+static hg_return_t
+hg_get_landing_bulk(struct hg_private_handle *hg_handle);
+
 /**
  * Get extra user payload using bulk transfer.
  */
@@ -184,6 +218,25 @@ hg_get_extra_payload_cb(const struct hg_cb_info *callback_info);
 static void
 hg_free_extra_payload(struct hg_private_handle *hg_handle);
 
+/**
+ * Copy bulk data returned ahead of output payload.
+ */
+static hg_return_t
+hg_get_eager_data(struct hg_private_handle *hg_handle);
+
+/**
+ * Record whether the target pulls compressed bulk data.
+ */
+static void
+hg_get_bulk_compress(struct hg_private_handle *hg_handle);
+
+/**
+ * Update round-trip time and inline threshold of eager bulk transfers.
+ */
+static void
+hg_bulk_eager_update(
+    struct hg_bulk_eager_class *hg_bulk_eager_class, hg_time_t forward_time);
+
 /**
  * Forward callback.
  */
@@ -196,6 +249,25 @@ hg_core_forward_cb(const struct hg_core_cb_info *callback_info);
 static HG_INLINE hg_return_t
 hg_core_respond_cb(const struct hg_core_cb_info *callback_info);
 
+/**
+ * Send response once both push and output encoding are done.
+ */
+static void
+hg_respond_with_bulk_send(struct hg_private_handle *hg_handle);
+
+/**
+ * Push callback.
+ */
+static hg_return_t
+hg_respond_with_bulk_cb(const struct hg_cb_info *callback_info);
+
+/**
+ * Push output to the origin's landing buffer (the caller must hold a count of
+ * respond_pending).
+ */
+static HG_INLINE hg_return_t
+hg_respond_landing_push(struct hg_private_handle *hg_handle);
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -248,6 +320,11 @@ hg_handle_create(struct hg_private_class *hg_class)
         hg_proc_create((hg_class_t *) hg_class, HG_CRC32, &hg_handle->out_proc);
     HG_CHECK_HG_ERROR(error, ret, "Cannot create HG proc");
 
+    /* Eager bulk state is shared by input and output procs */
+    hg_handle->bulk_eager.eager_class = &hg_class->bulk_eager_class;
+    hg_proc_set_bulk_eager(hg_handle->in_proc, &hg_handle->bulk_eager);
+    hg_proc_set_bulk_eager(hg_handle->out_proc, &hg_handle->bulk_eager);
+
     return hg_handle;
 
 error:
@@ -266,6 +343,9 @@ hg_handle_free(void *arg)
 
     if (hg_handle->handle.data_free_callback)
         hg_handle->handle.data_free_callback(hg_handle->handle.data);
+    hg_bulk_eager_write_release(&hg_handle->bulk_eager);
+    HG_Bulk_free(hg_handle->out_landing_bulk);
+    HG_Bulk_free(hg_handle->landing_bulk);
     if (hg_handle->in_proc != HG_PROC_NULL)
         hg_proc_free(hg_handle->in_proc);
     if (hg_handle->out_proc != HG_PROC_NULL)
@@ -358,6 +438,10 @@ hg_more_data_free_cb(hg_core_handle_t core_handle)
         return;
 
     hg_free_extra_payload(hg_handle);
+
+    /* Landing buffer is only valid for the request that carried it */
+    HG_Bulk_free(hg_handle->landing_bulk);
+    hg_handle->landing_bulk = HG_BULK_NULL;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -417,6 +501,7 @@ hg_get_struct(struct hg_private_handle *hg_handle,
 {
     hg_proc_t proc = HG_PROC_NULL;
     hg_proc_cb_t proc_cb = NULL;
+    hg_uint8_t proc_flags = 0;
     void *buf, *extra_buf;
     hg_size_t buf_size, extra_buf_size;
     struct hg_header *hg_header = &hg_handle->hg_header;
@@ -443,6 +528,9 @@ hg_get_struct(struct hg_private_handle *hg_handle,
 
             extra_buf = hg_handle->in_extra_buf;
             extra_buf_size = hg_handle->in_extra_buf_size;
+
+            /* Handles attached by a previous decode are no longer needed */
+            hg_bulk_eager_write_release(&hg_handle->bulk_eager);
             break;
         case HG_OUTPUT:
             /* Cannot respond if no_response flag set */
@@ -479,9 +567,31 @@ hg_get_struct(struct hg_private_handle *hg_handle,
     ret = hg_header_proc(HG_DECODE, buf, buf_size, hg_header);
     HG_CHECK_HG_ERROR(done, ret, "Could not process header");
 
-    /* If the payload did not fit into the core buffer and we have an extra
-     * buffer set, use that buffer directly */
-    if (extra_buf) {
+    /* Skip bulk data returned ahead of output payload */
+    if (op == HG_OUTPUT) {
+        header_offset += hg_header->msg.output.eager_size;
+        HG_CHECK_ERROR(header_offset > buf_size, done, ret, HG_PROTOCOL_ERROR,
+            "Invalid size of bulk data returned in response");
+    }
+
+    /* Skip output landing descriptor ahead of input payload */
+    if (op == HG_INPUT) {
+        header_offset += hg_header->msg.input.landing_size;
+        HG_CHECK_ERROR(header_offset > buf_size, done, ret, HG_PROTOCOL_ERROR,
+            "Invalid size of output landing descriptor");
+    }
+
+    if (op == HG_OUTPUT && hg_header->msg.output.landing_size > 0) {
+        /* Payload was pushed to our landing buffer */
+        HG_CHECK_ERROR(hg_header->msg.output.landing_size >
+                           hg_handle->out_landing_buf_size,
+            done, ret, HG_PROTOCOL_ERROR,
+            "Output exceeds size of landing buffer");
+        buf = hg_handle->out_landing_buf;
+        buf_size = hg_header->msg.output.landing_size;
+    } else if (extra_buf) {
+        /* If the payload did not fit into the core buffer and we have an extra
+         * buffer set, use that buffer directly */
         buf = extra_buf;
         buf_size = extra_buf_size;
     } else {
@@ -494,6 +604,30 @@ hg_get_struct(struct hg_private_handle *hg_handle,
     ret = hg_proc_reset(proc, buf, buf_size, HG_DECODE);
     HG_CHECK_HG_ERROR(done, ret, "Could not reset proc");
 
+#ifndef HG_HAS_XDR
+    /* Decoded data may point directly into the handle buffer */
+    if (hg_proc_info->decode_views)
+        proc_flags |= HG_PROC_VIEW;
+#endif
+
+    /* Decoded data may be allocated from the proc arena */
+    if (hg_proc_info->arena)
+        proc_flags |= HG_PROC_ARENA;
+
+#ifndef HG_HAS_XDR
+    /* Data pushed to bulk handles may be returned along with the response */
+    if (op == HG_INPUT && !hg_proc_info->no_response)
+        proc_flags |= HG_PROC_BULK_EAGER_WRITE;
+#endif
+
+#ifndef HG_HAS_XDR
+    /* Integers are encoded as varints */
+    if (hg_proc_info->varint)
+        proc_flags |= HG_PROC_VARINT;
+#endif
+
+    hg_proc_set_flags(proc, proc_flags);
+
     /* Decode parameters */
     ret = proc_cb(proc, struct_ptr);
     HG_CHECK_HG_ERROR(done, ret, "Could not decode parameters");
@@ -554,6 +688,9 @@ hg_set_struct(struct hg_private_handle *hg_handle,
             extra_buf = &hg_handle->in_extra_buf;
             extra_buf_size = &hg_handle->in_extra_buf_size;
             extra_bulk = &hg_handle->in_extra_bulk;
+
+            /* Handles reserved by a previous forward are no longer needed */
+            hg_bulk_eager_write_release(&hg_handle->bulk_eager);
             break;
         case HG_OUTPUT:
             /* Cannot respond if no_response flag set */
@@ -577,19 +714,68 @@ hg_set_struct(struct hg_private_handle *hg_handle,
             extra_buf = &hg_handle->out_extra_buf;
             extra_buf_size = &hg_handle->out_extra_buf_size;
             extra_bulk = &hg_handle->out_extra_bulk;
+            hg_handle->landing_push_size = 0;
             break;
         default:
             HG_GOTO_ERROR(done, ret, HG_INVALID_ARG, "Invalid HG op");
     }
+    /* Reset header */
+    hg_header_reset(hg_header, op);
+
+    /* Let the origin know that it can send compressed bulk data */
+    if (op == HG_OUTPUT && HG_HANDLE_CLASS(&hg_handle->handle)->bulk_compress)
+        hg_header->msg.output.flags |= HG_HEADER_BULK_COMPRESS;
+
+#ifndef HG_HAS_XDR
+    /* Return data pushed to bulk handles ahead of output payload */
+    if (op == HG_OUTPUT && hg_handle->bulk_eager.count > 0) {
+        hg_size_t eager_size = 0;
+
+        ret = hg_bulk_eager_write_encode(&hg_handle->bulk_eager,
+            (char *) buf + header_offset, buf_size - header_offset,
+            &eager_size);
+        hg_bulk_eager_write_release(&hg_handle->bulk_eager);
+        HG_CHECK_HG_ERROR(done, ret, "Could not encode inline bulk data");
+
+        hg_header->msg.output.eager_size = (hg_uint32_t) eager_size;
+        header_offset += eager_size;
+    }
+
+    /* Let the target push oversized output directly to our landing buffer */
+    if (op == HG_INPUT && hg_handle->out_landing_bulk != HG_BULK_NULL &&
+        !hg_proc_info->no_response &&
+        !HG_Core_addr_is_self(hg_handle->handle.core_handle->info.addr)) {
+        unsigned long bulk_flags = 0;
+        hg_size_t landing_size;
+
+#    ifdef NA_HAS_SM
+        if (HG_Core_addr_get_na_sm(hg_handle->handle.core_handle->info.addr) !=
+            NA_ADDR_NULL)
+            bulk_flags |= HG_BULK_SM;
+#    endif
+        landing_size =
+            HG_Bulk_get_serialize_size(hg_handle->out_landing_bulk, bulk_flags);
+        HG_CHECK_ERROR(header_offset + landing_size > buf_size, done, ret,
+            HG_OVERFLOW, "Output landing descriptor could not fit into buffer");
+
+        ret = HG_Bulk_serialize((char *) buf + header_offset, landing_size,
+            bulk_flags, hg_handle->out_landing_bulk);
+        HG_CHECK_HG_ERROR(
+            done, ret, "Could not serialize output landing descriptor");
+
+        hg_header->msg.input.landing_size = (hg_uint32_t) landing_size;
+        header_offset += landing_size;
+    }
+#endif
+
     if (!proc_cb || !struct_ptr) {
-        /* Silently skip */
+        /* Silently skip, only send header */
         *payload_size = header_offset;
+        ret = hg_header_proc(HG_ENCODE, buf, buf_size, hg_header);
+        HG_CHECK_HG_ERROR(done, ret, "Could not process header");
         goto done;
     }
 
-    /* Reset header */
-    hg_header_reset(hg_header, op);
-
     /* Include our own header offset */
     buf = (char *) buf + header_offset;
     buf_size -= header_offset;
@@ -607,9 +793,52 @@ hg_set_struct(struct hg_private_handle *hg_handle,
 
     /* Attempt to use eager bulk transfers when appropriate */
     if (HG_HANDLE_CLASS(&hg_handle->handle)->bulk_eager &&
-        !HG_Core_addr_is_self(hg_handle->handle.core_handle->info.addr))
+        !HG_Core_addr_is_self(hg_handle->handle.core_handle->info.addr)) {
         proc_flags |= HG_PROC_BULK_EAGER;
 
+#ifndef HG_HAS_XDR
+        /* Data pushed by the target may be returned along with the response,
+         * within half of the response buffer */
+        if (op == HG_INPUT && !hg_proc_info->no_response) {
+            void *out_buf;
+            hg_size_t out_buf_size,
+                out_header_size = hg_header_get_size(HG_OUTPUT) +
+                                  hg_handle->handle.info.hg_class->out_offset;
+
+            ret = HG_Core_get_output(
+                hg_handle->handle.core_handle, &out_buf, &out_buf_size);
+            HG_CHECK_HG_ERROR(done, ret, "Could not get output buffer");
+
+            hg_handle->bulk_eager.size_left =
+                (out_buf_size > out_header_size)
+                    ? (out_buf_size - out_header_size) / 2
+                    : 0;
+            proc_flags |= HG_PROC_BULK_EAGER_WRITE;
+        }
+#endif
+    }
+
+    /* Large read-only data may be pulled in compressed form by targets that
+     * support it, data must remain available until the response is received */
+    if (op == HG_INPUT && !hg_proc_info->no_response &&
+        HG_HANDLE_CLASS(&hg_handle->handle)->bulk_compress &&
+        !(proc_flags & HG_PROC_SM) &&
+        !HG_Core_addr_is_self(hg_handle->handle.core_handle->info.addr) &&
+        hg_core_addr_get_bulk_compress(
+            hg_handle->handle.core_handle->info.addr))
+        proc_flags |= HG_PROC_BULK_COMPRESS;
+
+    /* Read-only data may be verified by targets as it is pulled */
+    if (op == HG_INPUT && HG_HANDLE_CLASS(&hg_handle->handle)->bulk_checksum &&
+        !HG_Core_addr_is_self(hg_handle->handle.core_handle->info.addr))
+        proc_flags |= HG_PROC_BULK_CHECKSUM;
+
+#ifndef HG_HAS_XDR
+    /* Integers are encoded as varints */
+    if (hg_proc_info->varint)
+        proc_flags |= HG_PROC_VARINT;
+#endif
+
     hg_proc_set_flags(proc, proc_flags);
 
     /* Encode parameters */
@@ -652,6 +881,27 @@ hg_set_struct(struct hg_private_handle *hg_handle,
             extra_buf_size, HG_BULK_READ_ONLY, extra_bulk);
         HG_CHECK_HG_ERROR(done, ret, "Could not create bulk data handle");
 
+        /* Push payload to the origin's landing buffer if it fits, only the
+         * header is sent back and the origin does not need to pull */
+        if (op == HG_OUTPUT) {
+            ret = hg_get_landing_bulk(hg_handle);
+            HG_CHECK_HG_ERROR(done, ret, "Could not get output landing buffer");
+        }
+        if (op == HG_OUTPUT && hg_handle->landing_bulk != HG_BULK_NULL &&
+            *extra_buf_size <= HG_Bulk_get_size(hg_handle->landing_bulk) &&
+            *extra_buf_size <= UINT32_MAX) {
+            hg_header->msg.output.landing_size = (hg_uint32_t) *extra_buf_size;
+            hg_handle->landing_push_size = *extra_buf_size;
+
+            buf = (char *) buf - header_offset;
+            buf_size += header_offset;
+            ret = hg_header_proc(HG_ENCODE, buf, buf_size, hg_header);
+            HG_CHECK_HG_ERROR(done, ret, "Could not process header");
+
+            *payload_size = header_offset;
+            goto done;
+        }
+
         /* Reset proc */
         ret = hg_proc_reset(proc, buf, buf_size, HG_ENCODE);
         HG_CHECK_HG_ERROR(done, ret, "Could not reset proc");
@@ -755,13 +1005,27 @@ hg_free_struct(struct hg_private_handle *hg_handle,
     buf_size -= header_offset;
 #endif
 
-    /* Reset proc */
-    ret = hg_proc_reset(proc, buf, buf_size, HG_FREE);
-    HG_CHECK_HG_ERROR(done, ret, "Could not reset proc");
+    /* Arena-aware procs allocate all decoded data from the arena, there is
+     * nothing else to free */
+    if (!hg_proc_info->arena) {
+        /* Reset proc */
+        ret = hg_proc_reset(proc, buf, buf_size, HG_FREE);
+        HG_CHECK_HG_ERROR(done, ret, "Could not reset proc");
 
-    /* Free memory allocated during decode operation */
-    ret = proc_cb(proc, struct_ptr);
-    HG_CHECK_HG_ERROR(done, ret, "Could not free allocated parameters");
+#ifndef HG_HAS_XDR
+        /* Views were not allocated and must not be freed */
+        if (hg_proc_info->decode_views)
+            hg_proc_set_flags(proc, HG_PROC_VIEW);
+#endif
+
+        /* Free memory allocated during decode operation */
+        ret = proc_cb(proc, struct_ptr);
+        HG_CHECK_HG_ERROR(done, ret, "Could not free allocated parameters");
+    }
+
+    /* Release at once everything allocated from the arena */
+    ret = hg_proc_arena_reset(proc);
+    HG_CHECK_HG_ERROR(done, ret, "Could not reset proc arena");
 
     /* Decrement ref count or free */
     ret = HG_Core_destroy(hg_handle->handle.core_handle);
@@ -771,6 +1035,44 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_get_landing_bulk(struct hg_private_handle *hg_handle)
+{
+    struct hg_header hg_header;
+    hg_size_t header_offset = hg_header_get_size(HG_INPUT) +
+                              hg_handle->handle.info.hg_class->in_offset;
+    void *buf;
+    hg_size_t buf_size;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (hg_handle->landing_bulk != HG_BULK_NULL)
+        goto done;
+
+    /* Descriptor follows the input header in the request */
+    ret = HG_Core_get_input(hg_handle->handle.core_handle, &buf, &buf_size);
+    HG_CHECK_HG_ERROR(done, ret, "Could not get input buffer");
+
+    hg_header_reset(&hg_header, HG_INPUT);
+    ret = hg_header_proc(HG_DECODE, buf, buf_size, &hg_header);
+    HG_CHECK_HG_ERROR(done, ret, "Could not process header");
+
+    if (hg_header.msg.input.landing_size == 0)
+        goto done;
+    HG_CHECK_ERROR(header_offset + hg_header.msg.input.landing_size > buf_size,
+        done, ret, HG_PROTOCOL_ERROR,
+        "Invalid size of output landing descriptor");
+
+    ret = HG_Bulk_deserialize(hg_handle->handle.info.hg_class,
+        &hg_handle->landing_bulk, (char *) buf + header_offset,
+        hg_header.msg.input.landing_size);
+    HG_CHECK_HG_ERROR(
+        done, ret, "Could not deserialize output landing descriptor");
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
@@ -801,6 +1103,15 @@ hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
             extra_buf = &hg_handle->in_extra_buf;
             extra_buf_size = &hg_handle->in_extra_buf_size;
             extra_bulk = &hg_handle->in_extra_bulk;
+
+            /* Skip output landing descriptor ahead of input payload */
+            hg_header_reset(&hg_handle->hg_header, op);
+            ret = hg_header_proc(
+                HG_DECODE, buf, buf_size, &hg_handle->hg_header);
+            HG_CHECK_HG_ERROR(done, ret, "Could not process header");
+            header_offset += hg_handle->hg_header.msg.input.landing_size;
+            HG_CHECK_ERROR(header_offset > buf_size, done, ret,
+                HG_PROTOCOL_ERROR, "Invalid size of output landing descriptor");
             break;
         case HG_OUTPUT:
             /* Use custom header offset */
@@ -815,6 +1126,16 @@ hg_get_extra_payload(struct hg_private_handle *hg_handle, hg_op_t op,
             extra_buf = &hg_handle->out_extra_buf;
             extra_buf_size = &hg_handle->out_extra_buf_size;
             extra_bulk = &hg_handle->out_extra_bulk;
+
+            /* Skip bulk data returned ahead of output payload */
+            hg_header_reset(&hg_handle->hg_header, op);
+            ret = hg_header_proc(
+                HG_DECODE, buf, buf_size, &hg_handle->hg_header);
+            HG_CHECK_HG_ERROR(done, ret, "Could not process header");
+            header_offset += hg_handle->hg_header.msg.output.eager_size;
+            HG_CHECK_ERROR(header_offset > buf_size, done, ret,
+                HG_PROTOCOL_ERROR,
+                "Invalid size of bulk data returned in response");
             break;
         default:
             HG_GOTO_ERROR(done, ret, HG_INVALID_ARG, "Invalid HG op");
@@ -885,6 +1206,8 @@ hg_free_extra_payload(struct hg_private_handle *hg_handle)
     if (hg_handle->in_extra_buf) {
         HG_Bulk_free(hg_handle->in_extra_bulk);
         hg_handle->in_extra_bulk = HG_BULK_NULL;
+        HG_Bulk_reg_cache_invalidate(hg_handle->handle.info.hg_class,
+            hg_handle->in_extra_buf, hg_handle->in_extra_buf_size);
         hg_mem_aligned_free(hg_handle->in_extra_buf);
         hg_handle->in_extra_buf = NULL;
         hg_handle->in_extra_buf_size = 0;
@@ -893,26 +1216,140 @@ hg_free_extra_payload(struct hg_private_handle *hg_handle)
     if (hg_handle->out_extra_buf) {
         HG_Bulk_free(hg_handle->out_extra_bulk);
         hg_handle->out_extra_bulk = HG_BULK_NULL;
+        HG_Bulk_reg_cache_invalidate(hg_handle->handle.info.hg_class,
+            hg_handle->out_extra_buf, hg_handle->out_extra_buf_size);
         hg_mem_aligned_free(hg_handle->out_extra_buf);
         hg_handle->out_extra_buf = NULL;
         hg_handle->out_extra_buf_size = 0;
     }
 }
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_get_eager_data(struct hg_private_handle *hg_handle)
+{
+    hg_size_t header_offset = hg_header_get_size(HG_OUTPUT) +
+                              hg_handle->handle.info.hg_class->out_offset;
+    void *buf;
+    hg_size_t buf_size, eager_size;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Get core output buffer */
+    ret = HG_Core_get_output(hg_handle->handle.core_handle, &buf, &buf_size);
+    HG_CHECK_HG_ERROR(done, ret, "Could not get output buffer");
+
+    /* Get size of bulk data from header */
+    hg_header_reset(&hg_handle->hg_header, HG_OUTPUT);
+    ret = hg_header_proc(HG_DECODE, buf, buf_size, &hg_handle->hg_header);
+    HG_CHECK_HG_ERROR(done, ret, "Could not process header");
+    eager_size = hg_handle->hg_header.msg.output.eager_size;
+    HG_CHECK_ERROR(header_offset + eager_size > buf_size, done, ret,
+        HG_PROTOCOL_ERROR, "Invalid size of bulk data returned in response");
+
+    /* Copy data into bulk handles */
+    ret = hg_bulk_eager_write_decode(
+        &hg_handle->bulk_eager, (char *) buf + header_offset, eager_size);
+    HG_CHECK_HG_ERROR(done, ret, "Could not decode inline bulk data");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_get_bulk_compress(struct hg_private_handle *hg_handle)
+{
+    const struct hg_proc_info *hg_proc_info =
+        (const struct hg_proc_info *) HG_Core_get_rpc_data(
+            hg_handle->handle.core_handle);
+    hg_core_addr_t addr = hg_handle->handle.core_handle->info.addr;
+    struct hg_header hg_header;
+    void *buf;
+    hg_size_t buf_size;
+
+    /* No response to look at */
+    if (!hg_proc_info || hg_proc_info->no_response ||
+        HG_Core_addr_is_self(addr) || hg_core_addr_get_bulk_compress(addr))
+        return;
+
+    if (HG_Core_get_output(hg_handle->handle.core_handle, &buf, &buf_size) !=
+        HG_SUCCESS)
+        return;
+
+    hg_header_init(&hg_header, HG_OUTPUT);
+    if (hg_header_proc(HG_DECODE, buf, buf_size, &hg_header) == HG_SUCCESS &&
+        (hg_header.msg.output.flags & HG_HEADER_BULK_COMPRESS))
+        hg_core_addr_set_bulk_compress(addr);
+    hg_header_finalize(&hg_header);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_eager_update(
+    struct hg_bulk_eager_class *hg_bulk_eager_class, hg_time_t forward_time)
+{
+    hg_time_t now;
+    double sample_us;
+    hg_util_int32_t rtt, sample;
+    hg_size_t threshold;
+
+    hg_time_get_current(&now);
+    sample_us = hg_time_diff(now, forward_time) * 1000000.0;
+    sample = (sample_us < 1.0) ? 1
+             : (sample_us > (double) HG_BULK_EAGER_THRESHOLD_MAX)
+                 ? HG_BULK_EAGER_THRESHOLD_MAX
+                 : (hg_util_int32_t) sample_us;
+
+    /* Follow the lower envelope of samples so that time spent in RPC
+     * handlers does not inflate the round-trip time */
+    rtt = hg_atomic_get32(&hg_bulk_eager_class->rtt);
+    if (rtt == 0 || sample < rtt)
+        rtt = sample;
+    else
+        rtt += (sample - rtt) / 16;
+    hg_atomic_set32(&hg_bulk_eager_class->rtt, rtt);
+
+    threshold = (hg_size_t) rtt * HG_BULK_EAGER_RATE;
+    if (threshold < HG_BULK_EAGER_THRESHOLD_MIN)
+        threshold = HG_BULK_EAGER_THRESHOLD_MIN;
+    else if (threshold > HG_BULK_EAGER_THRESHOLD_MAX)
+        threshold = HG_BULK_EAGER_THRESHOLD_MAX;
+    hg_atomic_set32(
+        &hg_bulk_eager_class->threshold, (hg_util_int32_t) threshold);
+}
+
 /*---------------------------------------------------------------------------*/
 static HG_INLINE hg_return_t
 hg_core_forward_cb(const struct hg_core_cb_info *callback_info)
 {
     struct hg_private_handle *hg_handle =
         (struct hg_private_handle *) callback_info->arg;
+    hg_return_t cb_ret = callback_info->ret;
     hg_return_t ret = HG_SUCCESS;
 
+    if (hg_handle->rtt_sample && cb_ret == HG_SUCCESS)
+        hg_bulk_eager_update(
+            &HG_HANDLE_CLASS(&hg_handle->handle)->bulk_eager_class,
+            hg_handle->forward_time);
+    hg_handle->rtt_sample = HG_FALSE;
+
+    /* Learn whether the target pulls compressed bulk data */
+    if (cb_ret == HG_SUCCESS &&
+        HG_HANDLE_CLASS(&hg_handle->handle)->bulk_compress)
+        hg_get_bulk_compress(hg_handle);
+
+    /* Copy bulk data returned inline before completing, compressed copies
+     * are no longer needed either */
+    if (hg_handle->bulk_eager.count > 0 && cb_ret == HG_SUCCESS)
+        cb_ret = hg_get_eager_data(hg_handle);
+    hg_bulk_eager_write_release(&hg_handle->bulk_eager);
+
     /* Execute callback */
     if (hg_handle->forward_cb) {
         struct hg_cb_info hg_cb_info;
 
         hg_cb_info.arg = hg_handle->forward_arg;
-        hg_cb_info.ret = callback_info->ret;
+        hg_cb_info.ret = cb_ret;
         hg_cb_info.type = callback_info->type;
         hg_cb_info.info.forward.handle = (hg_handle_t) hg_handle;
 
@@ -945,6 +1382,75 @@ hg_core_respond_cb(const struct hg_core_cb_info *callback_info)
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static void
+hg_respond_with_bulk_send(struct hg_private_handle *hg_handle)
+{
+    hg_return_t ret = hg_handle->respond_ret;
+
+    if (ret == HG_SUCCESS) {
+        ret = HG_Core_respond(hg_handle->handle.core_handle,
+            hg_core_respond_cb, hg_handle, hg_handle->respond_flags,
+            hg_handle->respond_payload_size);
+        HG_CHECK_ERROR_NORET(ret != HG_SUCCESS, done, "Could not respond (%s)",
+            HG_Error_to_string(ret));
+    }
+
+done:
+    /* Response was not sent, report error to user */
+    if (ret != HG_SUCCESS && hg_handle->respond_cb) {
+        struct hg_cb_info hg_cb_info;
+
+        hg_cb_info.arg = hg_handle->respond_arg;
+        hg_cb_info.ret = ret;
+        hg_cb_info.type = HG_CB_RESPOND;
+        hg_cb_info.info.respond.handle = (hg_handle_t) hg_handle;
+
+        hg_handle->respond_cb(&hg_cb_info);
+    }
+
+    /* Release reference taken for the push */
+    (void) HG_Destroy((hg_handle_t) hg_handle);
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_respond_landing_push(struct hg_private_handle *hg_handle)
+{
+    hg_bool_t sync = hg_bulk_push_is_sync(hg_handle->handle.info.addr,
+        hg_handle->landing_bulk, 0, hg_handle->out_extra_bulk, 0,
+        hg_handle->landing_push_size);
+    hg_return_t ret;
+
+    /* Output has landed once the push is posted, no need to wait for it */
+    hg_atomic_incr32(&hg_handle->respond_pending);
+    ret = HG_Bulk_transfer_id(hg_handle->handle.info.context,
+        sync ? NULL : hg_respond_with_bulk_cb, hg_handle, HG_BULK_PUSH,
+        hg_handle->handle.info.addr, hg_handle->handle.info.context_id,
+        hg_handle->landing_bulk, 0, hg_handle->out_extra_bulk, 0,
+        hg_handle->landing_push_size, HG_OP_ID_IGNORE);
+    if (ret != HG_SUCCESS || sync)
+        hg_atomic_decr32(&hg_handle->respond_pending);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_respond_with_bulk_cb(const struct hg_cb_info *callback_info)
+{
+    struct hg_private_handle *hg_handle =
+        (struct hg_private_handle *) callback_info->arg;
+
+    if (callback_info->ret != HG_SUCCESS)
+        hg_handle->respond_ret = callback_info->ret;
+
+    if (hg_atomic_decr32(&hg_handle->respond_pending) == 0)
+        hg_respond_with_bulk_send(hg_handle);
+
+    return HG_SUCCESS;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Version_get(unsigned int *major, unsigned int *minor, unsigned int *patch)
@@ -1000,10 +1506,20 @@ HG_Init_opt(const char *na_info_string, hg_bool_t na_listen,
     /* Save bulk eager information */
     if (hg_init_info) {
         hg_class->bulk_eager = !hg_init_info->no_bulk_eager;
+        hg_class->bulk_compress = hg_init_info->bulk_compress;
+        hg_class->bulk_checksum = hg_init_info->bulk_checksum;
     } else {
         hg_class->bulk_eager = HG_TRUE;
     }
 
+    /* Inline threshold is only bounded by eager buffers until the round-trip
+     * time is measured */
+    hg_atomic_init64(&hg_class->bulk_eager_class.inlined_count, 0);
+    hg_atomic_init64(&hg_class->bulk_eager_class.rma_count, 0);
+    hg_atomic_init32(&hg_class->bulk_eager_class.rtt, 0);
+    hg_atomic_init32(
+        &hg_class->bulk_eager_class.threshold, HG_BULK_EAGER_THRESHOLD_MAX);
+
     hg_class->hg_class.core_class =
         HG_Core_init_opt(na_info_string, na_listen, hg_init_info);
     HG_CHECK_ERROR_NORET(hg_class->hg_class.core_class == NULL, error,
@@ -1075,6 +1591,33 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Class_get_bulk_eager_stats(
+    hg_class_t *hg_class, struct hg_bulk_eager_stats *stats)
+{
+    struct hg_private_class *private_class =
+        (struct hg_private_class *) hg_class;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+    HG_CHECK_ERROR(
+        stats == NULL, done, ret, HG_INVALID_ARG, "NULL stats pointer");
+
+    stats->inlined = (hg_uint64_t) hg_atomic_get64(
+        &private_class->bulk_eager_class.inlined_count);
+    stats->rma = (hg_uint64_t) hg_atomic_get64(
+        &private_class->bulk_eager_class.rma_count);
+    stats->threshold = (hg_size_t) hg_atomic_get32(
+        &private_class->bulk_eager_class.threshold);
+    stats->rtt =
+        (hg_uint32_t) hg_atomic_get32(&private_class->bulk_eager_class.rtt);
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_context_t *
 HG_Context_create(hg_class_t *hg_class)
@@ -1467,6 +2010,198 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Registered_enable_decode_views(
+    hg_class_t *hg_class, hg_id_t id, hg_bool_t enable)
+{
+    struct hg_private_class *private_class =
+        (struct hg_private_class *) hg_class;
+    struct hg_proc_info *hg_proc_info = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+#ifdef HG_HAS_XDR
+    HG_CHECK_ERROR(enable, done, ret, HG_OPNOTSUPPORTED,
+        "Decode views are not supported with XDR");
+#endif
+
+    hg_thread_spin_lock(&private_class->register_lock);
+
+    /* Retrieve proc function from function map */
+    hg_proc_info = (struct hg_proc_info *) HG_Core_registered_data(
+        hg_class->core_class, id);
+    HG_CHECK_ERROR(hg_proc_info == NULL, unlock, ret, HG_NOENTRY,
+        "Could not get registered data");
+
+    hg_proc_info->decode_views = enable;
+
+unlock:
+    hg_thread_spin_unlock(&private_class->register_lock);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Registered_enabled_decode_views(
+    hg_class_t *hg_class, hg_id_t id, hg_bool_t *enabled)
+{
+    struct hg_private_class *private_class =
+        (struct hg_private_class *) hg_class;
+    struct hg_proc_info *hg_proc_info = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+    HG_CHECK_ERROR(enabled == NULL, done, ret, HG_INVALID_ARG,
+        "NULL pointer to enabled flag");
+
+    hg_thread_spin_lock(&private_class->register_lock);
+
+    /* Retrieve proc function from function map */
+    hg_proc_info = (struct hg_proc_info *) HG_Core_registered_data(
+        hg_class->core_class, id);
+    HG_CHECK_ERROR(hg_proc_info == NULL, unlock, ret, HG_NOENTRY,
+        "Could not get registered data");
+
+    *enabled = hg_proc_info->decode_views;
+
+unlock:
+    hg_thread_spin_unlock(&private_class->register_lock);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Registered_enable_arena(hg_class_t *hg_class, hg_id_t id, hg_bool_t enable)
+{
+    struct hg_private_class *private_class =
+        (struct hg_private_class *) hg_class;
+    struct hg_proc_info *hg_proc_info = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+
+    hg_thread_spin_lock(&private_class->register_lock);
+
+    /* Retrieve proc function from function map */
+    hg_proc_info = (struct hg_proc_info *) HG_Core_registered_data(
+        hg_class->core_class, id);
+    HG_CHECK_ERROR(hg_proc_info == NULL, unlock, ret, HG_NOENTRY,
+        "Could not get registered data");
+
+    hg_proc_info->arena = enable;
+
+unlock:
+    hg_thread_spin_unlock(&private_class->register_lock);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Registered_enabled_arena(
+    hg_class_t *hg_class, hg_id_t id, hg_bool_t *enabled)
+{
+    struct hg_private_class *private_class =
+        (struct hg_private_class *) hg_class;
+    struct hg_proc_info *hg_proc_info = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+    HG_CHECK_ERROR(enabled == NULL, done, ret, HG_INVALID_ARG,
+        "NULL pointer to enabled flag");
+
+    hg_thread_spin_lock(&private_class->register_lock);
+
+    /* Retrieve proc function from function map */
+    hg_proc_info = (struct hg_proc_info *) HG_Core_registered_data(
+        hg_class->core_class, id);
+    HG_CHECK_ERROR(hg_proc_info == NULL, unlock, ret, HG_NOENTRY,
+        "Could not get registered data");
+
+    *enabled = hg_proc_info->arena;
+
+unlock:
+    hg_thread_spin_unlock(&private_class->register_lock);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Registered_enable_varint(hg_class_t *hg_class, hg_id_t id, hg_bool_t enable)
+{
+    struct hg_private_class *private_class =
+        (struct hg_private_class *) hg_class;
+    struct hg_proc_info *hg_proc_info = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+#ifdef HG_HAS_XDR
+    HG_CHECK_ERROR(enable, done, ret, HG_OPNOTSUPPORTED,
+        "Varint encoding is not supported with XDR");
+#endif
+
+    hg_thread_spin_lock(&private_class->register_lock);
+
+    /* Retrieve proc function from function map */
+    hg_proc_info = (struct hg_proc_info *) HG_Core_registered_data(
+        hg_class->core_class, id);
+    HG_CHECK_ERROR(hg_proc_info == NULL, unlock, ret, HG_NOENTRY,
+        "Could not get registered data");
+
+    hg_proc_info->varint = enable;
+
+unlock:
+    hg_thread_spin_unlock(&private_class->register_lock);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Registered_enabled_varint(
+    hg_class_t *hg_class, hg_id_t id, hg_bool_t *enabled)
+{
+    struct hg_private_class *private_class =
+        (struct hg_private_class *) hg_class;
+    struct hg_proc_info *hg_proc_info = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+    HG_CHECK_ERROR(enabled == NULL, done, ret, HG_INVALID_ARG,
+        "NULL pointer to enabled flag");
+
+    hg_thread_spin_lock(&private_class->register_lock);
+
+    /* Retrieve proc function from function map */
+    hg_proc_info = (struct hg_proc_info *) HG_Core_registered_data(
+        hg_class->core_class, id);
+    HG_CHECK_ERROR(hg_proc_info == NULL, unlock, ret, HG_NOENTRY,
+        "Could not get registered data");
+
+    *enabled = hg_proc_info->varint;
+
+unlock:
+    hg_thread_spin_unlock(&private_class->register_lock);
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Addr_lookup1(hg_context_t *context, hg_cb_t callback, void *arg,
@@ -1910,6 +2645,40 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Set_output_landing_buf(hg_handle_t handle, void *buf, hg_size_t buf_size)
+{
+    struct hg_private_handle *private_handle =
+        (struct hg_private_handle *) handle;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        handle == HG_HANDLE_NULL, done, ret, HG_INVALID_ARG, "NULL HG handle");
+
+    /* Release previous landing buffer */
+    ret = HG_Bulk_free(private_handle->out_landing_bulk);
+    HG_CHECK_HG_ERROR(done, ret, "Could not free landing bulk handle (%s)",
+        HG_Error_to_string(ret));
+    private_handle->out_landing_bulk = HG_BULK_NULL;
+    private_handle->out_landing_buf = NULL;
+    private_handle->out_landing_buf_size = 0;
+
+    if (buf == NULL || buf_size == 0)
+        goto done;
+
+    /* Register buffer once, it is reused by every forward on this handle */
+    ret = HG_Bulk_create(handle->info.hg_class, 1, &buf, &buf_size,
+        HG_BULK_WRITE_ONLY, &private_handle->out_landing_bulk);
+    HG_CHECK_HG_ERROR(done, ret, "Could not create landing bulk handle (%s)",
+        HG_Error_to_string(ret));
+    private_handle->out_landing_buf = buf;
+    private_handle->out_landing_buf_size = buf_size;
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Forward(hg_handle_t handle, hg_cb_t callback, void *arg, void *in_struct)
@@ -1951,6 +2720,13 @@ HG_Forward(hg_handle_t handle, hg_cb_t callback, void *arg, void *in_struct)
     if (hg_proc_info->no_response)
         flags |= HG_CORE_NO_RESPONSE;
 
+    /* Sample round-trip time to adapt eager bulk threshold */
+    private_handle->rtt_sample =
+        HG_HANDLE_CLASS(handle)->bulk_eager && !hg_proc_info->no_response &&
+        !HG_Core_addr_is_self(handle->core_handle->info.addr);
+    if (private_handle->rtt_sample)
+        hg_time_get_current(&private_handle->forward_time);
+
     /* Send request */
     ret = HG_Core_forward(
         handle->core_handle, hg_core_forward_cb, handle, flags, payload_size);
@@ -1998,6 +2774,25 @@ HG_Respond(hg_handle_t handle, hg_cb_t callback, void *arg, void *out_struct)
     if (more_data)
         flags |= HG_CORE_MORE_DATA;
 
+    /* Send response back once the output has landed at the origin */
+    if (private_handle->landing_push_size > 0) {
+        ret = HG_Core_ref_incr(handle->core_handle);
+        HG_CHECK_HG_ERROR(done, ret,
+            "Could not increment handle ref count (%s)",
+            HG_Error_to_string(ret));
+        hg_atomic_set32(&private_handle->respond_pending, 1);
+        private_handle->respond_ret = HG_SUCCESS;
+        private_handle->respond_payload_size = payload_size;
+        private_handle->respond_flags = flags;
+
+        ret = hg_respond_landing_push(private_handle);
+        HG_CHECK_HG_ERROR(error, ret, "Could not push output (%s)",
+            HG_Error_to_string(ret));
+        if (hg_atomic_decr32(&private_handle->respond_pending) == 0)
+            hg_respond_with_bulk_send(private_handle);
+        goto done;
+    }
+
     /* Send response back */
     ret = HG_Core_respond(
         handle->core_handle, hg_core_respond_cb, handle, flags, payload_size);
@@ -2006,6 +2801,95 @@ HG_Respond(hg_handle_t handle, hg_cb_t callback, void *arg, void *out_struct)
 
 done:
     return ret;
+
+error:
+    (void) HG_Destroy(handle);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Respond_with_bulk(hg_handle_t handle, hg_cb_t callback, void *arg,
+    void *out_struct, hg_bulk_t origin_handle, hg_size_t origin_offset,
+    hg_bulk_t local_handle, hg_size_t local_offset, hg_size_t size)
+{
+    struct hg_private_handle *private_handle =
+        (struct hg_private_handle *) handle;
+    const struct hg_proc_info *hg_proc_info;
+    hg_bool_t more_data = HG_FALSE, sync;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        handle == HG_HANDLE_NULL, done, ret, HG_INVALID_ARG, "NULL HG handle");
+
+    /* Data is returned along with the response, nothing to wait for */
+    if (hg_bulk_eager_write_push(
+            origin_handle, origin_offset, local_handle, local_offset, size))
+        return HG_Respond(handle, callback, arg, out_struct);
+
+    /* Set callback data */
+    private_handle->respond_cb = callback;
+    private_handle->respond_arg = arg;
+
+    /* Retrieve RPC data */
+    hg_proc_info =
+        (const struct hg_proc_info *) HG_Core_get_rpc_data(handle->core_handle);
+    HG_CHECK_ERROR(
+        hg_proc_info == NULL, done, ret, HG_FAULT, "Could not get proc info");
+
+    /* When the data has landed at the origin once the push is posted (local
+     * copy or NA SM), the response can be sent right after, otherwise it is
+     * sent from the push callback */
+    sync = hg_bulk_push_is_sync(handle->info.addr, origin_handle,
+        origin_offset, local_handle, local_offset, size);
+
+    /* Keep handle until the response is sent */
+    ret = HG_Core_ref_incr(handle->core_handle);
+    HG_CHECK_HG_ERROR(done, ret, "Could not increment handle ref count (%s)",
+        HG_Error_to_string(ret));
+    hg_atomic_set32(&private_handle->respond_pending, sync ? 1 : 2);
+    private_handle->respond_ret = HG_SUCCESS;
+
+    ret = HG_Bulk_transfer_id(handle->info.context,
+        sync ? NULL : hg_respond_with_bulk_cb, private_handle, HG_BULK_PUSH,
+        handle->info.addr, handle->info.context_id, origin_handle,
+        origin_offset, local_handle, local_offset, size, HG_OP_ID_IGNORE);
+    HG_CHECK_HG_ERROR(error, ret, "Could not push bulk data (%s)",
+        HG_Error_to_string(ret));
+
+    /* Output can be encoded while the push is in flight */
+    ret = hg_set_struct(private_handle, hg_proc_info, HG_OUTPUT, out_struct,
+        &private_handle->respond_payload_size, &more_data);
+    if (ret != HG_SUCCESS) {
+        HG_LOG_ERROR("Could not set output (%s)", HG_Error_to_string(ret));
+
+        /* Error is returned here, do not trigger callback */
+        private_handle->respond_cb = NULL;
+        private_handle->respond_ret = ret;
+    }
+    private_handle->respond_flags = more_data ? HG_CORE_MORE_DATA : 0;
+
+    /* Output is also pushed if it goes to the origin's landing buffer */
+    if (ret == HG_SUCCESS && private_handle->landing_push_size > 0) {
+        ret = hg_respond_landing_push(private_handle);
+        if (ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not push output (%s)", HG_Error_to_string(ret));
+            private_handle->respond_cb = NULL;
+            private_handle->respond_ret = ret;
+        }
+    }
+
+    if (hg_atomic_decr32(&private_handle->respond_pending) == 0)
+        hg_respond_with_bulk_send(private_handle);
+
+done:
+    return ret;
+
+error:
+    (void) HG_Destroy(handle);
+
+    return ret;
 }
 
 /*---------------------------------------------------------------------------*/
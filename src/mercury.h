@@ -239,6 +239,24 @@ HG_PUBLIC hg_return_t
 HG_Class_set_handle_create_callback(hg_class_t *hg_class,
     hg_return_t (*callback)(hg_handle_t, void *), void *arg);
 
+/**
+ * Retrieve statistics of eager bulk transfers. Small bulk handles passed
+ * as RPC arguments can have their data inlined in the RPC request (read-only
+ * handles) or in the RPC response (write-only handles, data pushed by the
+ * target is then returned along with the response), instead of being
+ * transferred through RMA. Data is only inlined below a threshold that is
+ * adapted to the RPC round-trip time measured on that class and within the
+ * room left in eager buffers.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param stats [OUT]           pointer to returned statistics
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Class_get_bulk_eager_stats(
+    hg_class_t *hg_class, struct hg_bulk_eager_stats *stats);
+
 /**
  * Create a new context. Must be destroyed by calling HG_Context_destroy().
  *
@@ -479,6 +497,107 @@ HG_PUBLIC hg_return_t
 HG_Registered_disabled_response(
     hg_class_t *hg_class, hg_id_t id, hg_bool_t *disabled);
 
+/**
+ * Enable decode views for a given RPC ID. When enabled, hg_const_string_t
+ * fields and byte arrays processed with hg_proc_bytes_view() are not copied
+ * when decoding the input/output but point directly into the handle's receive
+ * buffer. Decoded data therefore remains valid only until HG_Free_input() or
+ * HG_Free_output() is called. By default, decoded data is allocated and
+ * copied. Not supported when using XDR encoding.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               registered function ID
+ * \param enable [IN]           boolean (HG_TRUE to enable
+ *                                       HG_FALSE to disable)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Registered_enable_decode_views(
+    hg_class_t *hg_class, hg_id_t id, hg_bool_t enable);
+
+/**
+ * Check if decode views are enabled for a given RPC ID
+ * (i.e., HG_Registered_enable_decode_views() has been called for this RPC ID).
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               registered function ID
+ * \param enabled [OUT]         boolean (HG_TRUE if enabled
+ *                                       HG_FALSE if disabled)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Registered_enabled_decode_views(
+    hg_class_t *hg_class, hg_id_t id, hg_bool_t *enabled);
+
+/**
+ * Mark the procs of a given RPC ID as arena-aware. When enabled, decoded
+ * strings and byte arrays are allocated from the proc arena (see
+ * hg_proc_alloc()) and HG_Free_input() / HG_Free_output() no longer call the
+ * proc callbacks with HG_FREE but release all decoded data at once. Procs of
+ * that RPC must therefore allocate all decoded data using hg_proc_alloc() and
+ * must not decode types that require an explicit free (e.g., bulk handles).
+ * By default, arena is disabled.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               registered function ID
+ * \param enable [IN]           boolean (HG_TRUE to enable
+ *                                       HG_FALSE to disable)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Registered_enable_arena(hg_class_t *hg_class, hg_id_t id, hg_bool_t enable);
+
+/**
+ * Check if arena is enabled for a given RPC ID
+ * (i.e., HG_Registered_enable_arena() has been called for this RPC ID).
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               registered function ID
+ * \param enabled [OUT]         boolean (HG_TRUE if enabled
+ *                                       HG_FALSE if disabled)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Registered_enabled_arena(
+    hg_class_t *hg_class, hg_id_t id, hg_bool_t *enabled);
+
+/**
+ * Encode 32-bit and 64-bit integers of a given RPC ID as variable-length
+ * integers (LEB128, zigzag for signed types) instead of their fixed width,
+ * which reduces the size of messages carrying small values (IDs, sizes,
+ * counts). This changes the wire format of that RPC, it must therefore be
+ * enabled on both origin and target. Not supported with XDR.
+ * By default, varint encoding is disabled.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               registered function ID
+ * \param enable [IN]           boolean (HG_TRUE to enable
+ *                                       HG_FALSE to disable)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Registered_enable_varint(hg_class_t *hg_class, hg_id_t id, hg_bool_t enable);
+
+/**
+ * Check if varint encoding is enabled for a given RPC ID
+ * (i.e., HG_Registered_enable_varint() has been called for this RPC ID).
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param id [IN]               registered function ID
+ * \param enabled [OUT]         boolean (HG_TRUE if enabled
+ *                                       HG_FALSE if disabled)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Registered_enabled_varint(
+    hg_class_t *hg_class, hg_id_t id, hg_bool_t *enabled);
+
 /**
  * Lookup an addr from a peer address/name. Addresses need to be
  * freed by calling HG_Addr_free(). After completion, user callback is
@@ -835,6 +954,25 @@ HG_PUBLIC hg_return_t
 HG_Get_output_extra_buf(
     hg_handle_t handle, void **out_buf, hg_size_t *out_buf_size);
 
+/**
+ * Set a buffer on the origin side of the handle in which outputs that do not
+ * fit into an eager buffer are received. The buffer is registered once and
+ * advertised with each subsequent call to HG_Forward(), so that the target
+ * can push the output directly into it instead of having the origin pull
+ * it and acknowledge the transfer. Outputs larger than the buffer use the
+ * default path. The buffer must remain valid, and must not be reused, until
+ * HG_Free_output() is called or until it is replaced. Passing a NULL buffer
+ * removes any buffer previously set.
+ *
+ * \param handle [IN]           HG handle
+ * \param buf [IN]              pointer to landing buffer
+ * \param buf_size [IN]         landing buffer size
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Set_output_landing_buf(hg_handle_t handle, void *buf, hg_size_t buf_size);
+
 /**
  * Set target context ID that will receive and process the RPC request
  * (ID is defined on target context creation, see HG_Context_create_id()).
@@ -890,6 +1028,35 @@ HG_Forward(hg_handle_t handle, hg_cb_t callback, void *arg, void *in_struct);
 HG_PUBLIC hg_return_t
 HG_Respond(hg_handle_t handle, hg_cb_t callback, void *arg, void *out_struct);
 
+/**
+ * Push data to the origin and respond using an existing HG handle. Data
+ * is pushed from local_handle to origin_handle, as with HG_Bulk_transfer(),
+ * and the output structure is serialized while the push is in flight. The
+ * response is sent as soon as the push completes, without going through a
+ * separate user callback. Small pushes to handles that the origin marked as
+ * inlinable are copied into the response and do not wait at all, neither do
+ * pushes that complete while being posted (self and shared-memory). After
+ * the response completes, user callback is placed into a completion queue
+ * and can be triggered using HG_Trigger(). If the push fails, no response
+ * is sent and the callback is passed the error.
+ *
+ * \param handle [IN]           HG handle
+ * \param callback [IN]         pointer to function callback
+ * \param arg [IN]              pointer to data passed to callback
+ * \param out_struct [IN]       pointer to output structure
+ * \param origin_handle [IN]    abstract bulk handle received from origin
+ * \param origin_offset [IN]    offset
+ * \param local_handle [IN]     abstract bulk handle
+ * \param local_offset [IN]     offset
+ * \param size [IN]             size of data to be pushed
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Respond_with_bulk(hg_handle_t handle, hg_cb_t callback, void *arg,
+    void *out_struct, hg_bulk_t origin_handle, hg_size_t origin_offset,
+    hg_bulk_t local_handle, hg_size_t local_offset, hg_size_t size);
+
 /**
  * Try to progress RPC execution for at most timeout until timeout is reached or
  * any completion has occurred.
@@ -15,9 +15,15 @@
 #include "mercury_private.h"
 
 #include "mercury_atomic.h"
+#include "mercury_atomic_queue.h"
+#include "mercury_compress.h"
+#include "mercury_crc32c.h"
+#include "mercury_hash_table.h"
 #include "mercury_list.h"
+#include "mercury_mem.h"
 #include "mercury_thread_condition.h"
 #include "mercury_thread_spin.h"
+#include "mercury_time.h"
 
 #include <stdlib.h>
 #include <string.h>
@@ -35,10 +41,46 @@
 #define HG_BULK_REGV  (1 << 6) /* single registration for multiple segments */
 #define HG_BULK_VIRT  (1 << 7) /* addresses are virtual */
 
+/* Extended internal bulk flags */
+#define HG_BULK_OFFSET (1 << 0) /* data starts at offset of NA handle */
+#define HG_BULK_RESP   (1 << 1) /* pushed data returned in RPC response */
+#define HG_BULK_COMPRESSED                                                     \
+    (1 << 2) /* compressed copy of data follows descriptor */
+#define HG_BULK_CHECKSUMMED                                                    \
+    (1 << 3) /* checksums of data blocks follow descriptor */
+
+/* Internal serialize flag, compressed copy is described after descriptor */
+#define HG_BULK_COMPRESS (1 << 9)
+
+/* Min size of data compressed (blocks are compressed independently and may
+ * be stored as is if they do not compress) */
+#define HG_BULK_COMPRESS_MIN_SIZE (1 << 16)
+
+/* Status of compressed copy kept by handle */
+#define HG_BULK_COMPRESS_BUSY (1 << 0) /* copy is attached to an RPC */
+#define HG_BULK_COMPRESS_NONE (1 << 1) /* data does not compress */
+
+/* Blocks of data that are compressed or checksummed */
+#define HG_BULK_BLOCK_SIZE_MIN (1 << 16) /* Min size of blocks */
+#define HG_BULK_BLOCK_MAX      (128)     /* Max number of blocks */
+#define HG_BULK_BLOCK_WINDOW   (4)       /* Blocks pulled at once */
+
+/* Data of read-only handles that is not sent eagerly can be checksummed */
+#define HG_BULK_CHECKSUM_ENABLED(hg_bulk, flags)                               \
+    (((flags) &HG_BULK_CHECKSUM) &&                                            \
+        ((hg_bulk)->desc.info.flags & HG_BULK_READWRITE) ==                    \
+            HG_BULK_READ_ONLY &&                                               \
+        !((hg_bulk)->desc.info.flags & HG_BULK_VIRT) &&                        \
+        !((flags) &HG_BULK_EAGER) && (hg_bulk)->desc.info.len > 0)
+
+/* Period after which unused op IDs of a grown pool are released (ms) */
+#define HG_BULK_OP_POOL_IDLE_TIME (1000)
+
 /* Op ID status bits */
 #define HG_BULK_OP_COMPLETED (1 << 0)
 #define HG_BULK_OP_CANCELED  (1 << 1)
 #define HG_BULK_OP_ERRORED   (1 << 2)
+#define HG_BULK_OP_CHECKSUM  (1 << 3) /* Data does not match checksum */
 
 /* Encode type */
 #define HG_BULK_TYPE_ENCODE(label, ret, buf_ptr, buf_size_left, data, size)    \
@@ -84,6 +126,10 @@
     ((x)->desc.info.segment_count > HG_BULK_STATIC_MAX) ? (x)->desc.segments.d \
                                                         : (x)->desc.segments.s
 
+/* Dynamic segment arrays are followed by the offset of each segment */
+#define HG_BULK_SEGMENT_OFFSETS(segments, count)                               \
+    ((hg_size_t *) ((segments) + (count)))
+
 #define HG_BULK_MEM_HANDLES(x, count, flags)                                   \
     (count > HG_BULK_STATIC_MAX && !(flags & HG_BULK_REGV)) ? (x)->handles.d   \
                                                             : (x)->handles.s
@@ -149,6 +195,13 @@ struct hg_bulk_desc {
     } segments;                                       /* Remain last */
 };
 
+/* HG bulk strided layout */
+struct hg_bulk_stride {
+    struct hg_bulk_vector vectors[HG_BULK_VECTOR_MAX]; /* Nested vectors */
+    hg_ptr_t base;                                     /* Address of block */
+    hg_size_t block_len;                               /* Size of blocks */
+};
+
 /* NA descriptors */
 struct hg_bulk_na_mem_desc {
     union {
@@ -164,20 +217,69 @@ struct hg_bulk_na_mem_desc {
 /* HG bulk handle */
 struct hg_bulk {
     struct hg_bulk_desc desc;                /* Bulk descriptor   */
+    struct hg_bulk_stride stride;            /* Strided layout    */
     struct hg_bulk_na_mem_desc na_mem_descs; /* NA memory handles */
 #ifdef NA_HAS_SM
     struct hg_bulk_na_mem_desc na_sm_mem_descs; /* NA SM memory handles */
 #endif
-    hg_core_class_t *core_class; /* HG core class */
-    na_class_t *na_class;        /* NA class */
+    hg_core_class_t *core_class;         /* HG core class */
+    na_class_t *na_class;                /* NA class */
+    struct hg_bulk_reg_cache *reg_cache; /* Registration cache */
 #ifdef NA_HAS_SM
-    na_class_t *na_sm_class; /* NA SM class */
+    na_class_t *na_sm_class;                /* NA SM class */
+    struct hg_bulk_reg_cache *reg_sm_cache; /* SM registration cache */
 #endif
     hg_core_addr_t addr;         /* Addr (valid if bound to handle) */
+    struct hg_bulk *parent;      /* Handle owning NA handles (if shared) */
+    hg_size_t mem_offset;        /* Offset of data in NA handle */
     void *serialize_ptr;         /* Cached serialization buffer */
     hg_size_t serialize_size;    /* Cached serialization size */
     hg_atomic_int32_t ref_count; /* Reference count */
     hg_uint8_t context_id;       /* Context ID (valid if bound to handle) */
+    hg_bool_t desc_cached;       /* Shared through descriptor cache */
+    struct hg_bulk_eager_write *eager_write; /* Data returned in response */
+    struct hg_bulk_compressed *compressed;   /* Compressed copy of data */
+    struct hg_bulk_checksum *checksum;       /* Checksums of origin data */
+    struct hg_bulk *compress_copy;     /* Compressed copy reused by RPCs */
+    hg_atomic_int32_t compress_status; /* Status of compressed copy */
+};
+
+/* HG bulk checksums of blocks of origin data (target only) */
+struct hg_bulk_checksum {
+    hg_uint32_t *crcs;       /* CRC32C of each block */
+    hg_size_t block_size;    /* Size of blocks */
+    hg_uint32_t block_count; /* Number of blocks */
+};
+
+/* HG bulk compressed copy (on the origin, blocks are stored in the segment of
+ * the copy, on the target, they are pulled from the region handle) */
+struct hg_bulk_compressed {
+    struct hg_bulk *region;  /* Handle of remote compressed blocks */
+    hg_size_t *offsets;      /* Offsets of blocks (block_count + 1) */
+    hg_uint32_t *crcs;       /* CRC32C of blocks (origin, if checksummed) */
+    hg_size_t block_size;    /* Size of uncompressed blocks */
+    hg_uint32_t block_count; /* Number of blocks */
+};
+
+/* HG bulk data pushed by the target and returned in the RPC response */
+struct hg_bulk_eager_write {
+    void *buf;             /* Staging buffer (NULL once response is sent) */
+    hg_size_t len;         /* Size of staging buffer */
+    hg_size_t start;       /* Start of range written */
+    hg_size_t end;         /* End of range written */
+    hg_thread_spin_t lock; /* Lock */
+};
+
+/* HG bulk pool */
+struct hg_bulk_pool {
+    struct hg_bulk *hg_bulk;            /* Handle owning buffers */
+    struct hg_bulk **blocks;            /* Handles of buffers */
+    hg_atomic_int32_t *in_use;          /* Buffers retrieved from pool */
+    struct hg_atomic_queue *free_queue; /* Handles of free buffers */
+    void *buf;                          /* Buffers */
+    hg_size_t len;                      /* Size of buffers */
+    hg_size_t block_stride;             /* Distance between buffers */
+    hg_uint32_t count;                  /* Number of buffers */
 };
 
 /* HG bulk NA op IDs (not a union as we re-use op IDs) */
@@ -204,6 +306,10 @@ struct hg_bulk_op_id {
     hg_atomic_int32_t status;             /* Operation status */
     hg_atomic_int32_t op_completed_count; /* Number of operations completed */
     hg_atomic_int32_t ref_count;          /* Refcount */
+    struct hg_bulk_pipeline *pipeline;    /* Pipelined transfer */
+    struct hg_bulk_na_window *window;     /* Windowed NA operations */
+    struct hg_bulk_transfer_desc *batch;  /* Batched transfers */
+    hg_uint32_t batch_count;              /* Number of batched transfers */
     hg_uint32_t op_count;                 /* Number of ongoing operations */
     hg_bool_t reuse;                      /* Re-use op ID once ref_count is 0 */
 };
@@ -215,10 +321,103 @@ struct hg_bulk_op_pool {
     hg_core_context_t *core_context;          /* Context */
     HG_LIST_HEAD(hg_bulk_op_id) pending_list; /* Pending op IDs */
     hg_thread_spin_t pending_list_lock;       /* Pending list lock */
+    hg_time_t trim_time;                      /* End of idle period */
     unsigned long count;                      /* Number of op IDs */
+    unsigned long free_count;                 /* Number of pending op IDs */
+    unsigned long min_free_count;             /* Min pending since trim */
+    unsigned long na_op_count;                /* Number of NA op IDs */
+    unsigned long window_count;               /* Number of op windows */
+    unsigned int init_count;                  /* Initial number of op IDs */
+    unsigned int max_count;                   /* Max op IDs (0 if none) */
+    hg_atomic_int32_t unpooled_count;         /* Op IDs past max_count */
     hg_bool_t extending;                      /* When extending the pool */
 };
 
+/* Chunk of pipelined transfer */
+struct hg_bulk_pipeline_chunk {
+    struct hg_bulk_pipeline *pipeline; /* Pipeline that chunk belongs to */
+    struct hg_bulk_op_id *op_id;       /* Op ID of chunk transfer */
+    void *buf;                         /* Decompressed block (if needed) */
+    hg_size_t offset;                  /* Offset of chunk within transfer */
+    hg_size_t size;                    /* Size of chunk */
+    hg_uint32_t gen;                   /* Incremented each time chunk is used */
+    hg_uint32_t block;                 /* Origin block of chunk */
+    hg_bool_t busy;                    /* Chunk is in flight */
+    hg_bool_t staged;                  /* Block pulled into staging slot */
+};
+
+/* Pipelined transfer (chunks are issued within a bounded window) */
+struct hg_bulk_pipeline {
+    hg_thread_mutex_t mutex;               /* Pipeline lock */
+    struct hg_bulk_pipeline_chunk *chunks; /* Array of window chunks */
+    struct hg_bulk_op_id *op_id;           /* Op ID of pipelined transfer */
+    hg_bulk_chunk_cb_t chunk_callback;     /* Chunk callback */
+    struct hg_bulk_compressed *compressed; /* Compressed origin (if any) */
+    struct hg_bulk_checksum *checksum;     /* Origin checksums (if any) */
+    struct hg_bulk *staging;               /* Whole blocks of chunks */
+    struct hg_core_addr *origin_addr;      /* Origin address */
+    hg_size_t origin_offset;               /* Origin offset */
+    hg_size_t local_offset;                /* Local offset */
+    hg_size_t size;                        /* Total size of transfer */
+    hg_size_t chunk_size;                  /* Size of chunks */
+    hg_size_t block_size;                  /* Size of origin blocks (or 0) */
+    hg_size_t next_offset;                 /* Offset of next chunk to issue */
+    unsigned int window;                   /* Max number of chunks in flight */
+    unsigned int in_flight;                /* Number of chunks in flight */
+    hg_uint8_t origin_id;                  /* Origin context ID */
+    hg_bool_t completed;                   /* Pipeline has completed */
+};
+
+/* Cached memory registration */
+struct hg_bulk_reg_entry {
+    struct hg_bulk_reg_entry *left;     /* Left child in interval tree */
+    struct hg_bulk_reg_entry *right;    /* Right child in interval tree */
+    struct hg_bulk_reg_entry *lru_prev; /* Previous entry in LRU list */
+    struct hg_bulk_reg_entry *lru_next; /* Next entry in LRU list */
+    struct hg_bulk_reg_entry *next;     /* Next entry in release list */
+    hg_ptr_t base;                      /* Address of registered region */
+    hg_size_t len;                      /* Size of registered region */
+    hg_ptr_t max_end;                   /* Max end address of subtree */
+    na_mem_handle_t mem_handle;         /* NA memory handle */
+    na_size_t serialize_size;           /* Cached serialize size */
+    unsigned long flags;                /* Permission flags */
+    unsigned int ref_count;             /* Number of handles using entry */
+    int height;                         /* Height of subtree */
+    hg_bool_t invalid;                  /* Region was freed or unmapped */
+};
+
+/* Cache of memory registrations (unused entries are kept in LRU order) */
+struct hg_bulk_reg_cache {
+    struct hg_bulk_reg_cache_stats stats; /* Cache statistics */
+    na_class_t *na_class;                 /* NA class */
+    struct hg_bulk_reg_entry *root;       /* Interval tree of entries */
+    struct hg_bulk_reg_entry *lru_head;   /* Most recently released entry */
+    struct hg_bulk_reg_entry *lru_tail;   /* Least recently released entry */
+    hg_size_t max_size;                   /* Max size of registered memory */
+    hg_thread_spin_t lock;                /* Cache lock */
+};
+
+/* Cached remote handle (serialized descriptor is stored after entry) */
+struct hg_bulk_desc_entry {
+    struct hg_bulk_desc_entry *lru_prev; /* Previous entry in LRU list */
+    struct hg_bulk_desc_entry *lru_next; /* Next entry in LRU list */
+    struct hg_bulk_desc_entry *next;     /* Next entry in release list */
+    struct hg_bulk *hg_bulk;             /* Deserialized handle */
+    const void *buf;                     /* Serialized descriptor */
+    hg_size_t buf_size;                  /* Size of serialized descriptor */
+    unsigned int hash;                   /* Hash of serialized descriptor */
+};
+
+/* Cache of remote handles (entries are kept in LRU order) */
+struct hg_bulk_desc_cache {
+    struct hg_bulk_desc_cache_stats stats; /* Cache statistics */
+    hg_hash_table_t *table;                /* Entries keyed by descriptor */
+    struct hg_bulk_desc_entry *lru_head;   /* Most recently used entry */
+    struct hg_bulk_desc_entry *lru_tail;   /* Least recently used entry */
+    hg_uint32_t max_count;                 /* Max number of entries */
+    hg_thread_mutex_t lock;                /* Cache lock */
+};
+
 /* Wrapper on top of memcpy */
 typedef void (*hg_bulk_copy_op_t)(hg_ptr_t local_address,
     hg_size_t local_offset, hg_ptr_t remote_address, hg_size_t remote_offset,
@@ -231,10 +430,62 @@ typedef na_return_t (*na_bulk_op_t)(na_class_t *na_class, na_context_t *context,
     na_offset_t remote_offset, na_size_t data_size, na_addr_t remote_addr,
     na_uint8_t remote_id, na_op_id_t *op_id);
 
+/* Slot of windowed NA operations (NA op ID is re-used once completed) */
+struct hg_bulk_na_slot {
+    struct hg_bulk_op_id *op_id; /* Op ID that slot belongs to */
+    hg_uint32_t index;           /* Index of NA op ID */
+};
+
+/* Windowed NA operations (bounded number of NA operations in flight) */
+struct hg_bulk_na_window {
+    hg_thread_mutex_t mutex;                       /* Window lock */
+    struct hg_bulk_na_slot *slots;                 /* Array of slots */
+    const struct hg_bulk_transfer_desc *descs;     /* Next batched transfers */
+    const struct hg_bulk_segment *origin_segments; /* Origin segments */
+    const struct hg_bulk_segment *local_segments;  /* Local segments */
+    na_mem_handle_t *origin_mem_handles;           /* Origin NA mem handles */
+    na_mem_handle_t *local_mem_handles;            /* Local NA mem handles */
+    na_addr_t na_origin_addr;                      /* Origin NA address */
+    na_bulk_op_t na_bulk_op;                       /* NA operation */
+    hg_size_t origin_mem_offset;                   /* Offset in NA handle */
+    hg_size_t local_mem_offset;                    /* Offset in NA handle */
+    hg_size_t origin_offset;                       /* Offset within segment */
+    hg_size_t local_offset;                        /* Offset within segment */
+    hg_size_t remaining;                           /* Size left to issue */
+    hg_uint32_t origin_index;                      /* Origin segment index */
+    hg_uint32_t local_index;                       /* Local segment index */
+    hg_uint32_t origin_count;                      /* Origin segment count */
+    hg_uint32_t local_count;                       /* Local segment count */
+    hg_uint32_t desc_count;                        /* Batched transfers left */
+    hg_uint32_t slot_count;                        /* Number of slots */
+    hg_uint32_t issued_count;                      /* Operations issued */
+    na_uint8_t origin_id;                          /* Origin context ID */
+    hg_bool_t single;                              /* Single NA operation */
+};
+
 /********************/
 /* Local Prototypes */
 /********************/
 
+/**
+ * Coalesce adjacent segments, return number of coalesced segments.
+ */
+static hg_uint32_t
+hg_bulk_coalesce_segments(hg_uint32_t count, void **bufs,
+    const hg_size_t *lens, struct hg_bulk_segment *segments);
+
+/**
+ * Allocate dynamic array of segments.
+ */
+static struct hg_bulk_segment *
+hg_bulk_segments_alloc(hg_uint32_t count);
+
+/**
+ * Compute offsets of dynamic array of segments.
+ */
+static void
+hg_bulk_segments_index(struct hg_bulk_segment *segments, hg_uint32_t count);
+
 /**
  * Create handle.
  */
@@ -242,26 +493,95 @@ static hg_return_t
 hg_bulk_create(hg_core_class_t *core_class, hg_uint32_t count, void **bufs,
     const hg_size_t *lens, hg_uint8_t flags, struct hg_bulk **hg_bulk_ptr);
 
+/**
+ * Create handle from strided layout.
+ */
+static hg_return_t
+hg_bulk_create_strided(hg_core_class_t *core_class, void *base,
+    hg_size_t block_len, hg_uint32_t vector_count,
+    const struct hg_bulk_vector *vectors, hg_uint8_t flags,
+    struct hg_bulk **hg_bulk_ptr);
+
+/**
+ * Create handle that covers a sub-range of parent and shares its
+ * registrations.
+ */
+static hg_return_t
+hg_bulk_create_view(struct hg_bulk *parent, hg_size_t offset, hg_size_t len,
+    struct hg_bulk **hg_bulk_ptr);
+
+/**
+ * Share NA memory descriptors of parent segments.
+ */
+static hg_return_t
+hg_bulk_view_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
+    const struct hg_bulk_na_mem_desc *parent_na_mem_descs,
+    hg_uint32_t parent_count, hg_uint32_t start_index, hg_uint32_t count);
+
+/**
+ * Register segments of handle.
+ */
+static hg_return_t
+hg_bulk_create_mem_handles(struct hg_bulk *hg_bulk, hg_uint8_t flags);
+
+/**
+ * Get number of blocks of strided layout (0 if blocks are empty, overlap,
+ * exceed HG_BULK_STRIDE_BLOCK_MAX or if the layout overflows).
+ */
+static hg_uint32_t
+hg_bulk_stride_get_count(hg_size_t block_len,
+    const struct hg_bulk_vector *vectors, hg_uint32_t vector_count);
+
+/**
+ * Fill segments from strided layout.
+ */
+static void
+hg_bulk_stride_expand(const struct hg_bulk_stride *stride,
+    hg_uint32_t vector_count, struct hg_bulk_segment *segments,
+    hg_uint32_t count);
+
 /**
  * Free handle.
  */
 static hg_return_t
 hg_bulk_free(struct hg_bulk *hg_bulk);
 
+/**
+ * Create pool.
+ */
+static hg_return_t
+hg_bulk_pool_create(hg_core_class_t *core_class, hg_size_t block_size,
+    hg_uint32_t count, hg_uint8_t flags,
+    struct hg_bulk_pool **hg_bulk_pool_ptr);
+
+/**
+ * Destroy pool. Unless force is set, all the handles must have been returned.
+ */
+static hg_return_t
+hg_bulk_pool_destroy(struct hg_bulk_pool *hg_bulk_pool, hg_bool_t force);
+
+/**
+ * Get index of pool buffer that handle points to.
+ */
+static HG_INLINE hg_uint32_t
+hg_bulk_pool_index(
+    const struct hg_bulk_pool *hg_bulk_pool, const struct hg_bulk *hg_bulk);
+
 /**
  * Create NA memory descriptors.
  */
 static hg_return_t
 hg_bulk_create_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
-    na_class_t *na_class, struct hg_bulk_segment *segments, hg_uint32_t count,
-    hg_uint8_t flags);
+    na_class_t *na_class, struct hg_bulk_reg_cache *reg_cache,
+    struct hg_bulk_segment *segments, hg_uint32_t count, hg_uint8_t flags);
 
 /**
  * Free NA memory descriptors.
  */
 static hg_return_t
 hg_bulk_free_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
-    na_class_t *na_class, hg_uint32_t count);
+    na_class_t *na_class, struct hg_bulk_reg_cache *reg_cache,
+    const struct hg_bulk_segment *segments, hg_uint32_t count);
 
 /**
  * Register single segment.
@@ -285,11 +605,164 @@ hg_bulk_register_segments(na_class_t *na_class, struct na_segment *segments,
 static hg_return_t
 hg_bulk_deregister(na_class_t *na_class, na_mem_handle_t mem_handle);
 
+/**
+ * Register single segment through registration cache.
+ */
+static hg_return_t
+hg_bulk_reg_cache_register(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    void *base, na_size_t len, unsigned long flags,
+    na_mem_handle_t *mem_handle_ptr, na_size_t *serialize_size_ptr);
+
+/**
+ * Release segment registered through registration cache.
+ */
+static hg_return_t
+hg_bulk_reg_cache_deregister(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    void *base, na_mem_handle_t mem_handle);
+
+/**
+ * Invalidate cached registrations that overlap memory range.
+ */
+static hg_return_t
+hg_bulk_reg_cache_invalidate(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    hg_ptr_t base, hg_size_t len);
+
+/**
+ * Evict unused registrations until cache fits within its size limit.
+ */
+static void
+hg_bulk_reg_cache_evict(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry **release_list_ptr);
+
+/**
+ * Remove entry from cache.
+ */
+static void
+hg_bulk_reg_cache_remove(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry);
+
+/**
+ * Deregister and free list of entries.
+ */
+static hg_return_t
+hg_bulk_reg_cache_release(
+    na_class_t *na_class, struct hg_bulk_reg_entry *release_list);
+
+/**
+ * Insert entry into LRU list.
+ */
+static void
+hg_bulk_reg_lru_insert(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry);
+
+/**
+ * Remove entry from LRU list.
+ */
+static void
+hg_bulk_reg_lru_remove(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry);
+
+/**
+ * Insert entry into interval tree.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_insert(
+    struct hg_bulk_reg_entry *root, struct hg_bulk_reg_entry *entry);
+
+/**
+ * Remove entry from interval tree.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_remove(
+    struct hg_bulk_reg_entry *root, struct hg_bulk_reg_entry *entry);
+
+/**
+ * Remove min entry from interval tree.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_remove_min(
+    struct hg_bulk_reg_entry *root, struct hg_bulk_reg_entry **min_ptr);
+
+/**
+ * Re-balance interval tree.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_balance(struct hg_bulk_reg_entry *root);
+
+/**
+ * Find valid entry registered for exactly [base, base + len) with flags (a
+ * larger registration would expose more memory than the handle describes).
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_find(struct hg_bulk_reg_entry *root, hg_ptr_t base,
+    hg_size_t len, unsigned long flags);
+
+/**
+ * Find entry that starts at base and holds mem_handle.
+ */
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_find_handle(struct hg_bulk_reg_entry *root, hg_ptr_t base,
+    na_mem_handle_t mem_handle);
+
+/**
+ * Add entries that overlap [start, end) to list.
+ */
+static void
+hg_bulk_reg_tree_overlap(struct hg_bulk_reg_entry *root, hg_ptr_t start,
+    hg_ptr_t end, struct hg_bulk_reg_entry **list_ptr);
+
+/**
+ * Check whether an entry of the tree is still used by handles.
+ */
+static hg_bool_t
+hg_bulk_reg_tree_in_use(const struct hg_bulk_reg_entry *root);
+
+/**
+ * Height of subtree.
+ */
+static HG_INLINE int
+hg_bulk_reg_tree_height(const struct hg_bulk_reg_entry *root)
+{
+    return (root) ? root->height : 0;
+}
+
+/**
+ * Update height and max end address of subtree.
+ */
+static HG_INLINE void
+hg_bulk_reg_tree_update(struct hg_bulk_reg_entry *root)
+{
+    int left_height = hg_bulk_reg_tree_height(root->left),
+        right_height = hg_bulk_reg_tree_height(root->right);
+
+    root->height =
+        1 + ((left_height > right_height) ? left_height : right_height);
+    root->max_end = root->base + (hg_ptr_t) root->len;
+    if (root->left && root->left->max_end > root->max_end)
+        root->max_end = root->left->max_end;
+    if (root->right && root->right->max_end > root->max_end)
+        root->max_end = root->right->max_end;
+}
+
+/**
+ * Order entries by base address and entry address.
+ */
+static HG_INLINE int
+hg_bulk_reg_tree_cmp(
+    const struct hg_bulk_reg_entry *a, const struct hg_bulk_reg_entry *b)
+{
+    if (a->base != b->base)
+        return (a->base < b->base) ? -1 : 1;
+    if (a != b)
+        return ((hg_ptr_t) a < (hg_ptr_t) b) ? -1 : 1;
+    return 0;
+}
+
 /**
  * Get serialize size.
  */
 static hg_size_t
-hg_bulk_get_serialize_size(struct hg_bulk *hg_bulk, hg_uint8_t flags);
+hg_bulk_get_serialize_size(struct hg_bulk *hg_bulk, unsigned long flags);
 
 /**
  * Get serialize size of NA memory descriptors.
@@ -299,11 +772,12 @@ hg_bulk_get_serialize_size_mem_descs(
     struct hg_bulk_na_mem_desc *na_mem_descs, hg_uint32_t count);
 
 /**
- * Serialize bulk handle.
+ * Serialize bulk handle, checksums of blocks are computed unless crcs is
+ * passed.
  */
 static hg_return_t
-hg_bulk_serialize(
-    void *buf, hg_size_t buf_size, hg_uint8_t flags, struct hg_bulk *hg_bulk);
+hg_bulk_serialize(void *buf, hg_size_t buf_size, unsigned long flags,
+    struct hg_bulk *hg_bulk, const hg_uint32_t *crcs);
 
 /**
  * Serialize NA memory descriptors.
@@ -328,6 +802,105 @@ hg_bulk_deserialize_mem_descs(na_class_t *na_class, const char **buf_ptr,
     hg_size_t *buf_size_left, struct hg_bulk_na_mem_desc *na_mem_descs,
     const struct hg_bulk_segment *segments, hg_uint32_t count);
 
+/**
+ * Deserialize layout and descriptor of compressed copy.
+ */
+static hg_return_t
+hg_bulk_compressed_deserialize(hg_core_class_t *core_class,
+    struct hg_bulk *hg_bulk, const char **buf_ptr, hg_size_t *buf_size_left);
+
+/**
+ * Deserialize checksums of origin data.
+ */
+static hg_return_t
+hg_bulk_checksum_deserialize(
+    struct hg_bulk *hg_bulk, const char **buf_ptr, hg_size_t *buf_size_left);
+
+/**
+ * Get CRC32C of range of local handle.
+ */
+static hg_uint32_t
+hg_bulk_checksum_compute(
+    struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size);
+
+/**
+ * Get CRC32C of size bytes of segments starting at segment index and offset,
+ * which are advanced past the range so that consecutive ranges can be
+ * checksummed without translating offsets again.
+ */
+static hg_uint32_t
+hg_bulk_checksum_compute_segments(const struct hg_bulk_segment *segments,
+    hg_uint32_t count, hg_uint32_t *segment_index_ptr,
+    hg_size_t *segment_offset_ptr, hg_size_t size);
+
+/**
+ * Get size of blocks that data of len bytes is split into.
+ */
+static HG_INLINE hg_size_t
+hg_bulk_block_size(hg_size_t len);
+
+/**
+ * Make compressed copy of handle data, compressing into the copy passed if
+ * any. Blocks are also checksummed while they are read if requested.
+ */
+static hg_return_t
+hg_bulk_compress(struct hg_bulk *hg_bulk, hg_bool_t checksum,
+    struct hg_bulk **hg_bulk_copy_ptr);
+
+/**
+ * Free compressed copy information.
+ */
+static void
+hg_bulk_compressed_free(struct hg_bulk_compressed *hg_bulk_compressed);
+
+/**
+ * Deserialize handle or retrieve it from descriptor cache.
+ */
+static hg_return_t
+hg_bulk_desc_cache_deserialize(struct hg_bulk_desc_cache *hg_bulk_desc_cache,
+    hg_core_class_t *core_class, struct hg_bulk **hg_bulk_ptr, const void *buf,
+    hg_size_t buf_size);
+
+/**
+ * Release handles of evicted entries.
+ */
+static hg_return_t
+hg_bulk_desc_cache_release(struct hg_bulk_desc_entry *release_list);
+
+/**
+ * Remove handle from descriptor cache so that it is no longer shared, fails
+ * with HG_PERMISSION if other references to the handle exist.
+ */
+static hg_return_t
+hg_bulk_desc_cache_detach(
+    struct hg_bulk_desc_cache *hg_bulk_desc_cache, struct hg_bulk *hg_bulk);
+
+/**
+ * Hash serialized descriptor.
+ */
+static unsigned int
+hg_bulk_desc_hash(hg_hash_table_key_t key);
+
+/**
+ * Compare serialized descriptors.
+ */
+static int
+hg_bulk_desc_equal(hg_hash_table_key_t key1, hg_hash_table_key_t key2);
+
+/**
+ * Insert entry into LRU list.
+ */
+static void
+hg_bulk_desc_lru_insert(struct hg_bulk_desc_cache *hg_bulk_desc_cache,
+    struct hg_bulk_desc_entry *hg_bulk_desc_entry);
+
+/**
+ * Remove entry from LRU list.
+ */
+static void
+hg_bulk_desc_lru_remove(struct hg_bulk_desc_cache *hg_bulk_desc_cache,
+    struct hg_bulk_desc_entry *hg_bulk_desc_entry);
+
 /**
  * Access bulk handle and get segment addresses/sizes.
  */
@@ -351,12 +924,32 @@ static hg_return_t
 hg_bulk_op_create(
     hg_core_context_t *core_context, struct hg_bulk_op_id **hg_bulk_op_id_ptr);
 
+/**
+ * Free bulk operation ID and its NA op IDs.
+ */
+static hg_return_t
+hg_bulk_op_free(struct hg_bulk_op_id *hg_bulk_op_id);
+
 /**
  * Destroy bulk operation ID.
  */
 static hg_return_t
 hg_bulk_op_destroy(struct hg_bulk_op_id *hg_bulk_op_id);
 
+/**
+ * Create first count NA op IDs of bulk operation ID if not created yet.
+ */
+static hg_return_t
+hg_bulk_na_op_ids_create(struct hg_bulk_op_id *hg_bulk_op_id,
+    hg_bulk_na_op_id_t *hg_bulk_na_op_ids, hg_uint32_t count);
+
+/**
+ * Update number of NA op IDs and windows held by op IDs of pool.
+ */
+static HG_INLINE void
+hg_bulk_op_pool_account(struct hg_bulk_op_pool *hg_bulk_op_pool,
+    long na_op_count, long window_count);
+
 /**
  * Retrive bulk operation ID from pool.
  */
@@ -364,6 +957,21 @@ static hg_return_t
 hg_bulk_op_pool_get(struct hg_bulk_op_pool *hg_bulk_op_pool,
     struct hg_bulk_op_id **hg_bulk_op_id_ptr);
 
+/**
+ * Extend pool or create an op ID outside of pool if pool is full.
+ */
+static hg_return_t
+hg_bulk_op_pool_extend(struct hg_bulk_op_pool *hg_bulk_op_pool,
+    struct hg_bulk_op_id **hg_bulk_op_id_ptr);
+
+/**
+ * Return bulk operation ID to pool and release op IDs left unused during
+ * the last idle period.
+ */
+static hg_return_t
+hg_bulk_op_pool_release(struct hg_bulk_op_pool *hg_bulk_op_pool,
+    struct hg_bulk_op_id *hg_bulk_op_id);
+
 /**
  * Bulk transfer.
  */
@@ -374,6 +982,16 @@ hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
     struct hg_bulk *hg_bulk_local, hg_size_t local_offset, hg_size_t size,
     hg_op_id_t *op_id);
 
+/**
+ * Bulk transfer that is not split into blocks.
+ */
+static hg_return_t
+hg_bulk_transfer_direct(hg_core_context_t *core_context, hg_cb_t callback,
+    void *arg, hg_bulk_op_t op, struct hg_core_addr *origin_addr,
+    hg_uint8_t origin_id, struct hg_bulk *hg_bulk_origin,
+    hg_size_t origin_offset, struct hg_bulk *hg_bulk_local,
+    hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id);
+
 /**
  * Bulk transfer to self.
  */
@@ -395,6 +1013,15 @@ hg_bulk_transfer_segments_self(hg_bulk_copy_op_t copy_op,
     hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
     hg_size_t size);
 
+/**
+ * Stage data pushed to handle returned in response. Returns HG_FALSE if the
+ * data must be transferred through RMA instead.
+ */
+static hg_bool_t
+hg_bulk_eager_write_put(struct hg_bulk_eager_write *hg_bulk_eager_write,
+    hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
+    hg_uint32_t local_count, hg_size_t local_offset, hg_size_t size);
+
 /**
  * Memcpy.
  */
@@ -402,7 +1029,7 @@ static HG_INLINE void
 hg_bulk_memcpy_put(hg_ptr_t local_address, hg_size_t local_offset,
     hg_ptr_t remote_address, hg_size_t remote_offset, hg_size_t data_size)
 {
-    memcpy((void *) (remote_address + remote_offset),
+    hg_mem_copy((void *) (remote_address + remote_offset),
         (const void *) (local_address + local_offset), data_size);
 }
 
@@ -413,7 +1040,7 @@ static HG_INLINE void
 hg_bulk_memcpy_get(hg_ptr_t local_address, hg_size_t local_offset,
     hg_ptr_t remote_address, hg_size_t remote_offset, hg_size_t data_size)
 {
-    memcpy((void *) (local_address + local_offset),
+    hg_mem_copy((void *) (local_address + local_offset),
         (const void *) (remote_address + remote_offset), data_size);
 }
 
@@ -424,10 +1051,11 @@ static hg_return_t
 hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t na_origin_addr,
     hg_uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
     hg_uint32_t origin_count, na_mem_handle_t *origin_mem_handles,
-    hg_uint8_t origin_flags, hg_size_t origin_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    na_mem_handle_t *local_mem_handles, hg_uint8_t local_flags,
-    hg_size_t local_offset, hg_size_t size,
+    hg_size_t origin_mem_offset, hg_uint8_t origin_flags,
+    hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
+    hg_uint32_t local_count, na_mem_handle_t *local_mem_handles,
+    hg_size_t local_mem_offset, hg_uint8_t local_flags, hg_size_t local_offset,
+    hg_size_t size,
     struct hg_bulk_op_id *hg_bulk_op_id);
 
 /**
@@ -449,11 +1077,14 @@ hg_bulk_transfer_segments_na(na_class_t *na_class, na_context_t *na_context,
     na_bulk_op_t na_bulk_op, na_cb_t callback, void *arg, na_addr_t origin_addr,
     na_uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
     hg_uint32_t origin_count, na_mem_handle_t *origin_mem_handles,
-    hg_size_t origin_segment_start_index, hg_size_t origin_segment_start_offset,
+    hg_size_t origin_mem_offset, hg_size_t origin_segment_start_index,
+    hg_size_t origin_segment_start_offset,
     const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    na_mem_handle_t *local_mem_handles, hg_size_t local_segment_start_index,
-    hg_size_t local_segment_start_offset, hg_size_t size,
-    na_op_id_t *na_op_ids[], hg_uint32_t na_op_count);
+    na_mem_handle_t *local_mem_handles, hg_size_t local_mem_offset,
+    hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
+    hg_size_t size,
+    na_op_id_t *na_op_ids[], hg_uint32_t na_op_count,
+    hg_uint32_t *issued_count_ptr);
 
 /**
  * NA_Put wrapper
@@ -492,20 +1123,166 @@ static int
 hg_bulk_transfer_cb(const struct na_cb_info *callback_info);
 
 /**
- * Complete operation ID.
+ * Prepare windowed NA operations (NA op IDs are created on first use).
  */
 static hg_return_t
-hg_bulk_complete(struct hg_bulk_op_id *hg_bulk_op_id, hg_bool_t self_notify);
+hg_bulk_na_window_init(struct hg_bulk_op_id *hg_bulk_op_id);
 
 /**
- * Cancel operation ID.
+ * Free windowed NA operations.
  */
-static hg_return_t
-hg_bulk_cancel(struct hg_bulk_op_id *hg_bulk_op_id);
+static void
+hg_bulk_na_window_free(struct hg_bulk_op_id *hg_bulk_op_id);
 
-/*******************/
-/* Local Variables */
-/*******************/
+/**
+ * Set next transfer of window.
+ */
+static hg_return_t
+hg_bulk_na_window_load(struct hg_bulk_na_window *hg_bulk_na_window,
+    na_class_t *na_class, na_addr_t na_origin_addr, hg_uint8_t origin_id,
+    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
+    na_mem_handle_t *origin_mem_handles, hg_size_t origin_mem_offset,
+    hg_uint8_t origin_flags, hg_size_t origin_offset,
+    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
+    na_mem_handle_t *local_mem_handles, hg_size_t local_mem_offset,
+    hg_uint8_t local_flags, hg_size_t local_offset, hg_size_t size);
+
+/**
+ * Set next batched transfer of window.
+ */
+static hg_return_t
+hg_bulk_na_window_load_desc(struct hg_bulk_op_id *hg_bulk_op_id,
+    const struct hg_bulk_transfer_desc *desc);
+
+/**
+ * Issue first operations of window.
+ */
+static hg_return_t
+hg_bulk_na_window_start(struct hg_bulk_op_id *hg_bulk_op_id,
+    na_bulk_op_t na_bulk_op, const struct hg_bulk_transfer_desc *descs,
+    hg_uint32_t desc_count);
+
+/**
+ * Issue next operation of window using slot (window lock must be held).
+ */
+static hg_return_t
+hg_bulk_na_window_issue(
+    struct hg_bulk_op_id *hg_bulk_op_id, struct hg_bulk_na_slot *slot);
+
+/**
+ * Windowed transfer callback.
+ */
+static int
+hg_bulk_na_window_cb(const struct na_cb_info *callback_info);
+
+/**
+ * Cancel windowed NA operations.
+ */
+static hg_return_t
+hg_bulk_na_window_cancel(struct hg_bulk_op_id *hg_bulk_op_id);
+
+/**
+ * Complete operation ID.
+ */
+static hg_return_t
+hg_bulk_complete(struct hg_bulk_op_id *hg_bulk_op_id, hg_bool_t self_notify);
+
+/**
+ * Cancel operation ID.
+ */
+static hg_return_t
+hg_bulk_cancel(struct hg_bulk_op_id *hg_bulk_op_id);
+
+/**
+ * Pipelined transfer.
+ */
+static hg_return_t
+hg_bulk_transfer_pipelined(hg_core_context_t *core_context, hg_cb_t callback,
+    hg_bulk_chunk_cb_t chunk_callback, void *arg, hg_bulk_op_t op,
+    struct hg_core_addr *origin_addr, hg_uint8_t origin_id,
+    struct hg_bulk *hg_bulk_origin, hg_size_t origin_offset,
+    struct hg_bulk *hg_bulk_local, hg_size_t local_offset, hg_size_t size,
+    hg_size_t chunk_size, unsigned int window, hg_op_id_t *op_id);
+
+/**
+ * Issue chunks until window is full and complete pipelined transfer once all
+ * chunks have completed.
+ */
+static hg_return_t
+hg_bulk_pipeline_progress(struct hg_bulk_pipeline *hg_bulk_pipeline);
+
+/**
+ * Pull chunk of compressed or checksummed origin.
+ */
+static hg_return_t
+hg_bulk_pipeline_pull(struct hg_bulk_pipeline *hg_bulk_pipeline,
+    struct hg_bulk_pipeline_chunk *chunk, hg_op_id_t *op_id);
+
+/**
+ * Chunk transfer callback.
+ */
+static hg_return_t
+hg_bulk_pipeline_cb(const struct hg_cb_info *callback_info);
+
+/**
+ * Decompress and/or verify staged block of chunk and copy it into local handle.
+ */
+static hg_return_t
+hg_bulk_pipeline_unstage(struct hg_bulk_pipeline *hg_bulk_pipeline,
+    struct hg_bulk_pipeline_chunk *chunk);
+
+/**
+ * Cancel chunks of pipelined transfer that are in flight.
+ */
+static hg_return_t
+hg_bulk_pipeline_cancel(struct hg_bulk_pipeline *hg_bulk_pipeline);
+
+/**
+ * Free pipelined transfer.
+ */
+static void
+hg_bulk_pipeline_free(struct hg_bulk_pipeline *hg_bulk_pipeline);
+
+/**
+ * Batched transfer.
+ */
+static hg_return_t
+hg_bulk_transfer_batch(hg_core_context_t *core_context, hg_cb_t callback,
+    void *arg, hg_bulk_op_t op, const struct hg_bulk_transfer_desc *descs,
+    hg_uint32_t count, hg_op_id_t *op_id);
+
+/**
+ * Check whether transfer of batch can be done locally.
+ */
+static HG_INLINE hg_bool_t
+hg_bulk_transfer_batch_is_local(
+    hg_bulk_op_t op, const struct hg_bulk_transfer_desc *desc);
+
+/**
+ * Get number of NA operations needed by transfer of batch.
+ */
+static hg_uint32_t
+hg_bulk_transfer_batch_get_op_count(const struct hg_bulk_transfer_desc *desc);
+
+/**
+ * Copy data of local transfer of batch.
+ */
+static void
+hg_bulk_transfer_batch_self(
+    hg_bulk_copy_op_t copy_op, const struct hg_bulk_transfer_desc *desc);
+
+/**
+ * Issue NA operations of transfer of batch.
+ */
+static hg_return_t
+hg_bulk_transfer_batch_na(struct hg_bulk_op_id *hg_bulk_op_id,
+    na_bulk_op_t na_bulk_op, const struct hg_bulk_transfer_desc *desc,
+    na_op_id_t *na_op_ids[], hg_uint32_t na_op_count,
+    hg_uint32_t *issued_count_ptr);
+
+/*******************/
+/* Local Variables */
+/*******************/
 
 static hg_return_t
 hg_bulk_create(hg_core_class_t *core_class, hg_uint32_t count, void **bufs,
@@ -517,6 +1294,7 @@ hg_bulk_create(hg_core_class_t *core_class, hg_uint32_t count, void **bufs,
 #ifdef NA_HAS_SM
     na_class_t *na_sm_class = HG_Core_class_get_na_sm(core_class);
 #endif
+    hg_uint32_t buf_count = count;
     hg_return_t ret = HG_SUCCESS;
 
     hg_bulk = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
@@ -529,14 +1307,17 @@ hg_bulk_create(hg_core_class_t *core_class, hg_uint32_t count, void **bufs,
 #ifdef NA_HAS_SM
     hg_bulk->na_sm_class = na_sm_class;
 #endif
-    hg_bulk->desc.info.segment_count = count;
     hg_bulk->desc.info.flags = flags;
     hg_atomic_init32(&hg_bulk->ref_count, 1);
 
+    /* Segments that are adjacent can be registered and transferred at once */
+    if (bufs)
+        count = hg_bulk_coalesce_segments(count, bufs, lens, NULL);
+    hg_bulk->desc.info.segment_count = count;
+
     if (count > HG_BULK_STATIC_MAX) {
         /* Allocate segments */
-        hg_bulk->desc.segments.d = (struct hg_bulk_segment *) calloc(
-            count, sizeof(struct hg_bulk_segment));
+        hg_bulk->desc.segments.d = hg_bulk_segments_alloc(count);
         HG_CHECK_ERROR(hg_bulk->desc.segments.d == NULL, error, ret, HG_NOMEM,
             "Could not allocate segment array");
 
@@ -564,76 +1345,86 @@ hg_bulk_create(hg_core_class_t *core_class, hg_uint32_t count, void **bufs,
     } else {
         hg_uint32_t i;
 
-        for (i = 0; i < count; i++) {
-            segments[i].base = (hg_ptr_t) bufs[i];
-            segments[i].len = lens[i];
-            hg_bulk->desc.info.len += lens[i];
-        }
+        hg_bulk_coalesce_segments(buf_count, bufs, lens, segments);
+        for (i = 0; i < count; i++)
+            hg_bulk->desc.info.len += segments[i].len;
     }
+    if (count > HG_BULK_STATIC_MAX)
+        hg_bulk_segments_index(segments, count);
 
     HG_LOG_DEBUG("Creating bulk handle with %u segment(s), len is %zu bytes",
         hg_bulk->desc.info.segment_count, hg_bulk->desc.info.len);
 
-    /* Query max segment limit that NA plugin can handle */
-    if ((count > 1) && na_class->ops->mem_handle_create_segments) {
-        na_size_t max_segments =
-            na_class->ops->mem_handle_get_max_segments(na_class);
+    ret = hg_bulk_create_mem_handles(hg_bulk, flags);
+    HG_CHECK_HG_ERROR(error, ret, "Could not create NA memory handles");
 
-        /* Will use one single descriptor if supported */
-        if ((max_segments > 1) && (count <= max_segments))
-            hg_bulk->desc.info.flags |= HG_BULK_REGV;
+    *hg_bulk_ptr = hg_bulk;
 
-#ifdef NA_HAS_SM
-        /* Make sure SM can register as many segments */
-        if (na_sm_class) {
-            na_size_t max_sm_segments =
-                na_sm_class->ops->mem_handle_get_max_segments(na_sm_class);
+    return ret;
 
-            HG_CHECK_ERROR(!na_sm_class->ops->mem_handle_create_segments, error,
-                ret, HG_OPNOTSUPPORTED,
-                "Registration of segments not supported with SM");
-            HG_CHECK_ERROR(count > max_sm_segments, error, ret,
-                HG_OPNOTSUPPORTED, "SM class cannot register %zu segments",
-                count);
-        }
-#endif
-    }
+error:
+    hg_bulk_free(hg_bulk);
 
-    /* Register using one single descriptor if supported */
-    if (hg_bulk->desc.info.flags & HG_BULK_REGV) {
-        /* Register segments */
-        ret =
-            hg_bulk_register_segments(na_class, (struct na_segment *) segments,
-                count, flags, &hg_bulk->na_mem_descs.handles.s[0],
-                &hg_bulk->na_mem_descs.serialize_sizes.s[0]);
-        HG_CHECK_HG_ERROR(error, ret, "Could not register segments");
+    return ret;
+}
 
-#ifdef NA_HAS_SM
-        if (na_sm_class) {
-            /* Register segments */
-            ret = hg_bulk_register_segments(na_sm_class,
-                (struct na_segment *) segments, count, flags,
-                &hg_bulk->na_sm_mem_descs.handles.s[0],
-                &hg_bulk->na_sm_mem_descs.serialize_sizes.s[0]);
-            HG_CHECK_HG_ERROR(
-                error, ret, "Could not register segments with SM");
-        }
-#endif
-    } else {
-        /* Register segments individually */
-        ret = hg_bulk_create_na_mem_descs(
-            &hg_bulk->na_mem_descs, na_class, segments, count, flags);
-        HG_CHECK_HG_ERROR(error, ret, "Could not create NA mem descriptors");
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_create_strided(hg_core_class_t *core_class, void *base,
+    hg_size_t block_len, hg_uint32_t vector_count,
+    const struct hg_bulk_vector *vectors, hg_uint8_t flags,
+    struct hg_bulk **hg_bulk_ptr)
+{
+    struct hg_bulk *hg_bulk = NULL;
+    struct hg_bulk_segment *segments;
+    hg_uint32_t count =
+        hg_bulk_stride_get_count(block_len, vectors, vector_count);
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(count == 0, error, ret, HG_INVALID_ARG,
+        "Invalid strided layout (empty, overlapping or too many blocks)");
+
+    hg_bulk = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
+    HG_CHECK_ERROR(
+        hg_bulk == NULL, error, ret, HG_NOMEM, "Could not allocate handle");
 
+    memset(hg_bulk, 0, sizeof(struct hg_bulk));
+    hg_bulk->core_class = core_class;
+    hg_bulk->na_class = HG_Core_class_get_na(core_class);
 #ifdef NA_HAS_SM
-        if (na_sm_class) {
-            ret = hg_bulk_create_na_mem_descs(
-                &hg_bulk->na_sm_mem_descs, na_sm_class, segments, count, flags);
-            HG_CHECK_HG_ERROR(
-                error, ret, "Could not create NA SM mem descriptors");
-        }
+    hg_bulk->na_sm_class = HG_Core_class_get_na_sm(core_class);
 #endif
-    }
+    hg_bulk->desc.info.flags = flags;
+    hg_bulk->desc.info.segment_count = count;
+    hg_bulk->desc.info.vector_count = (hg_uint8_t) vector_count;
+    hg_bulk->desc.info.len = block_len * count;
+    hg_atomic_init32(&hg_bulk->ref_count, 1);
+
+    memcpy(hg_bulk->stride.vectors, vectors,
+        vector_count * sizeof(struct hg_bulk_vector));
+    hg_bulk->stride.base = (hg_ptr_t) base;
+    hg_bulk->stride.block_len = block_len;
+
+    /* Blocks are registered as individual segments */
+    if (count > HG_BULK_STATIC_MAX) {
+        hg_bulk->desc.segments.d = hg_bulk_segments_alloc(count);
+        HG_CHECK_ERROR(hg_bulk->desc.segments.d == NULL, error, ret, HG_NOMEM,
+            "Could not allocate segment array");
+
+        segments = hg_bulk->desc.segments.d;
+    } else
+        segments = hg_bulk->desc.segments.s;
+
+    hg_bulk_stride_expand(&hg_bulk->stride, vector_count, segments, count);
+    if (count > HG_BULK_STATIC_MAX)
+        hg_bulk_segments_index(segments, count);
+
+    HG_LOG_DEBUG("Creating strided bulk handle with %u vector(s) and %u "
+                 "block(s), len is %zu bytes",
+        vector_count, count, hg_bulk->desc.info.len);
+
+    ret = hg_bulk_create_mem_handles(hg_bulk, flags);
+    HG_CHECK_HG_ERROR(error, ret, "Could not create NA memory handles");
 
     *hg_bulk_ptr = hg_bulk;
 
@@ -647,100 +1438,136 @@ error:
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_free(struct hg_bulk *hg_bulk)
+hg_bulk_create_view(struct hg_bulk *parent, hg_size_t offset, hg_size_t len,
+    struct hg_bulk **hg_bulk_ptr)
 {
+    const struct hg_bulk_segment *parent_segments = HG_BULK_SEGMENTS(parent);
+    hg_uint32_t parent_count = parent->desc.info.segment_count;
+    hg_uint8_t parent_flags = parent->desc.info.flags;
+    struct hg_bulk *hg_bulk = NULL;
     struct hg_bulk_segment *segments;
+    hg_uint32_t start_index = 0, end_index = 0, count;
+    hg_size_t start_offset = 0, end_offset = 0;
     hg_return_t ret = HG_SUCCESS;
 
-    if (!hg_bulk)
-        goto done;
+    HG_CHECK_ERROR(len == 0, error, ret, HG_INVALID_ARG, "Invalid view size");
+    HG_CHECK_ERROR(offset + len > parent->desc.info.len, error, ret,
+        HG_OVERFLOW, "Exceeding parent handle size");
 
-    /* Cannot free yet */
-    if (hg_atomic_decr32(&hg_bulk->ref_count))
-        goto done;
+    /* Segments covered by view */
+    hg_bulk_offset_translate(
+        parent_segments, parent_count, offset, &start_index, &start_offset);
+    hg_bulk_offset_translate(parent_segments, parent_count, offset + len - 1,
+        &end_index, &end_offset);
+    count = end_index - start_index + 1;
 
-    /* Deregister segments */
-    if (hg_bulk->desc.info.flags & HG_BULK_REGV ||
-        (hg_bulk->desc.info.segment_count == 1)) {
-        if (hg_bulk->na_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL) {
-            ret = hg_bulk_deregister(
-                hg_bulk->na_class, hg_bulk->na_mem_descs.handles.s[0]);
-            HG_CHECK_HG_ERROR(done, ret, "Could not deregister segment");
-        }
+    hg_bulk = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
+    HG_CHECK_ERROR(
+        hg_bulk == NULL, error, ret, HG_NOMEM, "Could not allocate handle");
 
+    memset(hg_bulk, 0, sizeof(struct hg_bulk));
+    hg_bulk->core_class = parent->core_class;
+    hg_bulk->na_class = parent->na_class;
 #ifdef NA_HAS_SM
-        if (hg_bulk->na_sm_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL) {
-            ret = hg_bulk_deregister(
-                hg_bulk->na_sm_class, hg_bulk->na_sm_mem_descs.handles.s[0]);
-            HG_CHECK_HG_ERROR(
-                done, ret, "Could not deregister segment with SM");
-        }
+    hg_bulk->na_sm_class = parent->na_sm_class;
+#endif
+    /* Memory and address remain owned by parent */
+    hg_bulk->desc.info.flags = (hg_uint8_t)(
+        parent_flags & ~(HG_BULK_ALLOC | HG_BULK_BIND | HG_BULK_EAGER));
+    hg_bulk->desc.info.segment_count = count;
+    hg_bulk->desc.info.len = len;
+    hg_atomic_init32(&hg_bulk->ref_count, 1);
+
+    if (count > HG_BULK_STATIC_MAX) {
+        hg_bulk->desc.segments.d = hg_bulk_segments_alloc(count);
+        HG_CHECK_ERROR(hg_bulk->desc.segments.d == NULL, error, ret, HG_NOMEM,
+            "Could not allocate segment array");
+
+        segments = hg_bulk->desc.segments.d;
+    } else
+        segments = hg_bulk->desc.segments.s;
+
+    memcpy(segments, &parent_segments[start_index],
+        count * sizeof(struct hg_bulk_segment));
+    segments[0].base += start_offset;
+    segments[0].len -= start_offset;
+    segments[count - 1].len = (count == 1) ? len : end_offset + 1;
+    if (count > HG_BULK_STATIC_MAX)
+        hg_bulk_segments_index(segments, count);
+
+    /* NA handles remain owned by parent, offset only applies to the NA handle
+     * of first segment */
+    if ((parent_flags & HG_BULK_REGV) || parent_count == 1) {
+        hg_bulk->na_mem_descs.handles.s[0] = parent->na_mem_descs.handles.s[0];
+        hg_bulk->na_mem_descs.serialize_sizes.s[0] =
+            parent->na_mem_descs.serialize_sizes.s[0];
+#ifdef NA_HAS_SM
+        hg_bulk->na_sm_mem_descs.handles.s[0] =
+            parent->na_sm_mem_descs.handles.s[0];
+        hg_bulk->na_sm_mem_descs.serialize_sizes.s[0] =
+            parent->na_sm_mem_descs.serialize_sizes.s[0];
 #endif
+        hg_bulk->mem_offset = parent->mem_offset + offset;
     } else {
-        /* Free segments individually */
-        ret = hg_bulk_free_na_mem_descs(&hg_bulk->na_mem_descs,
-            hg_bulk->na_class, hg_bulk->desc.info.segment_count);
-        HG_CHECK_HG_ERROR(done, ret, "Could not free NA mem descriptors");
+        ret = hg_bulk_view_na_mem_descs(&hg_bulk->na_mem_descs,
+            &parent->na_mem_descs, parent_count, start_index, count);
+        HG_CHECK_HG_ERROR(error, ret, "Could not create NA mem descriptors");
 
 #ifdef NA_HAS_SM
         if (hg_bulk->na_sm_class) {
-            ret = hg_bulk_free_na_mem_descs(&hg_bulk->na_sm_mem_descs,
-                hg_bulk->na_sm_class, hg_bulk->desc.info.segment_count);
+            ret = hg_bulk_view_na_mem_descs(&hg_bulk->na_sm_mem_descs,
+                &parent->na_sm_mem_descs, parent_count, start_index, count);
             HG_CHECK_HG_ERROR(
-                done, ret, "Could not free NA SM mem descriptors");
+                error, ret, "Could not create NA SM mem descriptors");
         }
 #endif
+        hg_bulk->mem_offset =
+            ((start_index == 0) ? parent->mem_offset : 0) + start_offset;
     }
+    if (hg_bulk->mem_offset > 0)
+        hg_bulk->desc.info.ext_flags |= HG_BULK_OFFSET;
 
-    /* Free addr if any was attached to handle */
-    if (hg_bulk->desc.info.flags & HG_BULK_BIND) {
-        ret = HG_Core_addr_free(hg_bulk->addr);
-        HG_CHECK_HG_ERROR(done, ret, "Could not free addr");
-    }
-
-    segments = (hg_bulk->desc.info.segment_count > HG_BULK_STATIC_MAX)
-                   ? hg_bulk->desc.segments.d
-                   : hg_bulk->desc.segments.s;
-
-    /* Free segments if we allocated them */
-    if (hg_bulk->desc.info.flags & HG_BULK_ALLOC) {
-        hg_uint32_t i;
+    hg_bulk->parent = parent;
+    hg_atomic_incr32(&parent->ref_count);
 
-        for (i = 0; i < hg_bulk->desc.info.segment_count; i++)
-            free((void *) segments[i].base);
-    }
+    *hg_bulk_ptr = hg_bulk;
 
-    if (hg_bulk->desc.info.segment_count > HG_BULK_STATIC_MAX)
-        free(segments);
+    return ret;
 
-    free(hg_bulk);
+error:
+    hg_bulk_free(hg_bulk);
 
-done:
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_create_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
-    na_class_t *na_class, struct hg_bulk_segment *segments, hg_uint32_t count,
-    hg_uint8_t flags)
+hg_bulk_view_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
+    const struct hg_bulk_na_mem_desc *parent_na_mem_descs,
+    hg_uint32_t parent_count, hg_uint32_t start_index, hg_uint32_t count)
 {
+    const na_mem_handle_t *parent_handles;
+    const na_size_t *parent_serialize_sizes;
     na_mem_handle_t *na_mem_handles;
     na_size_t *na_mem_serialize_sizes;
     hg_return_t ret = HG_SUCCESS;
-    hg_uint32_t i;
+
+    if (parent_count > HG_BULK_STATIC_MAX) {
+        parent_handles = parent_na_mem_descs->handles.d;
+        parent_serialize_sizes = parent_na_mem_descs->serialize_sizes.d;
+    } else {
+        parent_handles = parent_na_mem_descs->handles.s;
+        parent_serialize_sizes = parent_na_mem_descs->serialize_sizes.s;
+    }
 
     if (count > HG_BULK_STATIC_MAX) {
-        /* Allocate NA memory handles */
         na_mem_descs->handles.d =
-            (na_mem_handle_t *) calloc(count, sizeof(na_mem_handle_t));
-        HG_CHECK_ERROR(na_mem_descs->handles.d == NULL, error, ret, HG_NOMEM,
+            (na_mem_handle_t *) malloc(count * sizeof(na_mem_handle_t));
+        HG_CHECK_ERROR(na_mem_descs->handles.d == NULL, done, ret, HG_NOMEM,
             "Could not allocate mem handle array");
-
-        /* Allocate serialize sizes */
         na_mem_descs->serialize_sizes.d =
-            (na_size_t *) calloc(count, sizeof(na_size_t));
-        HG_CHECK_ERROR(na_mem_descs->serialize_sizes.d == NULL, error, ret,
+            (na_size_t *) malloc(count * sizeof(na_size_t));
+        HG_CHECK_ERROR(na_mem_descs->serialize_sizes.d == NULL, done, ret,
             HG_NOMEM, "Could not allocate serialize sizes array");
 
         na_mem_handles = na_mem_descs->handles.d;
@@ -750,441 +1577,495 @@ hg_bulk_create_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
         na_mem_serialize_sizes = na_mem_descs->serialize_sizes.s;
     }
 
-    for (i = 0; i < count; i++) {
-        /* Skip null segments */
-        if (segments[i].base == (hg_ptr_t) NULL)
-            continue;
+    memcpy(na_mem_handles, &parent_handles[start_index],
+        count * sizeof(na_mem_handle_t));
+    memcpy(na_mem_serialize_sizes, &parent_serialize_sizes[start_index],
+        count * sizeof(na_size_t));
 
-        /* Register segment */
-        ret = hg_bulk_register(na_class, (void *) segments[i].base,
-            segments[i].len, flags, &na_mem_handles[i],
-            &na_mem_serialize_sizes[i]);
-        HG_CHECK_HG_ERROR(error, ret, "Could not register segment");
-    }
-
-    return ret;
-
-error:
+done:
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_free_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
-    na_class_t *na_class, hg_uint32_t count)
+hg_bulk_create_mem_handles(struct hg_bulk *hg_bulk, hg_uint8_t flags)
 {
-    na_mem_handle_t *na_mem_handles;
+    struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
+    hg_uint32_t count = hg_bulk->desc.info.segment_count;
+    hg_core_class_t *core_class = hg_bulk->core_class;
+    na_class_t *na_class = hg_bulk->na_class;
+#ifdef NA_HAS_SM
+    na_class_t *na_sm_class = hg_bulk->na_sm_class;
+#endif
     hg_return_t ret = HG_SUCCESS;
 
-    if (count > HG_BULK_STATIC_MAX) {
-        na_mem_handles = na_mem_descs->handles.d;
-        free(na_mem_descs->serialize_sizes.d);
-    } else
-        na_mem_handles = na_mem_descs->handles.s;
+    /* Query max segment limit that NA plugin can handle */
+    if ((count > 1) && na_class->ops->mem_handle_create_segments) {
+        na_size_t max_segments =
+            na_class->ops->mem_handle_get_max_segments(na_class);
 
-    if (na_mem_handles) {
-        hg_uint32_t i;
+        /* Will use one single descriptor if supported */
+        if ((max_segments > 1) && (count <= max_segments))
+            hg_bulk->desc.info.flags |= HG_BULK_REGV;
 
-        for (i = 0; i < count; i++) {
-            if (na_mem_handles[i] == NA_MEM_HANDLE_NULL)
-                continue;
+#ifdef NA_HAS_SM
+        /* Make sure SM can register as many segments */
+        if (na_sm_class) {
+            na_size_t max_sm_segments =
+                na_sm_class->ops->mem_handle_get_max_segments(na_sm_class);
 
-            ret = hg_bulk_deregister(na_class, na_mem_handles[i]);
-            HG_CHECK_HG_ERROR(done, ret, "Could not deregister segment");
+            HG_CHECK_ERROR(!na_sm_class->ops->mem_handle_create_segments, error,
+                ret, HG_OPNOTSUPPORTED,
+                "Registration of segments not supported with SM");
+            HG_CHECK_ERROR(count > max_sm_segments, error, ret,
+                HG_OPNOTSUPPORTED, "SM class cannot register %zu segments",
+                count);
         }
-        if (count > HG_BULK_STATIC_MAX)
-            free(na_mem_handles);
+#endif
     }
 
-done:
-    return ret;
-}
-
-/*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_bulk_bind(struct hg_bulk *hg_bulk, hg_core_context_t *core_context)
-{
-    hg_return_t ret = HG_SUCCESS;
-
-    HG_CHECK_ERROR(hg_bulk->addr != HG_CORE_ADDR_NULL, done, ret,
-        HG_INVALID_ARG, "Handle is already bound to an existing address");
+    /* Only segments that are registered individually and that were not
+     * allocated internally can be cached */
+    if (!(hg_bulk->desc.info.flags & (HG_BULK_ALLOC | HG_BULK_REGV))) {
+        hg_bulk->reg_cache =
+            hg_core_class_get_bulk_reg_cache(core_class, na_class);
+#ifdef NA_HAS_SM
+        if (na_sm_class)
+            hg_bulk->reg_sm_cache =
+                hg_core_class_get_bulk_reg_cache(core_class, na_sm_class);
+#endif
+    }
 
-    /* Retrieve self address */
-    ret = HG_Core_addr_self(hg_bulk->core_class, &hg_bulk->addr);
-    HG_CHECK_HG_ERROR(done, ret, "Could not get self address");
+    /* Register using one single descriptor if supported */
+    if (hg_bulk->desc.info.flags & HG_BULK_REGV) {
+        /* Register segments */
+        ret =
+            hg_bulk_register_segments(na_class, (struct na_segment *) segments,
+                count, flags, &hg_bulk->na_mem_descs.handles.s[0],
+                &hg_bulk->na_mem_descs.serialize_sizes.s[0]);
+        HG_CHECK_HG_ERROR(error, ret, "Could not register segments");
 
-    /* Add context ID */
-    hg_bulk->context_id = HG_Core_context_get_id(core_context);
+#ifdef NA_HAS_SM
+        if (na_sm_class) {
+            /* Register segments */
+            ret = hg_bulk_register_segments(na_sm_class,
+                (struct na_segment *) segments, count, flags,
+                &hg_bulk->na_sm_mem_descs.handles.s[0],
+                &hg_bulk->na_sm_mem_descs.serialize_sizes.s[0]);
+            HG_CHECK_HG_ERROR(
+                error, ret, "Could not register segments with SM");
+        }
+#endif
+    } else {
+        /* Register segments individually */
+        ret = hg_bulk_create_na_mem_descs(&hg_bulk->na_mem_descs, na_class,
+            hg_bulk->reg_cache, segments, count, flags);
+        HG_CHECK_HG_ERROR(error, ret, "Could not create NA mem descriptors");
 
-    /* Set flags */
-    hg_bulk->desc.info.flags |= HG_BULK_BIND;
+#ifdef NA_HAS_SM
+        if (na_sm_class) {
+            ret = hg_bulk_create_na_mem_descs(&hg_bulk->na_sm_mem_descs,
+                na_sm_class, hg_bulk->reg_sm_cache, segments, count, flags);
+            HG_CHECK_HG_ERROR(
+                error, ret, "Could not create NA SM mem descriptors");
+        }
+#endif
+    }
 
-done:
+error:
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_bulk_register(na_class_t *na_class, void *base, na_size_t len,
-    unsigned long flags, na_mem_handle_t *mem_handle_ptr,
-    na_size_t *serialize_size_ptr)
+static hg_uint32_t
+hg_bulk_coalesce_segments(hg_uint32_t count, void **bufs,
+    const hg_size_t *lens, struct hg_bulk_segment *segments)
 {
-    na_mem_handle_t mem_handle = NA_MEM_HANDLE_NULL;
-    na_size_t serialize_size = 0;
-    hg_bool_t registered = HG_FALSE;
-    hg_return_t ret = HG_SUCCESS;
-    na_return_t na_ret;
-
-    /* Create NA memory handle */
-    na_ret = NA_Mem_handle_create(na_class, base, len, flags, &mem_handle);
-    HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret, (hg_return_t) na_ret,
-        "NA_Mem_handle_create() failed (%s)", NA_Error_to_string(na_ret));
-
-    /* Register NA memory handle */
-    na_ret = NA_Mem_register(na_class, mem_handle);
-    HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret, (hg_return_t) na_ret,
-        "NA_Mem_register() failed (%s)", NA_Error_to_string(na_ret));
-    registered = HG_TRUE;
-
-    /* Cache serialize size */
-    serialize_size = NA_Mem_handle_get_serialize_size(na_class, mem_handle);
-    HG_CHECK_ERROR(serialize_size == 0, error, ret, HG_PROTOCOL_ERROR,
-        "NA_Mem_handle_get_serialize_size() failed");
+    hg_ptr_t end = (hg_ptr_t) NULL;
+    hg_uint32_t i, segment_count = 0;
 
-    *mem_handle_ptr = mem_handle;
-    *serialize_size_ptr = serialize_size;
+    for (i = 0; i < count; i++) {
+        /* Empty segments do not need to be registered */
+        if (lens[i] == 0)
+            continue;
 
-    return ret;
+        if (segment_count > 0 && (hg_ptr_t) bufs[i] == end) {
+            if (segments)
+                segments[segment_count - 1].len += lens[i];
+        } else {
+            if (segments) {
+                segments[segment_count].base = (hg_ptr_t) bufs[i];
+                segments[segment_count].len = lens[i];
+            }
+            segment_count++;
+        }
+        end = (hg_ptr_t) bufs[i] + lens[i];
+    }
 
-error:
-    if (mem_handle != NA_MEM_HANDLE_NULL) {
-        if (registered) {
-            na_ret = NA_Mem_deregister(na_class, mem_handle);
-            HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS,
-                "NA_Mem_deregister() failed (%s)", NA_Error_to_string(na_ret));
+    /* Keep one empty segment if all segments are empty */
+    if (segment_count == 0) {
+        if (segments) {
+            segments[0].base = (hg_ptr_t) bufs[0];
+            segments[0].len = 0;
         }
-        na_ret = NA_Mem_handle_free(na_class, mem_handle);
-        HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS,
-            "NA_Mem_handle_free() failed (%s)", NA_Error_to_string(na_ret));
+        segment_count = 1;
     }
-    return ret;
+
+    return segment_count;
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_bulk_register_segments(na_class_t *na_class, struct na_segment *segments,
-    na_size_t count, unsigned long flags, na_mem_handle_t *mem_handle_ptr,
-    na_size_t *serialize_size_ptr)
+static hg_uint32_t
+hg_bulk_stride_get_count(hg_size_t block_len,
+    const struct hg_bulk_vector *vectors, hg_uint32_t vector_count)
 {
-    na_mem_handle_t mem_handle = NA_MEM_HANDLE_NULL;
-    na_size_t serialize_size = 0;
-    hg_bool_t registered = HG_FALSE;
-    hg_return_t ret = HG_SUCCESS;
-    na_return_t na_ret;
+    hg_uint64_t count = 1;
+    hg_size_t extent = block_len;
+    hg_uint32_t i;
 
-    /* Create NA memory handle */
-    na_ret = NA_Mem_handle_create_segments(
-        na_class, segments, count, flags, &mem_handle);
-    HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret, (hg_return_t) na_ret,
-        "NA_Mem_handle_create_segments() failed (%s)",
-        NA_Error_to_string(na_ret));
+    if (block_len == 0)
+        return 0;
 
-    /* Register NA memory handle */
-    na_ret = NA_Mem_register(na_class, mem_handle);
-    HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret, (hg_return_t) na_ret,
-        "NA_Mem_register() failed (%s)", NA_Error_to_string(na_ret));
-    registered = HG_TRUE;
+    /* Walk from the innermost vector, each one must step over the extent of
+     * the vectors it contains so that blocks never overlap */
+    for (i = vector_count; i > 0; i--) {
+        const struct hg_bulk_vector *vector = &vectors[i - 1];
 
-    /* Cache serialize size */
-    serialize_size = NA_Mem_handle_get_serialize_size(na_class, mem_handle);
-    HG_CHECK_ERROR(serialize_size == 0, error, ret, HG_PROTOCOL_ERROR,
-        "NA_Mem_handle_get_serialize_size() failed");
+        if (vector->count == 0)
+            return 0;
+        count *= vector->count;
+        if (count > HG_BULK_STRIDE_BLOCK_MAX)
+            return 0;
+        if (vector->count == 1)
+            continue;
+        if (vector->stride < extent ||
+            vector->stride > (UINT64_MAX - extent) / (vector->count - 1))
+            return 0;
+        extent += (vector->count - 1) * vector->stride;
+    }
 
-    *mem_handle_ptr = mem_handle;
-    *serialize_size_ptr = serialize_size;
+    return (hg_uint32_t) count;
+}
 
-    return ret;
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_stride_expand(const struct hg_bulk_stride *stride,
+    hg_uint32_t vector_count, struct hg_bulk_segment *segments,
+    hg_uint32_t count)
+{
+    hg_uint32_t indices[HG_BULK_VECTOR_MAX] = {0};
+    hg_uint32_t i;
 
-error:
-    if (mem_handle != NA_MEM_HANDLE_NULL) {
-        if (registered) {
-            na_ret = NA_Mem_deregister(na_class, mem_handle);
-            HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS,
-                "NA_Mem_deregister() failed (%s)", NA_Error_to_string(na_ret));
+    /* Blocks are laid out with the last vector varying the fastest */
+    for (i = 0; i < count; i++) {
+        hg_ptr_t base = stride->base;
+        hg_uint32_t j;
+
+        for (j = 0; j < vector_count; j++)
+            base += indices[j] * stride->vectors[j].stride;
+        segments[i].base = base;
+        segments[i].len = stride->block_len;
+
+        for (j = vector_count; j > 0; j--) {
+            if (++indices[j - 1] < stride->vectors[j - 1].count)
+                break;
+            indices[j - 1] = 0;
         }
-        na_ret = NA_Mem_handle_free(na_class, mem_handle);
-        HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS,
-            "NA_Mem_handle_free() failed (%s)", NA_Error_to_string(na_ret));
     }
-    return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_bulk_deregister(na_class_t *na_class, na_mem_handle_t mem_handle)
+static struct hg_bulk_segment *
+hg_bulk_segments_alloc(hg_uint32_t count)
 {
-    hg_return_t ret = HG_SUCCESS;
-    na_return_t na_ret;
-
-    na_ret = NA_Mem_deregister(na_class, mem_handle);
-    HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
-        "NA_Mem_deregister() failed (%s)", NA_Error_to_string(na_ret));
+    /* Offsets are stored after segments so that they can be looked up from
+     * the segment array */
+    return (struct hg_bulk_segment *) calloc(
+        count, sizeof(struct hg_bulk_segment) + sizeof(hg_size_t));
+}
 
-    na_ret = NA_Mem_handle_free(na_class, mem_handle);
-    HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
-        "NA_Mem_handle_free() failed (%s)", NA_Error_to_string(na_ret));
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_segments_index(struct hg_bulk_segment *segments, hg_uint32_t count)
+{
+    hg_size_t *offsets = HG_BULK_SEGMENT_OFFSETS(segments, count);
+    hg_size_t offset = 0;
+    hg_uint32_t i;
 
-done:
-    return ret;
+    for (i = 0; i < count; i++) {
+        offsets[i] = offset;
+        offset += segments[i].len;
+    }
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_size_t
-hg_bulk_get_serialize_size(struct hg_bulk *hg_bulk, hg_uint8_t flags)
+static hg_return_t
+hg_bulk_free(struct hg_bulk *hg_bulk)
 {
-    hg_size_t ret = 0;
+    struct hg_bulk_segment *segments;
+    hg_return_t ret = HG_SUCCESS;
 
-    /* Descriptor info + segments */
-    ret = sizeof(hg_bulk->desc.info) +
-          hg_bulk->desc.info.segment_count * sizeof(struct hg_bulk_segment);
+    if (!hg_bulk)
+        goto done;
 
-    /* Memory handles */
-    if ((hg_bulk->desc.info.flags & HG_BULK_REGV) ||
-        (hg_bulk->desc.info.segment_count == 1)) {
-        /* Only one single memory handle in that case */
-        if (hg_bulk->na_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL)
-            ret +=
-                hg_bulk->na_mem_descs.serialize_sizes.s[0] + sizeof(na_size_t);
+    /* Cannot free yet */
+    if (hg_atomic_decr32(&hg_bulk->ref_count))
+        goto done;
 
-#ifdef NA_HAS_SM
-        /* Only add SM serialized handles if we're sending over SM, otherwise
-         * skip it. */
-        if ((flags & HG_BULK_SM) &&
-            (hg_bulk->na_sm_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL))
-            ret += hg_bulk->na_sm_mem_descs.serialize_sizes.s[0] +
-                   sizeof(na_size_t);
-#endif
-    } else {
-        ret += hg_bulk_get_serialize_size_mem_descs(
-            &hg_bulk->na_mem_descs, hg_bulk->desc.info.segment_count);
+    segments = (hg_bulk->desc.info.segment_count > HG_BULK_STATIC_MAX)
+                   ? hg_bulk->desc.segments.d
+                   : hg_bulk->desc.segments.s;
 
+    /* Deregister segments */
+    if (hg_bulk->parent) {
+        /* NA handles are released with the parent */
+        if (!(hg_bulk->desc.info.flags & HG_BULK_REGV) &&
+            hg_bulk->desc.info.segment_count > HG_BULK_STATIC_MAX) {
+            free(hg_bulk->na_mem_descs.handles.d);
+            free(hg_bulk->na_mem_descs.serialize_sizes.d);
 #ifdef NA_HAS_SM
-        /* Only add SM serialized handles if we're sending over SM, otherwise
-         * skip it. */
-        if ((flags & HG_BULK_SM) && hg_bulk->na_sm_class)
-            ret += hg_bulk_get_serialize_size_mem_descs(
-                &hg_bulk->na_sm_mem_descs, hg_bulk->desc.info.segment_count);
+            free(hg_bulk->na_sm_mem_descs.handles.d);
+            free(hg_bulk->na_sm_mem_descs.serialize_sizes.d);
 #endif
-    }
+        }
 
-    /* Address information (context ID + serialize size + address) */
-    if (hg_bulk->desc.info.flags & HG_BULK_BIND) {
-        unsigned long addr_flags = 0;
+        ret = hg_bulk_free(hg_bulk->parent);
+        HG_CHECK_HG_ERROR(done, ret, "Could not release parent handle");
+    } else if (hg_bulk->desc.info.flags & HG_BULK_REGV ||
+               (hg_bulk->desc.info.segment_count == 1)) {
+        if (hg_bulk->na_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL) {
+            if (hg_bulk->reg_cache)
+                ret = hg_bulk_reg_cache_deregister(hg_bulk->reg_cache,
+                    (void *) segments[0].base,
+                    hg_bulk->na_mem_descs.handles.s[0]);
+            else
+                ret = hg_bulk_deregister(
+                    hg_bulk->na_class, hg_bulk->na_mem_descs.handles.s[0]);
+            HG_CHECK_HG_ERROR(done, ret, "Could not deregister segment");
+        }
 
 #ifdef NA_HAS_SM
-        if (flags & HG_BULK_SM)
-            addr_flags |= HG_CORE_SM;
+        if (hg_bulk->na_sm_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL) {
+            if (hg_bulk->reg_sm_cache)
+                ret = hg_bulk_reg_cache_deregister(hg_bulk->reg_sm_cache,
+                    (void *) segments[0].base,
+                    hg_bulk->na_sm_mem_descs.handles.s[0]);
+            else
+                ret = hg_bulk_deregister(hg_bulk->na_sm_class,
+                    hg_bulk->na_sm_mem_descs.handles.s[0]);
+            HG_CHECK_HG_ERROR(
+                done, ret, "Could not deregister segment with SM");
+        }
+#endif
+    } else {
+        /* Free segments individually */
+        ret = hg_bulk_free_na_mem_descs(&hg_bulk->na_mem_descs,
+            hg_bulk->na_class, hg_bulk->reg_cache, segments,
+            hg_bulk->desc.info.segment_count);
+        HG_CHECK_HG_ERROR(done, ret, "Could not free NA mem descriptors");
+
+#ifdef NA_HAS_SM
+        if (hg_bulk->na_sm_class) {
+            ret = hg_bulk_free_na_mem_descs(&hg_bulk->na_sm_mem_descs,
+                hg_bulk->na_sm_class, hg_bulk->reg_sm_cache, segments,
+                hg_bulk->desc.info.segment_count);
+            HG_CHECK_HG_ERROR(
+                done, ret, "Could not free NA SM mem descriptors");
+        }
 #endif
-        ret += sizeof(hg_uint8_t) + sizeof(hg_size_t) +
-               HG_Core_addr_get_serialize_size(hg_bulk->addr, addr_flags);
     }
 
-    /* Eager mode (in eager mode, the actual data will be copied) */
-    if ((flags & HG_BULK_EAGER) &&
-        (hg_bulk->desc.info.flags & HG_BULK_READ_ONLY) &&
-        !(hg_bulk->desc.info.flags & HG_BULK_VIRT))
-        ret += hg_bulk->desc.info.len;
+    /* Free addr if any was attached to handle */
+    if (hg_bulk->desc.info.flags & HG_BULK_BIND) {
+        ret = HG_Core_addr_free(hg_bulk->addr);
+        HG_CHECK_HG_ERROR(done, ret, "Could not free addr");
+    }
 
-    return ret;
-}
+    /* Free segments if we allocated them */
+    if (hg_bulk->desc.info.flags & HG_BULK_ALLOC) {
+        hg_uint32_t i;
 
-/*---------------------------------------------------------------------------*/
-static hg_size_t
-hg_bulk_get_serialize_size_mem_descs(
-    struct hg_bulk_na_mem_desc *na_mem_descs, hg_uint32_t count)
-{
-    na_mem_handle_t *na_mem_handles;
-    na_size_t *na_mem_serialize_sizes;
-    hg_uint32_t i;
-    hg_size_t ret = 0;
+        for (i = 0; i < hg_bulk->desc.info.segment_count; i++)
+            free((void *) segments[i].base);
+    }
 
-    if (count > HG_BULK_STATIC_MAX) {
-        na_mem_handles = na_mem_descs->handles.d;
-        na_mem_serialize_sizes = na_mem_descs->serialize_sizes.d;
-    } else {
-        na_mem_handles = na_mem_descs->handles.s;
-        na_mem_serialize_sizes = na_mem_descs->serialize_sizes.s;
+    if (hg_bulk->desc.info.segment_count > HG_BULK_STATIC_MAX)
+        free(segments);
+
+    if (hg_bulk->eager_write) {
+        hg_thread_spin_destroy(&hg_bulk->eager_write->lock);
+        free(hg_bulk->eager_write->buf);
+        free(hg_bulk->eager_write);
     }
 
-    /* Serialize sizes */
-    ret += count * sizeof(na_size_t);
+    hg_bulk_compressed_free(hg_bulk->compressed);
+    if (hg_bulk->compress_copy) {
+        hg_return_t hg_ret = hg_bulk_free(hg_bulk->compress_copy);
+        HG_CHECK_ERROR_DONE(
+            hg_ret != HG_SUCCESS, "Could not free compressed copy");
+    }
+    if (hg_bulk->checksum) {
+        free(hg_bulk->checksum->crcs);
+        free(hg_bulk->checksum);
+    }
 
-    for (i = 0; i < count; i++)
-        if (na_mem_handles[i] != NA_MEM_HANDLE_NULL)
-            ret += na_mem_serialize_sizes[i];
+    free(hg_bulk);
 
+done:
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_serialize(
-    void *buf, hg_size_t buf_size, hg_uint8_t flags, struct hg_bulk *hg_bulk)
+hg_bulk_pool_create(hg_core_class_t *core_class, hg_size_t block_size,
+    hg_uint32_t count, hg_uint8_t flags,
+    struct hg_bulk_pool **hg_bulk_pool_ptr)
 {
-    struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
-    char *buf_ptr = (char *) buf;
-    hg_size_t buf_size_left = buf_size;
-    struct hg_bulk_desc_info desc_info = hg_bulk->desc.info;
+    struct hg_bulk_pool *hg_bulk_pool = NULL;
+    unsigned int queue_size = 2;
+    hg_uint32_t i;
     hg_return_t ret = HG_SUCCESS;
 
-    /* Always reset bulk alloc flag (only local) */
-    desc_info.flags &= (~HG_BULK_ALLOC & 0xff);
-
-    /* Add eager flag to descriptor */
-    if ((flags & HG_BULK_EAGER) && (desc_info.flags & HG_BULK_READ_ONLY) &&
-        !(hg_bulk->desc.info.flags & HG_BULK_VIRT)) {
-        HG_LOG_DEBUG("HG_BULK_EAGER flag set");
-        desc_info.flags |= HG_BULK_EAGER;
-    } else
-        desc_info.flags &= (~HG_BULK_EAGER & 0xff);
-
-#ifdef NA_HAS_SM
-    /* Add SM flag */
-    if (flags & HG_BULK_SM) {
-        HG_LOG_DEBUG("HG_BULK_SM flag set");
-        desc_info.flags |= HG_BULK_SM;
-    } else
-        desc_info.flags &= (~HG_BULK_SM & 0xff);
-#endif
-
-    HG_LOG_DEBUG("Serializing bulk handle with %u segment(s), len is %zu bytes",
-        hg_bulk->desc.info.segment_count, hg_bulk->desc.info.len);
+    hg_bulk_pool = (struct hg_bulk_pool *) calloc(1, sizeof(*hg_bulk_pool));
+    HG_CHECK_ERROR(
+        hg_bulk_pool == NULL, error, ret, HG_NOMEM, "Could not allocate pool");
+    hg_bulk_pool->count = count;
+
+    /* Buffers start on cache line boundaries */
+    hg_bulk_pool->block_stride = (block_size + HG_MEM_CACHE_LINE_SIZE - 1) &
+                                 ~((hg_size_t) HG_MEM_CACHE_LINE_SIZE - 1);
+    hg_bulk_pool->len = hg_bulk_pool->block_stride * count;
+    hg_bulk_pool->buf =
+        hg_mem_aligned_alloc(HG_MEM_PAGE_SIZE, hg_bulk_pool->len);
+    HG_CHECK_ERROR(hg_bulk_pool->buf == NULL, error, ret, HG_NOMEM,
+        "Could not allocate pool buffers");
+    memset(hg_bulk_pool->buf, 0, hg_bulk_pool->len);
+
+    /* Register all the buffers at once */
+    ret = hg_bulk_create(core_class, 1, &hg_bulk_pool->buf, &hg_bulk_pool->len,
+        flags, &hg_bulk_pool->hg_bulk);
+    HG_CHECK_HG_ERROR(error, ret, "Could not create pool handle");
+
+    hg_bulk_pool->blocks =
+        (struct hg_bulk **) calloc(count, sizeof(struct hg_bulk *));
+    HG_CHECK_ERROR(hg_bulk_pool->blocks == NULL, error, ret, HG_NOMEM,
+        "Could not allocate array of handles");
+
+    hg_bulk_pool->in_use =
+        (hg_atomic_int32_t *) malloc(count * sizeof(hg_atomic_int32_t));
+    HG_CHECK_ERROR(hg_bulk_pool->in_use == NULL, error, ret, HG_NOMEM,
+        "Could not allocate array of buffer states");
+    for (i = 0; i < count; i++)
+        hg_atomic_init32(&hg_bulk_pool->in_use[i], 0);
 
-    /* Descriptor info */
-    HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left, &desc_info,
-        struct hg_bulk_desc_info);
+    /* Queue size must be a power of 2 and can only hold size - 1 entries */
+    while (queue_size <= count)
+        queue_size <<= 1;
+    hg_bulk_pool->free_queue = hg_atomic_queue_alloc(queue_size);
+    HG_CHECK_ERROR(hg_bulk_pool->free_queue == NULL, error, ret, HG_NOMEM,
+        "Could not allocate queue of free handles");
 
-    /* Segments */
-    HG_BULK_ENCODE_ARRAY(done, ret, buf_ptr, buf_size_left, segments,
-        struct hg_bulk_segment, desc_info.segment_count);
+    for (i = 0; i < count; i++) {
+        ret = hg_bulk_create_view(hg_bulk_pool->hg_bulk,
+            i * hg_bulk_pool->block_stride, block_size,
+            &hg_bulk_pool->blocks[i]);
+        HG_CHECK_HG_ERROR(error, ret, "Could not create handle of buffer");
 
-    /* TODO if eager or self flag, skip mem handles ? */
+        hg_atomic_queue_push(hg_bulk_pool->free_queue, hg_bulk_pool->blocks[i]);
+    }
 
-    /* Add the NA memory handles */
-    if ((desc_info.flags & HG_BULK_REGV) || (desc_info.segment_count == 1)) {
-        /* N.B. skip serialize size if no handle */
-        if (hg_bulk->na_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL) {
-            na_return_t na_ret;
+    *hg_bulk_pool_ptr = hg_bulk_pool;
 
-            HG_LOG_DEBUG("Serializing single NA memory handle");
+    return ret;
 
-            HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left,
-                &hg_bulk->na_mem_descs.serialize_sizes.s[0], na_size_t);
+error:
+    if (hg_bulk_pool)
+        hg_bulk_pool_destroy(hg_bulk_pool, HG_TRUE);
 
-            na_ret = NA_Mem_handle_serialize(hg_bulk->na_class, buf_ptr,
-                buf_size_left, hg_bulk->na_mem_descs.handles.s[0]);
-            HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret,
-                (hg_return_t) na_ret, "Could not serialize memory handle (%s)",
-                NA_Error_to_string(na_ret));
-            buf_ptr += hg_bulk->na_mem_descs.serialize_sizes.s[0];
-            buf_size_left -= hg_bulk->na_mem_descs.serialize_sizes.s[0];
-        }
+    return ret;
+}
 
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_pool_destroy(struct hg_bulk_pool *hg_bulk_pool, hg_bool_t force)
+{
+    struct hg_bulk_reg_cache *reg_cache = NULL;
 #ifdef NA_HAS_SM
-        /* Only add SM serialized handles if we're sending over SM, otherwise
-         * skip then. */
-        if ((desc_info.flags & HG_BULK_SM) &&
-            (hg_bulk->na_sm_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL)) {
-            na_return_t na_ret;
-
-            HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left,
-                &hg_bulk->na_sm_mem_descs.serialize_sizes.s[0], na_size_t);
-
-            na_ret = NA_Mem_handle_serialize(hg_bulk->na_sm_class, buf_ptr,
-                buf_size_left, hg_bulk->na_sm_mem_descs.handles.s[0]);
-            HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret,
-                (hg_return_t) na_ret,
-                "Could not serialize SM memory handle (%s)",
-                NA_Error_to_string(na_ret));
-            buf_ptr += hg_bulk->na_sm_mem_descs.serialize_sizes.s[0];
-            buf_size_left -= hg_bulk->na_sm_mem_descs.serialize_sizes.s[0];
-        }
+    struct hg_bulk_reg_cache *reg_sm_cache = NULL;
 #endif
-    } else {
-        HG_LOG_DEBUG("Serializing %u NA memory handle(s)",
-            hg_bulk->desc.info.segment_count);
+    hg_uint32_t i;
+    hg_return_t ret = HG_SUCCESS;
 
-        ret = hg_bulk_serialize_mem_descs(hg_bulk->na_class, &buf_ptr,
-            &buf_size_left, &hg_bulk->na_mem_descs, segments,
-            desc_info.segment_count);
-        HG_CHECK_HG_ERROR(done, ret, "Could not serialize NA mem descriptors");
+    /* Partially created pools are always released */
+    if (!force)
+        HG_CHECK_ERROR(hg_atomic_queue_count(hg_bulk_pool->free_queue) !=
+                           hg_bulk_pool->count,
+            done, ret, HG_BUSY, "Pool handles are still in use");
 
-#ifdef NA_HAS_SM
-        /* Only add SM serialized handles if we're sending over SM, otherwise
-         * skip it. */
-        if ((desc_info.flags & HG_BULK_SM) && hg_bulk->na_sm_class) {
-            ret = hg_bulk_serialize_mem_descs(hg_bulk->na_sm_class, &buf_ptr,
-                &buf_size_left, &hg_bulk->na_sm_mem_descs, segments,
-                desc_info.segment_count);
-            HG_CHECK_HG_ERROR(
-                done, ret, "Could not serialize NA SM mem descriptors");
+    if (hg_bulk_pool->free_queue) {
+        hg_atomic_queue_free(hg_bulk_pool->free_queue);
+        hg_bulk_pool->free_queue = NULL;
+    }
+    free(hg_bulk_pool->in_use);
+    hg_bulk_pool->in_use = NULL;
+
+    if (hg_bulk_pool->blocks) {
+        for (i = 0; i < hg_bulk_pool->count; i++) {
+            ret = hg_bulk_free(hg_bulk_pool->blocks[i]);
+            HG_CHECK_HG_ERROR(done, ret, "Could not free handle of buffer");
+            hg_bulk_pool->blocks[i] = NULL;
         }
-#endif
+        free(hg_bulk_pool->blocks);
+        hg_bulk_pool->blocks = NULL;
     }
 
-    /* Address information */
-    if (desc_info.flags & HG_BULK_BIND) {
-        hg_size_t serialize_size;
-        unsigned long addr_flags = 0;
-
-        HG_LOG_DEBUG("HG_BULK_BIND flag set, serializing address information");
-
+    if (hg_bulk_pool->hg_bulk) {
+        reg_cache = hg_bulk_pool->hg_bulk->reg_cache;
 #ifdef NA_HAS_SM
-        if (flags & HG_BULK_SM)
-            addr_flags |= HG_CORE_SM;
+        reg_sm_cache = hg_bulk_pool->hg_bulk->reg_sm_cache;
 #endif
-
-        serialize_size =
-            HG_Core_addr_get_serialize_size(hg_bulk->addr, addr_flags);
-
-        HG_BULK_ENCODE(
-            done, ret, buf_ptr, buf_size_left, &serialize_size, hg_size_t);
-
-        ret = HG_Core_addr_serialize(
-            buf_ptr, buf_size_left, addr_flags, hg_bulk->addr);
-        HG_CHECK_HG_ERROR(done, ret, "Could not serialize address");
-        buf_ptr += serialize_size;
-        buf_size_left -= serialize_size;
-
-        /* Add context ID */
-        HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left, &hg_bulk->context_id,
-            hg_uint8_t);
+        ret = hg_bulk_free(hg_bulk_pool->hg_bulk);
+        HG_CHECK_HG_ERROR(done, ret, "Could not free pool handle");
+        hg_bulk_pool->hg_bulk = NULL;
     }
 
-    /* Add the serialized data if eager mode is requested */
-    if (desc_info.flags & HG_BULK_EAGER) {
-        hg_uint32_t i;
-
-        HG_LOG_DEBUG("Serializing eager bulk data, %u segment(s)",
-            hg_bulk->desc.info.segment_count);
-        for (i = 0; i < desc_info.segment_count; i++) {
-            if (!segments[i].len)
-                continue;
-
-            HG_BULK_ENCODE_ARRAY(done, ret, buf_ptr, buf_size_left,
-                (const void *) segments[i].base, char, segments[i].len);
-        }
+    /* Registration may have been kept by cache */
+    if (reg_cache) {
+        ret = hg_bulk_reg_cache_invalidate(
+            reg_cache, (hg_ptr_t) hg_bulk_pool->buf, hg_bulk_pool->len);
+        HG_CHECK_HG_ERROR(done, ret, "Could not invalidate registration");
     }
+#ifdef NA_HAS_SM
+    if (reg_sm_cache) {
+        ret = hg_bulk_reg_cache_invalidate(
+            reg_sm_cache, (hg_ptr_t) hg_bulk_pool->buf, hg_bulk_pool->len);
+        HG_CHECK_HG_ERROR(done, ret, "Could not invalidate SM registration");
+    }
+#endif
+
+    hg_mem_aligned_free(hg_bulk_pool->buf);
+    free(hg_bulk_pool);
 
 done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_uint32_t
+hg_bulk_pool_index(
+    const struct hg_bulk_pool *hg_bulk_pool, const struct hg_bulk *hg_bulk)
+{
+    const struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
+
+    return (hg_uint32_t) ((segments[0].base - (hg_ptr_t) hg_bulk_pool->buf) /
+                          hg_bulk_pool->block_stride);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_serialize_mem_descs(na_class_t *na_class, char **buf_ptr,
-    hg_size_t *buf_size_left, struct hg_bulk_na_mem_desc *na_mem_descs,
-    const struct hg_bulk_segment *segments, hg_uint32_t count)
+hg_bulk_create_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
+    na_class_t *na_class, struct hg_bulk_reg_cache *reg_cache,
+    struct hg_bulk_segment *segments, hg_uint32_t count, hg_uint8_t flags)
 {
     na_mem_handle_t *na_mem_handles;
     na_size_t *na_mem_serialize_sizes;
@@ -1192,6 +2073,18 @@ hg_bulk_serialize_mem_descs(na_class_t *na_class, char **buf_ptr,
     hg_uint32_t i;
 
     if (count > HG_BULK_STATIC_MAX) {
+        /* Allocate NA memory handles */
+        na_mem_descs->handles.d =
+            (na_mem_handle_t *) calloc(count, sizeof(na_mem_handle_t));
+        HG_CHECK_ERROR(na_mem_descs->handles.d == NULL, error, ret, HG_NOMEM,
+            "Could not allocate mem handle array");
+
+        /* Allocate serialize sizes */
+        na_mem_descs->serialize_sizes.d =
+            (na_size_t *) calloc(count, sizeof(na_size_t));
+        HG_CHECK_ERROR(na_mem_descs->serialize_sizes.d == NULL, error, ret,
+            HG_NOMEM, "Could not allocate serialize sizes array");
+
         na_mem_handles = na_mem_descs->handles.d;
         na_mem_serialize_sizes = na_mem_descs->serialize_sizes.d;
     } else {
@@ -1199,529 +2092,3864 @@ hg_bulk_serialize_mem_descs(na_class_t *na_class, char **buf_ptr,
         na_mem_serialize_sizes = na_mem_descs->serialize_sizes.s;
     }
 
-    /* Encode serialize sizes */
-    HG_BULK_ENCODE_ARRAY(done, ret, *buf_ptr, *buf_size_left,
-        na_mem_serialize_sizes, na_size_t, count);
-
     for (i = 0; i < count; i++) {
-        na_return_t na_ret;
-
         /* Skip null segments */
         if (segments[i].base == (hg_ptr_t) NULL)
             continue;
 
-        na_ret = NA_Mem_handle_serialize(
-            na_class, *buf_ptr, *buf_size_left, na_mem_handles[i]);
-        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
-            "Could not serialize memory handle (%s)",
-            NA_Error_to_string(na_ret));
-
-        *buf_ptr += na_mem_serialize_sizes[i];
-        *buf_size_left -= na_mem_serialize_sizes[i];
+        /* Register segment (empty segments cannot be invalidated and are
+         * therefore never cached) */
+        if (reg_cache && segments[i].len > 0)
+            ret = hg_bulk_reg_cache_register(reg_cache,
+                (void *) segments[i].base, segments[i].len, flags,
+                &na_mem_handles[i], &na_mem_serialize_sizes[i]);
+        else
+            ret = hg_bulk_register(na_class, (void *) segments[i].base,
+                segments[i].len, flags, &na_mem_handles[i],
+                &na_mem_serialize_sizes[i]);
+        HG_CHECK_HG_ERROR(error, ret, "Could not register segment");
     }
 
-done:
+    return ret;
+
+error:
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_deserialize(hg_core_class_t *core_class, struct hg_bulk **hg_bulk_ptr,
-    const void *buf, hg_size_t buf_size)
+hg_bulk_free_na_mem_descs(struct hg_bulk_na_mem_desc *na_mem_descs,
+    na_class_t *na_class, struct hg_bulk_reg_cache *reg_cache,
+    const struct hg_bulk_segment *segments, hg_uint32_t count)
 {
-    struct hg_bulk *hg_bulk = NULL;
-    struct hg_bulk_segment *segments;
-    const char *buf_ptr = (const char *) buf;
-    hg_size_t buf_size_left = buf_size;
+    na_mem_handle_t *na_mem_handles;
     hg_return_t ret = HG_SUCCESS;
 
-    hg_bulk = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
-    HG_CHECK_ERROR(
+    if (count > HG_BULK_STATIC_MAX) {
+        na_mem_handles = na_mem_descs->handles.d;
+        free(na_mem_descs->serialize_sizes.d);
+    } else
+        na_mem_handles = na_mem_descs->handles.s;
+
+    if (na_mem_handles) {
+        hg_uint32_t i;
+
+        for (i = 0; i < count; i++) {
+            if (na_mem_handles[i] == NA_MEM_HANDLE_NULL)
+                continue;
+
+            if (reg_cache && segments[i].len > 0)
+                ret = hg_bulk_reg_cache_deregister(
+                    reg_cache, (void *) segments[i].base, na_mem_handles[i]);
+            else
+                ret = hg_bulk_deregister(na_class, na_mem_handles[i]);
+            HG_CHECK_HG_ERROR(done, ret, "Could not deregister segment");
+        }
+        if (count > HG_BULK_STATIC_MAX)
+            free(na_mem_handles);
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_bind(struct hg_bulk *hg_bulk, hg_core_context_t *core_context)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(hg_bulk->addr != HG_CORE_ADDR_NULL, done, ret,
+        HG_INVALID_ARG, "Handle is already bound to an existing address");
+
+    /* Handles retrieved from the descriptor cache must no longer be shared */
+    if (hg_bulk->desc_cached) {
+        ret = hg_bulk_desc_cache_detach(
+            hg_core_class_get_bulk_desc_cache(hg_bulk->core_class), hg_bulk);
+        HG_CHECK_HG_ERROR(done, ret, "Could not detach handle from cache");
+    }
+
+    /* Retrieve self address */
+    ret = HG_Core_addr_self(hg_bulk->core_class, &hg_bulk->addr);
+    HG_CHECK_HG_ERROR(done, ret, "Could not get self address");
+
+    /* Add context ID */
+    hg_bulk->context_id = HG_Core_context_get_id(core_context);
+
+    /* Set flags */
+    hg_bulk->desc.info.flags |= HG_BULK_BIND;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_register(na_class_t *na_class, void *base, na_size_t len,
+    unsigned long flags, na_mem_handle_t *mem_handle_ptr,
+    na_size_t *serialize_size_ptr)
+{
+    na_mem_handle_t mem_handle = NA_MEM_HANDLE_NULL;
+    na_size_t serialize_size = 0;
+    hg_bool_t registered = HG_FALSE;
+    hg_return_t ret = HG_SUCCESS;
+    na_return_t na_ret;
+
+    /* Create NA memory handle */
+    na_ret = NA_Mem_handle_create(na_class, base, len, flags, &mem_handle);
+    HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret, (hg_return_t) na_ret,
+        "NA_Mem_handle_create() failed (%s)", NA_Error_to_string(na_ret));
+
+    /* Register NA memory handle */
+    na_ret = NA_Mem_register(na_class, mem_handle);
+    HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret, (hg_return_t) na_ret,
+        "NA_Mem_register() failed (%s)", NA_Error_to_string(na_ret));
+    registered = HG_TRUE;
+
+    /* Cache serialize size */
+    serialize_size = NA_Mem_handle_get_serialize_size(na_class, mem_handle);
+    HG_CHECK_ERROR(serialize_size == 0, error, ret, HG_PROTOCOL_ERROR,
+        "NA_Mem_handle_get_serialize_size() failed");
+
+    *mem_handle_ptr = mem_handle;
+    *serialize_size_ptr = serialize_size;
+
+    return ret;
+
+error:
+    if (mem_handle != NA_MEM_HANDLE_NULL) {
+        if (registered) {
+            na_ret = NA_Mem_deregister(na_class, mem_handle);
+            HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS,
+                "NA_Mem_deregister() failed (%s)", NA_Error_to_string(na_ret));
+        }
+        na_ret = NA_Mem_handle_free(na_class, mem_handle);
+        HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS,
+            "NA_Mem_handle_free() failed (%s)", NA_Error_to_string(na_ret));
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_register_segments(na_class_t *na_class, struct na_segment *segments,
+    na_size_t count, unsigned long flags, na_mem_handle_t *mem_handle_ptr,
+    na_size_t *serialize_size_ptr)
+{
+    na_mem_handle_t mem_handle = NA_MEM_HANDLE_NULL;
+    na_size_t serialize_size = 0;
+    hg_bool_t registered = HG_FALSE;
+    hg_return_t ret = HG_SUCCESS;
+    na_return_t na_ret;
+
+    /* Create NA memory handle */
+    na_ret = NA_Mem_handle_create_segments(
+        na_class, segments, count, flags, &mem_handle);
+    HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret, (hg_return_t) na_ret,
+        "NA_Mem_handle_create_segments() failed (%s)",
+        NA_Error_to_string(na_ret));
+
+    /* Register NA memory handle */
+    na_ret = NA_Mem_register(na_class, mem_handle);
+    HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret, (hg_return_t) na_ret,
+        "NA_Mem_register() failed (%s)", NA_Error_to_string(na_ret));
+    registered = HG_TRUE;
+
+    /* Cache serialize size */
+    serialize_size = NA_Mem_handle_get_serialize_size(na_class, mem_handle);
+    HG_CHECK_ERROR(serialize_size == 0, error, ret, HG_PROTOCOL_ERROR,
+        "NA_Mem_handle_get_serialize_size() failed");
+
+    *mem_handle_ptr = mem_handle;
+    *serialize_size_ptr = serialize_size;
+
+    return ret;
+
+error:
+    if (mem_handle != NA_MEM_HANDLE_NULL) {
+        if (registered) {
+            na_ret = NA_Mem_deregister(na_class, mem_handle);
+            HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS,
+                "NA_Mem_deregister() failed (%s)", NA_Error_to_string(na_ret));
+        }
+        na_ret = NA_Mem_handle_free(na_class, mem_handle);
+        HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS,
+            "NA_Mem_handle_free() failed (%s)", NA_Error_to_string(na_ret));
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_deregister(na_class_t *na_class, na_mem_handle_t mem_handle)
+{
+    hg_return_t ret = HG_SUCCESS;
+    na_return_t na_ret;
+
+    na_ret = NA_Mem_deregister(na_class, mem_handle);
+    HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+        "NA_Mem_deregister() failed (%s)", NA_Error_to_string(na_ret));
+
+    na_ret = NA_Mem_handle_free(na_class, mem_handle);
+    HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+        "NA_Mem_handle_free() failed (%s)", NA_Error_to_string(na_ret));
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_reg_cache_create(na_class_t *na_class, hg_size_t max_size,
+    struct hg_bulk_reg_cache **hg_bulk_reg_cache_ptr)
+{
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_bulk_reg_cache =
+        (struct hg_bulk_reg_cache *) malloc(sizeof(struct hg_bulk_reg_cache));
+    HG_CHECK_ERROR(hg_bulk_reg_cache == NULL, done, ret, HG_NOMEM,
+        "Could not allocate registration cache");
+    memset(hg_bulk_reg_cache, 0, sizeof(struct hg_bulk_reg_cache));
+
+    hg_bulk_reg_cache->na_class = na_class;
+    hg_bulk_reg_cache->max_size = max_size;
+    hg_thread_spin_init(&hg_bulk_reg_cache->lock);
+
+    HG_LOG_DEBUG("Created registration cache (%p) of %zu bytes",
+        hg_bulk_reg_cache, max_size);
+
+    *hg_bulk_reg_cache_ptr = hg_bulk_reg_cache;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_reg_cache_destroy(struct hg_bulk_reg_cache *hg_bulk_reg_cache)
+{
+    struct hg_bulk_reg_entry *release_list = NULL;
+    na_class_t *na_class;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_LOG_DEBUG("Destroying registration cache (%p)", hg_bulk_reg_cache);
+
+    /* Handles still refer to cached registrations, keep cache */
+    HG_CHECK_ERROR(hg_bulk_reg_cache_in_use(hg_bulk_reg_cache), done, ret,
+        HG_BUSY, "Cached registrations are still in use by bulk handles");
+
+    /* Release all registrations */
+    while (hg_bulk_reg_cache->root) {
+        struct hg_bulk_reg_entry *hg_bulk_reg_entry = hg_bulk_reg_cache->root;
+
+        hg_bulk_reg_cache_remove(hg_bulk_reg_cache, hg_bulk_reg_entry);
+        hg_bulk_reg_entry->next = release_list;
+        release_list = hg_bulk_reg_entry;
+    }
+
+    na_class = hg_bulk_reg_cache->na_class;
+    hg_thread_spin_destroy(&hg_bulk_reg_cache->lock);
+    free(hg_bulk_reg_cache);
+
+    /* Cache is gone even if some registrations could not be released */
+    ret = hg_bulk_reg_cache_release(na_class, release_list);
+    HG_CHECK_HG_ERROR(done, ret, "Could not release cached registrations");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bool_t
+hg_bulk_reg_cache_in_use(struct hg_bulk_reg_cache *hg_bulk_reg_cache)
+{
+    hg_bool_t in_use;
+
+    hg_thread_spin_lock(&hg_bulk_reg_cache->lock);
+    in_use = hg_bulk_reg_tree_in_use(hg_bulk_reg_cache->root);
+    hg_thread_spin_unlock(&hg_bulk_reg_cache->lock);
+
+    return in_use;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_reg_cache_register(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    void *base, na_size_t len, unsigned long flags,
+    na_mem_handle_t *mem_handle_ptr, na_size_t *serialize_size_ptr)
+{
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry = NULL, *release_list = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_thread_spin_lock(&hg_bulk_reg_cache->lock);
+    hg_bulk_reg_entry = hg_bulk_reg_tree_find(
+        hg_bulk_reg_cache->root, (hg_ptr_t) base, len, flags);
+    if (hg_bulk_reg_entry) {
+        /* Entry is no longer candidate for eviction */
+        if (hg_bulk_reg_entry->ref_count++ == 0)
+            hg_bulk_reg_lru_remove(hg_bulk_reg_cache, hg_bulk_reg_entry);
+        hg_bulk_reg_cache->stats.hits++;
+        hg_thread_spin_unlock(&hg_bulk_reg_cache->lock);
+
+        *mem_handle_ptr = hg_bulk_reg_entry->mem_handle;
+        *serialize_size_ptr = hg_bulk_reg_entry->serialize_size;
+
+        return ret;
+    }
+    hg_bulk_reg_cache->stats.misses++;
+    hg_thread_spin_unlock(&hg_bulk_reg_cache->lock);
+
+    /* Regions that could never fit are not cached */
+    if (len > hg_bulk_reg_cache->max_size) {
+        ret = hg_bulk_register(hg_bulk_reg_cache->na_class, base, len, flags,
+            mem_handle_ptr, serialize_size_ptr);
+        HG_CHECK_HG_ERROR(error, ret, "Could not register segment");
+
+        return ret;
+    }
+
+    hg_bulk_reg_entry =
+        (struct hg_bulk_reg_entry *) malloc(sizeof(struct hg_bulk_reg_entry));
+    HG_CHECK_ERROR(hg_bulk_reg_entry == NULL, error, ret, HG_NOMEM,
+        "Could not allocate registration entry");
+    memset(hg_bulk_reg_entry, 0, sizeof(struct hg_bulk_reg_entry));
+
+    /* Register outside of lock, concurrent misses may register the same
+     * region twice, in which case both entries are cached */
+    ret = hg_bulk_register(hg_bulk_reg_cache->na_class, base, len, flags,
+        &hg_bulk_reg_entry->mem_handle, &hg_bulk_reg_entry->serialize_size);
+    HG_CHECK_HG_ERROR(error, ret, "Could not register segment");
+
+    hg_bulk_reg_entry->base = (hg_ptr_t) base;
+    hg_bulk_reg_entry->len = len;
+    hg_bulk_reg_entry->flags = flags;
+    hg_bulk_reg_entry->ref_count = 1;
+
+    hg_thread_spin_lock(&hg_bulk_reg_cache->lock);
+    hg_bulk_reg_cache->root =
+        hg_bulk_reg_tree_insert(hg_bulk_reg_cache->root, hg_bulk_reg_entry);
+    hg_bulk_reg_cache->stats.size += len;
+    hg_bulk_reg_cache->stats.count++;
+    hg_bulk_reg_cache_evict(hg_bulk_reg_cache, &release_list);
+    hg_thread_spin_unlock(&hg_bulk_reg_cache->lock);
+
+    *mem_handle_ptr = hg_bulk_reg_entry->mem_handle;
+    *serialize_size_ptr = hg_bulk_reg_entry->serialize_size;
+
+    /* Evicted entries are not needed for this registration to succeed */
+    if (release_list) {
+        hg_return_t hg_ret = hg_bulk_reg_cache_release(
+            hg_bulk_reg_cache->na_class, release_list);
+        HG_CHECK_ERROR_DONE(
+            hg_ret != HG_SUCCESS, "Could not release evicted registrations");
+    }
+
+    return ret;
+
+error:
+    free(hg_bulk_reg_entry);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_reg_cache_deregister(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    void *base, na_mem_handle_t mem_handle)
+{
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry, *release_list = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_thread_spin_lock(&hg_bulk_reg_cache->lock);
+    hg_bulk_reg_entry = hg_bulk_reg_tree_find_handle(
+        hg_bulk_reg_cache->root, (hg_ptr_t) base, mem_handle);
+    if (!hg_bulk_reg_entry) {
+        hg_thread_spin_unlock(&hg_bulk_reg_cache->lock);
+
+        /* Registration was not cached */
+        ret = hg_bulk_deregister(hg_bulk_reg_cache->na_class, mem_handle);
+        HG_CHECK_HG_ERROR(done, ret, "Could not deregister segment");
+
+        goto done;
+    }
+
+    if (--hg_bulk_reg_entry->ref_count == 0) {
+        if (hg_bulk_reg_entry->invalid) {
+            /* Memory is no longer valid, release registration now */
+            hg_bulk_reg_cache_remove(hg_bulk_reg_cache, hg_bulk_reg_entry);
+            hg_bulk_reg_entry->next = release_list;
+            release_list = hg_bulk_reg_entry;
+        } else {
+            hg_bulk_reg_lru_insert(hg_bulk_reg_cache, hg_bulk_reg_entry);
+            hg_bulk_reg_cache_evict(hg_bulk_reg_cache, &release_list);
+        }
+    }
+    hg_thread_spin_unlock(&hg_bulk_reg_cache->lock);
+
+    ret = hg_bulk_reg_cache_release(hg_bulk_reg_cache->na_class, release_list);
+    HG_CHECK_HG_ERROR(done, ret, "Could not release cached registrations");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_reg_cache_invalidate(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    hg_ptr_t base, hg_size_t len)
+{
+    struct hg_bulk_reg_entry *overlap_list = NULL, *release_list = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_thread_spin_lock(&hg_bulk_reg_cache->lock);
+    hg_bulk_reg_tree_overlap(
+        hg_bulk_reg_cache->root, base, base + (hg_ptr_t) len, &overlap_list);
+    while (overlap_list) {
+        struct hg_bulk_reg_entry *hg_bulk_reg_entry = overlap_list;
+
+        overlap_list = hg_bulk_reg_entry->next;
+        if (hg_bulk_reg_entry->invalid)
+            continue;
+
+        hg_bulk_reg_entry->invalid = HG_TRUE;
+        hg_bulk_reg_cache->stats.invalidations++;
+
+        /* Entries in use are released when their last handle is freed */
+        if (hg_bulk_reg_entry->ref_count == 0) {
+            hg_bulk_reg_lru_remove(hg_bulk_reg_cache, hg_bulk_reg_entry);
+            hg_bulk_reg_cache_remove(hg_bulk_reg_cache, hg_bulk_reg_entry);
+            hg_bulk_reg_entry->next = release_list;
+            release_list = hg_bulk_reg_entry;
+        }
+    }
+    hg_thread_spin_unlock(&hg_bulk_reg_cache->lock);
+
+    ret = hg_bulk_reg_cache_release(hg_bulk_reg_cache->na_class, release_list);
+    HG_CHECK_HG_ERROR(done, ret, "Could not release cached registrations");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_reg_cache_evict(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry **release_list_ptr)
+{
+    while ((hg_bulk_reg_cache->stats.size > hg_bulk_reg_cache->max_size) &&
+           hg_bulk_reg_cache->lru_tail) {
+        struct hg_bulk_reg_entry *hg_bulk_reg_entry =
+            hg_bulk_reg_cache->lru_tail;
+
+        HG_LOG_DEBUG("Evicting registration (%p, %zu)",
+            (void *) hg_bulk_reg_entry->base, hg_bulk_reg_entry->len);
+
+        hg_bulk_reg_lru_remove(hg_bulk_reg_cache, hg_bulk_reg_entry);
+        hg_bulk_reg_cache_remove(hg_bulk_reg_cache, hg_bulk_reg_entry);
+        hg_bulk_reg_entry->next = *release_list_ptr;
+        *release_list_ptr = hg_bulk_reg_entry;
+        hg_bulk_reg_cache->stats.evictions++;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_reg_cache_remove(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry)
+{
+    hg_bulk_reg_cache->root =
+        hg_bulk_reg_tree_remove(hg_bulk_reg_cache->root, hg_bulk_reg_entry);
+    hg_bulk_reg_cache->stats.size -= hg_bulk_reg_entry->len;
+    hg_bulk_reg_cache->stats.count--;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_reg_cache_release(
+    na_class_t *na_class, struct hg_bulk_reg_entry *release_list)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Entries are already out of the cache, release all of them and report
+     * the first error */
+    while (release_list) {
+        struct hg_bulk_reg_entry *hg_bulk_reg_entry = release_list;
+        hg_return_t hg_ret;
+
+        release_list = hg_bulk_reg_entry->next;
+
+        hg_ret = hg_bulk_deregister(na_class, hg_bulk_reg_entry->mem_handle);
+        if (hg_ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not deregister segment");
+            if (ret == HG_SUCCESS)
+                ret = hg_ret;
+        }
+
+        free(hg_bulk_reg_entry);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_reg_lru_insert(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry)
+{
+    hg_bulk_reg_entry->lru_prev = NULL;
+    hg_bulk_reg_entry->lru_next = hg_bulk_reg_cache->lru_head;
+    if (hg_bulk_reg_cache->lru_head)
+        hg_bulk_reg_cache->lru_head->lru_prev = hg_bulk_reg_entry;
+    else
+        hg_bulk_reg_cache->lru_tail = hg_bulk_reg_entry;
+    hg_bulk_reg_cache->lru_head = hg_bulk_reg_entry;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_reg_lru_remove(struct hg_bulk_reg_cache *hg_bulk_reg_cache,
+    struct hg_bulk_reg_entry *hg_bulk_reg_entry)
+{
+    if (hg_bulk_reg_entry->lru_prev)
+        hg_bulk_reg_entry->lru_prev->lru_next = hg_bulk_reg_entry->lru_next;
+    else
+        hg_bulk_reg_cache->lru_head = hg_bulk_reg_entry->lru_next;
+    if (hg_bulk_reg_entry->lru_next)
+        hg_bulk_reg_entry->lru_next->lru_prev = hg_bulk_reg_entry->lru_prev;
+    else
+        hg_bulk_reg_cache->lru_tail = hg_bulk_reg_entry->lru_prev;
+    hg_bulk_reg_entry->lru_prev = NULL;
+    hg_bulk_reg_entry->lru_next = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_insert(
+    struct hg_bulk_reg_entry *root, struct hg_bulk_reg_entry *entry)
+{
+    if (!root) {
+        entry->left = NULL;
+        entry->right = NULL;
+        hg_bulk_reg_tree_update(entry);
+        return entry;
+    }
+
+    if (hg_bulk_reg_tree_cmp(entry, root) < 0)
+        root->left = hg_bulk_reg_tree_insert(root->left, entry);
+    else
+        root->right = hg_bulk_reg_tree_insert(root->right, entry);
+
+    return hg_bulk_reg_tree_balance(root);
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_remove(
+    struct hg_bulk_reg_entry *root, struct hg_bulk_reg_entry *entry)
+{
+    int cmp;
+
+    if (!root)
+        return NULL;
+
+    cmp = hg_bulk_reg_tree_cmp(entry, root);
+    if (cmp < 0)
+        root->left = hg_bulk_reg_tree_remove(root->left, entry);
+    else if (cmp > 0)
+        root->right = hg_bulk_reg_tree_remove(root->right, entry);
+    else {
+        struct hg_bulk_reg_entry *min = NULL;
+
+        if (!root->right)
+            return root->left;
+
+        /* Replace entry with its successor */
+        root->right = hg_bulk_reg_tree_remove_min(root->right, &min);
+        min->left = root->left;
+        min->right = root->right;
+        root = min;
+    }
+
+    return hg_bulk_reg_tree_balance(root);
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_remove_min(
+    struct hg_bulk_reg_entry *root, struct hg_bulk_reg_entry **min_ptr)
+{
+    if (!root->left) {
+        *min_ptr = root;
+        return root->right;
+    }
+
+    root->left = hg_bulk_reg_tree_remove_min(root->left, min_ptr);
+
+    return hg_bulk_reg_tree_balance(root);
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_balance(struct hg_bulk_reg_entry *root)
+{
+    struct hg_bulk_reg_entry *pivot;
+    int balance;
+
+    hg_bulk_reg_tree_update(root);
+    balance = hg_bulk_reg_tree_height(root->left) -
+              hg_bulk_reg_tree_height(root->right);
+
+    if (balance > 1) {
+        /* Left-right case */
+        if (hg_bulk_reg_tree_height(root->left->left) <
+            hg_bulk_reg_tree_height(root->left->right)) {
+            pivot = root->left->right;
+            root->left->right = pivot->left;
+            pivot->left = root->left;
+            hg_bulk_reg_tree_update(pivot->left);
+            root->left = pivot;
+        }
+
+        /* Rotate right */
+        pivot = root->left;
+        root->left = pivot->right;
+        pivot->right = root;
+        hg_bulk_reg_tree_update(root);
+        hg_bulk_reg_tree_update(pivot);
+
+        return pivot;
+    } else if (balance < -1) {
+        /* Right-left case */
+        if (hg_bulk_reg_tree_height(root->right->right) <
+            hg_bulk_reg_tree_height(root->right->left)) {
+            pivot = root->right->left;
+            root->right->left = pivot->right;
+            pivot->right = root->right;
+            hg_bulk_reg_tree_update(pivot->right);
+            root->right = pivot;
+        }
+
+        /* Rotate left */
+        pivot = root->right;
+        root->right = pivot->left;
+        pivot->left = root;
+        hg_bulk_reg_tree_update(root);
+        hg_bulk_reg_tree_update(pivot);
+
+        return pivot;
+    }
+
+    return root;
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_find(struct hg_bulk_reg_entry *root, hg_ptr_t base,
+    hg_size_t len, unsigned long flags)
+{
+    struct hg_bulk_reg_entry *entry;
+
+    while (root && root->base != base)
+        root = (base < root->base) ? root->left : root->right;
+    if (!root)
+        return NULL;
+
+    /* Entries with the same base address may be on either side */
+    if (!root->invalid && root->len == len && root->flags == flags)
+        return root;
+    if ((entry = hg_bulk_reg_tree_find(root->left, base, len, flags)))
+        return entry;
+
+    return hg_bulk_reg_tree_find(root->right, base, len, flags);
+}
+
+/*---------------------------------------------------------------------------*/
+static struct hg_bulk_reg_entry *
+hg_bulk_reg_tree_find_handle(struct hg_bulk_reg_entry *root, hg_ptr_t base,
+    na_mem_handle_t mem_handle)
+{
+    struct hg_bulk_reg_entry *entry;
+
+    while (root && root->base != base)
+        root = (base < root->base) ? root->left : root->right;
+    if (!root)
+        return NULL;
+
+    /* Entries with the same base address may be on either side */
+    if (root->mem_handle == mem_handle)
+        return root;
+    if ((entry = hg_bulk_reg_tree_find_handle(root->left, base, mem_handle)))
+        return entry;
+
+    return hg_bulk_reg_tree_find_handle(root->right, base, mem_handle);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_reg_tree_overlap(struct hg_bulk_reg_entry *root, hg_ptr_t start,
+    hg_ptr_t end, struct hg_bulk_reg_entry **list_ptr)
+{
+    /* No entry of that subtree ends after start */
+    if (!root || root->max_end <= start)
+        return;
+
+    hg_bulk_reg_tree_overlap(root->left, start, end, list_ptr);
+
+    /* Entries of right subtree all start after end */
+    if (root->base >= end)
+        return;
+
+    if (root->base + (hg_ptr_t) root->len > start) {
+        root->next = *list_ptr;
+        *list_ptr = root;
+    }
+
+    hg_bulk_reg_tree_overlap(root->right, start, end, list_ptr);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_bool_t
+hg_bulk_reg_tree_in_use(const struct hg_bulk_reg_entry *root)
+{
+    if (!root)
+        return HG_FALSE;
+
+    return (root->ref_count > 0 || hg_bulk_reg_tree_in_use(root->left) ||
+            hg_bulk_reg_tree_in_use(root->right));
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_size_t
+hg_bulk_get_serialize_size(struct hg_bulk *hg_bulk, unsigned long flags)
+{
+    hg_size_t ret = 0;
+
+    /* Descriptor info + segments (or strided layout) */
+    ret = sizeof(hg_bulk->desc.info);
+    if (hg_bulk->desc.info.vector_count > 0)
+        ret += sizeof(hg_ptr_t) + sizeof(hg_size_t) +
+               hg_bulk->desc.info.vector_count * sizeof(struct hg_bulk_vector);
+    else
+        ret +=
+            hg_bulk->desc.info.segment_count * sizeof(struct hg_bulk_segment);
+    if (hg_bulk->desc.info.ext_flags & HG_BULK_OFFSET)
+        ret += sizeof(hg_size_t);
+
+    /* Memory handles */
+    if ((hg_bulk->desc.info.flags & HG_BULK_REGV) ||
+        (hg_bulk->desc.info.segment_count == 1)) {
+        /* Only one single memory handle in that case */
+        if (hg_bulk->na_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL)
+            ret +=
+                hg_bulk->na_mem_descs.serialize_sizes.s[0] + sizeof(na_size_t);
+
+#ifdef NA_HAS_SM
+        /* Only add SM serialized handles if we're sending over SM, otherwise
+         * skip it. */
+        if ((flags & HG_BULK_SM) &&
+            (hg_bulk->na_sm_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL))
+            ret += hg_bulk->na_sm_mem_descs.serialize_sizes.s[0] +
+                   sizeof(na_size_t);
+#endif
+    } else {
+        ret += hg_bulk_get_serialize_size_mem_descs(
+            &hg_bulk->na_mem_descs, hg_bulk->desc.info.segment_count);
+
+#ifdef NA_HAS_SM
+        /* Only add SM serialized handles if we're sending over SM, otherwise
+         * skip it. */
+        if ((flags & HG_BULK_SM) && hg_bulk->na_sm_class)
+            ret += hg_bulk_get_serialize_size_mem_descs(
+                &hg_bulk->na_sm_mem_descs, hg_bulk->desc.info.segment_count);
+#endif
+    }
+
+    /* Address information (context ID + serialize size + address) */
+    if (hg_bulk->desc.info.flags & HG_BULK_BIND) {
+        unsigned long addr_flags = 0;
+
+#ifdef NA_HAS_SM
+        if (flags & HG_BULK_SM)
+            addr_flags |= HG_CORE_SM;
+#endif
+        ret += sizeof(hg_uint8_t) + sizeof(hg_size_t) +
+               HG_Core_addr_get_serialize_size(hg_bulk->addr, addr_flags);
+    }
+
+    /* Eager mode (in eager mode, the actual data will be copied) */
+    if ((flags & HG_BULK_EAGER) &&
+        (hg_bulk->desc.info.flags & HG_BULK_READ_ONLY) &&
+        !(hg_bulk->desc.info.flags & HG_BULK_VIRT))
+        ret += hg_bulk->desc.info.len;
+
+    /* Checksums (block size + block count + CRC of each block) */
+    if (HG_BULK_CHECKSUM_ENABLED(hg_bulk, flags)) {
+        hg_size_t block_size = hg_bulk_block_size(hg_bulk->desc.info.len);
+
+        ret += sizeof(hg_size_t) + sizeof(hg_uint32_t) +
+               ((hg_bulk->desc.info.len - 1) / block_size + 1) *
+                   sizeof(hg_uint32_t);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_size_t
+hg_bulk_get_serialize_size_mem_descs(
+    struct hg_bulk_na_mem_desc *na_mem_descs, hg_uint32_t count)
+{
+    na_mem_handle_t *na_mem_handles;
+    na_size_t *na_mem_serialize_sizes;
+    hg_uint32_t i;
+    hg_size_t ret = 0;
+
+    if (count > HG_BULK_STATIC_MAX) {
+        na_mem_handles = na_mem_descs->handles.d;
+        na_mem_serialize_sizes = na_mem_descs->serialize_sizes.d;
+    } else {
+        na_mem_handles = na_mem_descs->handles.s;
+        na_mem_serialize_sizes = na_mem_descs->serialize_sizes.s;
+    }
+
+    /* Serialize sizes */
+    ret += count * sizeof(na_size_t);
+
+    for (i = 0; i < count; i++)
+        if (na_mem_handles[i] != NA_MEM_HANDLE_NULL)
+            ret += na_mem_serialize_sizes[i];
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_serialize(void *buf, hg_size_t buf_size, unsigned long flags,
+    struct hg_bulk *hg_bulk, const hg_uint32_t *crcs)
+{
+    struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
+    char *buf_ptr = (char *) buf;
+    hg_size_t buf_size_left = buf_size;
+    struct hg_bulk_desc_info desc_info = hg_bulk->desc.info;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Always reset bulk alloc flag (only local) */
+    desc_info.flags &= (~HG_BULK_ALLOC & 0xff);
+
+    /* Add eager flag to descriptor */
+    if ((flags & HG_BULK_EAGER) && (desc_info.flags & HG_BULK_READ_ONLY) &&
+        !(hg_bulk->desc.info.flags & HG_BULK_VIRT)) {
+        HG_LOG_DEBUG("HG_BULK_EAGER flag set");
+        desc_info.flags |= HG_BULK_EAGER;
+    } else
+        desc_info.flags &= (~HG_BULK_EAGER & 0xff);
+
+    /* Request data pushed to write-only handle to be returned in response */
+    if ((flags & HG_BULK_EAGER_WRITE) &&
+        (desc_info.flags & HG_BULK_READWRITE) == HG_BULK_WRITE_ONLY &&
+        !(hg_bulk->desc.info.flags & HG_BULK_VIRT)) {
+        HG_LOG_DEBUG("HG_BULK_EAGER_WRITE flag set");
+        desc_info.ext_flags |= HG_BULK_RESP;
+    } else
+        desc_info.ext_flags &= (~HG_BULK_RESP & 0xff);
+
+    /* Layout of compressed copy is appended to descriptor */
+    if (flags & HG_BULK_COMPRESS)
+        desc_info.ext_flags |= HG_BULK_COMPRESSED;
+    else
+        desc_info.ext_flags &= (~HG_BULK_COMPRESSED & 0xff);
+
+    /* Checksums of data are appended to descriptor */
+    if (HG_BULK_CHECKSUM_ENABLED(hg_bulk, flags)) {
+        HG_LOG_DEBUG("HG_BULK_CHECKSUM flag set");
+        desc_info.ext_flags |= HG_BULK_CHECKSUMMED;
+    } else
+        desc_info.ext_flags &= (~HG_BULK_CHECKSUMMED & 0xff);
+
+#ifdef NA_HAS_SM
+    /* Add SM flag */
+    if (flags & HG_BULK_SM) {
+        HG_LOG_DEBUG("HG_BULK_SM flag set");
+        desc_info.flags |= HG_BULK_SM;
+    } else
+        desc_info.flags &= (~HG_BULK_SM & 0xff);
+#endif
+
+    HG_LOG_DEBUG("Serializing bulk handle with %u segment(s), len is %zu bytes",
+        hg_bulk->desc.info.segment_count, hg_bulk->desc.info.len);
+
+    /* Descriptor info */
+    HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left, &desc_info,
+        struct hg_bulk_desc_info);
+
+    /* Segments (strided layouts are sent as is and expanded by the peer) */
+    if (desc_info.vector_count > 0) {
+        HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left, &hg_bulk->stride.base,
+            hg_ptr_t);
+        HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left,
+            &hg_bulk->stride.block_len, hg_size_t);
+        HG_BULK_ENCODE_ARRAY(done, ret, buf_ptr, buf_size_left,
+            hg_bulk->stride.vectors, struct hg_bulk_vector,
+            desc_info.vector_count);
+    } else
+        HG_BULK_ENCODE_ARRAY(done, ret, buf_ptr, buf_size_left, segments,
+            struct hg_bulk_segment, desc_info.segment_count);
+
+    /* Offset of data in shared NA memory handle */
+    if (desc_info.ext_flags & HG_BULK_OFFSET)
+        HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left, &hg_bulk->mem_offset,
+            hg_size_t);
+
+    /* TODO if eager or self flag, skip mem handles ? */
+
+    /* Add the NA memory handles */
+    if ((desc_info.flags & HG_BULK_REGV) || (desc_info.segment_count == 1)) {
+        /* N.B. skip serialize size if no handle */
+        if (hg_bulk->na_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL) {
+            na_return_t na_ret;
+
+            HG_LOG_DEBUG("Serializing single NA memory handle");
+
+            HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left,
+                &hg_bulk->na_mem_descs.serialize_sizes.s[0], na_size_t);
+
+            na_ret = NA_Mem_handle_serialize(hg_bulk->na_class, buf_ptr,
+                buf_size_left, hg_bulk->na_mem_descs.handles.s[0]);
+            HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret,
+                (hg_return_t) na_ret, "Could not serialize memory handle (%s)",
+                NA_Error_to_string(na_ret));
+            buf_ptr += hg_bulk->na_mem_descs.serialize_sizes.s[0];
+            buf_size_left -= hg_bulk->na_mem_descs.serialize_sizes.s[0];
+        }
+
+#ifdef NA_HAS_SM
+        /* Only add SM serialized handles if we're sending over SM, otherwise
+         * skip then. */
+        if ((desc_info.flags & HG_BULK_SM) &&
+            (hg_bulk->na_sm_mem_descs.handles.s[0] != NA_MEM_HANDLE_NULL)) {
+            na_return_t na_ret;
+
+            HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left,
+                &hg_bulk->na_sm_mem_descs.serialize_sizes.s[0], na_size_t);
+
+            na_ret = NA_Mem_handle_serialize(hg_bulk->na_sm_class, buf_ptr,
+                buf_size_left, hg_bulk->na_sm_mem_descs.handles.s[0]);
+            HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret,
+                (hg_return_t) na_ret,
+                "Could not serialize SM memory handle (%s)",
+                NA_Error_to_string(na_ret));
+            buf_ptr += hg_bulk->na_sm_mem_descs.serialize_sizes.s[0];
+            buf_size_left -= hg_bulk->na_sm_mem_descs.serialize_sizes.s[0];
+        }
+#endif
+    } else {
+        HG_LOG_DEBUG("Serializing %u NA memory handle(s)",
+            hg_bulk->desc.info.segment_count);
+
+        ret = hg_bulk_serialize_mem_descs(hg_bulk->na_class, &buf_ptr,
+            &buf_size_left, &hg_bulk->na_mem_descs, segments,
+            desc_info.segment_count);
+        HG_CHECK_HG_ERROR(done, ret, "Could not serialize NA mem descriptors");
+
+#ifdef NA_HAS_SM
+        /* Only add SM serialized handles if we're sending over SM, otherwise
+         * skip it. */
+        if ((desc_info.flags & HG_BULK_SM) && hg_bulk->na_sm_class) {
+            ret = hg_bulk_serialize_mem_descs(hg_bulk->na_sm_class, &buf_ptr,
+                &buf_size_left, &hg_bulk->na_sm_mem_descs, segments,
+                desc_info.segment_count);
+            HG_CHECK_HG_ERROR(
+                done, ret, "Could not serialize NA SM mem descriptors");
+        }
+#endif
+    }
+
+    /* Address information */
+    if (desc_info.flags & HG_BULK_BIND) {
+        hg_size_t serialize_size;
+        unsigned long addr_flags = 0;
+
+        HG_LOG_DEBUG("HG_BULK_BIND flag set, serializing address information");
+
+#ifdef NA_HAS_SM
+        if (flags & HG_BULK_SM)
+            addr_flags |= HG_CORE_SM;
+#endif
+
+        serialize_size =
+            HG_Core_addr_get_serialize_size(hg_bulk->addr, addr_flags);
+
+        HG_BULK_ENCODE(
+            done, ret, buf_ptr, buf_size_left, &serialize_size, hg_size_t);
+
+        ret = HG_Core_addr_serialize(
+            buf_ptr, buf_size_left, addr_flags, hg_bulk->addr);
+        HG_CHECK_HG_ERROR(done, ret, "Could not serialize address");
+        buf_ptr += serialize_size;
+        buf_size_left -= serialize_size;
+
+        /* Add context ID */
+        HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left, &hg_bulk->context_id,
+            hg_uint8_t);
+    }
+
+    /* Add the serialized data if eager mode is requested */
+    if (desc_info.flags & HG_BULK_EAGER) {
+        hg_uint32_t i;
+
+        HG_LOG_DEBUG("Serializing eager bulk data, %u segment(s)",
+            hg_bulk->desc.info.segment_count);
+        for (i = 0; i < desc_info.segment_count; i++) {
+            if (!segments[i].len)
+                continue;
+
+            HG_BULK_ENCODE_ARRAY(done, ret, buf_ptr, buf_size_left,
+                (const void *) segments[i].base, char, segments[i].len);
+        }
+    }
+
+    /* Checksum each block of data as it is now, unless this was already done
+     * while compressing it */
+    if (desc_info.ext_flags & HG_BULK_CHECKSUMMED) {
+        hg_size_t block_size = hg_bulk_block_size(desc_info.len), offset;
+        hg_uint32_t block_count =
+            (hg_uint32_t) ((desc_info.len - 1) / block_size + 1);
+        hg_uint32_t segment_index = 0;
+        hg_size_t segment_offset = 0;
+
+        HG_BULK_ENCODE(
+            done, ret, buf_ptr, buf_size_left, &block_size, hg_size_t);
+        HG_BULK_ENCODE(
+            done, ret, buf_ptr, buf_size_left, &block_count, hg_uint32_t);
+        if (crcs)
+            HG_BULK_ENCODE_ARRAY(
+                done, ret, buf_ptr, buf_size_left, crcs, hg_uint32_t,
+                block_count);
+        else
+            for (offset = 0; offset < desc_info.len; offset += block_size) {
+                hg_uint32_t crc = hg_bulk_checksum_compute_segments(segments,
+                    desc_info.segment_count, &segment_index, &segment_offset,
+                    HG_BULK_MIN(block_size, desc_info.len - offset));
+
+                HG_BULK_ENCODE(
+                    done, ret, buf_ptr, buf_size_left, &crc, hg_uint32_t);
+            }
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_serialize_mem_descs(na_class_t *na_class, char **buf_ptr,
+    hg_size_t *buf_size_left, struct hg_bulk_na_mem_desc *na_mem_descs,
+    const struct hg_bulk_segment *segments, hg_uint32_t count)
+{
+    na_mem_handle_t *na_mem_handles;
+    na_size_t *na_mem_serialize_sizes;
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
+
+    if (count > HG_BULK_STATIC_MAX) {
+        na_mem_handles = na_mem_descs->handles.d;
+        na_mem_serialize_sizes = na_mem_descs->serialize_sizes.d;
+    } else {
+        na_mem_handles = na_mem_descs->handles.s;
+        na_mem_serialize_sizes = na_mem_descs->serialize_sizes.s;
+    }
+
+    /* Encode serialize sizes */
+    HG_BULK_ENCODE_ARRAY(done, ret, *buf_ptr, *buf_size_left,
+        na_mem_serialize_sizes, na_size_t, count);
+
+    for (i = 0; i < count; i++) {
+        na_return_t na_ret;
+
+        /* Skip null segments */
+        if (segments[i].base == (hg_ptr_t) NULL)
+            continue;
+
+        na_ret = NA_Mem_handle_serialize(
+            na_class, *buf_ptr, *buf_size_left, na_mem_handles[i]);
+        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+            "Could not serialize memory handle (%s)",
+            NA_Error_to_string(na_ret));
+
+        *buf_ptr += na_mem_serialize_sizes[i];
+        *buf_size_left -= na_mem_serialize_sizes[i];
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_deserialize(hg_core_class_t *core_class, struct hg_bulk **hg_bulk_ptr,
+    const void *buf, hg_size_t buf_size)
+{
+    struct hg_bulk *hg_bulk = NULL;
+    struct hg_bulk_segment *segments;
+    const char *buf_ptr = (const char *) buf;
+    hg_size_t buf_size_left = buf_size;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_bulk = (struct hg_bulk *) malloc(sizeof(struct hg_bulk));
+    HG_CHECK_ERROR(
         hg_bulk == NULL, error, ret, HG_NOMEM, "Could not allocate handle");
 
-    memset(hg_bulk, 0, sizeof(struct hg_bulk));
-    hg_bulk->core_class = core_class;
-    hg_bulk->na_class = HG_Core_class_get_na(core_class);
-    hg_atomic_init32(&hg_bulk->ref_count, 1);
+    memset(hg_bulk, 0, sizeof(struct hg_bulk));
+    hg_bulk->core_class = core_class;
+    hg_bulk->na_class = HG_Core_class_get_na(core_class);
+    hg_atomic_init32(&hg_bulk->ref_count, 1);
+
+    /* Descriptor info */
+    HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left, &hg_bulk->desc.info,
+        struct hg_bulk_desc_info);
+
+    HG_LOG_DEBUG(
+        "Deserializing bulk handle with %u segment(s), len is %zu bytes",
+        hg_bulk->desc.info.segment_count, hg_bulk->desc.info.len);
+
+#ifdef NA_HAS_SM
+    /* Use SM classes if requested */
+    if (hg_bulk->desc.info.flags & HG_BULK_SM) {
+        HG_LOG_DEBUG("HG_BULK_SM flag is set");
+        hg_bulk->na_sm_class = HG_Core_class_get_na_sm(core_class);
+        HG_CHECK_ERROR(hg_bulk->na_sm_class == NULL, error, ret,
+            HG_PROTOCOL_ERROR, "SM class is not set");
+    }
+#endif
+
+    /* Strided layout, validated before segments get allocated */
+    if (hg_bulk->desc.info.vector_count > 0) {
+        hg_uint32_t vector_count = hg_bulk->desc.info.vector_count;
+
+        HG_CHECK_ERROR(vector_count > HG_BULK_VECTOR_MAX, error, ret,
+            HG_PROTOCOL_ERROR, "Invalid vector count (%u)", vector_count);
+
+        HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left,
+            &hg_bulk->stride.base, hg_ptr_t);
+        HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left,
+            &hg_bulk->stride.block_len, hg_size_t);
+        HG_BULK_DECODE_ARRAY(error, ret, buf_ptr, buf_size_left,
+            hg_bulk->stride.vectors, struct hg_bulk_vector, vector_count);
+        HG_CHECK_ERROR(
+            hg_bulk_stride_get_count(hg_bulk->stride.block_len,
+                hg_bulk->stride.vectors,
+                vector_count) != hg_bulk->desc.info.segment_count,
+            error, ret, HG_PROTOCOL_ERROR,
+            "Strided layout does not match segment count");
+        HG_CHECK_ERROR(hg_bulk->stride.block_len *
+                               hg_bulk->desc.info.segment_count !=
+                           hg_bulk->desc.info.len,
+            error, ret, HG_PROTOCOL_ERROR,
+            "Strided layout does not match length");
+    }
+
+    /* Segments */
+    if (hg_bulk->desc.info.segment_count > HG_BULK_STATIC_MAX) {
+        /* Allocate segments */
+        hg_bulk->desc.segments.d =
+            hg_bulk_segments_alloc(hg_bulk->desc.info.segment_count);
+        HG_CHECK_ERROR(hg_bulk->desc.segments.d == NULL, error, ret, HG_NOMEM,
+            "Could not allocate segment array");
+
+        segments = hg_bulk->desc.segments.d;
+    } else
+        segments = hg_bulk->desc.segments.s;
+    if (hg_bulk->desc.info.vector_count > 0)
+        hg_bulk_stride_expand(&hg_bulk->stride,
+            hg_bulk->desc.info.vector_count, segments,
+            hg_bulk->desc.info.segment_count);
+    else
+        HG_BULK_DECODE_ARRAY(error, ret, buf_ptr, buf_size_left, segments,
+            struct hg_bulk_segment, hg_bulk->desc.info.segment_count);
+
+    /* Offset of data in shared NA memory handle */
+    if (hg_bulk->desc.info.ext_flags & HG_BULK_OFFSET)
+        HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left, &hg_bulk->mem_offset,
+            hg_size_t);
+    if (hg_bulk->desc.info.segment_count > HG_BULK_STATIC_MAX)
+        hg_bulk_segments_index(segments, hg_bulk->desc.info.segment_count);
+
+    /* Get the NA memory handles */
+    if (hg_bulk->desc.info.flags & HG_BULK_REGV ||
+        (hg_bulk->desc.info.segment_count == 1)) {
+        /* Always deserialize handle if HG_BULK_REGV is set */
+        if ((segments[0].base != (hg_ptr_t) NULL) ||
+            (hg_bulk->desc.info.flags & HG_BULK_REGV)) {
+            na_return_t na_ret;
+
+            HG_LOG_DEBUG("Deserializing single NA memory handle");
+
+            HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left,
+                &hg_bulk->na_mem_descs.serialize_sizes.s[0], na_size_t);
+
+            na_ret = NA_Mem_handle_deserialize(hg_bulk->na_class,
+                &hg_bulk->na_mem_descs.handles.s[0], buf_ptr, buf_size_left);
+            HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret,
+                (hg_return_t) na_ret,
+                "Could not deserialize memory handle (%s)",
+                NA_Error_to_string(na_ret));
+            buf_ptr += hg_bulk->na_mem_descs.serialize_sizes.s[0];
+            buf_size_left -= hg_bulk->na_mem_descs.serialize_sizes.s[0];
+
+#ifdef NA_HAS_SM
+            /* Only deserialize handles if we were sending over SM */
+            if (hg_bulk->desc.info.flags & HG_BULK_SM) {
+                HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left,
+                    &hg_bulk->na_sm_mem_descs.serialize_sizes.s[0], na_size_t);
+
+                na_ret = NA_Mem_handle_deserialize(hg_bulk->na_sm_class,
+                    &hg_bulk->na_sm_mem_descs.handles.s[0], buf_ptr,
+                    buf_size_left);
+                HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret,
+                    (hg_return_t) na_ret,
+                    "Could not deserialize SM memory handle (%s)",
+                    NA_Error_to_string(na_ret));
+                buf_ptr += hg_bulk->na_sm_mem_descs.serialize_sizes.s[0];
+                buf_size_left -= hg_bulk->na_sm_mem_descs.serialize_sizes.s[0];
+            }
+#endif
+        }
+    } else {
+        HG_LOG_DEBUG("Deserializing %u NA memory handle(s)",
+            hg_bulk->desc.info.segment_count);
+
+        ret = hg_bulk_deserialize_mem_descs(hg_bulk->na_class, &buf_ptr,
+            &buf_size_left, &hg_bulk->na_mem_descs, segments,
+            hg_bulk->desc.info.segment_count);
+        HG_CHECK_HG_ERROR(
+            error, ret, "Could not deserialize NA mem descriptors");
+
+#ifdef NA_HAS_SM
+        /* Only deserialize handles if we were sending over SM */
+        if (hg_bulk->desc.info.flags & HG_BULK_SM) {
+            ret = hg_bulk_deserialize_mem_descs(hg_bulk->na_sm_class, &buf_ptr,
+                &buf_size_left, &hg_bulk->na_sm_mem_descs, segments,
+                hg_bulk->desc.info.segment_count);
+            HG_CHECK_HG_ERROR(
+                error, ret, "Could not deserialize NA SM mem descriptors");
+        }
+#endif
+    }
+
+    /* Address information */
+    if (hg_bulk->desc.info.flags & HG_BULK_BIND) {
+        hg_size_t serialize_size;
+
+        HG_LOG_DEBUG(
+            "HG_BULK_BIND flag set, deserializing address information");
+
+        HG_BULK_DECODE(
+            error, ret, buf_ptr, buf_size_left, &serialize_size, hg_size_t);
+
+        ret = HG_Core_addr_deserialize(
+            hg_bulk->core_class, &hg_bulk->addr, buf_ptr, buf_size_left);
+        HG_CHECK_HG_ERROR(error, ret, "Could not deserialize address");
+        buf_ptr += serialize_size;
+        buf_size_left -= serialize_size;
+
+        /* Get context ID */
+        HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left, &hg_bulk->context_id,
+            hg_uint8_t);
+    }
+
+    /* Get the serialized data */
+    if (hg_bulk->desc.info.flags & HG_BULK_EAGER) {
+        hg_uint32_t i;
+
+        HG_LOG_DEBUG("Deserializing eager bulk data, %u segment(s)",
+            hg_bulk->desc.info.segment_count);
+        hg_bulk->desc.info.flags |= HG_BULK_ALLOC;
+        /* Segments no longer follow the strided layout once copied */
+        hg_bulk->desc.info.vector_count = 0;
+        for (i = 0; i < hg_bulk->desc.info.segment_count; i++) {
+            if (!segments[i].len)
+                continue;
+
+            /* Override base address to store data */
+            segments[i].base = (hg_ptr_t) calloc(1, segments[i].len);
+            HG_CHECK_ERROR(segments[i].base == (hg_ptr_t) NULL, error, ret,
+                HG_NOMEM, "Could not allocate segment");
+            ;
+
+            HG_BULK_DECODE_ARRAY(error, ret, buf_ptr, buf_size_left,
+                (void *) segments[i].base, char, segments[i].len);
+        }
+    } else
+        /* Addresses are virtual and do not point to physical memory */
+        hg_bulk->desc.info.flags |= HG_BULK_VIRT;
+
+    /* Checksums of data to verify once pulled */
+    if (hg_bulk->desc.info.ext_flags & HG_BULK_CHECKSUMMED) {
+        ret = hg_bulk_checksum_deserialize(hg_bulk, &buf_ptr, &buf_size_left);
+        HG_CHECK_HG_ERROR(error, ret, "Could not deserialize checksums");
+    }
+
+    /* Compressed copy that can be pulled instead */
+    if (hg_bulk->desc.info.ext_flags & HG_BULK_COMPRESSED) {
+        ret = hg_bulk_compressed_deserialize(
+            core_class, hg_bulk, &buf_ptr, &buf_size_left);
+        HG_CHECK_HG_ERROR(error, ret, "Could not deserialize compressed copy");
+    }
+
+    HG_CHECK_WARNING(buf_size_left != 0,
+        "Buffer size left for decoding bulk handle is not zero");
+
+    *hg_bulk_ptr = hg_bulk;
+
+    return ret;
+
+error:
+    hg_bulk_free(hg_bulk);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_deserialize_mem_descs(na_class_t *na_class, const char **buf_ptr,
+    hg_size_t *buf_size_left, struct hg_bulk_na_mem_desc *na_mem_descs,
+    const struct hg_bulk_segment *segments, hg_uint32_t count)
+{
+    na_mem_handle_t *na_mem_handles;
+    na_size_t *na_mem_serialize_sizes;
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
+
+    if (count > HG_BULK_STATIC_MAX) {
+        /* Allocate NA memory handles */
+        na_mem_descs->handles.d =
+            (na_mem_handle_t *) calloc(count, sizeof(na_mem_handle_t));
+        HG_CHECK_ERROR(na_mem_descs->handles.d == NULL, error, ret, HG_NOMEM,
+            "Could not allocate mem handle array");
+
+        /* Allocate serialize sizes */
+        na_mem_descs->serialize_sizes.d =
+            (na_size_t *) calloc(count, sizeof(na_size_t));
+        HG_CHECK_ERROR(na_mem_descs->serialize_sizes.d == NULL, error, ret,
+            HG_NOMEM, "Could not allocate serialize sizes array");
+
+        na_mem_handles = na_mem_descs->handles.d;
+        na_mem_serialize_sizes = na_mem_descs->serialize_sizes.d;
+    } else {
+        na_mem_handles = na_mem_descs->handles.s;
+        na_mem_serialize_sizes = na_mem_descs->serialize_sizes.s;
+    }
+
+    /* Decode serialize sizes */
+    HG_BULK_DECODE_ARRAY(error, ret, *buf_ptr, *buf_size_left,
+        na_mem_serialize_sizes, na_size_t, count);
+
+    for (i = 0; i < count; i++) {
+        na_return_t na_ret;
+
+        /* Skip null segments */
+        if (segments[i].base == (hg_ptr_t) NULL)
+            continue;
+
+        na_ret = NA_Mem_handle_deserialize(
+            na_class, &na_mem_handles[i], *buf_ptr, *buf_size_left);
+        HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret, (hg_return_t) na_ret,
+            "Could not deserialize memory handle (%s)",
+            NA_Error_to_string(na_ret));
+
+        *buf_ptr += na_mem_serialize_sizes[i];
+        *buf_size_left -= na_mem_serialize_sizes[i];
+    }
+
+    return ret;
+
+error:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_compressed_deserialize(hg_core_class_t *core_class,
+    struct hg_bulk *hg_bulk, const char **buf_ptr, hg_size_t *buf_size_left)
+{
+    struct hg_bulk_compressed *hg_bulk_compressed = NULL;
+    hg_size_t len = hg_bulk->desc.info.len, block_size;
+    hg_uint32_t block_count, i;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_BULK_DECODE(
+        error, ret, *buf_ptr, *buf_size_left, &block_size, hg_size_t);
+    HG_BULK_DECODE(
+        error, ret, *buf_ptr, *buf_size_left, &block_count, hg_uint32_t);
+    /* Block size is derived from len, which bounds the number of blocks to
+     * HG_BULK_BLOCK_MAX */
+    HG_CHECK_ERROR(len == 0 || block_size != hg_bulk_block_size(len) ||
+                       block_count != (len - 1) / block_size + 1,
+        error, ret, HG_PROTOCOL_ERROR,
+        "Invalid layout of compressed copy (%u blocks of %zu bytes)",
+        block_count, block_size);
+    HG_CHECK_ERROR(*buf_size_left < block_count * sizeof(hg_size_t), error,
+        ret, HG_OVERFLOW, "Buffer size too small (%zu)", *buf_size_left);
+    HG_CHECK_ERROR(
+        hg_bulk->checksum && hg_bulk->checksum->block_size != block_size,
+        error, ret, HG_PROTOCOL_ERROR,
+        "Compressed and checksummed blocks differ");
+
+    hg_bulk_compressed = (struct hg_bulk_compressed *) calloc(
+        1, sizeof(struct hg_bulk_compressed));
+    HG_CHECK_ERROR(hg_bulk_compressed == NULL, error, ret, HG_NOMEM,
+        "Could not allocate compressed copy");
+    hg_bulk_compressed->offsets = (hg_size_t *) malloc(
+        ((hg_size_t) block_count + 1) * sizeof(hg_size_t));
+    HG_CHECK_ERROR(hg_bulk_compressed->offsets == NULL, error, ret, HG_NOMEM,
+        "Could not allocate block offsets");
+    hg_bulk_compressed->block_size = block_size;
+    hg_bulk_compressed->block_count = block_count;
+
+    /* Blocks cannot be larger than their uncompressed size */
+    hg_bulk_compressed->offsets[0] = 0;
+    HG_BULK_DECODE_ARRAY(error, ret, *buf_ptr, *buf_size_left,
+        hg_bulk_compressed->offsets + 1, hg_size_t, block_count);
+    for (i = 0; i < block_count; i++) {
+        hg_size_t block_len = len - (hg_size_t) i * block_size;
+        hg_size_t *offsets = hg_bulk_compressed->offsets;
+
+        if (block_len > block_size)
+            block_len = block_size;
+        HG_CHECK_ERROR(offsets[i + 1] <= offsets[i] ||
+                           offsets[i + 1] - offsets[i] > block_len,
+            error, ret, HG_PROTOCOL_ERROR, "Invalid size of block %u", i);
+    }
+
+    /* Descriptor of compressed blocks */
+    ret = hg_bulk_deserialize(core_class, &hg_bulk_compressed->region,
+        *buf_ptr, *buf_size_left);
+    HG_CHECK_HG_ERROR(error, ret, "Could not deserialize compressed blocks");
+    HG_CHECK_ERROR(hg_bulk_compressed->region->desc.info.len <
+                       hg_bulk_compressed->offsets[block_count],
+        error, ret, HG_PROTOCOL_ERROR, "Compressed blocks exceed handle");
+    *buf_ptr += *buf_size_left;
+    *buf_size_left = 0;
+
+    hg_bulk->compressed = hg_bulk_compressed;
+
+    return ret;
+
+error:
+    hg_bulk_compressed_free(hg_bulk_compressed);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_checksum_deserialize(
+    struct hg_bulk *hg_bulk, const char **buf_ptr, hg_size_t *buf_size_left)
+{
+    struct hg_bulk_checksum *hg_bulk_checksum = NULL;
+    hg_size_t len = hg_bulk->desc.info.len, block_size;
+    hg_uint32_t block_count;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_BULK_DECODE(
+        error, ret, *buf_ptr, *buf_size_left, &block_size, hg_size_t);
+    HG_BULK_DECODE(
+        error, ret, *buf_ptr, *buf_size_left, &block_count, hg_uint32_t);
+    /* Block size is derived from len, which bounds the number of blocks to
+     * HG_BULK_BLOCK_MAX */
+    HG_CHECK_ERROR(len == 0 || block_size != hg_bulk_block_size(len) ||
+                       block_count != (len - 1) / block_size + 1,
+        error, ret, HG_PROTOCOL_ERROR,
+        "Invalid layout of checksums (%u blocks of %zu bytes)", block_count,
+        block_size);
+    HG_CHECK_ERROR(*buf_size_left < block_count * sizeof(hg_uint32_t), error,
+        ret, HG_OVERFLOW, "Buffer size too small (%zu)", *buf_size_left);
+
+    hg_bulk_checksum =
+        (struct hg_bulk_checksum *) malloc(sizeof(struct hg_bulk_checksum));
+    HG_CHECK_ERROR(hg_bulk_checksum == NULL, error, ret, HG_NOMEM,
+        "Could not allocate checksums");
+    hg_bulk_checksum->crcs =
+        (hg_uint32_t *) malloc(block_count * sizeof(hg_uint32_t));
+    HG_CHECK_ERROR(hg_bulk_checksum->crcs == NULL, error, ret, HG_NOMEM,
+        "Could not allocate checksums");
+    hg_bulk_checksum->block_size = block_size;
+    hg_bulk_checksum->block_count = block_count;
+
+    HG_BULK_DECODE_ARRAY(error, ret, *buf_ptr, *buf_size_left,
+        hg_bulk_checksum->crcs, hg_uint32_t, block_count);
+
+    hg_bulk->checksum = hg_bulk_checksum;
+
+    return ret;
+
+error:
+    if (hg_bulk_checksum) {
+        free(hg_bulk_checksum->crcs);
+        free(hg_bulk_checksum);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_uint32_t
+hg_bulk_checksum_compute(
+    struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size)
+{
+    const struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
+    hg_uint32_t segment_index;
+    hg_size_t segment_offset;
+
+    hg_bulk_offset_translate(segments, hg_bulk->desc.info.segment_count,
+        offset, &segment_index, &segment_offset);
+
+    return hg_bulk_checksum_compute_segments(segments,
+        hg_bulk->desc.info.segment_count, &segment_index, &segment_offset,
+        size);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_uint32_t
+hg_bulk_checksum_compute_segments(const struct hg_bulk_segment *segments,
+    hg_uint32_t count, hg_uint32_t *segment_index_ptr,
+    hg_size_t *segment_offset_ptr, hg_size_t size)
+{
+    hg_uint32_t segment_index = *segment_index_ptr, crc = 0;
+    hg_size_t segment_offset = *segment_offset_ptr;
+
+    /* Checksum is carried over segments */
+    while (size > 0 && segment_index < count) {
+        hg_size_t len = segments[segment_index].len - segment_offset;
+
+        len = HG_BULK_MIN(size, len);
+        crc = hg_crc32c(crc,
+            (const void *) (segments[segment_index].base + segment_offset),
+            len);
+        size -= len;
+        segment_offset += len;
+        if (segment_offset == segments[segment_index].len) {
+            segment_index++;
+            segment_offset = 0;
+        }
+    }
+
+    *segment_index_ptr = segment_index;
+    *segment_offset_ptr = segment_offset;
+
+    return crc;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_size_t
+hg_bulk_block_size(hg_size_t len)
+{
+    /* Page-aligned blocks, bounded in number so that the layout remains
+     * small */
+    hg_size_t block_size = (len + HG_BULK_BLOCK_MAX - 1) / HG_BULK_BLOCK_MAX;
+
+    block_size = (block_size + HG_MEM_PAGE_SIZE - 1) &
+                 ~((hg_size_t) HG_MEM_PAGE_SIZE - 1);
+
+    return (block_size < HG_BULK_BLOCK_SIZE_MIN) ? HG_BULK_BLOCK_SIZE_MIN
+                                                 : block_size;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_desc_cache_create(hg_uint32_t max_count,
+    struct hg_bulk_desc_cache **hg_bulk_desc_cache_ptr)
+{
+    struct hg_bulk_desc_cache *hg_bulk_desc_cache = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_bulk_desc_cache =
+        (struct hg_bulk_desc_cache *) malloc(sizeof(struct hg_bulk_desc_cache));
+    HG_CHECK_ERROR(hg_bulk_desc_cache == NULL, error, ret, HG_NOMEM,
+        "Could not allocate descriptor cache");
+    memset(hg_bulk_desc_cache, 0, sizeof(struct hg_bulk_desc_cache));
+
+    hg_bulk_desc_cache->table =
+        hg_hash_table_new(hg_bulk_desc_hash, hg_bulk_desc_equal);
+    HG_CHECK_ERROR(hg_bulk_desc_cache->table == NULL, error, ret, HG_NOMEM,
+        "Could not allocate descriptor table");
+
+    hg_bulk_desc_cache->max_count = max_count;
+    hg_thread_mutex_init(&hg_bulk_desc_cache->lock);
+
+    HG_LOG_DEBUG("Created descriptor cache (%p) of max %u entries",
+        hg_bulk_desc_cache, max_count);
+
+    *hg_bulk_desc_cache_ptr = hg_bulk_desc_cache;
+
+    return ret;
+
+error:
+    free(hg_bulk_desc_cache);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_desc_cache_destroy(struct hg_bulk_desc_cache *hg_bulk_desc_cache)
+{
+    struct hg_bulk_desc_entry *release_list = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_LOG_DEBUG("Destroying descriptor cache (%p)", hg_bulk_desc_cache);
+
+    /* Handles still in use remain valid until they are freed */
+    while (hg_bulk_desc_cache->lru_head) {
+        struct hg_bulk_desc_entry *hg_bulk_desc_entry =
+            hg_bulk_desc_cache->lru_head;
+
+        hg_bulk_desc_lru_remove(hg_bulk_desc_cache, hg_bulk_desc_entry);
+        hg_bulk_desc_entry->next = release_list;
+        release_list = hg_bulk_desc_entry;
+    }
+    hg_hash_table_free(hg_bulk_desc_cache->table);
+    hg_thread_mutex_destroy(&hg_bulk_desc_cache->lock);
+    free(hg_bulk_desc_cache);
+
+    /* Cache is gone even if some handles could not be released */
+    ret = hg_bulk_desc_cache_release(release_list);
+    HG_CHECK_HG_ERROR(done, ret, "Could not release cached handles");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_desc_cache_deserialize(struct hg_bulk_desc_cache *hg_bulk_desc_cache,
+    hg_core_class_t *core_class, struct hg_bulk **hg_bulk_ptr, const void *buf,
+    hg_size_t buf_size)
+{
+    struct hg_bulk_desc_entry desc_key, *hg_bulk_desc_entry = NULL;
+    struct hg_bulk_desc_entry *release_list = NULL;
+    struct hg_bulk_desc_info desc_info;
+    struct hg_bulk *hg_bulk = NULL;
+    hg_return_t ret = HG_SUCCESS;
+    int rc;
+
+    /* Eager descriptors carry data and are not worth caching, handles that
+     * return data in the response or describe a compressed copy are not
+     * shared between RPCs */
+    if (buf_size < sizeof(desc_info))
+        return hg_bulk_deserialize(core_class, hg_bulk_ptr, buf, buf_size);
+    memcpy(&desc_info, buf, sizeof(desc_info));
+    if ((desc_info.flags & HG_BULK_EAGER) ||
+        (desc_info.ext_flags & (HG_BULK_RESP | HG_BULK_COMPRESSED)))
+        return hg_bulk_deserialize(core_class, hg_bulk_ptr, buf, buf_size);
+
+    desc_key.buf = buf;
+    desc_key.buf_size = buf_size;
+    desc_key.hash = hg_bulk_desc_hash((hg_hash_table_key_t) &desc_key);
+
+    hg_thread_mutex_lock(&hg_bulk_desc_cache->lock);
+    hg_bulk_desc_entry = (struct hg_bulk_desc_entry *) hg_hash_table_lookup(
+        hg_bulk_desc_cache->table, (hg_hash_table_key_t) &desc_key);
+    if (hg_bulk_desc_entry != HG_HASH_TABLE_NULL) {
+        hg_bulk = hg_bulk_desc_entry->hg_bulk;
+        hg_atomic_incr32(&hg_bulk->ref_count);
+        hg_bulk_desc_lru_remove(hg_bulk_desc_cache, hg_bulk_desc_entry);
+        hg_bulk_desc_lru_insert(hg_bulk_desc_cache, hg_bulk_desc_entry);
+        hg_bulk_desc_cache->stats.hits++;
+        hg_thread_mutex_unlock(&hg_bulk_desc_cache->lock);
+
+        HG_LOG_DEBUG("Found cached handle (%p) for descriptor", hg_bulk);
+        *hg_bulk_ptr = hg_bulk;
+
+        return ret;
+    }
+    hg_bulk_desc_cache->stats.misses++;
+    hg_thread_mutex_unlock(&hg_bulk_desc_cache->lock);
+
+    /* Not found, deserialize without holding the lock */
+    ret = hg_bulk_deserialize(core_class, &hg_bulk, buf, buf_size);
+    HG_CHECK_HG_ERROR(error, ret, "Could not deserialize handle");
+
+    /* Keep a copy of the descriptor as key */
+    hg_bulk_desc_entry = (struct hg_bulk_desc_entry *) malloc(
+        sizeof(struct hg_bulk_desc_entry) + buf_size);
+    HG_CHECK_ERROR(hg_bulk_desc_entry == NULL, error, ret, HG_NOMEM,
+        "Could not allocate descriptor entry");
+    memcpy(hg_bulk_desc_entry + 1, buf, buf_size);
+    hg_bulk_desc_entry->buf = hg_bulk_desc_entry + 1;
+    hg_bulk_desc_entry->buf_size = buf_size;
+    hg_bulk_desc_entry->hash = desc_key.hash;
+    hg_bulk_desc_entry->hg_bulk = hg_bulk;
+    hg_bulk_desc_entry->next = NULL;
+
+    hg_thread_mutex_lock(&hg_bulk_desc_cache->lock);
+
+    /* Same descriptor may have been inserted concurrently, in which case the
+     * new handle is not shared */
+    if (hg_hash_table_lookup(hg_bulk_desc_cache->table,
+            (hg_hash_table_key_t) hg_bulk_desc_entry) != HG_HASH_TABLE_NULL) {
+        hg_thread_mutex_unlock(&hg_bulk_desc_cache->lock);
+        free(hg_bulk_desc_entry);
+        goto done;
+    }
+
+    rc = hg_hash_table_insert(hg_bulk_desc_cache->table,
+        (hg_hash_table_key_t) hg_bulk_desc_entry,
+        (hg_hash_table_value_t) hg_bulk_desc_entry);
+    if (rc == 0) {
+        hg_thread_mutex_unlock(&hg_bulk_desc_cache->lock);
+        free(hg_bulk_desc_entry);
+        HG_GOTO_ERROR(error, ret, HG_NOMEM, "Could not insert entry");
+    }
+
+    /* Cache keeps its own reference to the handle */
+    hg_atomic_incr32(&hg_bulk->ref_count);
+    hg_bulk->desc_cached = HG_TRUE;
+    hg_bulk_desc_lru_insert(hg_bulk_desc_cache, hg_bulk_desc_entry);
+    hg_bulk_desc_cache->stats.count++;
+
+    /* Evict least recently used entries, handles that are still in use are
+     * released once freed */
+    while (hg_bulk_desc_cache->stats.count > hg_bulk_desc_cache->max_count) {
+        struct hg_bulk_desc_entry *lru_entry = hg_bulk_desc_cache->lru_tail;
+
+        hg_bulk_desc_lru_remove(hg_bulk_desc_cache, lru_entry);
+        hg_hash_table_remove(
+            hg_bulk_desc_cache->table, (hg_hash_table_key_t) lru_entry);
+        hg_bulk_desc_cache->stats.count--;
+        hg_bulk_desc_cache->stats.evictions++;
+        lru_entry->next = release_list;
+        release_list = lru_entry;
+    }
+    hg_thread_mutex_unlock(&hg_bulk_desc_cache->lock);
+
+    ret = hg_bulk_desc_cache_release(release_list);
+    HG_CHECK_HG_ERROR(error, ret, "Could not release evicted handles");
+
+done:
+    *hg_bulk_ptr = hg_bulk;
+
+    return ret;
+
+error:
+    hg_bulk_free(hg_bulk);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_desc_cache_release(struct hg_bulk_desc_entry *release_list)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Entries are already out of the cache, release all of them and report
+     * the first error */
+    while (release_list) {
+        struct hg_bulk_desc_entry *hg_bulk_desc_entry = release_list;
+        hg_return_t hg_ret;
+
+        release_list = hg_bulk_desc_entry->next;
+
+        hg_ret = hg_bulk_free(hg_bulk_desc_entry->hg_bulk);
+        if (hg_ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not free cached handle");
+            if (ret == HG_SUCCESS)
+                ret = hg_ret;
+        }
+
+        free(hg_bulk_desc_entry);
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_desc_cache_detach(
+    struct hg_bulk_desc_cache *hg_bulk_desc_cache, struct hg_bulk *hg_bulk)
+{
+    struct hg_bulk_desc_entry *hg_bulk_desc_entry;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_thread_mutex_lock(&hg_bulk_desc_cache->lock);
+
+    /* Binding is rare, look for the entry of the handle in LRU order */
+    for (hg_bulk_desc_entry = hg_bulk_desc_cache->lru_head;
+         hg_bulk_desc_entry != NULL;
+         hg_bulk_desc_entry = hg_bulk_desc_entry->lru_next)
+        if (hg_bulk_desc_entry->hg_bulk == hg_bulk)
+            break;
+
+    /* References are only taken under the lock, the caller and the cache (if
+     * the entry was not evicted) must be the only owners */
+    HG_CHECK_ERROR(hg_atomic_get32(&hg_bulk->ref_count) !=
+                       ((hg_bulk_desc_entry != NULL) ? 2 : 1),
+        unlock, ret, HG_PERMISSION,
+        "Handle is shared through descriptor cache");
+
+    if (hg_bulk_desc_entry) {
+        hg_bulk_desc_lru_remove(hg_bulk_desc_cache, hg_bulk_desc_entry);
+        hg_hash_table_remove(hg_bulk_desc_cache->table,
+            (hg_hash_table_key_t) hg_bulk_desc_entry);
+        hg_bulk_desc_cache->stats.count--;
+        free(hg_bulk_desc_entry);
+
+        /* Drop reference of cache, caller still holds one */
+        hg_atomic_decr32(&hg_bulk->ref_count);
+    }
+    hg_bulk->desc_cached = HG_FALSE;
+
+unlock:
+    hg_thread_mutex_unlock(&hg_bulk_desc_cache->lock);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static unsigned int
+hg_bulk_desc_hash(hg_hash_table_key_t key)
+{
+    const struct hg_bulk_desc_entry *hg_bulk_desc_entry =
+        (const struct hg_bulk_desc_entry *) key;
+    const unsigned char *p = (const unsigned char *) hg_bulk_desc_entry->buf;
+    unsigned int result = 5381;
+    hg_size_t i;
+
+    /* Same as hg_hash_string() (djb2) */
+    for (i = 0; i < hg_bulk_desc_entry->buf_size; i++)
+        result = (result << 5) + result + p[i];
+
+    return result;
+}
+
+/*---------------------------------------------------------------------------*/
+static int
+hg_bulk_desc_equal(hg_hash_table_key_t key1, hg_hash_table_key_t key2)
+{
+    const struct hg_bulk_desc_entry *entry1 =
+        (const struct hg_bulk_desc_entry *) key1;
+    const struct hg_bulk_desc_entry *entry2 =
+        (const struct hg_bulk_desc_entry *) key2;
+
+    return entry1->hash == entry2->hash &&
+           entry1->buf_size == entry2->buf_size &&
+           memcmp(entry1->buf, entry2->buf, entry1->buf_size) == 0;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_desc_lru_insert(struct hg_bulk_desc_cache *hg_bulk_desc_cache,
+    struct hg_bulk_desc_entry *hg_bulk_desc_entry)
+{
+    hg_bulk_desc_entry->lru_prev = NULL;
+    hg_bulk_desc_entry->lru_next = hg_bulk_desc_cache->lru_head;
+    if (hg_bulk_desc_cache->lru_head)
+        hg_bulk_desc_cache->lru_head->lru_prev = hg_bulk_desc_entry;
+    else
+        hg_bulk_desc_cache->lru_tail = hg_bulk_desc_entry;
+    hg_bulk_desc_cache->lru_head = hg_bulk_desc_entry;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_desc_lru_remove(struct hg_bulk_desc_cache *hg_bulk_desc_cache,
+    struct hg_bulk_desc_entry *hg_bulk_desc_entry)
+{
+    if (hg_bulk_desc_entry->lru_prev)
+        hg_bulk_desc_entry->lru_prev->lru_next = hg_bulk_desc_entry->lru_next;
+    else
+        hg_bulk_desc_cache->lru_head = hg_bulk_desc_entry->lru_next;
+    if (hg_bulk_desc_entry->lru_next)
+        hg_bulk_desc_entry->lru_next->lru_prev = hg_bulk_desc_entry->lru_prev;
+    else
+        hg_bulk_desc_cache->lru_tail = hg_bulk_desc_entry->lru_prev;
+    hg_bulk_desc_entry->lru_prev = NULL;
+    hg_bulk_desc_entry->lru_next = NULL;
+}
+
+/*---------------------------------------------------------------------------*/
+void *
+hg_bulk_get_serialize_cached_ptr(struct hg_bulk *hg_bulk)
+{
+    return hg_bulk->serialize_ptr;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_size_t
+hg_bulk_get_serialize_cached_size(struct hg_bulk *hg_bulk)
+{
+    return hg_bulk->serialize_size;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_bulk_set_serialize_cached_ptr(
+    struct hg_bulk *hg_bulk, void *buf, na_size_t buf_size)
+{
+    /* Shared handles may be decoded from several buffers at once, descriptors
+     * of handles returned in a response must not be forwarded as is */
+    if (hg_bulk->desc_cached || (hg_bulk->desc.info.ext_flags & HG_BULK_RESP))
+        return;
+
+    hg_bulk->serialize_ptr = buf;
+    hg_bulk->serialize_size = buf_size;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bool_t
+hg_bulk_is_eager(struct hg_bulk *hg_bulk)
+{
+    return (hg_bulk->desc.info.flags & HG_BULK_READ_ONLY) &&
+           !(hg_bulk->desc.info.flags & HG_BULK_VIRT);
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bool_t
+hg_bulk_eager_write_reserve(
+    struct hg_bulk_eager_info *eager_info, struct hg_bulk *hg_bulk)
+{
+    hg_size_t size = hg_bulk->desc.info.len + HG_BULK_EAGER_WRITE_ENTRY_SIZE;
+
+    /* Only data of local write-only handles can be returned */
+    if ((hg_bulk->desc.info.flags & HG_BULK_READWRITE) != HG_BULK_WRITE_ONLY ||
+        (hg_bulk->desc.info.flags & HG_BULK_VIRT) ||
+        hg_bulk->desc.info.len == 0)
+        return HG_FALSE;
+
+    if (eager_info->count == HG_BULK_EAGER_WRITE_MAX ||
+        eager_info->size_left < size)
+        return HG_FALSE;
+
+    /* Keep handle until the response is received */
+    hg_atomic_incr32(&hg_bulk->ref_count);
+    eager_info->handles[eager_info->count++] = hg_bulk;
+    eager_info->size_left -= size;
+
+    return HG_TRUE;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_eager_write_attach(
+    struct hg_bulk_eager_info *eager_info, struct hg_bulk *hg_bulk)
+{
+    struct hg_bulk_eager_write *hg_bulk_eager_write = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (!(hg_bulk->desc.info.ext_flags & HG_BULK_RESP))
+        goto done;
+
+    HG_CHECK_ERROR(eager_info->count == HG_BULK_EAGER_WRITE_MAX ||
+                       hg_bulk->eager_write != NULL,
+        error, ret, HG_PROTOCOL_ERROR,
+        "Could not attach handle returned in response");
+
+    hg_bulk_eager_write =
+        (struct hg_bulk_eager_write *) malloc(sizeof(*hg_bulk_eager_write));
+    HG_CHECK_ERROR(hg_bulk_eager_write == NULL, error, ret, HG_NOMEM,
+        "Could not allocate eager write state");
+
+    hg_bulk_eager_write->buf = malloc(hg_bulk->desc.info.len);
+    HG_CHECK_ERROR(hg_bulk_eager_write->buf == NULL, error, ret, HG_NOMEM,
+        "Could not allocate staging buffer");
+    hg_bulk_eager_write->len = hg_bulk->desc.info.len;
+    hg_bulk_eager_write->start = 0;
+    hg_bulk_eager_write->end = 0;
+    hg_thread_spin_init(&hg_bulk_eager_write->lock);
+
+    hg_bulk->eager_write = hg_bulk_eager_write;
+    hg_atomic_incr32(&hg_bulk->ref_count);
+    eager_info->handles[eager_info->count++] = hg_bulk;
+
+done:
+    return ret;
+
+error:
+    if (hg_bulk_eager_write) {
+        free(hg_bulk_eager_write->buf);
+        free(hg_bulk_eager_write);
+    }
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_eager_write_encode(struct hg_bulk_eager_info *eager_info, void *buf,
+    hg_size_t buf_size, hg_size_t *size_ptr)
+{
+    char *buf_ptr = (char *) buf;
+    hg_size_t buf_size_left = buf_size;
+    hg_uint32_t i;
+    hg_return_t ret = HG_SUCCESS;
+
+    for (i = 0; i < eager_info->count; i++) {
+        struct hg_bulk_eager_write *hg_bulk_eager_write =
+            eager_info->handles[i]->eager_write;
+        hg_size_t offset, len;
+
+        /* Stop staging data, anything pushed from now on goes through RMA */
+        hg_thread_spin_lock(&hg_bulk_eager_write->lock);
+        offset = hg_bulk_eager_write->start;
+        len = hg_bulk_eager_write->end - hg_bulk_eager_write->start;
+        if (len > 0 &&
+            buf_size_left >= len + HG_BULK_EAGER_WRITE_ENTRY_SIZE) {
+            memcpy(buf_ptr, &i, sizeof(i));
+            buf_ptr += sizeof(i);
+            memcpy(buf_ptr, &offset, sizeof(offset));
+            buf_ptr += sizeof(offset);
+            memcpy(buf_ptr, &len, sizeof(len));
+            buf_ptr += sizeof(len);
+            memcpy(buf_ptr, (char *) hg_bulk_eager_write->buf + offset, len);
+            buf_ptr += len;
+            buf_size_left -= len + HG_BULK_EAGER_WRITE_ENTRY_SIZE;
+            len = 0;
+        }
+        free(hg_bulk_eager_write->buf);
+        hg_bulk_eager_write->buf = NULL;
+        hg_thread_spin_unlock(&hg_bulk_eager_write->lock);
+
+        HG_CHECK_ERROR(len > 0, done, ret, HG_OVERFLOW,
+            "Response buffer too small for %zu bytes of data", len);
+    }
+
+    *size_ptr = buf_size - buf_size_left;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_eager_write_decode(struct hg_bulk_eager_info *eager_info,
+    const void *buf, hg_size_t buf_size)
+{
+    const char *buf_ptr = (const char *) buf;
+    hg_size_t buf_size_left = buf_size;
+    hg_return_t ret = HG_SUCCESS;
+
+    while (buf_size_left > 0) {
+        struct hg_bulk *hg_bulk;
+        struct hg_bulk_segment data_segment;
+        hg_uint32_t index, segment_start_index = 0;
+        hg_size_t offset, len, segment_start_offset = 0;
+
+        HG_BULK_DECODE(done, ret, buf_ptr, buf_size_left, &index, hg_uint32_t);
+        HG_BULK_DECODE(done, ret, buf_ptr, buf_size_left, &offset, hg_size_t);
+        HG_BULK_DECODE(done, ret, buf_ptr, buf_size_left, &len, hg_size_t);
+        HG_CHECK_ERROR(index >= eager_info->count, done, ret,
+            HG_PROTOCOL_ERROR, "Invalid handle index (%u)", index);
+        hg_bulk = eager_info->handles[index];
+        HG_CHECK_ERROR(len > buf_size_left ||
+                           offset > hg_bulk->desc.info.len ||
+                           len > hg_bulk->desc.info.len - offset,
+            done, ret, HG_PROTOCOL_ERROR, "Invalid range of returned data");
+
+        /* Copy data into local segments */
+        if (offset > 0)
+            hg_bulk_offset_translate(HG_BULK_SEGMENTS(hg_bulk),
+                hg_bulk->desc.info.segment_count, offset, &segment_start_index,
+                &segment_start_offset);
+        data_segment.base = (hg_ptr_t) buf_ptr;
+        data_segment.len = len;
+        hg_bulk_transfer_segments_self(hg_bulk_memcpy_get, &data_segment, 1, 0,
+            0, HG_BULK_SEGMENTS(hg_bulk), hg_bulk->desc.info.segment_count,
+            segment_start_index, segment_start_offset, len);
+
+        buf_ptr += len;
+        buf_size_left -= len;
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bool_t
+hg_bulk_eager_write_push(hg_bulk_t origin_handle, hg_size_t origin_offset,
+    hg_bulk_t local_handle, hg_size_t local_offset, hg_size_t size)
+{
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) local_handle;
+
+    /* Invalid transfers are reported by the RMA path */
+    if (!hg_bulk_origin || !hg_bulk_origin->eager_write || !hg_bulk_local ||
+        size == 0 ||
+        (origin_offset + size) > hg_bulk_origin->desc.info.len ||
+        (local_offset + size) > hg_bulk_local->desc.info.len ||
+        !(hg_bulk_local->desc.info.flags & HG_BULK_READ_ONLY))
+        return HG_FALSE;
+
+    return hg_bulk_eager_write_put(hg_bulk_origin->eager_write, origin_offset,
+        HG_BULK_SEGMENTS(hg_bulk_local),
+        hg_bulk_local->desc.info.segment_count, local_offset, size);
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bool_t
+hg_bulk_push_is_sync(hg_addr_t origin_addr, hg_bulk_t origin_handle,
+    hg_size_t origin_offset, hg_bulk_t local_handle, hg_size_t local_offset,
+    hg_size_t size)
+{
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) local_handle;
+    na_class_t *na_class = hg_bulk_origin->na_class;
+
+    if (HG_Core_addr_is_self((hg_core_addr_t) origin_addr))
+        return HG_TRUE;
+
+#ifdef NA_HAS_SM
+    if (hg_bulk_origin->desc.info.flags & HG_BULK_SM)
+        na_class = hg_bulk_origin->na_sm_class;
+#endif
+
+    /* Operations that do not fit in a single round are issued from completion
+     * callbacks */
+    if (NA_Put_is_sync(na_class)) {
+        hg_uint32_t origin_count = hg_bulk_origin->desc.info.segment_count,
+                    local_count = hg_bulk_local->desc.info.segment_count;
+        hg_uint32_t origin_segment_start_index = 0,
+                    local_segment_start_index = 0;
+        hg_size_t origin_segment_start_offset = 0,
+                  local_segment_start_offset = 0;
+
+        if (((hg_bulk_origin->desc.info.flags & HG_BULK_REGV) ||
+                origin_count == 1) &&
+            ((hg_bulk_local->desc.info.flags & HG_BULK_REGV) ||
+                local_count == 1))
+            return HG_TRUE;
+
+        if (origin_offset > 0)
+            hg_bulk_offset_translate(HG_BULK_SEGMENTS(hg_bulk_origin),
+                origin_count, origin_offset, &origin_segment_start_index,
+                &origin_segment_start_offset);
+        if (local_offset > 0)
+            hg_bulk_offset_translate(HG_BULK_SEGMENTS(hg_bulk_local),
+                local_count, local_offset, &local_segment_start_index,
+                &local_segment_start_offset);
+
+        return hg_bulk_transfer_get_op_count(HG_BULK_SEGMENTS(hg_bulk_origin),
+                   origin_count, origin_segment_start_index,
+                   origin_segment_start_offset, HG_BULK_SEGMENTS(hg_bulk_local),
+                   local_count, local_segment_start_index,
+                   local_segment_start_offset, size) <= HG_BULK_STATIC_MAX;
+    }
+
+    return HG_FALSE;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_bulk_eager_write_release(struct hg_bulk_eager_info *eager_info)
+{
+    hg_uint32_t i;
+
+    for (i = 0; i < eager_info->count; i++) {
+        struct hg_bulk *hg_bulk = eager_info->handles[i];
+        hg_return_t ret;
+
+        /* Response was not sent, anything pushed from now on goes through
+         * RMA */
+        if (hg_bulk->eager_write) {
+            hg_thread_spin_lock(&hg_bulk->eager_write->lock);
+            free(hg_bulk->eager_write->buf);
+            hg_bulk->eager_write->buf = NULL;
+            hg_thread_spin_unlock(&hg_bulk->eager_write->lock);
+        }
+
+        ret = hg_bulk_free(hg_bulk);
+        HG_CHECK_ERROR_DONE(ret != HG_SUCCESS, "Could not release handle");
+    }
+    eager_info->count = 0;
+
+    for (i = 0; i < eager_info->compress_count; i++) {
+        struct hg_bulk *hg_bulk = eager_info->compress_handles[i];
+        hg_return_t ret;
+
+        /* Copy kept by handle can be used again by the next RPC */
+        if (eager_info->compress_copies[i] == hg_bulk->compress_copy)
+            hg_atomic_and32(
+                &hg_bulk->compress_status, ~HG_BULK_COMPRESS_BUSY);
+        else {
+            ret = hg_bulk_free(eager_info->compress_copies[i]);
+            HG_CHECK_ERROR_DONE(
+                ret != HG_SUCCESS, "Could not release compressed copy");
+        }
+        ret = hg_bulk_free(hg_bulk);
+        HG_CHECK_ERROR_DONE(ret != HG_SUCCESS, "Could not release handle");
+    }
+    eager_info->compress_count = 0;
+}
+
+/*---------------------------------------------------------------------------*/
+struct hg_bulk *
+hg_bulk_compress_attach(struct hg_bulk_eager_info *eager_info,
+    struct hg_bulk *hg_bulk, unsigned long flags)
+{
+    struct hg_bulk *hg_bulk_copy = NULL;
+    hg_util_int32_t status;
+    hg_bool_t reuse;
+    hg_return_t ret;
+    hg_uint32_t i;
+
+    /* Data of read-write handles may change through pushes */
+    if ((hg_bulk->desc.info.flags & HG_BULK_READWRITE) != HG_BULK_READ_ONLY ||
+        (hg_bulk->desc.info.flags & HG_BULK_VIRT) ||
+        hg_bulk->desc.info.len < HG_BULK_COMPRESS_MIN_SIZE)
+        return NULL;
+
+    /* Handle may be encoded more than once for the same RPC */
+    for (i = 0; i < eager_info->compress_count; i++)
+        if (eager_info->compress_handles[i] == hg_bulk)
+            return eager_info->compress_copies[i];
+
+    /* Data that did not compress once is not compressed again */
+    status = hg_atomic_get32(&hg_bulk->compress_status);
+    if (eager_info->compress_count == HG_BULK_EAGER_WRITE_MAX ||
+        (status & HG_BULK_COMPRESS_NONE))
+        return NULL;
+
+    /* Buffer and registration of the copy kept by the handle are reused,
+     * unless another RPC still has it attached */
+    reuse = !(status & HG_BULK_COMPRESS_BUSY) &&
+            hg_atomic_cas32(&hg_bulk->compress_status, status,
+                status | HG_BULK_COMPRESS_BUSY);
+    if (reuse)
+        hg_bulk_copy = hg_bulk->compress_copy;
+
+    ret = hg_bulk_compress(
+        hg_bulk, HG_BULK_CHECKSUM_ENABLED(hg_bulk, flags), &hg_bulk_copy);
+    if (ret != HG_SUCCESS) {
+        if (ret == HG_OVERFLOW)
+            hg_atomic_or32(&hg_bulk->compress_status, HG_BULK_COMPRESS_NONE);
+        if (reuse)
+            hg_atomic_and32(
+                &hg_bulk->compress_status, ~HG_BULK_COMPRESS_BUSY);
+        return NULL;
+    }
+    if (reuse)
+        hg_bulk->compress_copy = hg_bulk_copy;
+
+    /* Keep handle until the response is received */
+    hg_atomic_incr32(&hg_bulk->ref_count);
+    eager_info->compress_handles[eager_info->compress_count] = hg_bulk;
+    eager_info->compress_copies[eager_info->compress_count++] = hg_bulk_copy;
+
+    return hg_bulk_copy;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_size_t
+hg_bulk_compress_get_serialize_size(
+    struct hg_bulk *hg_bulk, unsigned long flags, struct hg_bulk *hg_bulk_copy)
+{
+    /* Descriptor + block layout + descriptor of compressed copy */
+    return hg_bulk_get_serialize_size(hg_bulk, flags) +
+           sizeof(hg_size_t) + sizeof(hg_uint32_t) +
+           hg_bulk_copy->compressed->block_count * sizeof(hg_size_t) +
+           hg_bulk_get_serialize_size(hg_bulk_copy, 0);
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_compress_serialize(void *buf, hg_size_t buf_size, unsigned long flags,
+    struct hg_bulk *hg_bulk, struct hg_bulk *hg_bulk_copy)
+{
+    struct hg_bulk_compressed *hg_bulk_compressed = hg_bulk_copy->compressed;
+    hg_size_t desc_size = hg_bulk_get_serialize_size(hg_bulk, flags);
+    char *buf_ptr = (char *) buf + desc_size;
+    hg_size_t buf_size_left;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(buf_size < desc_size, done, ret, HG_OVERFLOW,
+        "Buffer size too small (%zu)", buf_size);
+    buf_size_left = buf_size - desc_size;
+
+    ret = hg_bulk_serialize(buf, desc_size, flags | HG_BULK_COMPRESS, hg_bulk,
+        hg_bulk_compressed->crcs);
+    HG_CHECK_HG_ERROR(done, ret, "Could not serialize handle");
+
+    /* Size of blocks, followed by end offset of each block */
+    HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left,
+        &hg_bulk_compressed->block_size, hg_size_t);
+    HG_BULK_ENCODE(done, ret, buf_ptr, buf_size_left,
+        &hg_bulk_compressed->block_count, hg_uint32_t);
+    HG_BULK_ENCODE_ARRAY(done, ret, buf_ptr, buf_size_left,
+        hg_bulk_compressed->offsets + 1, hg_size_t,
+        hg_bulk_compressed->block_count);
+
+    ret = hg_bulk_serialize(buf_ptr, buf_size_left, 0, hg_bulk_copy, NULL);
+    HG_CHECK_HG_ERROR(done, ret, "Could not serialize compressed copy");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_compress(struct hg_bulk *hg_bulk, hg_bool_t checksum,
+    struct hg_bulk **hg_bulk_copy_ptr)
+{
+    const struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
+    struct hg_bulk *hg_bulk_copy = *hg_bulk_copy_ptr;
+    struct hg_bulk_compressed *hg_bulk_compressed;
+    hg_size_t len = hg_bulk->desc.info.len, block_size, max_size, offset;
+    char *buf, *raw_buf = NULL;
+    hg_uint32_t block_count, i;
+    hg_return_t ret = HG_SUCCESS;
+
+    block_size = hg_bulk_block_size(len);
+    block_count = (hg_uint32_t) ((len + block_size - 1) / block_size);
+
+    /* Not worth it if less than an eighth of the data is saved */
+    max_size = len - len / 8;
+
+    /* Blocks are compressed directly into the copy, which is allocated
+     * internally so that its registration is not cached */
+    if (!hg_bulk_copy) {
+        ret = hg_bulk_create(hg_bulk->core_class, 1, NULL, &max_size,
+            HG_BULK_READ_ONLY, &hg_bulk_copy);
+        HG_CHECK_HG_ERROR(
+            error, ret, "Could not create handle of compressed copy");
+
+        hg_bulk_compressed = (struct hg_bulk_compressed *) calloc(
+            1, sizeof(struct hg_bulk_compressed));
+        HG_CHECK_ERROR(hg_bulk_compressed == NULL, error, ret, HG_NOMEM,
+            "Could not allocate compressed copy");
+        hg_bulk_copy->compressed = hg_bulk_compressed;
+        hg_bulk_compressed->offsets =
+            (hg_size_t *) malloc((block_count + 1) * sizeof(hg_size_t));
+        HG_CHECK_ERROR(hg_bulk_compressed->offsets == NULL, error, ret,
+            HG_NOMEM, "Could not allocate block offsets");
+        hg_bulk_compressed->block_size = block_size;
+        hg_bulk_compressed->block_count = block_count;
+    } else
+        hg_bulk_compressed = hg_bulk_copy->compressed;
+    buf = (char *) hg_bulk_copy->desc.segments.s[0].base;
+
+    /* Checksums of a reused copy are recomputed along with its blocks */
+    if (checksum && !hg_bulk_compressed->crcs) {
+        hg_bulk_compressed->crcs =
+            (hg_uint32_t *) malloc(block_count * sizeof(hg_uint32_t));
+        HG_CHECK_ERROR(hg_bulk_compressed->crcs == NULL, error, ret, HG_NOMEM,
+            "Could not allocate block checksums");
+    } else if (!checksum) {
+        free(hg_bulk_compressed->crcs);
+        hg_bulk_compressed->crcs = NULL;
+    }
+
+    hg_bulk_compressed->offsets[0] = 0;
+    for (i = 0, offset = 0; i < block_count; i++, offset += block_size) {
+        hg_size_t block_len = HG_BULK_MIN(block_size, len - offset);
+        hg_size_t left = max_size - hg_bulk_compressed->offsets[i];
+        char *block_buf = buf + hg_bulk_compressed->offsets[i];
+        hg_size_t src_len, compressed_len;
+        hg_uint32_t count;
+        void *src = NULL;
+
+        /* Blocks that span segments are gathered first */
+        hg_bulk_access(
+            hg_bulk, offset, block_len, HG_BULK_READ_ONLY, 1, &src, &src_len,
+            &count);
+        if (src_len < block_len) {
+            struct hg_bulk_segment raw_segment;
+            hg_uint32_t segment_index;
+            hg_size_t segment_offset;
+
+            if (!raw_buf) {
+                raw_buf = (char *) malloc(block_size);
+                HG_CHECK_ERROR(raw_buf == NULL, error, ret, HG_NOMEM,
+                    "Could not allocate block buffer");
+            }
+            hg_bulk_offset_translate(segments,
+                hg_bulk->desc.info.segment_count, offset, &segment_index,
+                &segment_offset);
+            raw_segment.base = (hg_ptr_t) raw_buf;
+            raw_segment.len = block_len;
+            hg_bulk_transfer_segments_self(hg_bulk_memcpy_get, segments,
+                hg_bulk->desc.info.segment_count, segment_index,
+                segment_offset, &raw_segment, 1, 0, 0, block_len);
+            src = raw_buf;
+        }
+
+        /* Block is checksummed while it is hot in cache */
+        if (hg_bulk_compressed->crcs)
+            hg_bulk_compressed->crcs[i] = hg_crc32c(0, src, block_len);
+
+        /* Blocks that do not compress are stored as is */
+        compressed_len = hg_compress(
+            src, block_len, block_buf, HG_BULK_MIN(left, block_len - 1));
+        if (compressed_len == 0) {
+            if (block_len > left) {
+                HG_LOG_DEBUG("Data of handle (%p) does not compress", hg_bulk);
+                ret = HG_OVERFLOW;
+                goto error;
+            }
+            memcpy(block_buf, src, block_len);
+            compressed_len = block_len;
+        }
+        hg_bulk_compressed->offsets[i + 1] =
+            hg_bulk_compressed->offsets[i] + compressed_len;
+    }
+    free(raw_buf);
+
+    HG_LOG_DEBUG("Compressed %zu bytes of handle (%p) into %zu bytes",
+        hg_bulk->desc.info.len, hg_bulk,
+        hg_bulk_compressed->offsets[block_count]);
+
+    *hg_bulk_copy_ptr = hg_bulk_copy;
+
+    return ret;
+
+error:
+    free(raw_buf);
+    /* Copy passed by caller is left to it */
+    if (hg_bulk_copy && hg_bulk_copy != *hg_bulk_copy_ptr) {
+        hg_return_t hg_ret = hg_bulk_free(hg_bulk_copy);
+        HG_CHECK_ERROR_DONE(
+            hg_ret != HG_SUCCESS, "Could not free compressed copy");
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_compressed_free(struct hg_bulk_compressed *hg_bulk_compressed)
+{
+    if (!hg_bulk_compressed)
+        return;
+
+    if (hg_bulk_compressed->region) {
+        hg_return_t ret = hg_bulk_free(hg_bulk_compressed->region);
+        HG_CHECK_ERROR_DONE(
+            ret != HG_SUCCESS, "Could not free compressed blocks");
+    }
+    free(hg_bulk_compressed->offsets);
+    free(hg_bulk_compressed->crcs);
+    free(hg_bulk_compressed);
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
+    hg_uint8_t flags, hg_uint32_t max_count, void **buf_ptrs,
+    hg_size_t *buf_sizes, hg_uint32_t *actual_count)
+{
+    struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
+    hg_uint32_t segment_index;
+    hg_size_t segment_offset;
+    hg_size_t remaining_size = size;
+    hg_uint32_t count = 0;
+
+    /* TODO use flags */
+    (void) flags;
+
+    hg_bulk_offset_translate(segments, hg_bulk->desc.info.segment_count, offset,
+        &segment_index, &segment_offset);
+
+    while ((remaining_size > 0) && (count < max_count)) {
+        hg_ptr_t base;
+        hg_size_t len;
+
+        /* Can only transfer smallest size */
+        len = segments[segment_index].len - segment_offset;
+
+        /* Remaining size may be smaller */
+        len = HG_BULK_MIN(remaining_size, len);
+        base = segments[segment_index].base + (hg_ptr_t) segment_offset;
+
+        /* Fill segments */
+        if (buf_ptrs)
+            buf_ptrs[count] = (void *) base;
+        if (buf_sizes)
+            buf_sizes[count] = len;
+        /*
+        printf("Segment %d: address=0x%lX\n", count, segment_address);
+        printf("Segment %d: size=%zu\n", count, segment_size);
+         */
+
+        /* Decrease remaining size from the size of data we transferred */
+        remaining_size -= len;
+
+        /* Change segment */
+        segment_index++;
+        segment_offset = 0;
+        count++;
+    }
+
+    if (actual_count)
+        *actual_count = count;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_bulk_offset_translate(const struct hg_bulk_segment *segments,
+    hg_uint32_t count, hg_size_t offset, hg_uint32_t *segment_start_index,
+    hg_size_t *segment_start_offset)
+{
+    hg_uint32_t i, new_segment_start_index = 0;
+    hg_size_t new_segment_offset = offset, next_offset = 0;
+
+    /* Dynamic arrays of segments are indexed, look for the last segment that
+     * starts before offset */
+    if (count > HG_BULK_STATIC_MAX) {
+        const hg_size_t *offsets = HG_BULK_SEGMENT_OFFSETS(segments, count);
+        hg_uint32_t low = 0, high = count - 1;
+
+        while (low < high) {
+            hg_uint32_t mid = low + (high - low + 1) / 2;
+
+            if (offsets[mid] <= offset)
+                low = mid;
+            else
+                high = mid - 1;
+        }
+
+        *segment_start_index = low;
+        *segment_start_offset = offset - offsets[low];
+        return;
+    }
+
+    /* Get start index and handle offset */
+    for (i = 0; i < count; i++) {
+        next_offset += segments[i].len;
+        if (offset < next_offset) {
+            new_segment_start_index = i;
+            break;
+        }
+        new_segment_offset -= segments[i].len;
+    }
+
+    *segment_start_index = new_segment_start_index;
+    *segment_start_offset = new_segment_offset;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_op_create(
+    hg_core_context_t *core_context, struct hg_bulk_op_id **hg_bulk_op_id_ptr)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_bulk_op_id =
+        (struct hg_bulk_op_id *) malloc(sizeof(struct hg_bulk_op_id));
+    HG_CHECK_ERROR(hg_bulk_op_id == NULL, done, ret, HG_NOMEM,
+        "Could not allocate HG Bulk operation ID");
+    memset(hg_bulk_op_id, 0, sizeof(struct hg_bulk_op_id));
+
+    hg_bulk_op_id->core_context = core_context;
+    hg_atomic_init32(&hg_bulk_op_id->ref_count, 1);
+
+    /* Completed by default */
+    hg_atomic_init32(&hg_bulk_op_id->status, HG_BULK_OP_COMPLETED);
+
+    hg_bulk_op_id->callback_info.type = HG_CB_BULK;
+    hg_bulk_op_id->op_count = 1; /* Default */
+    hg_atomic_init32(&hg_bulk_op_id->op_completed_count, 0);
+
+    /* NA op IDs are created on first use */
+    HG_LOG_DEBUG("Created new bulk op ID (%p)", hg_bulk_op_id);
+
+    *hg_bulk_op_id_ptr = hg_bulk_op_id;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_op_free(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    hg_core_class_t *core_class = hg_bulk_op_id->core_context->core_class;
+    long na_op_count = 0;
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
+
+    HG_LOG_DEBUG("Freeing bulk op ID (%p)", hg_bulk_op_id);
+
+    /* NA op IDs of window are kept until op ID is freed */
+    hg_bulk_na_window_free(hg_bulk_op_id);
+
+    for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
+        na_return_t na_ret;
+
+        if (hg_bulk_op_id->na_op_ids.s[i] == NULL)
+            continue;
+
+        na_ret =
+            NA_Op_destroy(core_class->na_class, hg_bulk_op_id->na_op_ids.s[i]);
+        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+            "NA_Op_destroy() failed (%s)", NA_Error_to_string(na_ret));
+        hg_bulk_op_id->na_op_ids.s[i] = NULL;
+        na_op_count--;
+    }
+
+#ifdef NA_HAS_SM
+    for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
+        na_return_t na_ret;
+
+        if (hg_bulk_op_id->na_sm_op_ids.s[i] == NULL)
+            continue;
+
+        na_ret = NA_Op_destroy(
+            core_class->na_sm_class, hg_bulk_op_id->na_sm_op_ids.s[i]);
+        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+            "NA_Op_destroy() failed (%s)", NA_Error_to_string(na_ret));
+        hg_bulk_op_id->na_sm_op_ids.s[i] = NULL;
+        na_op_count--;
+    }
+#endif
+
+    if (hg_bulk_op_id->op_pool)
+        hg_bulk_op_pool_account(hg_bulk_op_id->op_pool, na_op_count, 0);
+
+    free(hg_bulk_op_id);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_op_destroy(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
+
+    if (hg_atomic_decr32(&hg_bulk_op_id->ref_count)) {
+        /* Cannot free yet */
+        goto done;
+    }
 
-    /* Descriptor info */
-    HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left, &hg_bulk->desc.info,
-        struct hg_bulk_desc_info);
+    /* Release pipelined transfer */
+    if (hg_bulk_op_id->pipeline) {
+        hg_bulk_pipeline_free(hg_bulk_op_id->pipeline);
+        hg_bulk_op_id->pipeline = NULL;
+    }
 
-    HG_LOG_DEBUG(
-        "Deserializing bulk handle with %u segment(s), len is %zu bytes",
-        hg_bulk->desc.info.segment_count, hg_bulk->desc.info.len);
+    /* Release handles of batched transfers */
+    if (hg_bulk_op_id->batch) {
+        for (i = 0; i < hg_bulk_op_id->batch_count; i++) {
+            hg_return_t hg_ret;
+
+            hg_ret = hg_bulk_free(
+                (struct hg_bulk *) hg_bulk_op_id->batch[i].origin_handle);
+            HG_CHECK_ERROR_DONE(
+                hg_ret != HG_SUCCESS, "Could not free origin handle");
+            hg_ret = hg_bulk_free(
+                (struct hg_bulk *) hg_bulk_op_id->batch[i].local_handle);
+            HG_CHECK_ERROR_DONE(
+                hg_ret != HG_SUCCESS, "Could not free local handle");
+        }
+        free(hg_bulk_op_id->batch);
+        hg_bulk_op_id->batch = NULL;
+        hg_bulk_op_id->batch_count = 0;
+    }
+
+    /* Release origin address of windowed transfer */
+    if (hg_bulk_op_id->window &&
+        hg_bulk_op_id->window->na_origin_addr != NA_ADDR_NULL) {
+        na_return_t na_ret = NA_Addr_free(
+            hg_bulk_op_id->na_class, hg_bulk_op_id->window->na_origin_addr);
+        HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS,
+            "Could not free NA address (%s)", NA_Error_to_string(na_ret));
+        hg_bulk_op_id->window->na_origin_addr = NA_ADDR_NULL;
+    }
+
+    /* Repost handle if we were listening, otherwise destroy it */
+    if (hg_bulk_op_id->reuse) {
+        HG_LOG_DEBUG("Re-using bulk op ID (%p)", hg_bulk_op_id);
+
+        /* Reset ref_count */
+        hg_atomic_set32(&hg_bulk_op_id->ref_count, 1);
+
+        /* Reset status */
+        hg_atomic_set32(&hg_bulk_op_id->status, HG_BULK_OP_COMPLETED);
+
+        ret = hg_bulk_op_pool_release(hg_bulk_op_id->op_pool, hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(done, ret, "Could not release bulk op ID");
+    } else {
+        /* Op ID was created past the max size of the pool */
+        if (hg_bulk_op_id->op_pool)
+            hg_atomic_decr32(&hg_bulk_op_id->op_pool->unpooled_count);
+
+        ret = hg_bulk_op_free(hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(done, ret, "Could not free bulk op ID");
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_na_op_ids_create(struct hg_bulk_op_id *hg_bulk_op_id,
+    hg_bulk_na_op_id_t *hg_bulk_na_op_ids, hg_uint32_t count)
+{
+    long na_op_count = 0;
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
+
+    for (i = 0; i < count; i++) {
+        if (hg_bulk_na_op_ids->s[i] != NULL)
+            continue;
+
+        hg_bulk_na_op_ids->s[i] = NA_Op_create(hg_bulk_op_id->na_class);
+        HG_CHECK_ERROR(hg_bulk_na_op_ids->s[i] == NULL, done, ret, HG_NA_ERROR,
+            "NA_Op_create() failed");
+        na_op_count++;
+    }
+
+done:
+    if (na_op_count > 0 && hg_bulk_op_id->op_pool)
+        hg_bulk_op_pool_account(hg_bulk_op_id->op_pool, na_op_count, 0);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_bulk_op_pool_account(struct hg_bulk_op_pool *hg_bulk_op_pool,
+    long na_op_count, long window_count)
+{
+    hg_thread_spin_lock(&hg_bulk_op_pool->pending_list_lock);
+    hg_bulk_op_pool->na_op_count += (unsigned long) na_op_count;
+    hg_bulk_op_pool->window_count += (unsigned long) window_count;
+    hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_op_pool_create(hg_core_context_t *core_context, unsigned int init_count,
+    unsigned int max_count, struct hg_bulk_op_pool **hg_bulk_op_pool_ptr)
+{
+    struct hg_bulk_op_pool *hg_bulk_op_pool = NULL;
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    HG_LOG_DEBUG("Creating pool with %u bulk op IDs (max %u)", init_count,
+        max_count);
+
+    hg_bulk_op_pool =
+        (struct hg_bulk_op_pool *) malloc(sizeof(struct hg_bulk_op_pool));
+    HG_CHECK_ERROR(hg_bulk_op_pool == NULL, error, ret, HG_NOMEM,
+        "Could not allocate bulk op pool");
+    memset(hg_bulk_op_pool, 0, sizeof(struct hg_bulk_op_pool));
+
+    hg_thread_mutex_init(&hg_bulk_op_pool->extend_mutex);
+    hg_thread_cond_init(&hg_bulk_op_pool->extend_cond);
+    hg_bulk_op_pool->core_context = core_context;
+    HG_LIST_INIT(&hg_bulk_op_pool->pending_list);
+    hg_thread_spin_init(&hg_bulk_op_pool->pending_list_lock);
+    hg_bulk_op_pool->init_count = init_count;
+    hg_bulk_op_pool->max_count = max_count;
+    hg_atomic_init32(&hg_bulk_op_pool->unpooled_count, 0);
+    hg_bulk_op_pool->extending = HG_FALSE;
+
+    for (i = 0; i < init_count; i++) {
+        struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+
+        ret = hg_bulk_op_create(core_context, &hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(error, ret, "Could not create bulk op ID");
+
+        hg_bulk_op_id->reuse = HG_TRUE;
+        hg_bulk_op_id->op_pool = hg_bulk_op_pool;
+
+        hg_thread_spin_lock(&hg_bulk_op_pool->pending_list_lock);
+        HG_LIST_INSERT_HEAD(
+            &hg_bulk_op_pool->pending_list, hg_bulk_op_id, pending);
+        hg_bulk_op_pool->count++;
+        hg_bulk_op_pool->free_count++;
+        hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
+    }
+    hg_bulk_op_pool->min_free_count = hg_bulk_op_pool->free_count;
+    hg_time_get_current_ms(&hg_bulk_op_pool->trim_time);
+    hg_bulk_op_pool->trim_time = hg_time_add(hg_bulk_op_pool->trim_time,
+        hg_time_from_ms(HG_BULK_OP_POOL_IDLE_TIME));
+
+    HG_LOG_DEBUG("Created bulk op ID pool (%p)", hg_bulk_op_pool);
+
+    *hg_bulk_op_pool_ptr = hg_bulk_op_pool;
+
+    return ret;
+
+error:
+    if (hg_bulk_op_pool)
+        hg_bulk_op_pool_destroy(hg_bulk_op_pool);
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_bulk_op_pool_destroy(struct hg_bulk_op_pool *hg_bulk_op_pool)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_LOG_DEBUG("Free bulk op ID pool (%p)", hg_bulk_op_pool);
+
+    /* No other thread can access the pool at this point */
+    hg_bulk_op_id = HG_LIST_FIRST(&hg_bulk_op_pool->pending_list);
+
+    while (hg_bulk_op_id) {
+        struct hg_bulk_op_id *hg_bulk_op_id_next =
+            HG_LIST_NEXT(hg_bulk_op_id, pending);
+        HG_LIST_REMOVE(hg_bulk_op_id, pending);
+
+        /* Destroy op IDs */
+        ret = hg_bulk_op_free(hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(done, ret, "Could not free bulk op ID");
+
+        hg_bulk_op_id = hg_bulk_op_id_next;
+    }
+    HG_CHECK_WARNING(hg_atomic_get32(&hg_bulk_op_pool->unpooled_count) > 0,
+        "%d bulk op IDs are still in use",
+        hg_atomic_get32(&hg_bulk_op_pool->unpooled_count));
+
+    hg_thread_mutex_destroy(&hg_bulk_op_pool->extend_mutex);
+    hg_thread_cond_destroy(&hg_bulk_op_pool->extend_cond);
+    hg_thread_spin_destroy(&hg_bulk_op_pool->pending_list_lock);
+
+    free(hg_bulk_op_pool);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_op_pool_get(struct hg_bulk_op_pool *hg_bulk_op_pool,
+    struct hg_bulk_op_id **hg_bulk_op_id_ptr)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    hg_return_t ret = HG_SUCCESS;
+
+    while (!hg_bulk_op_id) {
+        hg_thread_spin_lock(&hg_bulk_op_pool->pending_list_lock);
+        if ((hg_bulk_op_id = HG_LIST_FIRST(&hg_bulk_op_pool->pending_list))) {
+            HG_LIST_REMOVE(hg_bulk_op_id, pending);
+            hg_bulk_op_pool->free_count--;
+            if (hg_bulk_op_pool->free_count < hg_bulk_op_pool->min_free_count)
+                hg_bulk_op_pool->min_free_count = hg_bulk_op_pool->free_count;
+        }
+        hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
+
+        if (hg_bulk_op_id)
+            break;
+
+        /* Create another batch of IDs if empty */
+        hg_thread_mutex_lock(&hg_bulk_op_pool->extend_mutex);
+        if (hg_bulk_op_pool->extending) {
+            hg_thread_cond_wait(
+                &hg_bulk_op_pool->extend_cond, &hg_bulk_op_pool->extend_mutex);
+            hg_thread_mutex_unlock(&hg_bulk_op_pool->extend_mutex);
+            continue;
+        }
+        hg_bulk_op_pool->extending = HG_TRUE;
+        hg_thread_mutex_unlock(&hg_bulk_op_pool->extend_mutex);
+
+        /* Only a single thread can extend the pool */
+        ret = hg_bulk_op_pool_extend(hg_bulk_op_pool, &hg_bulk_op_id);
+
+        hg_thread_mutex_lock(&hg_bulk_op_pool->extend_mutex);
+        hg_bulk_op_pool->extending = HG_FALSE;
+        hg_thread_cond_broadcast(&hg_bulk_op_pool->extend_cond);
+        hg_thread_mutex_unlock(&hg_bulk_op_pool->extend_mutex);
+
+        HG_CHECK_HG_ERROR(done, ret, "Could not extend bulk op ID pool");
+    }
+
+    *hg_bulk_op_id_ptr = hg_bulk_op_id;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_op_pool_extend(struct hg_bulk_op_pool *hg_bulk_op_pool,
+    struct hg_bulk_op_id **hg_bulk_op_id_ptr)
+{
+    unsigned long count, i;
+    hg_return_t ret = HG_SUCCESS;
+
+    /* Double size of pool within max_count */
+    hg_thread_spin_lock(&hg_bulk_op_pool->pending_list_lock);
+    count = (hg_bulk_op_pool->count > 0) ? hg_bulk_op_pool->count : 1;
+    if (hg_bulk_op_pool->max_count > 0)
+        count = (hg_bulk_op_pool->count < hg_bulk_op_pool->max_count)
+                    ? HG_BULK_MIN(count,
+                          hg_bulk_op_pool->max_count - hg_bulk_op_pool->count)
+                    : 0;
+    hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
+
+    if (count == 0) {
+        struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+
+        /* Pool is full, op ID is freed once completed */
+        ret = hg_bulk_op_create(hg_bulk_op_pool->core_context, &hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(done, ret, "Could not create bulk op ID");
+
+        hg_bulk_op_id->op_pool = hg_bulk_op_pool;
+        hg_atomic_incr32(&hg_bulk_op_pool->unpooled_count);
+
+        *hg_bulk_op_id_ptr = hg_bulk_op_id;
+        goto done;
+    }
+
+    HG_LOG_DEBUG("Extending pool (%p) with %lu bulk op IDs", hg_bulk_op_pool,
+        count);
+
+    for (i = 0; i < count; i++) {
+        struct hg_bulk_op_id *new_op_id = NULL;
+
+        ret = hg_bulk_op_create(hg_bulk_op_pool->core_context, &new_op_id);
+        HG_CHECK_HG_ERROR(done, ret, "Could not create bulk op ID");
+
+        new_op_id->reuse = HG_TRUE;
+        new_op_id->op_pool = hg_bulk_op_pool;
+
+        hg_thread_spin_lock(&hg_bulk_op_pool->pending_list_lock);
+        HG_LIST_INSERT_HEAD(&hg_bulk_op_pool->pending_list, new_op_id, pending);
+        hg_bulk_op_pool->count++;
+        hg_bulk_op_pool->free_count++;
+        hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
+    }
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_op_pool_release(struct hg_bulk_op_pool *hg_bulk_op_pool,
+    struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    HG_LIST_HEAD(hg_bulk_op_id) trim_list;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_LIST_INIT(&trim_list);
+
+    hg_thread_spin_lock(&hg_bulk_op_pool->pending_list_lock);
+    HG_LIST_INSERT_HEAD(&hg_bulk_op_pool->pending_list, hg_bulk_op_id, pending);
+    hg_bulk_op_pool->free_count++;
+
+    /* Op IDs that remained pending during the whole idle period are not
+     * needed, release them if the pool grew past its initial size */
+    if (hg_bulk_op_pool->count > hg_bulk_op_pool->init_count) {
+        hg_time_t now;
+
+        hg_time_get_current_ms(&now);
+        if (hg_time_less(hg_bulk_op_pool->trim_time, now)) {
+            unsigned long trim_count = HG_BULK_MIN(
+                hg_bulk_op_pool->min_free_count,
+                hg_bulk_op_pool->count - hg_bulk_op_pool->init_count);
+
+            HG_LOG_DEBUG("Trimming pool (%p) of %lu bulk op IDs",
+                hg_bulk_op_pool, trim_count);
+
+            while (trim_count-- > 0) {
+                struct hg_bulk_op_id *trim_op_id =
+                    HG_LIST_FIRST(&hg_bulk_op_pool->pending_list);
+
+                HG_LIST_REMOVE(trim_op_id, pending);
+                HG_LIST_INSERT_HEAD(&trim_list, trim_op_id, pending);
+                hg_bulk_op_pool->count--;
+                hg_bulk_op_pool->free_count--;
+            }
+            hg_bulk_op_pool->min_free_count = hg_bulk_op_pool->free_count;
+            hg_bulk_op_pool->trim_time =
+                hg_time_add(now, hg_time_from_ms(HG_BULK_OP_POOL_IDLE_TIME));
+        }
+    }
+    hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
+
+    /* Free trimmed op IDs outside of lock */
+    while (!HG_LIST_IS_EMPTY(&trim_list)) {
+        struct hg_bulk_op_id *trim_op_id = HG_LIST_FIRST(&trim_list);
+
+        HG_LIST_REMOVE(trim_op_id, pending);
+        ret = hg_bulk_op_free(trim_op_id);
+        HG_CHECK_ERROR_DONE(ret != HG_SUCCESS, "Could not free bulk op ID");
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, struct hg_core_addr *origin_addr, hg_uint8_t origin_id,
+    struct hg_bulk *hg_bulk_origin, hg_size_t origin_offset,
+    struct hg_bulk *hg_bulk_local, hg_size_t local_offset, hg_size_t size,
+    hg_op_id_t *op_id)
+{
+    /* Compressed or checksummed data is pulled block by block so that blocks
+     * are decompressed and verified while the next ones are in flight */
+    if ((hg_bulk_origin->compressed || hg_bulk_origin->checksum) &&
+        op == HG_BULK_PULL && size > 0 && !HG_Core_addr_is_self(origin_addr))
+        return hg_bulk_transfer_pipelined(core_context, callback, NULL, arg, op,
+            origin_addr, origin_id, hg_bulk_origin, origin_offset,
+            hg_bulk_local, local_offset, size, 0, HG_BULK_BLOCK_WINDOW, op_id);
+
+    return hg_bulk_transfer_direct(core_context, callback, arg, op,
+        origin_addr, origin_id, hg_bulk_origin, origin_offset, hg_bulk_local,
+        local_offset, size, op_id);
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_transfer_direct(hg_core_context_t *core_context, hg_cb_t callback,
+    void *arg, hg_bulk_op_t op, struct hg_core_addr *origin_addr,
+    hg_uint8_t origin_id, struct hg_bulk *hg_bulk_origin,
+    hg_size_t origin_offset, struct hg_bulk *hg_bulk_local,
+    hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id)
+{
+    const struct hg_bulk_segment *origin_segments =
+        HG_BULK_SEGMENTS(hg_bulk_origin);
+    const struct hg_bulk_segment *local_segments =
+        HG_BULK_SEGMENTS(hg_bulk_local);
+    hg_uint32_t origin_count = hg_bulk_origin->desc.info.segment_count,
+                local_count = hg_bulk_local->desc.info.segment_count;
+    uint8_t origin_flags = hg_bulk_origin->desc.info.flags;
+    uint8_t local_flags = hg_bulk_local->desc.info.flags;
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    struct hg_bulk_op_pool *hg_bulk_op_pool =
+        hg_core_context_get_bulk_op_pool(core_context);
+    hg_return_t ret = HG_SUCCESS;
 
-#ifdef NA_HAS_SM
-    /* Use SM classes if requested */
-    if (hg_bulk->desc.info.flags & HG_BULK_SM) {
-        HG_LOG_DEBUG("HG_BULK_SM flag is set");
-        hg_bulk->na_sm_class = HG_Core_class_get_na_sm(core_class);
-        HG_CHECK_ERROR(hg_bulk->na_sm_class == NULL, error, ret,
-            HG_PROTOCOL_ERROR, "SM class is not set");
+    /* Get a new OP ID from context */
+    if (hg_bulk_op_pool) {
+        ret = hg_bulk_op_pool_get(hg_bulk_op_pool, &hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(error, ret, "Could not get bulk op ID");
+    } else {
+        ret = hg_bulk_op_create(core_context, &hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(error, ret, "Could not create bulk op ID");
     }
-#endif
 
-    /* Segments */
-    if (hg_bulk->desc.info.segment_count > HG_BULK_STATIC_MAX) {
-        /* Allocate segments */
-        hg_bulk->desc.segments.d = (struct hg_bulk_segment *) calloc(
-            hg_bulk->desc.info.segment_count, sizeof(struct hg_bulk_segment));
-        HG_CHECK_ERROR(hg_bulk->desc.segments.d == NULL, error, ret, HG_NOMEM,
-            "Could not allocate segment array");
+    hg_bulk_op_id->callback = callback;
+    hg_bulk_op_id->callback_info.arg = arg;
+    hg_bulk_op_id->callback_info.info.bulk.origin_handle = hg_bulk_origin;
+    hg_atomic_incr32(&hg_bulk_origin->ref_count);
+    hg_bulk_op_id->callback_info.info.bulk.local_handle = hg_bulk_local;
+    hg_atomic_incr32(&hg_bulk_local->ref_count);
+    hg_bulk_op_id->callback_info.info.bulk.op = op;
 
-        segments = hg_bulk->desc.segments.d;
-    } else
-        segments = hg_bulk->desc.segments.s;
-    HG_BULK_DECODE_ARRAY(error, ret, buf_ptr, buf_size_left, segments,
-        struct hg_bulk_segment, hg_bulk->desc.info.segment_count);
+    /* Reset status */
+    hg_atomic_set32(&hg_bulk_op_id->status, 0);
 
-    /* Get the NA memory handles */
-    if (hg_bulk->desc.info.flags & HG_BULK_REGV ||
-        (hg_bulk->desc.info.segment_count == 1)) {
-        /* Always deserialize handle if HG_BULK_REGV is set */
-        if ((segments[0].base != (hg_ptr_t) NULL) ||
-            (hg_bulk->desc.info.flags & HG_BULK_REGV)) {
-            na_return_t na_ret;
+    /* Expected op count */
+    hg_bulk_op_id->op_count = (size > 0) ? 1 : 0; /* Default */
+    hg_atomic_set32(&hg_bulk_op_id->op_completed_count, 0);
 
-            HG_LOG_DEBUG("Deserializing single NA memory handle");
+    if (size == 0) {
+        /* Complete immediately */
+        ret = hg_bulk_complete(hg_bulk_op_id, HG_TRUE);
+        HG_CHECK_HG_ERROR(error, ret, "Could not complete bulk operation");
+    } else if (HG_Core_addr_is_self(origin_addr) ||
+               ((origin_flags & HG_BULK_EAGER) && (op != HG_BULK_PUSH))) {
+        hg_bulk_op_id->na_class = NULL;
+        hg_bulk_op_id->na_context = NULL;
 
-            HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left,
-                &hg_bulk->na_mem_descs.serialize_sizes.s[0], na_size_t);
+        /* When doing eager transfers, use self code path to copy data locally
+         */
+        ret = hg_bulk_transfer_self(op, origin_segments, origin_count,
+            origin_offset, local_segments, local_count, local_offset, size,
+            hg_bulk_op_id);
+    } else if (hg_bulk_origin->eager_write && (op == HG_BULK_PUSH) &&
+               hg_bulk_eager_write_put(hg_bulk_origin->eager_write,
+                   origin_offset, local_segments, local_count, local_offset,
+                   size)) {
+        hg_bulk_op_id->na_class = NULL;
+        hg_bulk_op_id->na_context = NULL;
 
-            na_ret = NA_Mem_handle_deserialize(hg_bulk->na_class,
-                &hg_bulk->na_mem_descs.handles.s[0], buf_ptr, buf_size_left);
-            HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret,
-                (hg_return_t) na_ret,
-                "Could not deserialize memory handle (%s)",
-                NA_Error_to_string(na_ret));
-            buf_ptr += hg_bulk->na_mem_descs.serialize_sizes.s[0];
-            buf_size_left -= hg_bulk->na_mem_descs.serialize_sizes.s[0];
+        /* Data was staged and will be returned along with the response */
+        ret = hg_bulk_complete(hg_bulk_op_id, HG_TRUE);
+        HG_CHECK_HG_ERROR(error, ret, "Could not complete bulk operation");
+    } else {
+        struct hg_bulk_na_mem_desc *origin_mem_descs, *local_mem_descs;
+        na_mem_handle_t *origin_mem_handles, *local_mem_handles;
+        na_addr_t na_origin_addr = NA_ADDR_NULL;
 
 #ifdef NA_HAS_SM
-            /* Only deserialize handles if we were sending over SM */
-            if (hg_bulk->desc.info.flags & HG_BULK_SM) {
-                HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left,
-                    &hg_bulk->na_sm_mem_descs.serialize_sizes.s[0], na_size_t);
+        /* Use SM if we can */
+        if (hg_bulk_origin->desc.info.flags & HG_BULK_SM) {
+            HG_LOG_DEBUG("Using NA SM class for this transfer");
 
-                na_ret = NA_Mem_handle_deserialize(hg_bulk->na_sm_class,
-                    &hg_bulk->na_sm_mem_descs.handles.s[0], buf_ptr,
-                    buf_size_left);
-                HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret,
-                    (hg_return_t) na_ret,
-                    "Could not deserialize SM memory handle (%s)",
-                    NA_Error_to_string(na_ret));
-                buf_ptr += hg_bulk->na_sm_mem_descs.serialize_sizes.s[0];
-                buf_size_left -= hg_bulk->na_sm_mem_descs.serialize_sizes.s[0];
-            }
+            hg_bulk_op_id->na_class = hg_bulk_origin->na_sm_class;
+            hg_bulk_op_id->na_context = HG_Core_context_get_na_sm(core_context);
+            na_origin_addr = HG_Core_addr_get_na_sm(origin_addr);
+            origin_mem_descs = &hg_bulk_origin->na_sm_mem_descs;
+            local_mem_descs = &hg_bulk_local->na_sm_mem_descs;
+        } else {
 #endif
-        }
-    } else {
-        HG_LOG_DEBUG("Deserializing %u NA memory handle(s)",
-            hg_bulk->desc.info.segment_count);
-
-        ret = hg_bulk_deserialize_mem_descs(hg_bulk->na_class, &buf_ptr,
-            &buf_size_left, &hg_bulk->na_mem_descs, segments,
-            hg_bulk->desc.info.segment_count);
-        HG_CHECK_HG_ERROR(
-            error, ret, "Could not deserialize NA mem descriptors");
+            HG_LOG_DEBUG("Using default NA class for this transfer");
 
+            hg_bulk_op_id->na_class = hg_bulk_origin->na_class;
+            hg_bulk_op_id->na_context = HG_Core_context_get_na(core_context);
+            na_origin_addr = HG_Core_addr_get_na(origin_addr);
+            origin_mem_descs = &hg_bulk_origin->na_mem_descs;
+            local_mem_descs = &hg_bulk_local->na_mem_descs;
 #ifdef NA_HAS_SM
-        /* Only deserialize handles if we were sending over SM */
-        if (hg_bulk->desc.info.flags & HG_BULK_SM) {
-            ret = hg_bulk_deserialize_mem_descs(hg_bulk->na_sm_class, &buf_ptr,
-                &buf_size_left, &hg_bulk->na_sm_mem_descs, segments,
-                hg_bulk->desc.info.segment_count);
-            HG_CHECK_HG_ERROR(
-                error, ret, "Could not deserialize NA SM mem descriptors");
         }
 #endif
+
+        origin_mem_handles =
+            HG_BULK_MEM_HANDLES(origin_mem_descs, origin_count, origin_flags);
+        local_mem_handles =
+            HG_BULK_MEM_HANDLES(local_mem_descs, local_count, local_flags);
+
+        ret = hg_bulk_transfer_na(op, na_origin_addr, origin_id,
+            origin_segments, origin_count, origin_mem_handles,
+            hg_bulk_origin->mem_offset, origin_flags, origin_offset,
+            local_segments, local_count, local_mem_handles,
+            hg_bulk_local->mem_offset, local_flags, local_offset, size,
+            hg_bulk_op_id);
     }
 
-    /* Address information */
-    if (hg_bulk->desc.info.flags & HG_BULK_BIND) {
-        hg_size_t serialize_size;
+    /* Assign op_id */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_bulk_op_id;
 
-        HG_LOG_DEBUG(
-            "HG_BULK_BIND flag set, deserializing address information");
+    return ret;
 
-        HG_BULK_DECODE(
-            error, ret, buf_ptr, buf_size_left, &serialize_size, hg_size_t);
+error:
+    if (hg_bulk_op_id) {
+        hg_return_t hg_ret = hg_bulk_op_destroy(hg_bulk_op_id);
+        HG_CHECK_ERROR_DONE(hg_ret != HG_SUCCESS, "Could not destroy op ID");
+    }
+    return ret;
+}
 
-        ret = HG_Core_addr_deserialize(
-            hg_bulk->core_class, &hg_bulk->addr, buf_ptr, buf_size_left);
-        HG_CHECK_HG_ERROR(error, ret, "Could not deserialize address");
-        buf_ptr += serialize_size;
-        buf_size_left -= serialize_size;
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_transfer_self(hg_bulk_op_t op,
+    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
+    hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
+    hg_uint32_t local_count, hg_size_t local_offset, hg_size_t size,
+    struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    hg_uint32_t origin_segment_start_index = 0, local_segment_start_index = 0;
+    hg_size_t origin_segment_start_offset = 0, local_segment_start_offset = 0;
+    hg_bulk_copy_op_t copy_op;
+    hg_return_t ret = HG_SUCCESS;
 
-        /* Get context ID */
-        HG_BULK_DECODE(error, ret, buf_ptr, buf_size_left, &hg_bulk->context_id,
-            hg_uint8_t);
+    switch (op) {
+        case HG_BULK_PUSH:
+            copy_op = hg_bulk_memcpy_put;
+            break;
+        case HG_BULK_PULL:
+            copy_op = hg_bulk_memcpy_get;
+            break;
+        default:
+            HG_GOTO_ERROR(done, ret, HG_INVALID_ARG, "Unknown bulk operation");
     }
 
-    /* Get the serialized data */
-    if (hg_bulk->desc.info.flags & HG_BULK_EAGER) {
-        hg_uint32_t i;
+    HG_LOG_DEBUG("Transferring data through self");
 
-        HG_LOG_DEBUG("Deserializing eager bulk data, %u segment(s)",
-            hg_bulk->desc.info.segment_count);
-        hg_bulk->desc.info.flags |= HG_BULK_ALLOC;
-        for (i = 0; i < hg_bulk->desc.info.segment_count; i++) {
-            if (!segments[i].len)
-                continue;
+    /* Translate origin offset */
+    if (origin_offset > 0)
+        hg_bulk_offset_translate(origin_segments, origin_count, origin_offset,
+            &origin_segment_start_index, &origin_segment_start_offset);
 
-            /* Override base address to store data */
-            segments[i].base = (hg_ptr_t) calloc(1, segments[i].len);
-            HG_CHECK_ERROR(segments[i].base == (hg_ptr_t) NULL, error, ret,
-                HG_NOMEM, "Could not allocate segment");
-            ;
+    /* Translate local offset */
+    if (local_offset > 0)
+        hg_bulk_offset_translate(local_segments, local_count, local_offset,
+            &local_segment_start_index, &local_segment_start_offset);
 
-            HG_BULK_DECODE_ARRAY(error, ret, buf_ptr, buf_size_left,
-                (void *) segments[i].base, char, segments[i].len);
-        }
-    } else
-        /* Addresses are virtual and do not point to physical memory */
-        hg_bulk->desc.info.flags |= HG_BULK_VIRT;
+    /* Do actual transfer */
+    hg_bulk_transfer_segments_self(copy_op, origin_segments, origin_count,
+        origin_segment_start_index, origin_segment_start_offset, local_segments,
+        local_count, local_segment_start_index, local_segment_start_offset,
+        size);
+
+    /* Complete immediately */
+    ret = hg_bulk_complete(hg_bulk_op_id, HG_TRUE);
+    HG_CHECK_HG_ERROR(done, ret, "Could not complete bulk operation");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_bool_t
+hg_bulk_eager_write_put(struct hg_bulk_eager_write *hg_bulk_eager_write,
+    hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
+    hg_uint32_t local_count, hg_size_t local_offset, hg_size_t size)
+{
+    struct hg_bulk_segment staging_segment;
+    hg_uint32_t local_segment_start_index = 0;
+    hg_size_t local_segment_start_offset = 0;
+    hg_bool_t ret = HG_FALSE;
+
+    hg_thread_spin_lock(&hg_bulk_eager_write->lock);
+
+    /* Response already sent */
+    if (!hg_bulk_eager_write->buf)
+        goto done;
+
+    /* Only a single range is staged so that every byte returned was actually
+     * written, disjoint ranges go through RMA */
+    if ((hg_bulk_eager_write->end > hg_bulk_eager_write->start) &&
+        ((origin_offset > hg_bulk_eager_write->end) ||
+            (origin_offset + size < hg_bulk_eager_write->start)))
+        goto done;
+
+    HG_LOG_DEBUG("Staging %zu bytes returned in response", size);
+
+    if (local_offset > 0)
+        hg_bulk_offset_translate(local_segments, local_count, local_offset,
+            &local_segment_start_index, &local_segment_start_offset);
+
+    staging_segment.base = (hg_ptr_t) hg_bulk_eager_write->buf;
+    staging_segment.len = hg_bulk_eager_write->len;
+    hg_bulk_transfer_segments_self(hg_bulk_memcpy_put, &staging_segment, 1, 0,
+        origin_offset, local_segments, local_count, local_segment_start_index,
+        local_segment_start_offset, size);
+
+    if (hg_bulk_eager_write->end == hg_bulk_eager_write->start) {
+        hg_bulk_eager_write->start = origin_offset;
+        hg_bulk_eager_write->end = origin_offset + size;
+    } else {
+        if (origin_offset < hg_bulk_eager_write->start)
+            hg_bulk_eager_write->start = origin_offset;
+        if (origin_offset + size > hg_bulk_eager_write->end)
+            hg_bulk_eager_write->end = origin_offset + size;
+    }
+    ret = HG_TRUE;
+
+done:
+    hg_thread_spin_unlock(&hg_bulk_eager_write->lock);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_transfer_segments_self(hg_bulk_copy_op_t copy_op,
+    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
+    hg_size_t origin_segment_start_index, hg_size_t origin_segment_start_offset,
+    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
+    hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
+    hg_size_t size)
+{
+    hg_size_t origin_segment_index = origin_segment_start_index;
+    hg_size_t local_segment_index = local_segment_start_index;
+    hg_size_t origin_segment_offset = origin_segment_start_offset;
+    hg_size_t local_segment_offset = local_segment_start_offset;
+    hg_size_t remaining_size = size;
 
-    HG_CHECK_WARNING(buf_size_left != 0,
-        "Buffer size left for decoding bulk handle is not zero");
+    while (remaining_size > 0 && origin_segment_index < origin_count &&
+           local_segment_index < local_count) {
+        /* Can only transfer smallest size */
+        hg_size_t transfer_size = HG_BULK_MIN(
+            (origin_segments[origin_segment_index].len - origin_segment_offset),
+            (local_segments[local_segment_index].len - local_segment_offset));
 
-    *hg_bulk_ptr = hg_bulk;
+        /* Remaining size may be smaller */
+        transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
 
-    return ret;
+        /* Copy segment */
+        copy_op(local_segments[local_segment_index].base, local_segment_offset,
+            origin_segments[origin_segment_index].base, origin_segment_offset,
+            transfer_size);
 
-error:
-    hg_bulk_free(hg_bulk);
+        /* Decrease remaining size from the size of data we transferred
+         * and exit if everything has been transferred */
+        remaining_size -= transfer_size;
+        if (remaining_size == 0)
+            break;
 
-    return ret;
+        /* Increment offsets from the size of data we transferred */
+        origin_segment_offset += transfer_size;
+        local_segment_offset += transfer_size;
+
+        /* Change segment if new offset exceeds segment size */
+        if (origin_segment_offset >=
+            origin_segments[origin_segment_index].len) {
+            origin_segment_index++;
+            origin_segment_offset = 0;
+        }
+        if (local_segment_offset >= local_segments[local_segment_index].len) {
+            local_segment_index++;
+            local_segment_offset = 0;
+        }
+    }
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_deserialize_mem_descs(na_class_t *na_class, const char **buf_ptr,
-    hg_size_t *buf_size_left, struct hg_bulk_na_mem_desc *na_mem_descs,
-    const struct hg_bulk_segment *segments, hg_uint32_t count)
+hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t na_origin_addr,
+    hg_uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
+    hg_uint32_t origin_count, na_mem_handle_t *origin_mem_handles,
+    hg_size_t origin_mem_offset, hg_uint8_t origin_flags,
+    hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
+    hg_uint32_t local_count, na_mem_handle_t *local_mem_handles,
+    hg_size_t local_mem_offset, hg_uint8_t local_flags, hg_size_t local_offset,
+    hg_size_t size, struct hg_bulk_op_id *hg_bulk_op_id)
 {
-    na_mem_handle_t *na_mem_handles;
-    na_size_t *na_mem_serialize_sizes;
+    hg_bulk_na_op_id_t *hg_bulk_na_op_ids;
+    na_bulk_op_t na_bulk_op;
     hg_return_t ret = HG_SUCCESS;
-    hg_uint32_t i;
-
-    if (count > HG_BULK_STATIC_MAX) {
-        /* Allocate NA memory handles */
-        na_mem_descs->handles.d =
-            (na_mem_handle_t *) calloc(count, sizeof(na_mem_handle_t));
-        HG_CHECK_ERROR(na_mem_descs->handles.d == NULL, error, ret, HG_NOMEM,
-            "Could not allocate mem handle array");
-
-        /* Allocate serialize sizes */
-        na_mem_descs->serialize_sizes.d =
-            (na_size_t *) calloc(count, sizeof(na_size_t));
-        HG_CHECK_ERROR(na_mem_descs->serialize_sizes.d == NULL, error, ret,
-            HG_NOMEM, "Could not allocate serialize sizes array");
 
-        na_mem_handles = na_mem_descs->handles.d;
-        na_mem_serialize_sizes = na_mem_descs->serialize_sizes.d;
-    } else {
-        na_mem_handles = na_mem_descs->handles.s;
-        na_mem_serialize_sizes = na_mem_descs->serialize_sizes.s;
+    /* Map op to NA op */
+    switch (op) {
+        case HG_BULK_PUSH:
+            na_bulk_op = hg_bulk_na_put;
+            break;
+        case HG_BULK_PULL:
+            na_bulk_op = hg_bulk_na_get;
+            break;
+        default:
+            HG_GOTO_ERROR(done, ret, HG_INVALID_ARG, "Unknown bulk operation");
     }
 
-    /* Decode serialize sizes */
-    HG_BULK_DECODE_ARRAY(error, ret, *buf_ptr, *buf_size_left,
-        na_mem_serialize_sizes, na_size_t, count);
+#ifdef NA_HAS_SM
+    /* Use NA SM op IDs if needed */
+    if (origin_flags & HG_BULK_SM)
+        hg_bulk_na_op_ids = &hg_bulk_op_id->na_sm_op_ids;
+    else
+#endif
+        hg_bulk_na_op_ids = &hg_bulk_op_id->na_op_ids;
 
-    for (i = 0; i < count; i++) {
+    if (((origin_flags & HG_BULK_REGV) || origin_count == 1) &&
+        ((local_flags & HG_BULK_REGV) || local_count == 1)) {
         na_return_t na_ret;
 
-        /* Skip null segments */
-        if (segments[i].base == (hg_ptr_t) NULL)
-            continue;
+        HG_LOG_DEBUG("Transferring data through NA in single operation");
 
-        na_ret = NA_Mem_handle_deserialize(
-            na_class, &na_mem_handles[i], *buf_ptr, *buf_size_left);
-        HG_CHECK_ERROR(na_ret != NA_SUCCESS, error, ret, (hg_return_t) na_ret,
-            "Could not deserialize memory handle (%s)",
-            NA_Error_to_string(na_ret));
+        ret = hg_bulk_na_op_ids_create(hg_bulk_op_id, hg_bulk_na_op_ids, 1);
+        HG_CHECK_HG_ERROR(done, ret, "Could not create NA op IDs");
 
-        *buf_ptr += na_mem_serialize_sizes[i];
-        *buf_size_left -= na_mem_serialize_sizes[i];
-    }
+        na_ret = na_bulk_op(hg_bulk_op_id->na_class, hg_bulk_op_id->na_context,
+            hg_bulk_transfer_cb, hg_bulk_op_id, local_mem_handles[0],
+            local_mem_offset + local_offset, origin_mem_handles[0],
+            origin_mem_offset + origin_offset, size, na_origin_addr, origin_id,
+            hg_bulk_na_op_ids->s[0]);
+        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+            "Could not transfer data (%s)", NA_Error_to_string(na_ret));
+    } else {
+        hg_uint32_t origin_segment_start_index = 0,
+                    local_segment_start_index = 0;
+        hg_size_t origin_segment_start_offset = 0,
+                  local_segment_start_offset = 0;
 
-    return ret;
+        /* Translate bulk_offset */
+        if (origin_offset > 0)
+            hg_bulk_offset_translate(origin_segments, origin_count,
+                origin_offset, &origin_segment_start_index,
+                &origin_segment_start_offset);
 
-error:
-    return ret;
-}
+        /* Translate block offset */
+        if (local_offset > 0)
+            hg_bulk_offset_translate(local_segments, local_count, local_offset,
+                &local_segment_start_index, &local_segment_start_offset);
 
-/*---------------------------------------------------------------------------*/
-void *
-hg_bulk_get_serialize_cached_ptr(struct hg_bulk *hg_bulk)
-{
-    return hg_bulk->serialize_ptr;
-}
+        /* Determine number of NA operations that will be needed */
+        hg_bulk_op_id->op_count = hg_bulk_transfer_get_op_count(origin_segments,
+            origin_count, origin_segment_start_index,
+            origin_segment_start_offset, local_segments, local_count,
+            local_segment_start_index, local_segment_start_offset, size);
+        HG_CHECK_ERROR(hg_bulk_op_id->op_count == 0, done, ret, HG_INVALID_ARG,
+            "Could not get bulk op_count");
 
-/*---------------------------------------------------------------------------*/
-hg_size_t
-hg_bulk_get_serialize_cached_size(struct hg_bulk *hg_bulk)
-{
-    return hg_bulk->serialize_size;
-}
+        HG_LOG_DEBUG("Transferring data through NA in %u operation(s)",
+            hg_bulk_op_id->op_count);
 
-/*---------------------------------------------------------------------------*/
-void
-hg_bulk_set_serialize_cached_ptr(
-    struct hg_bulk *hg_bulk, void *buf, na_size_t buf_size)
-{
-    hg_bulk->serialize_ptr = buf;
-    hg_bulk->serialize_size = buf_size;
+        /* Issue operations within a window of pre-allocated op IDs if the
+         * number of operations exceeds the number of static op IDs */
+        if (hg_bulk_op_id->op_count > HG_BULK_STATIC_MAX) {
+            ret = hg_bulk_na_window_init(hg_bulk_op_id);
+            HG_CHECK_HG_ERROR(done, ret, "Could not initialize window");
+
+            ret = hg_bulk_na_window_load(hg_bulk_op_id->window,
+                hg_bulk_op_id->na_class, na_origin_addr, origin_id,
+                origin_segments, origin_count, origin_mem_handles,
+                origin_mem_offset, origin_flags, origin_offset, local_segments,
+                local_count, local_mem_handles, local_mem_offset, local_flags,
+                local_offset, size);
+            HG_CHECK_HG_ERROR(done, ret, "Could not load transfer");
+
+            ret = hg_bulk_na_window_start(hg_bulk_op_id, na_bulk_op, NULL, 0);
+            HG_CHECK_HG_ERROR(done, ret, "Could not start transfer");
+            goto done;
+        }
+
+        ret = hg_bulk_na_op_ids_create(
+            hg_bulk_op_id, hg_bulk_na_op_ids, hg_bulk_op_id->op_count);
+        HG_CHECK_HG_ERROR(done, ret, "Could not create NA op IDs");
+
+        /* Do actual transfer */
+        ret = hg_bulk_transfer_segments_na(hg_bulk_op_id->na_class,
+            hg_bulk_op_id->na_context, na_bulk_op, hg_bulk_transfer_cb,
+            hg_bulk_op_id, na_origin_addr, origin_id, origin_segments,
+            origin_count, origin_mem_handles, origin_mem_offset,
+            origin_segment_start_index, origin_segment_start_offset,
+            local_segments, local_count, local_mem_handles, local_mem_offset,
+            local_segment_start_index, local_segment_start_offset, size,
+            hg_bulk_na_op_ids->s, hg_bulk_op_id->op_count, NULL);
+        HG_CHECK_HG_ERROR(done, ret, "Could not transfer data segments");
+    }
+
+done:
+    return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static void
-hg_bulk_access(struct hg_bulk *hg_bulk, hg_size_t offset, hg_size_t size,
-    hg_uint8_t flags, hg_uint32_t max_count, void **buf_ptrs,
-    hg_size_t *buf_sizes, hg_uint32_t *actual_count)
+static hg_uint32_t
+hg_bulk_transfer_get_op_count(const struct hg_bulk_segment *origin_segments,
+    hg_uint32_t origin_count, hg_size_t origin_segment_start_index,
+    hg_size_t origin_segment_start_offset,
+    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
+    hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
+    hg_size_t size)
 {
-    struct hg_bulk_segment *segments = HG_BULK_SEGMENTS(hg_bulk);
-    hg_uint32_t segment_index;
-    hg_size_t segment_offset;
+    hg_size_t origin_segment_index = origin_segment_start_index;
+    hg_size_t local_segment_index = local_segment_start_index;
+    hg_size_t origin_segment_offset = origin_segment_start_offset;
+    hg_size_t local_segment_offset = local_segment_start_offset;
     hg_size_t remaining_size = size;
     hg_uint32_t count = 0;
 
-    /* TODO use flags */
-    (void) flags;
-
-    hg_bulk_offset_translate(segments, hg_bulk->desc.info.segment_count, offset,
-        &segment_index, &segment_offset);
-
-    while ((remaining_size > 0) && (count < max_count)) {
-        hg_ptr_t base;
-        hg_size_t len;
-
+    while (remaining_size > 0 && origin_segment_index < origin_count &&
+           local_segment_index < local_count) {
         /* Can only transfer smallest size */
-        len = segments[segment_index].len - segment_offset;
+        hg_size_t transfer_size = HG_BULK_MIN(
+            (origin_segments[origin_segment_index].len - origin_segment_offset),
+            (local_segments[local_segment_index].len - local_segment_offset));
 
         /* Remaining size may be smaller */
-        len = HG_BULK_MIN(remaining_size, len);
-        base = segments[segment_index].base + (hg_ptr_t) segment_offset;
-
-        /* Fill segments */
-        if (buf_ptrs)
-            buf_ptrs[count] = (void *) base;
-        if (buf_sizes)
-            buf_sizes[count] = len;
-        /*
-        printf("Segment %d: address=0x%lX\n", count, segment_address);
-        printf("Segment %d: size=%zu\n", count, segment_size);
-         */
-
-        /* Decrease remaining size from the size of data we transferred */
-        remaining_size -= len;
+        transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
 
-        /* Change segment */
-        segment_index++;
-        segment_offset = 0;
+        /* Increment op count */
         count++;
-    }
 
-    if (actual_count)
-        *actual_count = count;
-}
+        /* Decrease remaining size from the size of data we transferred
+         * and exit if everything has been transferred */
+        remaining_size -= transfer_size;
+        if (remaining_size == 0)
+            break;
 
-/*---------------------------------------------------------------------------*/
-static HG_INLINE void
-hg_bulk_offset_translate(const struct hg_bulk_segment *segments,
-    hg_uint32_t count, hg_size_t offset, hg_uint32_t *segment_start_index,
-    hg_size_t *segment_start_offset)
-{
-    hg_uint32_t i, new_segment_start_index = 0;
-    hg_size_t new_segment_offset = offset, next_offset = 0;
+        /* Increment offsets from the size of data we transferred */
+        origin_segment_offset += transfer_size;
+        local_segment_offset += transfer_size;
 
-    /* Get start index and handle offset */
-    for (i = 0; i < count; i++) {
-        next_offset += segments[i].len;
-        if (offset < next_offset) {
-            new_segment_start_index = i;
-            break;
+        /* Change segment if new offset exceeds segment size */
+        if (origin_segment_offset >=
+            origin_segments[origin_segment_index].len) {
+            origin_segment_index++;
+            origin_segment_offset = 0;
+        }
+        if (local_segment_offset >= local_segments[local_segment_index].len) {
+            local_segment_index++;
+            local_segment_offset = 0;
         }
-        new_segment_offset -= segments[i].len;
     }
 
-    *segment_start_index = new_segment_start_index;
-    *segment_start_offset = new_segment_offset;
+    return count;
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_op_create(
-    hg_core_context_t *core_context, struct hg_bulk_op_id **hg_bulk_op_id_ptr)
+hg_bulk_transfer_segments_na(na_class_t *na_class, na_context_t *na_context,
+    na_bulk_op_t na_bulk_op, na_cb_t callback, void *arg, na_addr_t origin_addr,
+    na_uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
+    hg_uint32_t origin_count, na_mem_handle_t *origin_mem_handles,
+    hg_size_t origin_mem_offset, hg_size_t origin_segment_start_index,
+    hg_size_t origin_segment_start_offset,
+    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
+    na_mem_handle_t *local_mem_handles, hg_size_t local_mem_offset,
+    hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
+    hg_size_t size,
+    na_op_id_t *na_op_ids[], hg_uint32_t na_op_count,
+    hg_uint32_t *issued_count_ptr)
 {
-    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    hg_size_t origin_segment_index = origin_segment_start_index;
+    hg_size_t local_segment_index = local_segment_start_index;
+    hg_size_t origin_segment_offset = origin_segment_start_offset;
+    hg_size_t local_segment_offset = local_segment_start_offset;
+    hg_size_t remaining_size = size;
+    hg_uint32_t count = 0;
     hg_return_t ret = HG_SUCCESS;
-    int i;
 
-    hg_bulk_op_id =
-        (struct hg_bulk_op_id *) malloc(sizeof(struct hg_bulk_op_id));
-    HG_CHECK_ERROR(hg_bulk_op_id == NULL, error, ret, HG_NOMEM,
-        "Could not allocate HG Bulk operation ID");
-    memset(hg_bulk_op_id, 0, sizeof(struct hg_bulk_op_id));
+    while (remaining_size > 0 && origin_segment_index < origin_count &&
+           local_segment_index < local_count) {
+        /* Can only transfer smallest size */
+        hg_size_t transfer_size = HG_BULK_MIN(
+            (origin_segments[origin_segment_index].len - origin_segment_offset),
+            (local_segments[local_segment_index].len - local_segment_offset));
+        na_return_t na_ret;
 
-    hg_bulk_op_id->core_context = core_context;
-    hg_atomic_init32(&hg_bulk_op_id->ref_count, 1);
+        /* Remaining size may be smaller */
+        transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
 
-    /* Completed by default */
-    hg_atomic_init32(&hg_bulk_op_id->status, HG_BULK_OP_COMPLETED);
+        na_ret = na_bulk_op(na_class, na_context, callback, arg,
+            local_mem_handles[local_segment_index],
+            ((local_segment_index == 0) ? local_mem_offset : 0) +
+                local_segment_offset,
+            origin_mem_handles[origin_segment_index],
+            ((origin_segment_index == 0) ? origin_mem_offset : 0) +
+                origin_segment_offset,
+            transfer_size,
+            origin_addr, origin_id, na_op_ids[count]);
+        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+            "Could not transfer data (%s)", NA_Error_to_string(na_ret));
 
-    hg_bulk_op_id->callback_info.type = HG_CB_BULK;
-    hg_bulk_op_id->op_count = 1; /* Default */
-    hg_atomic_init32(&hg_bulk_op_id->op_completed_count, 0);
+        count++;
 
-    /* Preallocate NA OP IDs */
-    for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-        hg_bulk_op_id->na_op_ids.s[i] =
-            NA_Op_create(core_context->core_class->na_class);
-        HG_CHECK_ERROR(hg_bulk_op_id->na_op_ids.s[i] == NULL, error, ret,
-            HG_NA_ERROR, "NA_Op_create() failed");
-    }
-#ifdef NA_HAS_SM
-    if (core_context->core_class->na_sm_class) {
-        for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-            hg_bulk_op_id->na_sm_op_ids.s[i] =
-                NA_Op_create(core_context->core_class->na_sm_class);
-            HG_CHECK_ERROR(hg_bulk_op_id->na_sm_op_ids.s[i] == NULL, error, ret,
-                HG_NA_ERROR, "NA_Op_create() failed");
+        /* Decrease remaining size from the size of data we transferred
+         * and exit if everything has been transferred */
+        remaining_size -= transfer_size;
+        if (remaining_size == 0)
+            break;
+
+        /* Increment offsets from the size of data we transferred */
+        origin_segment_offset += transfer_size;
+        local_segment_offset += transfer_size;
+
+        /* Change segment if new offset exceeds segment size */
+        if (origin_segment_offset >=
+            origin_segments[origin_segment_index].len) {
+            origin_segment_index++;
+            origin_segment_offset = 0;
+        }
+        if (local_segment_offset >= local_segments[local_segment_index].len) {
+            local_segment_index++;
+            local_segment_offset = 0;
         }
     }
-#endif
 
-    HG_LOG_DEBUG("Created new bulk op ID (%p)", hg_bulk_op_id);
+    HG_CHECK_ERROR(count != na_op_count, done, ret, HG_PROTOCOL_ERROR,
+        "Expected %u operations, issued %u", na_op_count, count);
 
-    *hg_bulk_op_id_ptr = hg_bulk_op_id;
+done:
+    if (issued_count_ptr)
+        *issued_count_ptr = count;
 
     return ret;
+}
 
-error:
-    if (hg_bulk_op_id) {
-        for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-            na_return_t na_ret;
-
-            if (hg_bulk_op_id->na_op_ids.s[i] == NULL)
-                continue;
+/*---------------------------------------------------------------------------*/
+static int
+hg_bulk_transfer_cb(const struct na_cb_info *callback_info)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id =
+        (struct hg_bulk_op_id *) callback_info->arg;
+    hg_bool_t completed = HG_TRUE;
 
-            na_ret = NA_Op_destroy(core_context->core_class->na_class,
-                hg_bulk_op_id->na_op_ids.s[i]);
-            HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS, "NA_Op_destroy() failed");
-        }
-#ifdef NA_HAS_SM
-        for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-            na_return_t na_ret;
+    /* If canceled, mark handle as canceled */
+    if (callback_info->ret == NA_CANCELED) {
+        HG_CHECK_WARNING(
+            hg_atomic_get32(&hg_bulk_op_id->status) & HG_BULK_OP_COMPLETED,
+            "Operation was completed");
+        HG_LOG_DEBUG("NA_CANCELED event on op ID %p", hg_bulk_op_id);
+        HG_CHECK_WARNING(
+            !(hg_atomic_get32(&hg_bulk_op_id->status) & HG_BULK_OP_CANCELED),
+            "Received NA_CANCELED event on op ID that was not canceled");
+    } else if (callback_info->ret != NA_SUCCESS) {
+        HG_LOG_ERROR("NA callback returned error (%s)",
+            NA_Error_to_string(callback_info->ret));
 
-            if (hg_bulk_op_id->na_sm_op_ids.s[i] == NULL)
-                continue;
+        /* Mark handle as errored */
+        hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
+    }
 
-            na_ret = NA_Op_destroy(core_context->core_class->na_sm_class,
-                hg_bulk_op_id->na_sm_op_ids.s[i]);
-            HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS, "NA_Op_destroy() failed");
-        }
-#endif
-        free(hg_bulk_op_id);
+    /* When all NA transfers that correspond to bulk operation complete
+     * add HG user callback to completion queue
+     */
+    if ((hg_uint32_t) hg_atomic_incr32(&hg_bulk_op_id->op_completed_count) ==
+        hg_bulk_op_id->op_count) {
+        hg_return_t ret = hg_bulk_complete(hg_bulk_op_id, HG_FALSE);
+        HG_CHECK_ERROR_DONE(ret != HG_SUCCESS, "Could not complete operation");
     }
-    return ret;
+
+    return (int) completed;
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_op_destroy(struct hg_bulk_op_id *hg_bulk_op_id)
+hg_bulk_na_window_init(struct hg_bulk_op_id *hg_bulk_op_id)
 {
+    struct hg_bulk_na_window *hg_bulk_na_window = hg_bulk_op_id->window;
+    hg_bulk_na_op_id_t *hg_bulk_na_op_ids;
     hg_return_t ret = HG_SUCCESS;
     hg_uint32_t i;
 
-    if (hg_atomic_decr32(&hg_bulk_op_id->ref_count)) {
-        /* Cannot free yet */
-        goto done;
+    /* Window is kept along with op ID */
+    if (!hg_bulk_na_window) {
+        hg_uint32_t slot_count = hg_core_class_get_bulk_op_window(
+            hg_bulk_op_id->core_context->core_class);
+
+        hg_bulk_na_window = (struct hg_bulk_na_window *) malloc(
+            sizeof(struct hg_bulk_na_window));
+        HG_CHECK_ERROR(hg_bulk_na_window == NULL, done, ret, HG_NOMEM,
+            "Could not allocate window");
+        memset(hg_bulk_na_window, 0, sizeof(struct hg_bulk_na_window));
+
+        hg_bulk_na_window->slots = (struct hg_bulk_na_slot *) malloc(
+            slot_count * sizeof(struct hg_bulk_na_slot));
+        if (hg_bulk_na_window->slots == NULL) {
+            free(hg_bulk_na_window);
+            HG_GOTO_ERROR(
+                done, ret, HG_NOMEM, "Could not allocate window slots");
+        }
+        for (i = 0; i < slot_count; i++) {
+            hg_bulk_na_window->slots[i].op_id = hg_bulk_op_id;
+            hg_bulk_na_window->slots[i].index = i;
+        }
+        hg_bulk_na_window->slot_count = slot_count;
+        hg_thread_mutex_init(&hg_bulk_na_window->mutex);
+
+        hg_bulk_op_id->window = hg_bulk_na_window;
+        if (hg_bulk_op_id->op_pool)
+            hg_bulk_op_pool_account(hg_bulk_op_id->op_pool, 0, 1);
     }
 
-    /* We may have used extra op IDs if this NA class was used */
-    if (hg_bulk_op_id->na_class &&
-        hg_bulk_op_id->op_count > HG_BULK_STATIC_MAX) {
-        na_op_id_t **na_op_ids = NULL;
 #ifdef NA_HAS_SM
-        if (hg_bulk_op_id->na_class ==
-            hg_bulk_op_id->core_context->core_class->na_sm_class)
-            na_op_ids = hg_bulk_op_id->na_sm_op_ids.d;
-        else
+    if (hg_bulk_op_id->na_class ==
+        hg_bulk_op_id->core_context->core_class->na_sm_class)
+        hg_bulk_na_op_ids = &hg_bulk_op_id->na_sm_op_ids;
+    else
 #endif
-            na_op_ids = hg_bulk_op_id->na_op_ids.d;
+        hg_bulk_na_op_ids = &hg_bulk_op_id->na_op_ids;
 
-        if (na_op_ids) {
-            for (i = 0; i < hg_bulk_op_id->op_count; i++) {
-                na_return_t na_ret;
+    /* Create NA op IDs of window for that NA class */
+    if (hg_bulk_na_op_ids->d == NULL) {
+        na_op_id_t **na_op_ids = (na_op_id_t **) calloc(
+            hg_bulk_na_window->slot_count, sizeof(na_op_id_t *));
+        HG_CHECK_ERROR(na_op_ids == NULL, done, ret, HG_NOMEM,
+            "Could not allocate memory for op_ids");
+
+        for (i = 0; i < hg_bulk_na_window->slot_count; i++) {
+            na_op_ids[i] = NA_Op_create(hg_bulk_op_id->na_class);
+            if (na_op_ids[i] == NULL) {
+                while (i-- > 0)
+                    NA_Op_destroy(hg_bulk_op_id->na_class, na_op_ids[i]);
+                free(na_op_ids);
+                HG_GOTO_ERROR(
+                    done, ret, HG_NA_ERROR, "Could not create NA op ID");
+            }
+        }
+        hg_bulk_na_op_ids->d = na_op_ids;
+        if (hg_bulk_op_id->op_pool)
+            hg_bulk_op_pool_account(hg_bulk_op_id->op_pool,
+                (long) hg_bulk_na_window->slot_count, 0);
+    }
 
-                if (na_op_ids[i] == NULL)
-                    continue;
+    /* Reset transfer */
+    hg_bulk_na_window->descs = NULL;
+    hg_bulk_na_window->desc_count = 0;
+    hg_bulk_na_window->remaining = 0;
+    hg_bulk_na_window->issued_count = 0;
 
-                na_ret = NA_Op_destroy(hg_bulk_op_id->na_class, na_op_ids[i]);
-                HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret,
-                    (hg_return_t) na_ret, "NA_Op_destroy() failed (%s)",
-                    NA_Error_to_string(na_ret));
-            }
-            free(na_op_ids);
-            hg_bulk_op_id->na_op_ids.d = NULL;
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_na_window_free(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    struct hg_bulk_na_window *hg_bulk_na_window = hg_bulk_op_id->window;
+    long na_op_count = 0;
+    hg_uint32_t i;
+
+    if (!hg_bulk_na_window)
+        return;
+
+    if (hg_bulk_op_id->na_op_ids.d) {
+        for (i = 0; i < hg_bulk_na_window->slot_count; i++) {
+            na_return_t na_ret =
+                NA_Op_destroy(hg_bulk_op_id->core_context->core_class->na_class,
+                    hg_bulk_op_id->na_op_ids.d[i]);
+            HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS,
+                "NA_Op_destroy() failed (%s)", NA_Error_to_string(na_ret));
+        }
+        free(hg_bulk_op_id->na_op_ids.d);
+        hg_bulk_op_id->na_op_ids.d = NULL;
+        na_op_count -= (long) hg_bulk_na_window->slot_count;
+    }
 #ifdef NA_HAS_SM
-            hg_bulk_op_id->na_sm_op_ids.d = NULL;
-#endif
+    if (hg_bulk_op_id->na_sm_op_ids.d) {
+        for (i = 0; i < hg_bulk_na_window->slot_count; i++) {
+            na_return_t na_ret = NA_Op_destroy(
+                hg_bulk_op_id->core_context->core_class->na_sm_class,
+                hg_bulk_op_id->na_sm_op_ids.d[i]);
+            HG_CHECK_ERROR_DONE(na_ret != NA_SUCCESS,
+                "NA_Op_destroy() failed (%s)", NA_Error_to_string(na_ret));
         }
+        free(hg_bulk_op_id->na_sm_op_ids.d);
+        hg_bulk_op_id->na_sm_op_ids.d = NULL;
+        na_op_count -= (long) hg_bulk_na_window->slot_count;
     }
+#endif
+    if (hg_bulk_op_id->op_pool)
+        hg_bulk_op_pool_account(hg_bulk_op_id->op_pool, na_op_count, -1);
 
-    /* Repost handle if we were listening, otherwise destroy it */
-    if (hg_bulk_op_id->reuse) {
-        HG_LOG_DEBUG("Re-using bulk op ID (%p)", hg_bulk_op_id);
+    hg_thread_mutex_destroy(&hg_bulk_na_window->mutex);
+    free(hg_bulk_na_window->slots);
+    free(hg_bulk_na_window);
+    hg_bulk_op_id->window = NULL;
+}
 
-        /* Reset ref_count */
-        hg_atomic_set32(&hg_bulk_op_id->ref_count, 1);
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_na_window_load(struct hg_bulk_na_window *hg_bulk_na_window,
+    na_class_t *na_class, na_addr_t na_origin_addr, hg_uint8_t origin_id,
+    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
+    na_mem_handle_t *origin_mem_handles, hg_size_t origin_mem_offset,
+    hg_uint8_t origin_flags, hg_size_t origin_offset,
+    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
+    na_mem_handle_t *local_mem_handles, hg_size_t local_mem_offset,
+    hg_uint8_t local_flags, hg_size_t local_offset, hg_size_t size)
+{
+    hg_return_t ret = HG_SUCCESS;
+    na_return_t na_ret;
 
-        /* Reset status */
-        hg_atomic_set32(&hg_bulk_op_id->status, HG_BULK_OP_COMPLETED);
+    /* Operations may be issued after the user released the address, keep a
+     * reference until the window is released */
+    if (hg_bulk_na_window->na_origin_addr != NA_ADDR_NULL) {
+        na_ret = NA_Addr_free(na_class, hg_bulk_na_window->na_origin_addr);
+        hg_bulk_na_window->na_origin_addr = NA_ADDR_NULL;
+        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+            "Could not free NA address (%s)", NA_Error_to_string(na_ret));
+    }
+    na_ret = NA_Addr_dup(
+        na_class, na_origin_addr, &hg_bulk_na_window->na_origin_addr);
+    HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+        "Could not dup NA address (%s)", NA_Error_to_string(na_ret));
+
+    hg_bulk_na_window->origin_id = origin_id;
+    hg_bulk_na_window->origin_segments = origin_segments;
+    hg_bulk_na_window->origin_count = origin_count;
+    hg_bulk_na_window->origin_mem_handles = origin_mem_handles;
+    hg_bulk_na_window->origin_mem_offset = origin_mem_offset;
+    hg_bulk_na_window->origin_index = 0;
+    hg_bulk_na_window->origin_offset = origin_offset;
+    hg_bulk_na_window->local_segments = local_segments;
+    hg_bulk_na_window->local_count = local_count;
+    hg_bulk_na_window->local_mem_handles = local_mem_handles;
+    hg_bulk_na_window->local_mem_offset = local_mem_offset;
+    hg_bulk_na_window->local_index = 0;
+    hg_bulk_na_window->local_offset = local_offset;
+    hg_bulk_na_window->remaining = size;
+
+    /* Offsets are kept as is when transferring in single operation */
+    hg_bulk_na_window->single =
+        ((origin_flags & HG_BULK_REGV) || origin_count == 1) &&
+        ((local_flags & HG_BULK_REGV) || local_count == 1);
+    if (hg_bulk_na_window->single)
+        goto done;
 
-        hg_thread_spin_lock(&hg_bulk_op_id->op_pool->pending_list_lock);
-        HG_LIST_INSERT_HEAD(
-            &hg_bulk_op_id->op_pool->pending_list, hg_bulk_op_id, pending);
-        hg_thread_spin_unlock(&hg_bulk_op_id->op_pool->pending_list_lock);
-    } else {
-        HG_LOG_DEBUG("Freeing bulk op ID (%p)", hg_bulk_op_id);
+    hg_bulk_na_window->origin_offset = 0;
+    if (origin_offset > 0)
+        hg_bulk_offset_translate(origin_segments, origin_count, origin_offset,
+            &hg_bulk_na_window->origin_index,
+            &hg_bulk_na_window->origin_offset);
 
-        for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-            na_return_t na_ret;
+    hg_bulk_na_window->local_offset = 0;
+    if (local_offset > 0)
+        hg_bulk_offset_translate(local_segments, local_count, local_offset,
+            &hg_bulk_na_window->local_index, &hg_bulk_na_window->local_offset);
 
-            if (hg_bulk_op_id->na_op_ids.s[i] == NULL)
-                continue;
+done:
+    return ret;
+}
 
-            na_ret =
-                NA_Op_destroy(hg_bulk_op_id->core_context->core_class->na_class,
-                    hg_bulk_op_id->na_op_ids.s[i]);
-            HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret,
-                (hg_return_t) na_ret, "NA_Op_destroy() failed (%s)",
-                NA_Error_to_string(na_ret));
-        }
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_na_window_load_desc(struct hg_bulk_op_id *hg_bulk_op_id,
+    const struct hg_bulk_transfer_desc *desc)
+{
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) desc->origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) desc->local_handle;
+    hg_uint32_t origin_count = hg_bulk_origin->desc.info.segment_count,
+                local_count = hg_bulk_local->desc.info.segment_count;
+    uint8_t origin_flags = hg_bulk_origin->desc.info.flags;
+    uint8_t local_flags = hg_bulk_local->desc.info.flags;
+    struct hg_bulk_na_mem_desc *origin_mem_descs, *local_mem_descs;
+    na_addr_t na_origin_addr;
 
 #ifdef NA_HAS_SM
-        for (i = 0; i < HG_BULK_STATIC_MAX; i++) {
-            na_return_t na_ret;
+    if (origin_flags & HG_BULK_SM) {
+        na_origin_addr =
+            HG_Core_addr_get_na_sm((hg_core_addr_t) desc->origin_addr);
+        origin_mem_descs = &hg_bulk_origin->na_sm_mem_descs;
+        local_mem_descs = &hg_bulk_local->na_sm_mem_descs;
+    } else {
+#endif
+        na_origin_addr =
+            HG_Core_addr_get_na((hg_core_addr_t) desc->origin_addr);
+        origin_mem_descs = &hg_bulk_origin->na_mem_descs;
+        local_mem_descs = &hg_bulk_local->na_mem_descs;
+#ifdef NA_HAS_SM
+    }
+#endif
 
-            if (hg_bulk_op_id->na_sm_op_ids.s[i] == NULL)
-                continue;
+    return hg_bulk_na_window_load(hg_bulk_op_id->window,
+        hg_bulk_op_id->na_class, na_origin_addr, desc->origin_id,
+        HG_BULK_SEGMENTS(hg_bulk_origin), origin_count,
+        HG_BULK_MEM_HANDLES(origin_mem_descs, origin_count, origin_flags),
+        hg_bulk_origin->mem_offset, origin_flags, desc->origin_offset,
+        HG_BULK_SEGMENTS(hg_bulk_local), local_count,
+        HG_BULK_MEM_HANDLES(local_mem_descs, local_count, local_flags),
+        hg_bulk_local->mem_offset, local_flags, desc->local_offset, desc->size);
+}
 
-            na_ret = NA_Op_destroy(
-                hg_bulk_op_id->core_context->core_class->na_sm_class,
-                hg_bulk_op_id->na_sm_op_ids.s[i]);
-            HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret,
-                (hg_return_t) na_ret, "NA_Op_destroy() failed (%s)",
-                NA_Error_to_string(na_ret));
-        }
-#endif
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_na_window_start(struct hg_bulk_op_id *hg_bulk_op_id,
+    na_bulk_op_t na_bulk_op, const struct hg_bulk_transfer_desc *descs,
+    hg_uint32_t desc_count)
+{
+    struct hg_bulk_na_window *hg_bulk_na_window = hg_bulk_op_id->window;
+    hg_uint32_t slot_count =
+        HG_BULK_MIN(hg_bulk_na_window->slot_count, hg_bulk_op_id->op_count);
+    hg_uint32_t issued_count, i;
+    hg_return_t ret = HG_SUCCESS;
+
+    hg_bulk_na_window->na_bulk_op = na_bulk_op;
+    hg_bulk_na_window->descs = descs;
+    hg_bulk_na_window->desc_count = desc_count;
+
+    HG_LOG_DEBUG("Issuing %u NA operation(s) within window of %u",
+        hg_bulk_op_id->op_count, slot_count);
 
-        free(hg_bulk_op_id);
+    /* Callbacks of operations issued may re-use their slot once the window
+     * lock is released */
+    hg_thread_mutex_lock(&hg_bulk_na_window->mutex);
+    for (i = 0; i < slot_count; i++) {
+        ret = hg_bulk_na_window_issue(
+            hg_bulk_op_id, &hg_bulk_na_window->slots[i]);
+        if (ret != HG_SUCCESS)
+            break;
+    }
+    issued_count = hg_bulk_na_window->issued_count;
+    if (ret != HG_SUCCESS)
+        hg_bulk_na_window->issued_count = hg_bulk_op_id->op_count;
+    hg_thread_mutex_unlock(&hg_bulk_na_window->mutex);
+
+    if (ret != HG_SUCCESS) {
+        /* Nothing is in flight, let the caller release the op ID */
+        if (issued_count == 0)
+            goto done;
+
+        /* Operations that could not be issued are accounted as completed
+         * and the error is reported to user callback */
+        hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
+        ret = HG_SUCCESS;
+        for (i = issued_count; i < hg_bulk_op_id->op_count; i++) {
+            if ((hg_uint32_t) hg_atomic_incr32(
+                    &hg_bulk_op_id->op_completed_count) ==
+                hg_bulk_op_id->op_count) {
+                ret = hg_bulk_complete(hg_bulk_op_id, HG_TRUE);
+                HG_CHECK_HG_ERROR(
+                    done, ret, "Could not complete bulk operation");
+            }
+        }
     }
 
 done:
@@ -1729,184 +5957,399 @@ done:
 }
 
 /*---------------------------------------------------------------------------*/
-hg_return_t
-hg_bulk_op_pool_create(hg_core_context_t *core_context, unsigned int init_count,
-    struct hg_bulk_op_pool **hg_bulk_op_pool_ptr)
+static hg_return_t
+hg_bulk_na_window_issue(
+    struct hg_bulk_op_id *hg_bulk_op_id, struct hg_bulk_na_slot *slot)
 {
-    struct hg_bulk_op_pool *hg_bulk_op_pool = NULL;
+    struct hg_bulk_na_window *hg_bulk_na_window = hg_bulk_op_id->window;
+    na_mem_handle_t origin_mem_handle, local_mem_handle;
+    hg_size_t origin_offset, local_offset, transfer_size;
+    na_op_id_t **na_op_ids;
     hg_return_t ret = HG_SUCCESS;
-    unsigned int i;
+    na_return_t na_ret;
 
-    HG_LOG_DEBUG("Creating pool with %u bulk op IDs", init_count);
+    /* Move to next batched transfer that goes through NA */
+    while (hg_bulk_na_window->remaining == 0 &&
+           hg_bulk_na_window->desc_count > 0) {
+        const struct hg_bulk_transfer_desc *desc = hg_bulk_na_window->descs;
 
-    hg_bulk_op_pool =
-        (struct hg_bulk_op_pool *) malloc(sizeof(struct hg_bulk_op_pool));
-    HG_CHECK_ERROR(hg_bulk_op_pool == NULL, error, ret, HG_NOMEM,
-        "Could not allocate bulk op pool");
+        hg_bulk_na_window->descs++;
+        hg_bulk_na_window->desc_count--;
+        if (desc->size == 0 ||
+            hg_bulk_transfer_batch_is_local(
+                hg_bulk_op_id->callback_info.info.bulk.op, desc))
+            continue;
 
-    hg_thread_mutex_init(&hg_bulk_op_pool->extend_mutex);
-    hg_thread_cond_init(&hg_bulk_op_pool->extend_cond);
-    hg_bulk_op_pool->core_context = core_context;
-    HG_LIST_INIT(&hg_bulk_op_pool->pending_list);
-    hg_thread_spin_init(&hg_bulk_op_pool->pending_list_lock);
-    hg_bulk_op_pool->count = init_count;
-    hg_bulk_op_pool->extending = HG_FALSE;
+        ret = hg_bulk_na_window_load_desc(hg_bulk_op_id, desc);
+        HG_CHECK_HG_ERROR(done, ret, "Could not load batched transfer");
+    }
+    HG_CHECK_ERROR(hg_bulk_na_window->remaining == 0, done, ret,
+        HG_PROTOCOL_ERROR, "Expected %u operations, issued %u",
+        hg_bulk_op_id->op_count, hg_bulk_na_window->issued_count);
+
+    if (hg_bulk_na_window->single) {
+        origin_mem_handle = hg_bulk_na_window->origin_mem_handles[0];
+        local_mem_handle = hg_bulk_na_window->local_mem_handles[0];
+        transfer_size = hg_bulk_na_window->remaining;
+    } else {
+        hg_uint32_t origin_index = hg_bulk_na_window->origin_index,
+                    local_index = hg_bulk_na_window->local_index;
 
-    for (i = 0; i < init_count; i++) {
-        struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+        HG_CHECK_ERROR(origin_index >= hg_bulk_na_window->origin_count ||
+                           local_index >= hg_bulk_na_window->local_count,
+            done, ret, HG_PROTOCOL_ERROR, "Segment index out of range");
 
-        ret = hg_bulk_op_create(core_context, &hg_bulk_op_id);
-        HG_CHECK_HG_ERROR(error, ret, "Could not create bulk op ID");
+        origin_mem_handle = hg_bulk_na_window->origin_mem_handles[origin_index];
+        local_mem_handle = hg_bulk_na_window->local_mem_handles[local_index];
+
+        /* Can only transfer smallest size */
+        transfer_size = HG_BULK_MIN(
+            (hg_bulk_na_window->origin_segments[origin_index].len -
+                hg_bulk_na_window->origin_offset),
+            (hg_bulk_na_window->local_segments[local_index].len -
+                hg_bulk_na_window->local_offset));
+
+        /* Remaining size may be smaller */
+        transfer_size =
+            HG_BULK_MIN(hg_bulk_na_window->remaining, transfer_size);
+    }
+    /* Offset in NA handle only applies to first segment */
+    origin_offset = hg_bulk_na_window->origin_offset;
+    if (hg_bulk_na_window->origin_index == 0)
+        origin_offset += hg_bulk_na_window->origin_mem_offset;
+    local_offset = hg_bulk_na_window->local_offset;
+    if (hg_bulk_na_window->local_index == 0)
+        local_offset += hg_bulk_na_window->local_mem_offset;
+
+#ifdef NA_HAS_SM
+    if (hg_bulk_op_id->na_class ==
+        hg_bulk_op_id->core_context->core_class->na_sm_class)
+        na_op_ids = hg_bulk_op_id->na_sm_op_ids.d;
+    else
+#endif
+        na_op_ids = hg_bulk_op_id->na_op_ids.d;
 
-        hg_bulk_op_id->reuse = HG_TRUE;
-        hg_bulk_op_id->op_pool = hg_bulk_op_pool;
+    na_ret = hg_bulk_na_window->na_bulk_op(hg_bulk_op_id->na_class,
+        hg_bulk_op_id->na_context, hg_bulk_na_window_cb, slot,
+        local_mem_handle, local_offset, origin_mem_handle, origin_offset,
+        transfer_size, hg_bulk_na_window->na_origin_addr,
+        hg_bulk_na_window->origin_id, na_op_ids[slot->index]);
+    HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+        "Could not transfer data (%s)", NA_Error_to_string(na_ret));
 
-        hg_thread_spin_lock(&hg_bulk_op_pool->pending_list_lock);
-        HG_LIST_INSERT_HEAD(
-            &hg_bulk_op_pool->pending_list, hg_bulk_op_id, pending);
-        hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
-    }
+    hg_bulk_na_window->issued_count++;
 
-    HG_LOG_DEBUG("Created bulk op ID pool (%p)", hg_bulk_op_pool);
+    /* Decrease remaining size from the size of data we transferred */
+    hg_bulk_na_window->remaining -= transfer_size;
+    if (hg_bulk_na_window->single || hg_bulk_na_window->remaining == 0)
+        goto done;
 
-    *hg_bulk_op_pool_ptr = hg_bulk_op_pool;
+    /* Increment offsets from the size of data we transferred */
+    hg_bulk_na_window->origin_offset += transfer_size;
+    hg_bulk_na_window->local_offset += transfer_size;
 
-    return ret;
+    /* Change segment if new offset exceeds segment size */
+    if (hg_bulk_na_window->origin_offset >=
+        hg_bulk_na_window->origin_segments[hg_bulk_na_window->origin_index]
+            .len) {
+        hg_bulk_na_window->origin_index++;
+        hg_bulk_na_window->origin_offset = 0;
+    }
+    if (hg_bulk_na_window->local_offset >=
+        hg_bulk_na_window->local_segments[hg_bulk_na_window->local_index].len) {
+        hg_bulk_na_window->local_index++;
+        hg_bulk_na_window->local_offset = 0;
+    }
 
-error:
-    if (hg_bulk_op_pool)
-        hg_bulk_op_pool_destroy(hg_bulk_op_pool);
+done:
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-hg_return_t
-hg_bulk_op_pool_destroy(struct hg_bulk_op_pool *hg_bulk_op_pool)
+static int
+hg_bulk_na_window_cb(const struct na_cb_info *callback_info)
 {
-    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
-    hg_return_t ret = HG_SUCCESS;
-
-    HG_LOG_DEBUG("Free bulk op ID pool (%p)", hg_bulk_op_pool);
-
-    hg_thread_spin_lock(&hg_bulk_op_pool->pending_list_lock);
+    struct hg_bulk_na_slot *slot =
+        (struct hg_bulk_na_slot *) callback_info->arg;
+    struct hg_bulk_op_id *hg_bulk_op_id = slot->op_id;
+    struct hg_bulk_na_window *hg_bulk_na_window = hg_bulk_op_id->window;
+    hg_uint32_t completed_count = 1, i;
+    hg_bool_t completed = HG_TRUE;
 
-    hg_bulk_op_id = HG_LIST_FIRST(&hg_bulk_op_pool->pending_list);
+    /* If canceled, mark handle as canceled */
+    if (callback_info->ret == NA_CANCELED) {
+        HG_LOG_DEBUG("NA_CANCELED event on op ID %p", hg_bulk_op_id);
+        HG_CHECK_WARNING(
+            !(hg_atomic_get32(&hg_bulk_op_id->status) & HG_BULK_OP_CANCELED),
+            "Received NA_CANCELED event on op ID that was not canceled");
+    } else if (callback_info->ret != NA_SUCCESS) {
+        HG_LOG_ERROR("NA callback returned error (%s)",
+            NA_Error_to_string(callback_info->ret));
 
-    while (hg_bulk_op_id) {
-        struct hg_bulk_op_id *hg_bulk_op_id_next =
-            HG_LIST_NEXT(hg_bulk_op_id, pending);
-        HG_LIST_REMOVE(hg_bulk_op_id, pending);
+        /* Mark handle as errored */
+        hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
+    }
 
-        /* Prevent re-initialization */
-        hg_bulk_op_id->reuse = HG_FALSE;
+    /* Re-use NA op ID of that slot to issue next operation, operations that
+     * will not be issued are accounted as completed */
+    hg_thread_mutex_lock(&hg_bulk_na_window->mutex);
+    if (hg_bulk_na_window->issued_count < hg_bulk_op_id->op_count) {
+        hg_bool_t skip = HG_FALSE;
+
+        if (hg_atomic_get32(&hg_bulk_op_id->status) &
+            (HG_BULK_OP_CANCELED | HG_BULK_OP_ERRORED))
+            skip = HG_TRUE;
+        else if (hg_bulk_na_window_issue(hg_bulk_op_id, slot) != HG_SUCCESS) {
+            hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
+            skip = HG_TRUE;
+        }
 
-        /* Destroy op IDs */
-        ret = hg_bulk_op_destroy(hg_bulk_op_id);
-        HG_CHECK_HG_ERROR(unlock, ret, "Could not destroy bulk op ID");
+        if (skip) {
+            completed_count +=
+                hg_bulk_op_id->op_count - hg_bulk_na_window->issued_count;
+            hg_bulk_na_window->issued_count = hg_bulk_op_id->op_count;
+        }
+    }
+    hg_thread_mutex_unlock(&hg_bulk_na_window->mutex);
 
-        hg_bulk_op_id = hg_bulk_op_id_next;
+    /* When all NA transfers that correspond to bulk operation complete
+     * add HG user callback to completion queue
+     */
+    for (i = 0; i < completed_count; i++) {
+        if ((hg_uint32_t) hg_atomic_incr32(
+                &hg_bulk_op_id->op_completed_count) ==
+            hg_bulk_op_id->op_count) {
+            hg_return_t ret = hg_bulk_complete(hg_bulk_op_id, HG_FALSE);
+            HG_CHECK_ERROR_DONE(
+                ret != HG_SUCCESS, "Could not complete operation");
+        }
     }
-    hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
 
-    hg_thread_mutex_destroy(&hg_bulk_op_pool->extend_mutex);
-    hg_thread_cond_destroy(&hg_bulk_op_pool->extend_cond);
-    hg_thread_spin_destroy(&hg_bulk_op_pool->pending_list_lock);
+    return (int) completed;
+}
 
-    free(hg_bulk_op_pool);
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_na_window_cancel(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    struct hg_bulk_na_window *hg_bulk_na_window = hg_bulk_op_id->window;
+    hg_uint32_t slot_count =
+        HG_BULK_MIN(hg_bulk_na_window->slot_count, hg_bulk_op_id->op_count);
+    na_op_id_t **na_op_ids;
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
 
-    return ret;
+#ifdef NA_HAS_SM
+    if (hg_bulk_op_id->na_class ==
+        hg_bulk_op_id->core_context->core_class->na_sm_class)
+        na_op_ids = hg_bulk_op_id->na_sm_op_ids.d;
+    else
+#endif
+        na_op_ids = hg_bulk_op_id->na_op_ids.d;
+
+    /* Prevent slots from being re-used while canceling */
+    hg_thread_mutex_lock(&hg_bulk_na_window->mutex);
+    for (i = 0; i < slot_count; i++) {
+        na_return_t na_ret = NA_Cancel(
+            hg_bulk_op_id->na_class, hg_bulk_op_id->na_context, na_op_ids[i]);
+        HG_CHECK_ERROR(na_ret != NA_SUCCESS, unlock, ret, (hg_return_t) na_ret,
+            "Could not cancel NA op ID (%s)", NA_Error_to_string(na_ret));
+    }
 
 unlock:
-    hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
+    hg_thread_mutex_unlock(&hg_bulk_na_window->mutex);
 
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_op_pool_get(struct hg_bulk_op_pool *hg_bulk_op_pool,
-    struct hg_bulk_op_id **hg_bulk_op_id_ptr)
+hg_bulk_complete(struct hg_bulk_op_id *hg_bulk_op_id, hg_bool_t self_notify)
 {
-    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    struct hg_cb_info *callback_info = NULL;
     hg_return_t ret = HG_SUCCESS;
+    hg_util_int32_t status;
 
-    while (!hg_bulk_op_id) {
-        unsigned int i;
+    /* Mark op id as completed before checking for cancelation */
+    status = hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_COMPLETED);
 
-        hg_thread_spin_lock(&hg_bulk_op_pool->pending_list_lock);
-        if ((hg_bulk_op_id = HG_LIST_FIRST(&hg_bulk_op_pool->pending_list)))
-            HG_LIST_REMOVE(hg_bulk_op_id, pending);
-        hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
+    /* Init callback info */
+    callback_info = &hg_bulk_op_id->callback_info;
 
-        if (hg_bulk_op_id)
-            break;
+    /* Check for current status before completing */
+    if (status & HG_BULK_OP_CANCELED) {
+        /* If it was canceled while being processed, set callback ret
+         * accordingly */
+        HG_LOG_DEBUG("Operation ID %p is canceled", hg_bulk_op_id);
+        callback_info->ret = HG_CANCELED;
+    } else if (status & HG_BULK_OP_CHECKSUM) {
+        /* Data transferred does not match checksums of origin */
+        HG_LOG_DEBUG("Operation ID %p failed checksum", hg_bulk_op_id);
+        callback_info->ret = HG_CHECKSUM_ERROR;
+    } else if (status & HG_BULK_OP_ERRORED) {
+        /* If it was errored, set callback ret accordingly */
+        HG_LOG_DEBUG("Operation ID %p is errored", hg_bulk_op_id);
+        callback_info->ret = HG_PROTOCOL_ERROR;
+    } else
+        callback_info->ret = HG_SUCCESS;
 
-        /* Create another batch of IDs if empty */
-        hg_thread_mutex_lock(&hg_bulk_op_pool->extend_mutex);
-        if (hg_bulk_op_pool->extending) {
-            hg_thread_cond_wait(
-                &hg_bulk_op_pool->extend_cond, &hg_bulk_op_pool->extend_mutex);
-            continue;
-        }
-        hg_bulk_op_pool->extending = HG_TRUE;
-        hg_thread_mutex_unlock(&hg_bulk_op_pool->extend_mutex);
+    if (callback_info->info.bulk.origin_handle &&
+        (callback_info->info.bulk.origin_handle->desc.info.flags &
+            HG_BULK_EAGER)) {
+        /* In the case of eager bulk transfer, directly trigger the operation
+         * to avoid potential deadlocks */
+        ret = hg_bulk_trigger_entry(hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(done, ret, "Could not trigger completion entry");
+    } else {
+        struct hg_completion_entry *hg_completion_entry =
+            &hg_bulk_op_id->hg_completion_entry;
 
-        /* Only a single thread can extend the pool */
-        for (i = 0; i < hg_bulk_op_pool->count; i++) {
-            struct hg_bulk_op_id *new_op_id = NULL;
+        hg_completion_entry->op_type = HG_BULK;
+        hg_completion_entry->op_id.hg_bulk_op_id = hg_bulk_op_id;
+
+        ret = hg_core_completion_add(
+            hg_bulk_op_id->core_context, hg_completion_entry, self_notify);
+        HG_CHECK_HG_ERROR(
+            done, ret, "Could not add HG completion entry to completion queue");
+    }
 
-            ret = hg_bulk_op_create(hg_bulk_op_pool->core_context, &new_op_id);
-            HG_CHECK_HG_ERROR(error, ret, "Could not create bulk op ID");
+done:
+    return ret;
+}
 
-            new_op_id->reuse = HG_TRUE;
-            new_op_id->op_pool = hg_bulk_op_pool;
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_cancel(struct hg_bulk_op_id *hg_bulk_op_id)
+{
+    na_op_id_t **na_op_ids;
+    hg_return_t ret = HG_SUCCESS;
+    hg_util_int32_t status;
+    unsigned int i;
 
-            hg_thread_spin_lock(&hg_bulk_op_pool->pending_list_lock);
-            HG_LIST_INSERT_HEAD(
-                &hg_bulk_op_pool->pending_list, new_op_id, pending);
-            hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
-        }
-        hg_bulk_op_pool->count *= 2;
+    /* Exit if op has already completed */
+    status = hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_CANCELED);
+    if ((status & HG_BULK_OP_COMPLETED) || (status & HG_BULK_OP_ERRORED))
+        goto done;
 
-        hg_thread_mutex_lock(&hg_bulk_op_pool->extend_mutex);
-        hg_bulk_op_pool->extending = HG_FALSE;
-        hg_thread_cond_broadcast(&hg_bulk_op_pool->extend_cond);
-        hg_thread_mutex_unlock(&hg_bulk_op_pool->extend_mutex);
+    /* Pipelined transfers are canceled through their chunks */
+    if (hg_bulk_op_id->pipeline) {
+        ret = hg_bulk_pipeline_cancel(hg_bulk_op_id->pipeline);
+        HG_CHECK_HG_ERROR(done, ret, "Could not cancel pipelined transfer");
+        goto done;
     }
 
-    *hg_bulk_op_id_ptr = hg_bulk_op_id;
+    /* Windowed transfers re-use a bounded number of op IDs */
+    if (hg_bulk_op_id->op_count > HG_BULK_STATIC_MAX) {
+        ret = hg_bulk_na_window_cancel(hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(done, ret, "Could not cancel windowed transfer");
+        goto done;
+    }
 
-    return ret;
+        /* Cancel all NA operations issued */
+#ifdef NA_HAS_SM
+    if (hg_bulk_op_id->na_class ==
+        hg_bulk_op_id->core_context->core_class->na_sm_class)
+        na_op_ids = HG_BULK_NA_SM_OP_IDS(hg_bulk_op_id);
+    else
+#endif
+        na_op_ids = HG_BULK_NA_OP_IDS(hg_bulk_op_id);
 
-error:
-    hg_thread_mutex_lock(&hg_bulk_op_pool->extend_mutex);
-    hg_bulk_op_pool->extending = HG_FALSE;
-    hg_thread_cond_broadcast(&hg_bulk_op_pool->extend_cond);
-    hg_thread_mutex_unlock(&hg_bulk_op_pool->extend_mutex);
+    for (i = 0; i < hg_bulk_op_id->op_count; i++) {
+        na_return_t na_ret = NA_Cancel(
+            hg_bulk_op_id->na_class, hg_bulk_op_id->na_context, na_op_ids[i]);
+        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+            "Could not cancel NA op ID (%s)", NA_Error_to_string(na_ret));
+    }
 
+done:
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
-    hg_bulk_op_t op, struct hg_core_addr *origin_addr, hg_uint8_t origin_id,
+hg_bulk_transfer_pipelined(hg_core_context_t *core_context, hg_cb_t callback,
+    hg_bulk_chunk_cb_t chunk_callback, void *arg, hg_bulk_op_t op,
+    struct hg_core_addr *origin_addr, hg_uint8_t origin_id,
     struct hg_bulk *hg_bulk_origin, hg_size_t origin_offset,
     struct hg_bulk *hg_bulk_local, hg_size_t local_offset, hg_size_t size,
-    hg_op_id_t *op_id)
+    hg_size_t chunk_size, unsigned int window, hg_op_id_t *op_id)
 {
-    const struct hg_bulk_segment *origin_segments =
-        HG_BULK_SEGMENTS(hg_bulk_origin);
-    const struct hg_bulk_segment *local_segments =
-        HG_BULK_SEGMENTS(hg_bulk_local);
-    hg_uint32_t origin_count = hg_bulk_origin->desc.info.segment_count,
-                local_count = hg_bulk_local->desc.info.segment_count;
-    uint8_t origin_flags = hg_bulk_origin->desc.info.flags;
-    uint8_t local_flags = hg_bulk_local->desc.info.flags;
+    struct hg_bulk_pipeline *hg_bulk_pipeline = NULL;
     struct hg_bulk_op_id *hg_bulk_op_id = NULL;
     struct hg_bulk_op_pool *hg_bulk_op_pool =
         hg_core_context_get_bulk_op_pool(core_context);
+    hg_size_t chunk_count, block_size = 0;
+    hg_bool_t staged = HG_FALSE;
     hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    /* Eager transfers are copied at once */
+    if ((hg_bulk_origin->desc.info.flags & HG_BULK_EAGER) &&
+        (op != HG_BULK_PUSH) && size > 0)
+        chunk_size = size;
+
+    /* Compressed or checksummed blocks are pulled one chunk at a time */
+    if ((hg_bulk_origin->compressed || hg_bulk_origin->checksum) &&
+        op == HG_BULK_PULL && size > 0 && !HG_Core_addr_is_self(origin_addr)) {
+        hg_size_t end = origin_offset + size;
+
+        block_size = (hg_bulk_origin->compressed)
+                         ? hg_bulk_origin->compressed->block_size
+                         : hg_bulk_origin->checksum->block_size;
+        chunk_size = block_size;
+        chunk_count = (end - 1) / block_size - origin_offset / block_size + 1;
+
+        /* Partial blocks must be pulled whole to be verified */
+        staged = hg_bulk_origin->compressed ||
+                 (origin_offset % block_size) != 0 ||
+                 (end % block_size != 0 &&
+                     end != hg_bulk_origin->desc.info.len);
+    } else
+        /* No need for more slots than there are chunks */
+        chunk_count = (size + chunk_size - 1) / chunk_size;
+    if (chunk_count < window)
+        window = (chunk_count > 0) ? (unsigned int) chunk_count : 1;
+
+    hg_bulk_pipeline =
+        (struct hg_bulk_pipeline *) malloc(sizeof(struct hg_bulk_pipeline));
+    HG_CHECK_ERROR(hg_bulk_pipeline == NULL, error, ret, HG_NOMEM,
+        "Could not allocate pipelined transfer");
+    memset(hg_bulk_pipeline, 0, sizeof(struct hg_bulk_pipeline));
+    hg_thread_mutex_init(&hg_bulk_pipeline->mutex);
+
+    hg_bulk_pipeline->chunks = (struct hg_bulk_pipeline_chunk *) calloc(
+        window, sizeof(struct hg_bulk_pipeline_chunk));
+    HG_CHECK_ERROR(hg_bulk_pipeline->chunks == NULL, error, ret, HG_NOMEM,
+        "Could not allocate chunks");
+    for (i = 0; i < window; i++)
+        hg_bulk_pipeline->chunks[i].pipeline = hg_bulk_pipeline;
+
+    /* Origin address must remain valid until all chunks are issued */
+    ret = HG_Core_addr_dup(origin_addr, &hg_bulk_pipeline->origin_addr);
+    HG_CHECK_HG_ERROR(error, ret, "Could not duplicate origin address");
+
+    hg_bulk_pipeline->chunk_callback = chunk_callback;
+    hg_bulk_pipeline->origin_offset = origin_offset;
+    hg_bulk_pipeline->local_offset = local_offset;
+    hg_bulk_pipeline->size = size;
+    hg_bulk_pipeline->chunk_size = chunk_size;
+    hg_bulk_pipeline->window = window;
+    hg_bulk_pipeline->origin_id = origin_id;
+
+    if (block_size > 0) {
+        hg_bulk_pipeline->compressed = hg_bulk_origin->compressed;
+        hg_bulk_pipeline->checksum = hg_bulk_origin->checksum;
+        hg_bulk_pipeline->block_size = block_size;
+    }
+
+    /* Staging slot of one whole block per chunk */
+    if (staged) {
+        hg_size_t staging_size = window * block_size;
+
+        ret = hg_bulk_create(hg_bulk_origin->core_class, 1, NULL,
+            &staging_size, HG_BULK_READWRITE, &hg_bulk_pipeline->staging);
+        HG_CHECK_HG_ERROR(error, ret, "Could not create staging handle");
+    }
 
     /* Get a new OP ID from context */
     if (hg_bulk_op_pool) {
@@ -1924,500 +6367,734 @@ hg_bulk_transfer(hg_core_context_t *core_context, hg_cb_t callback, void *arg,
     hg_bulk_op_id->callback_info.info.bulk.local_handle = hg_bulk_local;
     hg_atomic_incr32(&hg_bulk_local->ref_count);
     hg_bulk_op_id->callback_info.info.bulk.op = op;
+    hg_bulk_op_id->na_class = NULL;
+    hg_bulk_op_id->na_context = NULL;
+    hg_bulk_op_id->pipeline = hg_bulk_pipeline;
+    hg_bulk_pipeline->op_id = hg_bulk_op_id;
 
     /* Reset status */
     hg_atomic_set32(&hg_bulk_op_id->status, 0);
 
-    /* Expected op count */
-    hg_bulk_op_id->op_count = (size > 0) ? 1 : 0; /* Default */
+    /* NA operations are tracked by chunks */
+    hg_bulk_op_id->op_count = 0;
     hg_atomic_set32(&hg_bulk_op_id->op_completed_count, 0);
 
-    if (size == 0) {
-        /* Complete immediately */
-        ret = hg_bulk_complete(hg_bulk_op_id, HG_TRUE);
-        HG_CHECK_HG_ERROR(error, ret, "Could not complete bulk operation");
-    } else if (HG_Core_addr_is_self(origin_addr) ||
-               ((origin_flags & HG_BULK_EAGER) && (op != HG_BULK_PUSH))) {
-        hg_bulk_op_id->na_class = NULL;
-        hg_bulk_op_id->na_context = NULL;
+    HG_LOG_DEBUG("Transferring %zu bytes in chunks of %zu bytes, window is %u",
+        size, chunk_size, window);
 
-        /* When doing eager transfers, use self code path to copy data locally
-         */
-        ret = hg_bulk_transfer_self(op, origin_segments, origin_count,
-            origin_offset, local_segments, local_count, local_offset, size,
-            hg_bulk_op_id);
-    } else {
-        struct hg_bulk_na_mem_desc *origin_mem_descs, *local_mem_descs;
-        na_mem_handle_t *origin_mem_handles, *local_mem_handles;
-        na_addr_t na_origin_addr = NA_ADDR_NULL;
+    /* Assign op_id before chunks may complete it */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_bulk_op_id;
 
-#ifdef NA_HAS_SM
-        /* Use SM if we can */
-        if (hg_bulk_origin->desc.info.flags & HG_BULK_SM) {
-            HG_LOG_DEBUG("Using NA SM class for this transfer");
+    /* Issue first chunks, errors are reported to user callback */
+    ret = hg_bulk_pipeline_progress(hg_bulk_pipeline);
+    HG_CHECK_HG_ERROR(done, ret, "Could not progress pipelined transfer");
 
-            hg_bulk_op_id->na_class = hg_bulk_origin->na_sm_class;
-            hg_bulk_op_id->na_context = HG_Core_context_get_na_sm(core_context);
-            na_origin_addr = HG_Core_addr_get_na_sm(origin_addr);
-            origin_mem_descs = &hg_bulk_origin->na_sm_mem_descs;
-            local_mem_descs = &hg_bulk_local->na_sm_mem_descs;
-        } else {
-#endif
-            HG_LOG_DEBUG("Using default NA class for this transfer");
+done:
+    return ret;
 
-            hg_bulk_op_id->na_class = hg_bulk_origin->na_class;
-            hg_bulk_op_id->na_context = HG_Core_context_get_na(core_context);
-            na_origin_addr = HG_Core_addr_get_na(origin_addr);
-            origin_mem_descs = &hg_bulk_origin->na_mem_descs;
-            local_mem_descs = &hg_bulk_local->na_mem_descs;
-#ifdef NA_HAS_SM
+error:
+    if (hg_bulk_pipeline)
+        hg_bulk_pipeline_free(hg_bulk_pipeline);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_pipeline_progress(struct hg_bulk_pipeline *hg_bulk_pipeline)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = hg_bulk_pipeline->op_id;
+    struct hg_bulk *hg_bulk_origin =
+        (struct hg_bulk *) hg_bulk_op_id->callback_info.info.bulk.origin_handle;
+    struct hg_bulk *hg_bulk_local =
+        (struct hg_bulk *) hg_bulk_op_id->callback_info.info.bulk.local_handle;
+    hg_bool_t complete = HG_FALSE;
+    hg_return_t ret = HG_SUCCESS, hg_ret;
+
+    /* Prevent op ID from being released while pipeline is accessed */
+    hg_atomic_incr32(&hg_bulk_op_id->ref_count);
+
+    hg_thread_mutex_lock(&hg_bulk_pipeline->mutex);
+    while (!(hg_atomic_get32(&hg_bulk_op_id->status) &
+               (HG_BULK_OP_CANCELED | HG_BULK_OP_ERRORED)) &&
+           hg_bulk_pipeline->next_offset < hg_bulk_pipeline->size &&
+           hg_bulk_pipeline->in_flight < hg_bulk_pipeline->window) {
+        struct hg_bulk_pipeline_chunk *chunk = NULL;
+        struct hg_bulk_op_id *chunk_op_id = NULL;
+        hg_size_t offset, size;
+        hg_uint32_t gen;
+        unsigned int i;
+
+        /* Reserve free chunk */
+        for (i = 0; i < hg_bulk_pipeline->window; i++) {
+            if (!hg_bulk_pipeline->chunks[i].busy) {
+                chunk = &hg_bulk_pipeline->chunks[i];
+                break;
+            }
         }
-#endif
+        offset = hg_bulk_pipeline->next_offset;
+        size = hg_bulk_pipeline->size - offset;
+        if (size > hg_bulk_pipeline->chunk_size)
+            size = hg_bulk_pipeline->chunk_size;
+        if (hg_bulk_pipeline->block_size > 0) {
+            /* Chunks do not cross block boundaries */
+            hg_size_t block_left = hg_bulk_pipeline->block_size -
+                                   (hg_bulk_pipeline->origin_offset + offset) %
+                                       hg_bulk_pipeline->block_size;
+            if (size > block_left)
+                size = block_left;
+        }
+        chunk->op_id = NULL;
+        chunk->offset = offset;
+        chunk->size = size;
+        chunk->busy = HG_TRUE;
+        gen = ++chunk->gen;
+        hg_bulk_pipeline->next_offset += size;
+        hg_bulk_pipeline->in_flight++;
+        hg_thread_mutex_unlock(&hg_bulk_pipeline->mutex);
+
+        if (hg_bulk_pipeline->block_size > 0)
+            hg_ret = hg_bulk_pipeline_pull(
+                hg_bulk_pipeline, chunk, (hg_op_id_t *) &chunk_op_id);
+        else
+            hg_ret = hg_bulk_transfer(hg_bulk_op_id->core_context,
+                hg_bulk_pipeline_cb, chunk,
+                hg_bulk_op_id->callback_info.info.bulk.op,
+                hg_bulk_pipeline->origin_addr, hg_bulk_pipeline->origin_id,
+                hg_bulk_origin, hg_bulk_pipeline->origin_offset + offset,
+                hg_bulk_local, hg_bulk_pipeline->local_offset + offset, size,
+                (hg_op_id_t *) &chunk_op_id);
+
+        hg_thread_mutex_lock(&hg_bulk_pipeline->mutex);
+        if (hg_ret != HG_SUCCESS) {
+            HG_LOG_ERROR("Could not transfer chunk at offset %zu", offset);
+            hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
+            chunk->busy = HG_FALSE;
+            hg_bulk_pipeline->in_flight--;
+        } else if (chunk->busy && chunk->gen == gen)
+            /* Chunk may have already completed and been re-used */
+            chunk->op_id = chunk_op_id;
+    }
 
-        origin_mem_handles =
-            HG_BULK_MEM_HANDLES(origin_mem_descs, origin_count, origin_flags);
-        local_mem_handles =
-            HG_BULK_MEM_HANDLES(local_mem_descs, local_count, local_flags);
+    /* Complete once no chunk is left in flight */
+    if (hg_bulk_pipeline->in_flight == 0 && !hg_bulk_pipeline->completed &&
+        ((hg_bulk_pipeline->next_offset == hg_bulk_pipeline->size) ||
+            (hg_atomic_get32(&hg_bulk_op_id->status) &
+                (HG_BULK_OP_CANCELED | HG_BULK_OP_ERRORED)))) {
+        hg_bulk_pipeline->completed = HG_TRUE;
+        complete = HG_TRUE;
+    }
+    hg_thread_mutex_unlock(&hg_bulk_pipeline->mutex);
 
-        ret = hg_bulk_transfer_na(op, na_origin_addr, origin_id,
-            origin_segments, origin_count, origin_mem_handles, origin_flags,
-            origin_offset, local_segments, local_count, local_mem_handles,
-            local_flags, local_offset, size, hg_bulk_op_id);
+    if (complete) {
+        ret = hg_bulk_complete(hg_bulk_op_id, HG_TRUE);
+        HG_CHECK_HG_ERROR(done, ret, "Could not complete bulk operation");
     }
 
-    /* Assign op_id */
-    if (op_id && op_id != HG_OP_ID_IGNORE)
-        *op_id = (hg_op_id_t) hg_bulk_op_id;
+done:
+    hg_ret = hg_bulk_op_destroy(hg_bulk_op_id);
+    HG_CHECK_ERROR_DONE(hg_ret != HG_SUCCESS, "Could not destroy op ID");
 
     return ret;
+}
 
-error:
-    if (hg_bulk_op_id) {
-        hg_return_t hg_ret = hg_bulk_op_destroy(hg_bulk_op_id);
-        HG_CHECK_ERROR_DONE(hg_ret != HG_SUCCESS, "Could not destroy op ID");
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_pipeline_pull(struct hg_bulk_pipeline *hg_bulk_pipeline,
+    struct hg_bulk_pipeline_chunk *chunk, hg_op_id_t *op_id)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = hg_bulk_pipeline->op_id;
+    struct hg_bulk_compressed *hg_bulk_compressed =
+        hg_bulk_pipeline->compressed;
+    struct hg_bulk *hg_bulk_origin =
+        (struct hg_bulk *) hg_bulk_op_id->callback_info.info.bulk.origin_handle;
+    hg_size_t block_size = hg_bulk_pipeline->block_size;
+    hg_size_t offset = hg_bulk_pipeline->origin_offset + chunk->offset;
+    hg_uint32_t block = (hg_uint32_t) (offset / block_size);
+    hg_size_t block_len = hg_bulk_origin->desc.info.len - block * block_size;
+    struct hg_bulk *hg_bulk_src = hg_bulk_origin;
+    hg_size_t src_offset = block * block_size, src_len;
+
+    block_len = HG_BULK_MIN(block_len, block_size);
+    src_len = block_len;
+    chunk->block = block;
+
+    if (hg_bulk_compressed) {
+        hg_bulk_src = hg_bulk_compressed->region;
+        src_offset = hg_bulk_compressed->offsets[block];
+        src_len = hg_bulk_compressed->offsets[block + 1] - src_offset;
     }
-    return ret;
+
+    /* Blocks that did not compress are pulled directly, unless only part of
+     * them is needed and the whole block must be verified */
+    chunk->staged = (src_len != block_len) ||
+                    (hg_bulk_pipeline->checksum && chunk->size != block_len);
+    if (!chunk->staged)
+        return hg_bulk_transfer_direct(hg_bulk_op_id->core_context,
+            hg_bulk_pipeline_cb, chunk, HG_BULK_PULL,
+            hg_bulk_pipeline->origin_addr, hg_bulk_pipeline->origin_id,
+            hg_bulk_src, src_offset + offset % block_size,
+            (struct hg_bulk *) hg_bulk_op_id->callback_info.info.bulk
+                .local_handle,
+            hg_bulk_pipeline->local_offset + chunk->offset, chunk->size,
+            op_id);
+
+    /* Whole block is needed to decompress or verify part of it */
+    return hg_bulk_transfer_direct(hg_bulk_op_id->core_context,
+        hg_bulk_pipeline_cb, chunk, HG_BULK_PULL, hg_bulk_pipeline->origin_addr,
+        hg_bulk_pipeline->origin_id, hg_bulk_src, src_offset,
+        hg_bulk_pipeline->staging,
+        (hg_size_t) (chunk - hg_bulk_pipeline->chunks) * block_size, src_len,
+        op_id);
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_transfer_self(hg_bulk_op_t op,
-    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
-    hg_size_t origin_offset, const struct hg_bulk_segment *local_segments,
-    hg_uint32_t local_count, hg_size_t local_offset, hg_size_t size,
-    struct hg_bulk_op_id *hg_bulk_op_id)
+hg_bulk_pipeline_cb(const struct hg_cb_info *callback_info)
 {
-    hg_uint32_t origin_segment_start_index = 0, local_segment_start_index = 0;
-    hg_size_t origin_segment_start_offset = 0, local_segment_start_offset = 0;
-    hg_bulk_copy_op_t copy_op;
-    hg_return_t ret = HG_SUCCESS;
-
-    switch (op) {
-        case HG_BULK_PUSH:
-            copy_op = hg_bulk_memcpy_put;
-            break;
-        case HG_BULK_PULL:
-            copy_op = hg_bulk_memcpy_get;
-            break;
-        default:
-            HG_GOTO_ERROR(done, ret, HG_INVALID_ARG, "Unknown bulk operation");
+    struct hg_bulk_pipeline_chunk *chunk =
+        (struct hg_bulk_pipeline_chunk *) callback_info->arg;
+    struct hg_bulk_pipeline *hg_bulk_pipeline = chunk->pipeline;
+    struct hg_bulk_op_id *hg_bulk_op_id = hg_bulk_pipeline->op_id;
+    hg_return_t ret = HG_SUCCESS, chunk_ret = callback_info->ret;
+
+    if (chunk_ret == HG_SUCCESS && chunk->staged) {
+        chunk_ret = hg_bulk_pipeline_unstage(hg_bulk_pipeline, chunk);
+        if (chunk_ret != HG_SUCCESS)
+            HG_LOG_ERROR(
+                "Could not unstage chunk at offset %zu", chunk->offset);
+    } else if (chunk_ret == HG_SUCCESS && hg_bulk_pipeline->checksum) {
+        /* Whole block was pulled directly into local handle */
+        hg_uint32_t crc = hg_bulk_checksum_compute(
+            (struct hg_bulk *) hg_bulk_op_id->callback_info.info.bulk
+                .local_handle,
+            hg_bulk_pipeline->local_offset + chunk->offset, chunk->size);
+
+        if (crc != hg_bulk_pipeline->checksum->crcs[chunk->block]) {
+            HG_LOG_ERROR("Checksum mismatch for block %u", chunk->block);
+            chunk_ret = HG_CHECKSUM_ERROR;
+        }
     }
 
-    HG_LOG_DEBUG("Transferring data through self");
+    if (chunk_ret == HG_SUCCESS) {
+        if (hg_bulk_pipeline->chunk_callback) {
+            struct hg_cb_info chunk_callback_info = *callback_info;
+            hg_return_t cb_ret;
+
+            /* Pass user arg and handles (staged chunks transfer into
+             * internal handles) */
+            chunk_callback_info.arg = hg_bulk_op_id->callback_info.arg;
+            chunk_callback_info.info.bulk =
+                hg_bulk_op_id->callback_info.info.bulk;
+
+            cb_ret = hg_bulk_pipeline->chunk_callback(
+                &chunk_callback_info, chunk->offset, chunk->size);
+            if (cb_ret != HG_SUCCESS) {
+                HG_LOG_ERROR("Chunk callback returned error");
+                hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
+            }
+        }
+    } else if (chunk_ret == HG_CANCELED)
+        hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_CANCELED);
+    else if (chunk_ret == HG_CHECKSUM_ERROR)
+        hg_atomic_or32(
+            &hg_bulk_op_id->status, HG_BULK_OP_CHECKSUM | HG_BULK_OP_ERRORED);
+    else
+        hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
 
-    /* Translate origin offset */
-    if (origin_offset > 0)
-        hg_bulk_offset_translate(origin_segments, origin_count, origin_offset,
-            &origin_segment_start_index, &origin_segment_start_offset);
+    /* Release chunk */
+    hg_thread_mutex_lock(&hg_bulk_pipeline->mutex);
+    chunk->op_id = NULL;
+    chunk->busy = HG_FALSE;
+    hg_bulk_pipeline->in_flight--;
+    hg_thread_mutex_unlock(&hg_bulk_pipeline->mutex);
 
-    /* Translate local offset */
-    if (local_offset > 0)
-        hg_bulk_offset_translate(local_segments, local_count, local_offset,
-            &local_segment_start_index, &local_segment_start_offset);
+    ret = hg_bulk_pipeline_progress(hg_bulk_pipeline);
+    HG_CHECK_HG_ERROR(done, ret, "Could not progress pipelined transfer");
 
-    /* Do actual transfer */
-    hg_bulk_transfer_segments_self(copy_op, origin_segments, origin_count,
-        origin_segment_start_index, origin_segment_start_offset, local_segments,
-        local_count, local_segment_start_index, local_segment_start_offset,
-        size);
+done:
+    return ret;
+}
 
-    /* Complete immediately */
-    ret = hg_bulk_complete(hg_bulk_op_id, HG_TRUE);
-    HG_CHECK_HG_ERROR(done, ret, "Could not complete bulk operation");
+/*---------------------------------------------------------------------------*/
+static hg_return_t
+hg_bulk_pipeline_unstage(struct hg_bulk_pipeline *hg_bulk_pipeline,
+    struct hg_bulk_pipeline_chunk *chunk)
+{
+    struct hg_bulk_op_id *hg_bulk_op_id = hg_bulk_pipeline->op_id;
+    struct hg_bulk_compressed *hg_bulk_compressed =
+        hg_bulk_pipeline->compressed;
+    struct hg_bulk *hg_bulk_origin =
+        (struct hg_bulk *) hg_bulk_op_id->callback_info.info.bulk.origin_handle;
+    struct hg_bulk *hg_bulk_local =
+        (struct hg_bulk *) hg_bulk_op_id->callback_info.info.bulk.local_handle;
+    const struct hg_bulk_segment *local_segments =
+        HG_BULK_SEGMENTS(hg_bulk_local);
+    hg_size_t block_size = hg_bulk_pipeline->block_size;
+    hg_size_t block_len =
+        hg_bulk_origin->desc.info.len - chunk->block * block_size;
+    hg_size_t local_offset = hg_bulk_pipeline->local_offset + chunk->offset;
+    const char *src =
+        (const char *) hg_bulk_pipeline->staging->desc.segments.s[0].base +
+        (hg_size_t) (chunk - hg_bulk_pipeline->chunks) * block_size;
+    hg_size_t src_len;
+    const void *block_data = src;
+    struct hg_bulk_segment block_segment;
+    hg_uint32_t segment_index;
+    hg_size_t segment_offset;
+    hg_return_t ret = HG_SUCCESS;
+
+    block_len = HG_BULK_MIN(block_len, block_size);
+    src_len = (hg_bulk_compressed)
+                  ? hg_bulk_compressed->offsets[chunk->block + 1] -
+                        hg_bulk_compressed->offsets[chunk->block]
+                  : block_len;
+
+    if (src_len != block_len) {
+        /* Whole block into contiguous local memory is decompressed in place */
+        if (chunk->size == block_len) {
+            hg_size_t dst_len;
+            hg_uint32_t count;
+            void *dst;
+
+            hg_bulk_access(hg_bulk_local, local_offset, chunk->size,
+                HG_BULK_READWRITE, 1, &dst, &dst_len, &count);
+            if (dst_len == chunk->size) {
+                HG_CHECK_ERROR(hg_decompress(src, src_len, dst, block_len) !=
+                                   HG_UTIL_SUCCESS,
+                    done, ret, HG_PROTOCOL_ERROR, "Corrupted block %u",
+                    chunk->block);
+                if (hg_bulk_pipeline->checksum)
+                    HG_CHECK_ERROR(hg_crc32c(0, dst, block_len) !=
+                                       hg_bulk_pipeline->checksum
+                                           ->crcs[chunk->block],
+                        done, ret, HG_CHECKSUM_ERROR,
+                        "Checksum mismatch for block %u", chunk->block);
+                goto done;
+            }
+        }
+
+        if (!chunk->buf) {
+            chunk->buf = malloc(block_size);
+            HG_CHECK_ERROR(chunk->buf == NULL, done, ret, HG_NOMEM,
+                "Could not allocate decompression buffer");
+        }
+        HG_CHECK_ERROR(hg_decompress(src, src_len, chunk->buf, block_len) !=
+                           HG_UTIL_SUCCESS,
+            done, ret, HG_PROTOCOL_ERROR, "Corrupted block %u", chunk->block);
+        block_data = chunk->buf;
+    }
+
+    /* Verify whole block before any of it reaches local handle */
+    if (hg_bulk_pipeline->checksum)
+        HG_CHECK_ERROR(hg_crc32c(0, block_data, block_len) !=
+                           hg_bulk_pipeline->checksum->crcs[chunk->block],
+            done, ret, HG_CHECKSUM_ERROR, "Checksum mismatch for block %u",
+            chunk->block);
+
+    /* Copy range of chunk */
+    block_segment.base = (hg_ptr_t) block_data;
+    block_segment.len = block_len;
+    hg_bulk_offset_translate(local_segments,
+        hg_bulk_local->desc.info.segment_count, local_offset, &segment_index,
+        &segment_offset);
+    hg_bulk_transfer_segments_self(hg_bulk_memcpy_get, &block_segment, 1, 0,
+        (hg_bulk_pipeline->origin_offset + chunk->offset) % block_size,
+        local_segments, hg_bulk_local->desc.info.segment_count, segment_index,
+        segment_offset, chunk->size);
 
 done:
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static void
-hg_bulk_transfer_segments_self(hg_bulk_copy_op_t copy_op,
-    const struct hg_bulk_segment *origin_segments, hg_uint32_t origin_count,
-    hg_size_t origin_segment_start_index, hg_size_t origin_segment_start_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
-    hg_size_t size)
+static hg_return_t
+hg_bulk_pipeline_cancel(struct hg_bulk_pipeline *hg_bulk_pipeline)
 {
-    hg_size_t origin_segment_index = origin_segment_start_index;
-    hg_size_t local_segment_index = local_segment_start_index;
-    hg_size_t origin_segment_offset = origin_segment_start_offset;
-    hg_size_t local_segment_offset = local_segment_start_offset;
-    hg_size_t remaining_size = size;
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
 
-    while (remaining_size > 0 && origin_segment_index < origin_count &&
-           local_segment_index < local_count) {
-        /* Can only transfer smallest size */
-        hg_size_t transfer_size = HG_BULK_MIN(
-            (origin_segments[origin_segment_index].len - origin_segment_offset),
-            (local_segments[local_segment_index].len - local_segment_offset));
+    /* Chunk op IDs cannot be released while lock is held */
+    hg_thread_mutex_lock(&hg_bulk_pipeline->mutex);
+    for (i = 0; i < hg_bulk_pipeline->window; i++) {
+        struct hg_bulk_pipeline_chunk *chunk = &hg_bulk_pipeline->chunks[i];
 
-        /* Remaining size may be smaller */
-        transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
+        if (!chunk->busy || chunk->op_id == NULL)
+            continue;
 
-        /* Copy segment */
-        copy_op(local_segments[local_segment_index].base, local_segment_offset,
-            origin_segments[origin_segment_index].base, origin_segment_offset,
-            transfer_size);
+        ret = hg_bulk_cancel(chunk->op_id);
+        HG_CHECK_HG_ERROR(unlock, ret, "Could not cancel chunk");
+    }
 
-        /* Decrease remaining size from the size of data we transferred
-         * and exit if everything has been transferred */
-        remaining_size -= transfer_size;
-        if (remaining_size == 0)
-            break;
+unlock:
+    hg_thread_mutex_unlock(&hg_bulk_pipeline->mutex);
 
-        /* Increment offsets from the size of data we transferred */
-        origin_segment_offset += transfer_size;
-        local_segment_offset += transfer_size;
+    return ret;
+}
 
-        /* Change segment if new offset exceeds segment size */
-        if (origin_segment_offset >=
-            origin_segments[origin_segment_index].len) {
-            origin_segment_index++;
-            origin_segment_offset = 0;
-        }
-        if (local_segment_offset >= local_segments[local_segment_index].len) {
-            local_segment_index++;
-            local_segment_offset = 0;
-        }
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_pipeline_free(struct hg_bulk_pipeline *hg_bulk_pipeline)
+{
+    if (hg_bulk_pipeline->origin_addr) {
+        hg_return_t ret = HG_Core_addr_free(hg_bulk_pipeline->origin_addr);
+        HG_CHECK_ERROR_DONE(ret != HG_SUCCESS, "Could not free origin address");
+    }
+    if (hg_bulk_pipeline->staging) {
+        hg_return_t ret = hg_bulk_free(hg_bulk_pipeline->staging);
+        HG_CHECK_ERROR_DONE(ret != HG_SUCCESS, "Could not free staging handle");
+    }
+    if (hg_bulk_pipeline->chunks) {
+        unsigned int i;
+
+        for (i = 0; i < hg_bulk_pipeline->window; i++)
+            free(hg_bulk_pipeline->chunks[i].buf);
     }
+    hg_thread_mutex_destroy(&hg_bulk_pipeline->mutex);
+    free(hg_bulk_pipeline->chunks);
+    free(hg_bulk_pipeline);
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_transfer_na(hg_bulk_op_t op, na_addr_t na_origin_addr,
-    hg_uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
-    hg_uint32_t origin_count, na_mem_handle_t *origin_mem_handles,
-    hg_uint8_t origin_flags, hg_size_t origin_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    na_mem_handle_t *local_mem_handles, hg_uint8_t local_flags,
-    hg_size_t local_offset, hg_size_t size, struct hg_bulk_op_id *hg_bulk_op_id)
+hg_bulk_transfer_batch(hg_core_context_t *core_context, hg_cb_t callback,
+    void *arg, hg_bulk_op_t op, const struct hg_bulk_transfer_desc *descs,
+    hg_uint32_t count, hg_op_id_t *op_id)
 {
-    hg_bulk_na_op_id_t *hg_bulk_na_op_ids;
+    struct hg_bulk_op_id *hg_bulk_op_id = NULL;
+    struct hg_bulk_op_pool *hg_bulk_op_pool =
+        hg_core_context_get_bulk_op_pool(core_context);
+    hg_bulk_na_op_id_t *hg_bulk_na_op_ids = NULL;
     na_bulk_op_t na_bulk_op;
+    hg_bulk_copy_op_t copy_op;
+    hg_uint32_t op_count = 0, issued_count = 0, i;
     hg_return_t ret = HG_SUCCESS;
 
-    /* Map op to NA op */
+    /* Map op to copy and NA ops */
     switch (op) {
         case HG_BULK_PUSH:
+            copy_op = hg_bulk_memcpy_put;
             na_bulk_op = hg_bulk_na_put;
             break;
         case HG_BULK_PULL:
+            copy_op = hg_bulk_memcpy_get;
             na_bulk_op = hg_bulk_na_get;
             break;
         default:
-            HG_GOTO_ERROR(done, ret, HG_INVALID_ARG, "Unknown bulk operation");
+            HG_GOTO_ERROR(error, ret, HG_INVALID_ARG, "Unknown bulk operation");
     }
 
-#ifdef NA_HAS_SM
-    /* Use NA SM op IDs if needed */
-    if (origin_flags & HG_BULK_SM)
-        hg_bulk_na_op_ids = &hg_bulk_op_id->na_sm_op_ids;
-    else
-#endif
-        hg_bulk_na_op_ids = &hg_bulk_op_id->na_op_ids;
-
-    if (((origin_flags & HG_BULK_REGV) || origin_count == 1) &&
-        ((local_flags & HG_BULK_REGV) || local_count == 1)) {
-        na_return_t na_ret;
-
-        HG_LOG_DEBUG("Transferring data through NA in single operation");
-
-        na_ret = na_bulk_op(hg_bulk_op_id->na_class, hg_bulk_op_id->na_context,
-            hg_bulk_transfer_cb, hg_bulk_op_id, local_mem_handles[0],
-            local_offset, origin_mem_handles[0], origin_offset, size,
-            na_origin_addr, origin_id, hg_bulk_na_op_ids->s[0]);
-        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
-            "Could not transfer data (%s)", NA_Error_to_string(na_ret));
+    /* Get a new OP ID from context */
+    if (hg_bulk_op_pool) {
+        ret = hg_bulk_op_pool_get(hg_bulk_op_pool, &hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(error, ret, "Could not get bulk op ID");
     } else {
-        hg_uint32_t origin_segment_start_index = 0,
-                    local_segment_start_index = 0;
-        hg_size_t origin_segment_start_offset = 0,
-                  local_segment_start_offset = 0;
-        na_op_id_t **na_op_ids;
-
-        /* Translate bulk_offset */
-        if (origin_offset > 0)
-            hg_bulk_offset_translate(origin_segments, origin_count,
-                origin_offset, &origin_segment_start_index,
-                &origin_segment_start_offset);
-
-        /* Translate block offset */
-        if (local_offset > 0)
-            hg_bulk_offset_translate(local_segments, local_count, local_offset,
-                &local_segment_start_index, &local_segment_start_offset);
-
-        /* Determine number of NA operations that will be needed */
-        hg_bulk_op_id->op_count = hg_bulk_transfer_get_op_count(origin_segments,
-            origin_count, origin_segment_start_index,
-            origin_segment_start_offset, local_segments, local_count,
-            local_segment_start_index, local_segment_start_offset, size);
-        HG_CHECK_ERROR(hg_bulk_op_id->op_count == 0, done, ret, HG_INVALID_ARG,
-            "Could not get bulk op_count");
-
-        HG_LOG_DEBUG("Transferring data through NA in %u operation(s)",
-            hg_bulk_op_id->op_count);
-
-        /* Create extra operation IDs if the number of operations exceeds
-         * the number of pre-allocated op IDs */
-        if (hg_bulk_op_id->op_count > HG_BULK_STATIC_MAX) {
-            unsigned int i;
-
-            /* Allocate memory for NA operation IDs */
-            hg_bulk_na_op_ids->d =
-                malloc(sizeof(na_op_id_t *) * hg_bulk_op_id->op_count);
-            HG_CHECK_ERROR(hg_bulk_na_op_ids->d == NULL, done, ret, HG_NOMEM,
-                "Could not allocate memory for op_ids");
-
-            for (i = 0; i < hg_bulk_op_id->op_count; i++) {
-                hg_bulk_na_op_ids->d[i] = NA_Op_create(hg_bulk_op_id->na_class);
-                HG_CHECK_ERROR(hg_bulk_na_op_ids->d[i] == NULL, done, ret,
-                    HG_NA_ERROR, "Could not create NA op ID");
-            }
-
-            na_op_ids = hg_bulk_na_op_ids->d;
-        } else
-            na_op_ids = hg_bulk_na_op_ids->s;
-
-        /* Do actual transfer */
-        ret = hg_bulk_transfer_segments_na(hg_bulk_op_id->na_class,
-            hg_bulk_op_id->na_context, na_bulk_op, hg_bulk_transfer_cb,
-            hg_bulk_op_id, na_origin_addr, origin_id, origin_segments,
-            origin_count, origin_mem_handles, origin_segment_start_index,
-            origin_segment_start_offset, local_segments, local_count,
-            local_mem_handles, local_segment_start_index,
-            local_segment_start_offset, size, na_op_ids,
-            hg_bulk_op_id->op_count);
-        HG_CHECK_HG_ERROR(done, ret, "Could not transfer data segments");
+        ret = hg_bulk_op_create(core_context, &hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(error, ret, "Could not create bulk op ID");
     }
 
-done:
-    return ret;
-}
-
-/*---------------------------------------------------------------------------*/
-static hg_uint32_t
-hg_bulk_transfer_get_op_count(const struct hg_bulk_segment *origin_segments,
-    hg_uint32_t origin_count, hg_size_t origin_segment_start_index,
-    hg_size_t origin_segment_start_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    hg_size_t local_segment_start_index, hg_size_t local_segment_start_offset,
-    hg_size_t size)
-{
-    hg_size_t origin_segment_index = origin_segment_start_index;
-    hg_size_t local_segment_index = local_segment_start_index;
-    hg_size_t origin_segment_offset = origin_segment_start_offset;
-    hg_size_t local_segment_offset = local_segment_start_offset;
-    hg_size_t remaining_size = size;
-    hg_uint32_t count = 0;
-
-    while (remaining_size > 0 && origin_segment_index < origin_count &&
-           local_segment_index < local_count) {
-        /* Can only transfer smallest size */
-        hg_size_t transfer_size = HG_BULK_MIN(
-            (origin_segments[origin_segment_index].len - origin_segment_offset),
-            (local_segments[local_segment_index].len - local_segment_offset));
-
-        /* Remaining size may be smaller */
-        transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
-
-        /* Increment op count */
-        count++;
-
-        /* Decrease remaining size from the size of data we transferred
-         * and exit if everything has been transferred */
-        remaining_size -= transfer_size;
-        if (remaining_size == 0)
-            break;
+    hg_bulk_op_id->callback = callback;
+    hg_bulk_op_id->callback_info.arg = arg;
+    hg_bulk_op_id->callback_info.info.bulk.origin_handle = HG_BULK_NULL;
+    hg_bulk_op_id->callback_info.info.bulk.local_handle = HG_BULK_NULL;
+    hg_bulk_op_id->callback_info.info.bulk.op = op;
+    hg_bulk_op_id->na_class = NULL;
+    hg_bulk_op_id->na_context = NULL;
 
-        /* Increment offsets from the size of data we transferred */
-        origin_segment_offset += transfer_size;
-        local_segment_offset += transfer_size;
+    /* Keep a copy of descriptors with resolved addresses, handles are
+     * released once the batch is destroyed */
+    hg_bulk_op_id->batch = (struct hg_bulk_transfer_desc *) malloc(
+        count * sizeof(struct hg_bulk_transfer_desc));
+    HG_CHECK_ERROR(hg_bulk_op_id->batch == NULL, error, ret, HG_NOMEM,
+        "Could not allocate batch descriptors");
 
-        /* Change segment if new offset exceeds segment size */
-        if (origin_segment_offset >=
-            origin_segments[origin_segment_index].len) {
-            origin_segment_index++;
-            origin_segment_offset = 0;
+    for (i = 0; i < count; i++) {
+        struct hg_bulk_transfer_desc *desc = &hg_bulk_op_id->batch[i];
+        struct hg_bulk *hg_bulk_origin =
+            (struct hg_bulk *) descs[i].origin_handle;
+
+        *desc = descs[i];
+        if (hg_bulk_origin->addr != HG_CORE_ADDR_NULL) {
+            desc->origin_addr = (hg_addr_t) hg_bulk_origin->addr;
+            desc->origin_id = hg_bulk_origin->context_id;
         }
-        if (local_segment_offset >= local_segments[local_segment_index].len) {
-            local_segment_index++;
-            local_segment_offset = 0;
+        hg_atomic_incr32(&hg_bulk_origin->ref_count);
+        hg_atomic_incr32(&((struct hg_bulk *) desc->local_handle)->ref_count);
+        hg_bulk_op_id->batch_count++;
+    }
+
+    /* Count NA operations, all transfers that are not local must go through
+     * the same NA class */
+    for (i = 0; i < count; i++) {
+        const struct hg_bulk_transfer_desc *desc = &hg_bulk_op_id->batch[i];
+        struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) desc->origin_handle;
+        na_class_t *na_class;
+        na_context_t *na_context;
+
+        if (desc->size == 0 || hg_bulk_transfer_batch_is_local(op, desc))
+            continue;
+
+#ifdef NA_HAS_SM
+        if (hg_bulk_origin->desc.info.flags & HG_BULK_SM) {
+            na_class = hg_bulk_origin->na_sm_class;
+            na_context = HG_Core_context_get_na_sm(core_context);
+            hg_bulk_na_op_ids = &hg_bulk_op_id->na_sm_op_ids;
+        } else {
+#endif
+            na_class = hg_bulk_origin->na_class;
+            na_context = HG_Core_context_get_na(core_context);
+            hg_bulk_na_op_ids = &hg_bulk_op_id->na_op_ids;
+#ifdef NA_HAS_SM
         }
+#endif
+        HG_CHECK_ERROR(hg_bulk_op_id->na_class != NULL &&
+                           hg_bulk_op_id->na_class != na_class,
+            error, ret, HG_INVALID_ARG,
+            "Transfers of a batch must all use the same NA class");
+        hg_bulk_op_id->na_class = na_class;
+        hg_bulk_op_id->na_context = na_context;
+
+        op_count += hg_bulk_transfer_batch_get_op_count(desc);
     }
 
-    return count;
-}
+    /* Reset status */
+    hg_atomic_set32(&hg_bulk_op_id->status, 0);
 
-/*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_bulk_transfer_segments_na(na_class_t *na_class, na_context_t *na_context,
-    na_bulk_op_t na_bulk_op, na_cb_t callback, void *arg, na_addr_t origin_addr,
-    na_uint8_t origin_id, const struct hg_bulk_segment *origin_segments,
-    hg_uint32_t origin_count, na_mem_handle_t *origin_mem_handles,
-    hg_size_t origin_segment_start_index, hg_size_t origin_segment_start_offset,
-    const struct hg_bulk_segment *local_segments, hg_uint32_t local_count,
-    na_mem_handle_t *local_mem_handles, hg_size_t local_segment_start_index,
-    hg_size_t local_segment_start_offset, hg_size_t size,
-    na_op_id_t *na_op_ids[], hg_uint32_t na_op_count)
-{
-    hg_size_t origin_segment_index = origin_segment_start_index;
-    hg_size_t local_segment_index = local_segment_start_index;
-    hg_size_t origin_segment_offset = origin_segment_start_offset;
-    hg_size_t local_segment_offset = local_segment_start_offset;
-    hg_size_t remaining_size = size;
-    hg_uint32_t count = 0;
-    hg_return_t ret = HG_SUCCESS;
+    /* Expected op count */
+    hg_bulk_op_id->op_count = op_count;
+    hg_atomic_set32(&hg_bulk_op_id->op_completed_count, 0);
 
-    while (remaining_size > 0 && origin_segment_index < origin_count &&
-           local_segment_index < local_count) {
-        /* Can only transfer smallest size */
-        hg_size_t transfer_size = HG_BULK_MIN(
-            (origin_segments[origin_segment_index].len - origin_segment_offset),
-            (local_segments[local_segment_index].len - local_segment_offset));
-        na_return_t na_ret;
+    HG_LOG_DEBUG("Transferring batch of %u transfer(s) in %u NA operation(s)",
+        count, op_count);
 
-        /* Remaining size may be smaller */
-        transfer_size = HG_BULK_MIN(remaining_size, transfer_size);
+    /* Issue operations within a window of pre-allocated op IDs if the
+     * number of operations exceeds the number of static op IDs */
+    if (op_count > HG_BULK_STATIC_MAX) {
+        ret = hg_bulk_na_window_init(hg_bulk_op_id);
+        HG_CHECK_HG_ERROR(error, ret, "Could not initialize window");
+    }
 
-        na_ret = na_bulk_op(na_class, na_context, callback, arg,
-            local_mem_handles[local_segment_index], local_segment_offset,
-            origin_mem_handles[origin_segment_index], origin_segment_offset,
-            transfer_size, origin_addr, origin_id, na_op_ids[count]);
-        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
-            "Could not transfer data (%s)", NA_Error_to_string(na_ret));
+    /* Copy local data first so that it is in place once the last NA
+     * operation completes */
+    for (i = 0; i < count; i++) {
+        const struct hg_bulk_transfer_desc *desc = &hg_bulk_op_id->batch[i];
 
-        count++;
+        if (desc->size > 0 && hg_bulk_transfer_batch_is_local(op, desc))
+            hg_bulk_transfer_batch_self(copy_op, desc);
+    }
 
-        /* Decrease remaining size from the size of data we transferred
-         * and exit if everything has been transferred */
-        remaining_size -= transfer_size;
-        if (remaining_size == 0)
-            break;
+    if (op_count == 0) {
+        /* Complete immediately */
+        ret = hg_bulk_complete(hg_bulk_op_id, HG_TRUE);
+        HG_CHECK_HG_ERROR(error, ret, "Could not complete bulk operation");
+    } else if (op_count > HG_BULK_STATIC_MAX) {
+        ret = hg_bulk_na_window_start(
+            hg_bulk_op_id, na_bulk_op, hg_bulk_op_id->batch, count);
+        HG_CHECK_HG_ERROR(error, ret, "Could not start batch");
+    } else {
+        ret = hg_bulk_na_op_ids_create(
+            hg_bulk_op_id, hg_bulk_na_op_ids, op_count);
+        HG_CHECK_HG_ERROR(error, ret, "Could not create NA op IDs");
 
-        /* Increment offsets from the size of data we transferred */
-        origin_segment_offset += transfer_size;
-        local_segment_offset += transfer_size;
+        for (i = 0; i < count && issued_count < op_count; i++) {
+            const struct hg_bulk_transfer_desc *desc = &hg_bulk_op_id->batch[i];
+            hg_uint32_t desc_op_count, desc_issued_count = 0;
 
-        /* Change segment if new offset exceeds segment size */
-        if (origin_segment_offset >=
-            origin_segments[origin_segment_index].len) {
-            origin_segment_index++;
-            origin_segment_offset = 0;
+            if (desc->size == 0 || hg_bulk_transfer_batch_is_local(op, desc))
+                continue;
+
+            desc_op_count = hg_bulk_transfer_batch_get_op_count(desc);
+            ret = hg_bulk_transfer_batch_na(hg_bulk_op_id, na_bulk_op, desc,
+                &hg_bulk_na_op_ids->s[issued_count], desc_op_count,
+                &desc_issued_count);
+            issued_count += desc_issued_count;
+            if (ret != HG_SUCCESS) {
+                HG_LOG_ERROR("Could not transfer data of batch (%d)", ret);
+                break;
+            }
         }
-        if (local_segment_offset >= local_segments[local_segment_index].len) {
-            local_segment_index++;
-            local_segment_offset = 0;
+
+        /* Operations that could not be issued are accounted as completed
+         * and the error is reported to user callback */
+        if (issued_count < op_count) {
+            hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
+            for (i = issued_count; i < op_count; i++) {
+                if ((hg_uint32_t) hg_atomic_incr32(
+                        &hg_bulk_op_id->op_completed_count) == op_count) {
+                    ret = hg_bulk_complete(hg_bulk_op_id, HG_TRUE);
+                    HG_CHECK_HG_ERROR(
+                        done, ret, "Could not complete bulk operation");
+                }
+            }
+            ret = HG_SUCCESS;
         }
     }
 
-    HG_CHECK_ERROR(count != na_op_count, done, ret, HG_PROTOCOL_ERROR,
-        "Expected %u operations, issued %u", na_op_count, count);
-
 done:
+    /* Assign op_id */
+    if (op_id && op_id != HG_OP_ID_IGNORE)
+        *op_id = (hg_op_id_t) hg_bulk_op_id;
+
+    return ret;
+
+error:
+    if (hg_bulk_op_id) {
+        hg_return_t hg_ret = hg_bulk_op_destroy(hg_bulk_op_id);
+        HG_CHECK_ERROR_DONE(hg_ret != HG_SUCCESS, "Could not destroy op ID");
+    }
     return ret;
 }
 
 /*---------------------------------------------------------------------------*/
-static int
-hg_bulk_transfer_cb(const struct na_cb_info *callback_info)
+static HG_INLINE hg_bool_t
+hg_bulk_transfer_batch_is_local(
+    hg_bulk_op_t op, const struct hg_bulk_transfer_desc *desc)
 {
-    struct hg_bulk_op_id *hg_bulk_op_id =
-        (struct hg_bulk_op_id *) callback_info->arg;
-    hg_bool_t completed = HG_TRUE;
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) desc->origin_handle;
 
-    /* If canceled, mark handle as canceled */
-    if (callback_info->ret == NA_CANCELED) {
-        HG_CHECK_WARNING(
-            hg_atomic_get32(&hg_bulk_op_id->status) & HG_BULK_OP_COMPLETED,
-            "Operation was completed");
-        HG_LOG_DEBUG("NA_CANCELED event on op ID %p", hg_bulk_op_id);
-        HG_CHECK_WARNING(
-            !(hg_atomic_get32(&hg_bulk_op_id->status) & HG_BULK_OP_CANCELED),
-            "Received NA_CANCELED event on op ID that was not canceled");
-    } else if (callback_info->ret != NA_SUCCESS) {
-        HG_LOG_ERROR("NA callback returned error (%s)",
-            NA_Error_to_string(callback_info->ret));
+    /* When doing eager transfers, use self code path to copy data locally */
+    return HG_Core_addr_is_self((hg_core_addr_t) desc->origin_addr) ||
+           ((hg_bulk_origin->desc.info.flags & HG_BULK_EAGER) &&
+               (op != HG_BULK_PUSH));
+}
 
-        /* Mark handle as errored */
-        hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_ERRORED);
-    }
+/*---------------------------------------------------------------------------*/
+static hg_uint32_t
+hg_bulk_transfer_batch_get_op_count(const struct hg_bulk_transfer_desc *desc)
+{
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) desc->origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) desc->local_handle;
+    hg_uint32_t origin_count = hg_bulk_origin->desc.info.segment_count,
+                local_count = hg_bulk_local->desc.info.segment_count;
+    hg_uint32_t origin_segment_start_index = 0, local_segment_start_index = 0;
+    hg_size_t origin_segment_start_offset = 0, local_segment_start_offset = 0;
 
-    /* When all NA transfers that correspond to bulk operation complete
-     * add HG user callback to completion queue
-     */
-    if ((hg_uint32_t) hg_atomic_incr32(&hg_bulk_op_id->op_completed_count) ==
-        hg_bulk_op_id->op_count) {
-        hg_return_t ret = hg_bulk_complete(hg_bulk_op_id, HG_FALSE);
-        HG_CHECK_ERROR_DONE(ret != HG_SUCCESS, "Could not complete operation");
-    }
+    if (((hg_bulk_origin->desc.info.flags & HG_BULK_REGV) ||
+            origin_count == 1) &&
+        ((hg_bulk_local->desc.info.flags & HG_BULK_REGV) || local_count == 1))
+        return 1;
+
+    if (desc->origin_offset > 0)
+        hg_bulk_offset_translate(HG_BULK_SEGMENTS(hg_bulk_origin),
+            origin_count, desc->origin_offset, &origin_segment_start_index,
+            &origin_segment_start_offset);
+    if (desc->local_offset > 0)
+        hg_bulk_offset_translate(HG_BULK_SEGMENTS(hg_bulk_local), local_count,
+            desc->local_offset, &local_segment_start_index,
+            &local_segment_start_offset);
+
+    return hg_bulk_transfer_get_op_count(HG_BULK_SEGMENTS(hg_bulk_origin),
+        origin_count, origin_segment_start_index, origin_segment_start_offset,
+        HG_BULK_SEGMENTS(hg_bulk_local), local_count,
+        local_segment_start_index, local_segment_start_offset, desc->size);
+}
 
-    return (int) completed;
+/*---------------------------------------------------------------------------*/
+static void
+hg_bulk_transfer_batch_self(
+    hg_bulk_copy_op_t copy_op, const struct hg_bulk_transfer_desc *desc)
+{
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) desc->origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) desc->local_handle;
+    hg_uint32_t origin_count = hg_bulk_origin->desc.info.segment_count,
+                local_count = hg_bulk_local->desc.info.segment_count;
+    hg_uint32_t origin_segment_start_index = 0, local_segment_start_index = 0;
+    hg_size_t origin_segment_start_offset = 0, local_segment_start_offset = 0;
+
+    if (desc->origin_offset > 0)
+        hg_bulk_offset_translate(HG_BULK_SEGMENTS(hg_bulk_origin),
+            origin_count, desc->origin_offset, &origin_segment_start_index,
+            &origin_segment_start_offset);
+    if (desc->local_offset > 0)
+        hg_bulk_offset_translate(HG_BULK_SEGMENTS(hg_bulk_local), local_count,
+            desc->local_offset, &local_segment_start_index,
+            &local_segment_start_offset);
+
+    hg_bulk_transfer_segments_self(copy_op, HG_BULK_SEGMENTS(hg_bulk_origin),
+        origin_count, origin_segment_start_index, origin_segment_start_offset,
+        HG_BULK_SEGMENTS(hg_bulk_local), local_count,
+        local_segment_start_index, local_segment_start_offset, desc->size);
 }
 
 /*---------------------------------------------------------------------------*/
 static hg_return_t
-hg_bulk_complete(struct hg_bulk_op_id *hg_bulk_op_id, hg_bool_t self_notify)
+hg_bulk_transfer_batch_na(struct hg_bulk_op_id *hg_bulk_op_id,
+    na_bulk_op_t na_bulk_op, const struct hg_bulk_transfer_desc *desc,
+    na_op_id_t *na_op_ids[], hg_uint32_t na_op_count,
+    hg_uint32_t *issued_count_ptr)
 {
-    struct hg_cb_info *callback_info = NULL;
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) desc->origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) desc->local_handle;
+    hg_uint32_t origin_count = hg_bulk_origin->desc.info.segment_count,
+                local_count = hg_bulk_local->desc.info.segment_count;
+    uint8_t origin_flags = hg_bulk_origin->desc.info.flags;
+    uint8_t local_flags = hg_bulk_local->desc.info.flags;
+    struct hg_bulk_na_mem_desc *origin_mem_descs, *local_mem_descs;
+    na_mem_handle_t *origin_mem_handles, *local_mem_handles;
+    na_addr_t na_origin_addr;
     hg_return_t ret = HG_SUCCESS;
-    hg_util_int32_t status;
 
-    /* Mark op id as completed before checking for cancelation */
-    status = hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_COMPLETED);
+#ifdef NA_HAS_SM
+    if (origin_flags & HG_BULK_SM) {
+        na_origin_addr =
+            HG_Core_addr_get_na_sm((hg_core_addr_t) desc->origin_addr);
+        origin_mem_descs = &hg_bulk_origin->na_sm_mem_descs;
+        local_mem_descs = &hg_bulk_local->na_sm_mem_descs;
+    } else {
+#endif
+        na_origin_addr =
+            HG_Core_addr_get_na((hg_core_addr_t) desc->origin_addr);
+        origin_mem_descs = &hg_bulk_origin->na_mem_descs;
+        local_mem_descs = &hg_bulk_local->na_mem_descs;
+#ifdef NA_HAS_SM
+    }
+#endif
 
-    /* Init callback info */
-    callback_info = &hg_bulk_op_id->callback_info;
+    origin_mem_handles =
+        HG_BULK_MEM_HANDLES(origin_mem_descs, origin_count, origin_flags);
+    local_mem_handles =
+        HG_BULK_MEM_HANDLES(local_mem_descs, local_count, local_flags);
 
-    /* Check for current status before completing */
-    if (status & HG_BULK_OP_CANCELED) {
-        /* If it was canceled while being processed, set callback ret
-         * accordingly */
-        HG_LOG_DEBUG("Operation ID %p is canceled", hg_bulk_op_id);
-        callback_info->ret = HG_CANCELED;
-    } else if (status & HG_BULK_OP_ERRORED) {
-        /* If it was errored, set callback ret accordingly */
-        HG_LOG_DEBUG("Operation ID %p is errored", hg_bulk_op_id);
-        callback_info->ret = HG_PROTOCOL_ERROR;
-    } else
-        callback_info->ret = HG_SUCCESS;
+    if (((origin_flags & HG_BULK_REGV) || origin_count == 1) &&
+        ((local_flags & HG_BULK_REGV) || local_count == 1)) {
+        na_return_t na_ret;
 
-    if (callback_info->info.bulk.origin_handle->desc.info.flags &
-        HG_BULK_EAGER) {
-        /* In the case of eager bulk transfer, directly trigger the operation
-         * to avoid potential deadlocks */
-        ret = hg_bulk_trigger_entry(hg_bulk_op_id);
-        HG_CHECK_HG_ERROR(done, ret, "Could not trigger completion entry");
+        *issued_count_ptr = 0;
+        na_ret = na_bulk_op(hg_bulk_op_id->na_class, hg_bulk_op_id->na_context,
+            hg_bulk_transfer_cb, hg_bulk_op_id, local_mem_handles[0],
+            hg_bulk_local->mem_offset + desc->local_offset,
+            origin_mem_handles[0],
+            hg_bulk_origin->mem_offset + desc->origin_offset, desc->size,
+            na_origin_addr, desc->origin_id, na_op_ids[0]);
+        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
+            "Could not transfer data (%s)", NA_Error_to_string(na_ret));
+        *issued_count_ptr = 1;
     } else {
-        struct hg_completion_entry *hg_completion_entry =
-            &hg_bulk_op_id->hg_completion_entry;
+        hg_uint32_t origin_segment_start_index = 0,
+                    local_segment_start_index = 0;
+        hg_size_t origin_segment_start_offset = 0,
+                  local_segment_start_offset = 0;
 
-        hg_completion_entry->op_type = HG_BULK;
-        hg_completion_entry->op_id.hg_bulk_op_id = hg_bulk_op_id;
+        if (desc->origin_offset > 0)
+            hg_bulk_offset_translate(HG_BULK_SEGMENTS(hg_bulk_origin),
+                origin_count, desc->origin_offset, &origin_segment_start_index,
+                &origin_segment_start_offset);
+        if (desc->local_offset > 0)
+            hg_bulk_offset_translate(HG_BULK_SEGMENTS(hg_bulk_local),
+                local_count, desc->local_offset, &local_segment_start_index,
+                &local_segment_start_offset);
 
-        ret = hg_core_completion_add(
-            hg_bulk_op_id->core_context, hg_completion_entry, self_notify);
-        HG_CHECK_HG_ERROR(
-            done, ret, "Could not add HG completion entry to completion queue");
+        ret = hg_bulk_transfer_segments_na(hg_bulk_op_id->na_class,
+            hg_bulk_op_id->na_context, na_bulk_op, hg_bulk_transfer_cb,
+            hg_bulk_op_id, na_origin_addr, desc->origin_id,
+            HG_BULK_SEGMENTS(hg_bulk_origin), origin_count, origin_mem_handles,
+            hg_bulk_origin->mem_offset, origin_segment_start_index,
+            origin_segment_start_offset, HG_BULK_SEGMENTS(hg_bulk_local),
+            local_count, local_mem_handles, hg_bulk_local->mem_offset,
+            local_segment_start_index, local_segment_start_offset, desc->size,
+            na_op_ids, na_op_count, issued_count_ptr);
+        HG_CHECK_HG_ERROR(done, ret, "Could not transfer data segments");
     }
 
 done:
@@ -2425,34 +7102,26 @@ done:
 }
 
 /*---------------------------------------------------------------------------*/
-static hg_return_t
-hg_bulk_cancel(struct hg_bulk_op_id *hg_bulk_op_id)
+hg_return_t
+hg_bulk_trigger_entry(struct hg_bulk_op_id *hg_bulk_op_id)
 {
-    na_op_id_t **na_op_ids;
     hg_return_t ret = HG_SUCCESS;
-    hg_util_int32_t status;
-    unsigned int i;
 
-    /* Exit if op has already completed */
-    status = hg_atomic_or32(&hg_bulk_op_id->status, HG_BULK_OP_CANCELED);
-    if ((status & HG_BULK_OP_COMPLETED) || (status & HG_BULK_OP_ERRORED))
-        goto done;
+    /* Execute callback */
+    if (hg_bulk_op_id->callback)
+        hg_bulk_op_id->callback(&hg_bulk_op_id->callback_info);
 
-        /* Cancel all NA operations issued */
-#ifdef NA_HAS_SM
-    if (hg_bulk_op_id->na_class ==
-        hg_bulk_op_id->core_context->core_class->na_sm_class)
-        na_op_ids = HG_BULK_NA_SM_OP_IDS(hg_bulk_op_id);
-    else
-#endif
-        na_op_ids = HG_BULK_NA_OP_IDS(hg_bulk_op_id);
+    /* Decrement ref_count */
+    ret = hg_bulk_free(hg_bulk_op_id->callback_info.info.bulk.origin_handle);
+    HG_CHECK_HG_ERROR(done, ret, "Could not free origin handle");
 
-    for (i = 0; i < hg_bulk_op_id->op_count; i++) {
-        na_return_t na_ret = NA_Cancel(
-            hg_bulk_op_id->na_class, hg_bulk_op_id->na_context, na_op_ids[i]);
-        HG_CHECK_ERROR(na_ret != NA_SUCCESS, done, ret, (hg_return_t) na_ret,
-            "Could not cancel NA op ID (%s)", NA_Error_to_string(na_ret));
-    }
+    ret = hg_bulk_free(hg_bulk_op_id->callback_info.info.bulk.local_handle);
+    HG_CHECK_HG_ERROR(done, ret, "Could not free local handle");
+
+    /* Release bulk op ID (can be released after callback execution since
+     * op IDs are managed internally) */
+    ret = hg_bulk_op_destroy(hg_bulk_op_id);
+    HG_CHECK_HG_ERROR(done, ret, "Could not destroy bulk op ID");
 
 done:
     return ret;
@@ -2460,25 +7129,36 @@ done:
 
 /*---------------------------------------------------------------------------*/
 hg_return_t
-hg_bulk_trigger_entry(struct hg_bulk_op_id *hg_bulk_op_id)
+HG_Bulk_create(hg_class_t *hg_class, hg_uint32_t count, void **buf_ptrs,
+    const hg_size_t *buf_sizes, hg_uint8_t flags, hg_bulk_t *handle)
 {
     hg_return_t ret = HG_SUCCESS;
 
-    /* Execute callback */
-    if (hg_bulk_op_id->callback)
-        hg_bulk_op_id->callback(&hg_bulk_op_id->callback_info);
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+    HG_CHECK_ERROR(
+        count == 0, done, ret, HG_INVALID_ARG, "Invalid number of segments");
+    HG_CHECK_ERROR(buf_sizes == NULL, done, ret, HG_INVALID_ARG,
+        "NULL segment size pointer");
+    /* We allow for 0-sized segments though. */
 
-    /* Decrement ref_count */
-    ret = hg_bulk_free(hg_bulk_op_id->callback_info.info.bulk.origin_handle);
-    HG_CHECK_HG_ERROR(done, ret, "Could not free origin handle");
+    switch (flags) {
+        case HG_BULK_READWRITE:
+        case HG_BULK_READ_ONLY:
+        case HG_BULK_WRITE_ONLY:
+            break;
+        default:
+            HG_GOTO_ERROR(
+                done, ret, HG_INVALID_ARG, "Unrecognized handle flag");
+    }
 
-    ret = hg_bulk_free(hg_bulk_op_id->callback_info.info.bulk.local_handle);
-    HG_CHECK_HG_ERROR(done, ret, "Could not free local handle");
+    HG_LOG_DEBUG("Creating new bulk handle with %u segment(s)", count);
 
-    /* Release bulk op ID (can be released after callback execution since
-     * op IDs are managed internally) */
-    ret = hg_bulk_op_destroy(hg_bulk_op_id);
-    HG_CHECK_HG_ERROR(done, ret, "Could not destroy bulk op ID");
+    ret = hg_bulk_create(hg_class->core_class, count, buf_ptrs, buf_sizes,
+        flags, (struct hg_bulk **) handle);
+    HG_CHECK_HG_ERROR(done, ret, "Could not create bulk handle");
+
+    HG_LOG_DEBUG("Created new bulk handle (%p)", *handle);
 
 done:
     return ret;
@@ -2486,18 +7166,26 @@ done:
 
 /*---------------------------------------------------------------------------*/
 hg_return_t
-HG_Bulk_create(hg_class_t *hg_class, hg_uint32_t count, void **buf_ptrs,
-    const hg_size_t *buf_sizes, hg_uint8_t flags, hg_bulk_t *handle)
+HG_Bulk_create_strided(hg_class_t *hg_class, void *base, hg_size_t block_len,
+    hg_uint32_t vector_count, const struct hg_bulk_vector *vectors,
+    hg_uint8_t flags, hg_bulk_t *handle)
 {
+    hg_uint32_t i;
     hg_return_t ret = HG_SUCCESS;
 
     HG_CHECK_ERROR(
         hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+    HG_CHECK_ERROR(base == NULL, done, ret, HG_INVALID_ARG, "NULL base");
     HG_CHECK_ERROR(
-        count == 0, done, ret, HG_INVALID_ARG, "Invalid number of segments");
-    HG_CHECK_ERROR(buf_sizes == NULL, done, ret, HG_INVALID_ARG,
-        "NULL segment size pointer");
-    /* We allow for 0-sized segments though. */
+        vectors == NULL, done, ret, HG_INVALID_ARG, "NULL vector pointer");
+    HG_CHECK_ERROR(vector_count == 0 || vector_count > HG_BULK_VECTOR_MAX,
+        done, ret, HG_INVALID_ARG, "Invalid number of vectors (%u)",
+        vector_count);
+    HG_CHECK_ERROR(
+        block_len == 0, done, ret, HG_INVALID_ARG, "Invalid block length");
+    for (i = 0; i < vector_count; i++)
+        HG_CHECK_ERROR(vectors[i].count == 0, done, ret, HG_INVALID_ARG,
+            "Invalid number of blocks for vector %u", i);
 
     switch (flags) {
         case HG_BULK_READWRITE:
@@ -2509,13 +7197,38 @@ HG_Bulk_create(hg_class_t *hg_class, hg_uint32_t count, void **buf_ptrs,
                 done, ret, HG_INVALID_ARG, "Unrecognized handle flag");
     }
 
-    HG_LOG_DEBUG("Creating new bulk handle with %u segment(s)", count);
+    HG_LOG_DEBUG("Creating new strided bulk handle with %u vector(s)",
+        vector_count);
 
-    ret = hg_bulk_create(hg_class->core_class, count, buf_ptrs, buf_sizes,
-        flags, (struct hg_bulk **) handle);
-    HG_CHECK_HG_ERROR(done, ret, "Could not create bulk handle");
+    ret = hg_bulk_create_strided(hg_class->core_class, base, block_len,
+        vector_count, vectors, flags, (struct hg_bulk **) handle);
+    HG_CHECK_HG_ERROR(done, ret, "Could not create strided bulk handle");
 
-    HG_LOG_DEBUG("Created new bulk handle (%p)", *handle);
+    HG_LOG_DEBUG("Created new strided bulk handle (%p)", *handle);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_create_view(
+    hg_bulk_t handle, hg_size_t offset, hg_size_t size, hg_bulk_t *view)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(handle == HG_BULK_NULL, done, ret, HG_INVALID_ARG,
+        "NULL bulk handle passed");
+    HG_CHECK_ERROR(view == NULL, done, ret, HG_INVALID_ARG, "NULL pointer");
+
+    HG_LOG_DEBUG("Creating view of bulk handle (%p), offset=%zu, size=%zu",
+        handle, offset, size);
+
+    ret = hg_bulk_create_view(
+        (struct hg_bulk *) handle, offset, size, (struct hg_bulk **) view);
+    HG_CHECK_HG_ERROR(done, ret, "Could not create bulk view");
+
+    HG_LOG_DEBUG("Created new bulk view (%p)", *view);
 
 done:
     return ret;
@@ -2637,7 +7350,7 @@ HG_Bulk_get_serialize_size(hg_bulk_t handle, unsigned long flags)
     HG_CHECK_ERROR_NORET(
         handle == HG_BULK_NULL, done, "NULL bulk handle passed");
 
-    ret = hg_bulk_get_serialize_size((struct hg_bulk *) handle, flags & 0xff);
+    ret = hg_bulk_get_serialize_size((struct hg_bulk *) handle, flags);
 
     HG_LOG_DEBUG(
         "Serialize size with flags eager=%d, sm=%d, is %zu bytes for bulk "
@@ -2664,7 +7377,7 @@ HG_Bulk_serialize(
         (flags & HG_BULK_SM) ? HG_TRUE : HG_FALSE);
 
     ret = hg_bulk_serialize(
-        buf, buf_size, flags & 0xff, (struct hg_bulk *) handle);
+        buf, buf_size, flags, (struct hg_bulk *) handle, NULL);
     HG_CHECK_HG_ERROR(done, ret, "Could not serialize handle");
 
 done:
@@ -2676,13 +7389,20 @@ hg_return_t
 HG_Bulk_deserialize(hg_class_t *hg_class, hg_bulk_t *handle, const void *buf,
     hg_size_t buf_size)
 {
+    struct hg_bulk_desc_cache *hg_bulk_desc_cache;
     hg_return_t ret = HG_SUCCESS;
 
     HG_CHECK_ERROR(
         handle == NULL, done, ret, HG_INVALID_ARG, "NULL bulk handle passed");
 
-    ret = hg_bulk_deserialize(
-        hg_class->core_class, (struct hg_bulk **) handle, buf, buf_size);
+    hg_bulk_desc_cache =
+        hg_core_class_get_bulk_desc_cache(hg_class->core_class);
+    if (hg_bulk_desc_cache)
+        ret = hg_bulk_desc_cache_deserialize(hg_bulk_desc_cache,
+            hg_class->core_class, (struct hg_bulk **) handle, buf, buf_size);
+    else
+        ret = hg_bulk_deserialize(
+            hg_class->core_class, (struct hg_bulk **) handle, buf, buf_size);
     HG_CHECK_HG_ERROR(done, ret, "Could not deserialize handle");
 
     HG_LOG_DEBUG("Deserialized into new bulk handle (%p)", *handle);
@@ -2847,6 +7567,135 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_transfer_pipelined(hg_context_t *context, hg_cb_t callback,
+    hg_bulk_chunk_cb_t chunk_callback, void *arg, hg_bulk_op_t op,
+    hg_addr_t origin_addr, hg_uint8_t origin_id, hg_bulk_t origin_handle,
+    hg_size_t origin_offset, hg_bulk_t local_handle, hg_size_t local_offset,
+    hg_size_t size, hg_size_t chunk_size, unsigned int window,
+    hg_op_id_t *op_id)
+{
+    struct hg_bulk *hg_bulk_origin = (struct hg_bulk *) origin_handle;
+    struct hg_bulk *hg_bulk_local = (struct hg_bulk *) local_handle;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        context == NULL, done, ret, HG_INVALID_ARG, "NULL HG context");
+    HG_CHECK_ERROR(
+        chunk_size == 0, done, ret, HG_INVALID_ARG, "Invalid chunk size");
+    HG_CHECK_ERROR(
+        window == 0, done, ret, HG_INVALID_ARG, "Invalid window size");
+
+    /* Origin handle sanity checks */
+    HG_CHECK_ERROR(hg_bulk_origin == NULL, done, ret, HG_INVALID_ARG,
+        "NULL origin handle passed");
+    HG_CHECK_ERROR((origin_offset + size) > hg_bulk_origin->desc.info.len, done,
+        ret, HG_INVALID_ARG,
+        "Exceeding size of memory exposed by origin handle (%zu + %zu > %zu)",
+        origin_offset, size, hg_bulk_origin->desc.info.len);
+
+    /* Use address information embedded into origin_handle if any */
+    if (hg_bulk_origin->addr != HG_CORE_ADDR_NULL) {
+        origin_addr = (hg_addr_t) hg_bulk_origin->addr;
+        origin_id = hg_bulk_origin->context_id;
+    }
+    HG_CHECK_ERROR(origin_addr == HG_ADDR_NULL, done, ret, HG_INVALID_ARG,
+        "NULL origin address");
+
+    /* Local handle sanity checks */
+    HG_CHECK_ERROR(hg_bulk_local == NULL, done, ret, HG_INVALID_ARG,
+        "NULL local handle passed");
+    HG_CHECK_ERROR((local_offset + size) > hg_bulk_local->desc.info.len, done,
+        ret, HG_INVALID_ARG,
+        "Exceeding size of memory exposed by local handle (%zu + %zu > %zu)",
+        local_offset, size, hg_bulk_local->desc.info.len);
+
+    /* Check permission flags */
+    HG_BULK_CHECK_FLAGS(op, hg_bulk_origin->desc.info.flags,
+        hg_bulk_local->desc.info.flags, done, ret);
+
+    HG_LOG_DEBUG("Pipelining transfer between bulk handle (%p) and bulk "
+                 "handle (%p)",
+        hg_bulk_origin, hg_bulk_local);
+
+    /* Do pipelined bulk transfer */
+    ret = hg_bulk_transfer_pipelined(context->core_context, callback,
+        chunk_callback, arg, op, (hg_core_addr_t) origin_addr, origin_id,
+        hg_bulk_origin, origin_offset, hg_bulk_local, local_offset, size,
+        chunk_size, window, op_id);
+    HG_CHECK_HG_ERROR(done, ret, "Could not start pipelined transfer");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_transfer_batch(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, const struct hg_bulk_transfer_desc *descs,
+    hg_uint32_t count, hg_op_id_t *op_id)
+{
+    hg_return_t ret = HG_SUCCESS;
+    hg_uint32_t i;
+
+    HG_CHECK_ERROR(
+        context == NULL, done, ret, HG_INVALID_ARG, "NULL HG context");
+    HG_CHECK_ERROR(
+        descs == NULL, done, ret, HG_INVALID_ARG, "NULL transfer descriptors");
+    HG_CHECK_ERROR(count == 0, done, ret, HG_INVALID_ARG,
+        "Invalid number of transfer descriptors");
+
+    for (i = 0; i < count; i++) {
+        struct hg_bulk *hg_bulk_origin =
+            (struct hg_bulk *) descs[i].origin_handle;
+        struct hg_bulk *hg_bulk_local =
+            (struct hg_bulk *) descs[i].local_handle;
+
+        /* Origin handle sanity checks */
+        HG_CHECK_ERROR(hg_bulk_origin == NULL, done, ret, HG_INVALID_ARG,
+            "NULL origin handle passed (descriptor %u)", i);
+        HG_CHECK_ERROR(
+            (descs[i].origin_offset + descs[i].size) >
+                hg_bulk_origin->desc.info.len,
+            done, ret, HG_INVALID_ARG,
+            "Exceeding size of memory exposed by origin handle (%zu + %zu > "
+            "%zu, descriptor %u)",
+            descs[i].origin_offset, descs[i].size,
+            hg_bulk_origin->desc.info.len, i);
+        HG_CHECK_ERROR(hg_bulk_origin->addr == HG_CORE_ADDR_NULL &&
+                           descs[i].origin_addr == HG_ADDR_NULL,
+            done, ret, HG_INVALID_ARG, "NULL origin address (descriptor %u)",
+            i);
+
+        /* Local handle sanity checks */
+        HG_CHECK_ERROR(hg_bulk_local == NULL, done, ret, HG_INVALID_ARG,
+            "NULL local handle passed (descriptor %u)", i);
+        HG_CHECK_ERROR(
+            (descs[i].local_offset + descs[i].size) >
+                hg_bulk_local->desc.info.len,
+            done, ret, HG_INVALID_ARG,
+            "Exceeding size of memory exposed by local handle (%zu + %zu > "
+            "%zu, descriptor %u)",
+            descs[i].local_offset, descs[i].size, hg_bulk_local->desc.info.len,
+            i);
+
+        /* Check permission flags */
+        HG_BULK_CHECK_FLAGS(op, hg_bulk_origin->desc.info.flags,
+            hg_bulk_local->desc.info.flags, done, ret);
+    }
+
+    HG_LOG_DEBUG("Transferring batch of %u transfer(s)", count);
+
+    /* Do batched bulk transfer */
+    ret = hg_bulk_transfer_batch(
+        context->core_context, callback, arg, op, descs, count, op_id);
+    HG_CHECK_HG_ERROR(done, ret, "Could not start batched transfer");
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 HG_Bulk_cancel(hg_op_id_t op_id)
@@ -2864,3 +7713,279 @@ HG_Bulk_cancel(hg_op_id_t op_id)
 done:
     return ret;
 }
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_reg_cache_invalidate(
+    hg_class_t *hg_class, void *buf, hg_size_t buf_size)
+{
+    struct hg_bulk_reg_cache *hg_bulk_reg_cache;
+#ifdef NA_HAS_SM
+    na_class_t *na_sm_class;
+#endif
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+
+    if (buf == NULL || buf_size == 0)
+        goto done;
+
+    HG_LOG_DEBUG("Invalidating cached registrations of range (%p, %zu)", buf,
+        buf_size);
+
+    hg_bulk_reg_cache = hg_core_class_get_bulk_reg_cache(
+        hg_class->core_class, HG_Core_class_get_na(hg_class->core_class));
+    if (hg_bulk_reg_cache) {
+        ret = hg_bulk_reg_cache_invalidate(
+            hg_bulk_reg_cache, (hg_ptr_t) buf, buf_size);
+        HG_CHECK_HG_ERROR(done, ret, "Could not invalidate registrations");
+    }
+
+#ifdef NA_HAS_SM
+    na_sm_class = HG_Core_class_get_na_sm(hg_class->core_class);
+    if (na_sm_class) {
+        hg_bulk_reg_cache = hg_core_class_get_bulk_reg_cache(
+            hg_class->core_class, na_sm_class);
+        if (hg_bulk_reg_cache) {
+            ret = hg_bulk_reg_cache_invalidate(
+                hg_bulk_reg_cache, (hg_ptr_t) buf, buf_size);
+            HG_CHECK_HG_ERROR(
+                done, ret, "Could not invalidate SM registrations");
+        }
+    }
+#endif
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_desc_cache_get_stats(
+    hg_class_t *hg_class, struct hg_bulk_desc_cache_stats *stats)
+{
+    struct hg_bulk_desc_cache *hg_bulk_desc_cache;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+    HG_CHECK_ERROR(
+        stats == NULL, done, ret, HG_INVALID_ARG, "NULL stats pointer");
+
+    memset(stats, 0, sizeof(struct hg_bulk_desc_cache_stats));
+
+    hg_bulk_desc_cache =
+        hg_core_class_get_bulk_desc_cache(hg_class->core_class);
+    if (!hg_bulk_desc_cache)
+        goto done;
+
+    hg_thread_mutex_lock(&hg_bulk_desc_cache->lock);
+    *stats = hg_bulk_desc_cache->stats;
+    hg_thread_mutex_unlock(&hg_bulk_desc_cache->lock);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_op_pool_get_stats(
+    hg_context_t *context, struct hg_bulk_op_pool_stats *stats)
+{
+    struct hg_bulk_op_pool *hg_bulk_op_pool;
+    unsigned long window_count;
+    hg_uint32_t unpooled_count;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        context == NULL, done, ret, HG_INVALID_ARG, "NULL HG context");
+    HG_CHECK_ERROR(
+        stats == NULL, done, ret, HG_INVALID_ARG, "NULL stats pointer");
+
+    memset(stats, 0, sizeof(struct hg_bulk_op_pool_stats));
+
+    hg_bulk_op_pool = hg_core_context_get_bulk_op_pool(context->core_context);
+    if (!hg_bulk_op_pool)
+        goto done;
+
+    unpooled_count =
+        (hg_uint32_t) hg_atomic_get32(&hg_bulk_op_pool->unpooled_count);
+
+    hg_thread_spin_lock(&hg_bulk_op_pool->pending_list_lock);
+    stats->count = (hg_uint32_t) hg_bulk_op_pool->count + unpooled_count;
+    stats->free_count = (hg_uint32_t) hg_bulk_op_pool->free_count;
+    stats->na_op_count = (hg_uint32_t) hg_bulk_op_pool->na_op_count;
+    window_count = hg_bulk_op_pool->window_count;
+    hg_thread_spin_unlock(&hg_bulk_op_pool->pending_list_lock);
+
+    /* Memory internally used by NA op IDs is not known */
+    stats->size = (hg_size_t) stats->count * sizeof(struct hg_bulk_op_id) +
+                  (hg_size_t) window_count *
+                      (sizeof(struct hg_bulk_na_window) +
+                          hg_core_class_get_bulk_op_window(
+                              context->core_context->core_class) *
+                              (sizeof(struct hg_bulk_na_slot) +
+                                  sizeof(na_op_id_t *)));
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_pool_create(hg_class_t *hg_class, hg_size_t block_size,
+    hg_uint32_t count, hg_uint8_t flags, hg_bulk_pool_t *pool)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+    HG_CHECK_ERROR(
+        block_size == 0, done, ret, HG_INVALID_ARG, "Invalid block size");
+    HG_CHECK_ERROR(count == 0 || count > INT32_MAX, done, ret, HG_INVALID_ARG,
+        "Invalid number of blocks");
+    HG_CHECK_ERROR(pool == NULL, done, ret, HG_INVALID_ARG, "NULL pointer");
+
+    switch (flags) {
+        case HG_BULK_READWRITE:
+        case HG_BULK_READ_ONLY:
+        case HG_BULK_WRITE_ONLY:
+            break;
+        default:
+            HG_GOTO_ERROR(
+                done, ret, HG_INVALID_ARG, "Unrecognized handle flag");
+    }
+
+    HG_LOG_DEBUG("Creating new bulk pool of %u block(s) of %zu bytes", count,
+        block_size);
+
+    ret = hg_bulk_pool_create(hg_class->core_class, block_size, count, flags,
+        (struct hg_bulk_pool **) pool);
+    HG_CHECK_HG_ERROR(done, ret, "Could not create bulk pool");
+
+    HG_LOG_DEBUG("Created new bulk pool (%p)", *pool);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_pool_destroy(hg_bulk_pool_t pool)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (pool == HG_BULK_POOL_NULL)
+        goto done;
+
+    HG_LOG_DEBUG("Destroying bulk pool (%p)", pool);
+
+    ret = hg_bulk_pool_destroy((struct hg_bulk_pool *) pool, HG_FALSE);
+    HG_CHECK_HG_ERROR(done, ret, "Could not destroy bulk pool");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_pool_get(hg_bulk_pool_t pool, hg_bulk_t *handle)
+{
+    struct hg_bulk_pool *hg_bulk_pool = (struct hg_bulk_pool *) pool;
+    struct hg_bulk *hg_bulk;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_bulk_pool == NULL, done, ret, HG_INVALID_ARG, "NULL bulk pool");
+    HG_CHECK_ERROR(handle == NULL, done, ret, HG_INVALID_ARG, "NULL pointer");
+
+    hg_bulk = (struct hg_bulk *) hg_atomic_queue_pop_mc(
+        hg_bulk_pool->free_queue);
+    if (hg_bulk == NULL)
+        HG_GOTO_DONE(done, ret, HG_AGAIN);
+    hg_atomic_set32(
+        &hg_bulk_pool->in_use[hg_bulk_pool_index(hg_bulk_pool, hg_bulk)], 1);
+
+    *handle = (hg_bulk_t) hg_bulk;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_pool_put(hg_bulk_pool_t pool, hg_bulk_t handle)
+{
+    struct hg_bulk_pool *hg_bulk_pool = (struct hg_bulk_pool *) pool;
+    struct hg_bulk *hg_bulk = (struct hg_bulk *) handle;
+    int rc;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(
+        hg_bulk_pool == NULL, done, ret, HG_INVALID_ARG, "NULL bulk pool");
+    HG_CHECK_ERROR(hg_bulk == NULL, done, ret, HG_INVALID_ARG, "NULL handle");
+    HG_CHECK_ERROR(hg_bulk->parent != hg_bulk_pool->hg_bulk, done, ret,
+        HG_INVALID_ARG, "Handle does not belong to pool");
+
+    /* Only the first put of a handle retrieved from the pool succeeds */
+    HG_CHECK_ERROR(!hg_atomic_cas32(&hg_bulk_pool->in_use[hg_bulk_pool_index(
+                                        hg_bulk_pool, hg_bulk)],
+                       1, 0),
+        done, ret, HG_INVALID_ARG, "Handle was already returned to pool");
+
+    rc = hg_atomic_queue_push(hg_bulk_pool->free_queue, hg_bulk);
+    HG_CHECK_ERROR(rc != HG_UTIL_SUCCESS, done, ret, HG_OVERFLOW,
+        "Pool is full, handle was already returned");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+HG_Bulk_reg_cache_get_stats(
+    hg_class_t *hg_class, struct hg_bulk_reg_cache_stats *stats)
+{
+    struct hg_bulk_reg_cache *hg_bulk_reg_caches[2] = {NULL, NULL};
+#ifdef NA_HAS_SM
+    na_class_t *na_sm_class;
+#endif
+    hg_return_t ret = HG_SUCCESS;
+    unsigned int i;
+
+    HG_CHECK_ERROR(
+        hg_class == NULL, done, ret, HG_INVALID_ARG, "NULL HG class");
+    HG_CHECK_ERROR(
+        stats == NULL, done, ret, HG_INVALID_ARG, "NULL stats pointer");
+
+    memset(stats, 0, sizeof(struct hg_bulk_reg_cache_stats));
+
+    hg_bulk_reg_caches[0] = hg_core_class_get_bulk_reg_cache(
+        hg_class->core_class, HG_Core_class_get_na(hg_class->core_class));
+#ifdef NA_HAS_SM
+    na_sm_class = HG_Core_class_get_na_sm(hg_class->core_class);
+    if (na_sm_class)
+        hg_bulk_reg_caches[1] =
+            hg_core_class_get_bulk_reg_cache(hg_class->core_class, na_sm_class);
+#endif
+
+    for (i = 0; i < 2; i++) {
+        struct hg_bulk_reg_cache *hg_bulk_reg_cache = hg_bulk_reg_caches[i];
+
+        if (!hg_bulk_reg_cache)
+            continue;
+
+        hg_thread_spin_lock(&hg_bulk_reg_cache->lock);
+        stats->hits += hg_bulk_reg_cache->stats.hits;
+        stats->misses += hg_bulk_reg_cache->stats.misses;
+        stats->evictions += hg_bulk_reg_cache->stats.evictions;
+        stats->invalidations += hg_bulk_reg_cache->stats.invalidations;
+        stats->size += hg_bulk_reg_cache->stats.size;
+        stats->count += hg_bulk_reg_cache->stats.count;
+        hg_thread_spin_unlock(&hg_bulk_reg_cache->lock);
+    }
+
+done:
+    return ret;
+}
@@ -17,16 +17,77 @@
 /* Public Type and Struct Definition */
 /*************************************/
 
+/* Pool of registered bulk buffers */
+typedef struct hg_bulk_pool *hg_bulk_pool_t;
+
+/* Bulk registration cache statistics */
+struct hg_bulk_reg_cache_stats {
+    hg_uint64_t hits;          /* Registrations re-used from cache */
+    hg_uint64_t misses;        /* Registrations not found in cache */
+    hg_uint64_t evictions;     /* Registrations evicted to honor size limit */
+    hg_uint64_t invalidations; /* Registrations invalidated */
+    hg_size_t size;            /* Amount of memory currently registered */
+    hg_uint32_t count;         /* Number of registrations currently cached */
+};
+
+/* Bulk descriptor cache statistics */
+struct hg_bulk_desc_cache_stats {
+    hg_uint64_t hits;      /* Descriptors resolved to a cached handle */
+    hg_uint64_t misses;    /* Descriptors deserialized and added to cache */
+    hg_uint64_t evictions; /* Descriptors evicted to honor count limit */
+    hg_uint32_t count;     /* Number of descriptors currently cached */
+};
+
+/* Bulk op ID pool statistics */
+struct hg_bulk_op_pool_stats {
+    hg_size_t size;          /* Memory used by op IDs (excluding NA) */
+    hg_uint32_t count;       /* Number of op IDs currently allocated */
+    hg_uint32_t free_count;  /* Number of op IDs available in pool */
+    hg_uint32_t na_op_count; /* Number of NA op IDs held by op IDs */
+};
+
+/* Callback executed when a chunk of a pipelined transfer completes, offset
+ * is relative to the origin and local offsets of the transfer */
+typedef hg_return_t (*hg_bulk_chunk_cb_t)(
+    const struct hg_cb_info *callback_info, hg_size_t offset, hg_size_t size);
+
+/* Transfer of a bulk batch (origin_addr and origin_id are ignored if
+ * origin_handle was bound using HG_Bulk_bind()) */
+struct hg_bulk_transfer_desc {
+    hg_addr_t origin_addr;   /* Abstract address of origin */
+    hg_bulk_t origin_handle; /* Origin bulk handle */
+    hg_size_t origin_offset; /* Origin offset */
+    hg_bulk_t local_handle;  /* Local bulk handle */
+    hg_size_t local_offset;  /* Local offset */
+    hg_size_t size;          /* Size of data to be transferred */
+    hg_uint8_t origin_id;    /* Context ID of origin */
+};
+
+/* Vector of a strided layout: count elements, each element starting stride
+ * bytes after the previous one */
+struct hg_bulk_vector {
+    hg_uint32_t count; /* Number of elements */
+    hg_size_t stride;  /* Distance between elements in bytes */
+};
+
 /*****************/
 /* Public Macros */
 /*****************/
 
+#define HG_BULK_POOL_NULL ((hg_bulk_pool_t) 0)
+
 /* The memory attributes associated with the bulk handle
  * can be defined as read only, write only or read-write */
 #define HG_BULK_READ_ONLY  (1 << 0)
 #define HG_BULK_WRITE_ONLY (1 << 1)
 #define HG_BULK_READWRITE  (HG_BULK_READ_ONLY | HG_BULK_WRITE_ONLY)
 
+/* Max number of nested vectors of a strided layout */
+#define HG_BULK_VECTOR_MAX (4)
+
+/* Max number of blocks of a strided layout */
+#define HG_BULK_STRIDE_BLOCK_MAX (1 << 20)
+
 /*********************/
 /* Public Prototypes */
 /*********************/
@@ -41,6 +102,9 @@ extern "C" {
  * \remark If NULL is passed to buf_ptrs, i.e.,
  * \verbatim HG_Bulk_create(count, NULL, buf_sizes, flags, &handle) \endverbatim
  * memory for the missing buf_ptrs array will be internally allocated.
+ * \remark Segments of buf_ptrs that are adjacent in memory are coalesced
+ * and empty segments are dropped, HG_Bulk_get_segment_count() may therefore
+ * return a smaller count than the one that was passed.
  *
  * \param hg_class [IN]         pointer to HG class
  * \param count [IN]            number of segments
@@ -58,6 +122,53 @@ HG_PUBLIC hg_return_t
 HG_Bulk_create(hg_class_t *hg_class, hg_uint32_t count, void **buf_ptrs,
     const hg_size_t *buf_sizes, hg_uint8_t flags, hg_bulk_t *handle);
 
+/**
+ * Create an abstract bulk handle from a strided memory layout. A block of
+ * block_len bytes starting at base is repeated along nested vectors, vectors[0]
+ * being the outermost one, e.g., a column of a 2D array is described by one
+ * vector of (rows, row_size). The handle has one segment per block but is
+ * serialized using only the layout description. Blocks must not be empty and
+ * must not overlap, i.e., the stride of each vector must be at least the
+ * extent of the vectors it contains, and there can be at most
+ * HG_BULK_STRIDE_BLOCK_MAX blocks.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param base [IN]             address of first block
+ * \param block_len [IN]        size of blocks
+ * \param vector_count [IN]     number of vectors (max HG_BULK_VECTOR_MAX)
+ * \param vectors [IN]          array of vectors
+ * \param flags [IN]            permission flag:
+ *                                - HG_BULK_READWRITE
+ *                                - HG_BULK_READ_ONLY
+ *                                - HG_BULK_WRITE_ONLY
+ * \param handle [OUT]          pointer to returned abstract bulk handle
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_create_strided(hg_class_t *hg_class, void *base, hg_size_t block_len,
+    hg_uint32_t vector_count, const struct hg_bulk_vector *vectors,
+    hg_uint8_t flags, hg_bulk_t *handle);
+
+/**
+ * Create a bulk handle that covers size bytes of an existing handle, starting
+ * at offset. The view does not allocate or register memory, it shares the
+ * memory registrations of handle and keeps a reference to it until the view
+ * is freed with HG_Bulk_free(). A view can be serialized and transferred like
+ * any other handle, in which case only the sub-range is exposed. The address
+ * that handle may be bound to is not inherited.
+ *
+ * \param handle [IN]           abstract bulk handle
+ * \param offset [IN]           offset of view in handle
+ * \param size [IN]             size of view
+ * \param view [OUT]            pointer to returned abstract bulk handle
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_create_view(
+    hg_bulk_t handle, hg_size_t offset, hg_size_t size, hg_bulk_t *view);
+
 /**
  * Free bulk handle.
  *
@@ -97,10 +208,15 @@ HG_Bulk_ref_incr(hg_bulk_t handle);
  * For that usage, the origin will have called this function to bind the bulk
  * handle to its local context, prior to sending the RPC request to target A.
  *
+ * A handle returned by HG_Bulk_deserialize() while the descriptor cache is
+ * enabled is removed from the cache when bound, so that binding does not
+ * affect other users of the same descriptor.
+ *
  * \param context [IN]          pointer to HG context
  * \param handle [IN]           abstract bulk handle
  *
- * \return HG_SUCCESS or corresponding HG error code
+ * \return HG_SUCCESS, HG_PERMISSION if the handle is shared through the
+ *         descriptor cache by other references, or corresponding HG error code
  */
 HG_PUBLIC hg_return_t
 HG_Bulk_bind(hg_bulk_t handle, hg_context_t *context);
@@ -209,7 +325,9 @@ HG_Bulk_serialize(
     void *buf, hg_size_t buf_size, unsigned long flags, hg_bulk_t handle);
 
 /**
- * Deserialize bulk handle from an existing buffer.
+ * Deserialize bulk handle from an existing buffer. If the bulk descriptor
+ * cache is enabled (see hg_init_info), deserializing a buffer that was already
+ * deserialized may return a new reference to the same handle.
  *
  * \param hg_class [IN]         pointer to HG class
  * \param handle [OUT]          abstract bulk handle
@@ -304,6 +422,84 @@ HG_Bulk_transfer_id(hg_context_t *context, hg_cb_t callback, void *arg,
     hg_bulk_t origin_handle, hg_size_t origin_offset, hg_bulk_t local_handle,
     hg_size_t local_offset, hg_size_t size, hg_op_id_t *op_id);
 
+/**
+ * Transfer data to/from origin using abstract bulk handles by splitting the
+ * transfer into chunks of chunk_size bytes, keeping at most window chunks in
+ * flight at the same time. If chunk_callback is not NULL, it is triggered
+ * as each chunk successfully completes so that data can be processed while
+ * the rest of the transfer is in progress. Chunks may
+ * complete out of order. Once all chunks have completed, user callback is
+ * placed into a completion queue and can be triggered using HG_Trigger().
+ * Both callbacks are passed the same arg. If a chunk fails or chunk_callback
+ * returns an error, no further chunk is issued and the error is reported to
+ * user callback. Canceling the returned operation ID cancels all the chunks
+ * that are in flight. If origin_handle describes a compressed copy of its
+ * data or carries checksums, chunks follow its blocks and chunk_size is
+ * ignored; a block that does not match its checksum fails the transfer with
+ * HG_CHECKSUM_ERROR.
+ * \remark If origin_handle was bound using HG_Bulk_bind(), origin_addr and
+ * origin_id are ignored and address information embedded into origin_handle
+ * is used instead.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param callback [IN]         pointer to function callback
+ * \param chunk_callback [IN]   pointer to chunk function callback
+ * \param arg [IN]              pointer to data passed to callbacks
+ * \param op [IN]               transfer operation:
+ *                                  - HG_BULK_PUSH
+ *                                  - HG_BULK_PULL
+ * \param origin_addr [IN]      abstract address of origin
+ * \param origin_id [IN]        context ID of origin
+ * \param origin_handle [IN]    abstract bulk handle
+ * \param origin_offset [IN]    offset
+ * \param local_handle [IN]     abstract bulk handle
+ * \param local_offset [IN]     offset
+ * \param size [IN]             size of data to be transferred
+ * \param chunk_size [IN]       size of each chunk (last one may be smaller)
+ * \param window [IN]           maximum number of chunks in flight
+ * \param op_id [OUT]           pointer to returned operation ID
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_transfer_pipelined(hg_context_t *context, hg_cb_t callback,
+    hg_bulk_chunk_cb_t chunk_callback, void *arg, hg_bulk_op_t op,
+    hg_addr_t origin_addr, hg_uint8_t origin_id, hg_bulk_t origin_handle,
+    hg_size_t origin_offset, hg_bulk_t local_handle, hg_size_t local_offset,
+    hg_size_t size, hg_size_t chunk_size, unsigned int window,
+    hg_op_id_t *op_id);
+
+/**
+ * Transfer a batch of bulk regions at once. Each descriptor of descs is
+ * transferred as if it had been passed to HG_Bulk_transfer_id(), but all
+ * transfers share a single operation ID. Once all transfers have completed,
+ * user callback is placed into a completion queue and can be triggered
+ * using HG_Trigger(). If any transfer fails, the error is reported to user
+ * callback once all transfers have completed. Canceling the returned
+ * operation ID cancels all the transfers of the batch.
+ * \remark The origin_handle and local_handle fields of the callback info
+ * are set to HG_BULK_NULL. Transfers that are not local must all go through
+ * the same NA class, i.e., origin handles must either all or none have been
+ * exposed through shared-memory. The descs array can be released once the
+ * call returns.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param callback [IN]         pointer to function callback
+ * \param arg [IN]              pointer to data passed to callback
+ * \param op [IN]               transfer operation:
+ *                                  - HG_BULK_PUSH
+ *                                  - HG_BULK_PULL
+ * \param descs [IN]            array of transfer descriptors
+ * \param count [IN]            number of transfer descriptors
+ * \param op_id [OUT]           pointer to returned operation ID
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_transfer_batch(hg_context_t *context, hg_cb_t callback, void *arg,
+    hg_bulk_op_t op, const struct hg_bulk_transfer_desc *descs,
+    hg_uint32_t count, hg_op_id_t *op_id);
+
 /**
  * Cancel an ongoing operation.
  *
@@ -314,6 +510,128 @@ HG_Bulk_transfer_id(hg_context_t *context, hg_cb_t callback, void *arg,
 HG_PUBLIC hg_return_t
 HG_Bulk_cancel(hg_op_id_t op_id);
 
+/**
+ * Invalidate cached memory registrations that overlap the range of memory
+ * [buf, buf + buf_size). This function must be called before memory that
+ * was exposed through HG_Bulk_create() is freed or unmapped when the bulk
+ * registration cache is enabled (see hg_init_info::bulk_reg_cache_size).
+ * Registrations that are still in use by bulk handles are released once the
+ * last handle using them is freed. Calling this function when the cache is
+ * not enabled has no effect.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param buf [IN]              start address of memory range
+ * \param buf_size [IN]         size of memory range
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_reg_cache_invalidate(
+    hg_class_t *hg_class, void *buf, hg_size_t buf_size);
+
+/**
+ * Retrieve statistics of the bulk registration cache. Statistics are
+ * accumulated over all the NA classes used by the HG class. All the fields
+ * are set to zero if the cache is not enabled.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param stats [OUT]           pointer to returned statistics
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_reg_cache_get_stats(
+    hg_class_t *hg_class, struct hg_bulk_reg_cache_stats *stats);
+
+/**
+ * Retrieve statistics of the bulk descriptor cache. All the fields are set to
+ * zero if the cache is not enabled.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param stats [OUT]           pointer to returned statistics
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_desc_cache_get_stats(
+    hg_class_t *hg_class, struct hg_bulk_desc_cache_stats *stats);
+
+/**
+ * Retrieve statistics of the pool of bulk operation IDs of a context. NA
+ * operation IDs are only created when operation IDs are first used for NA
+ * transfers, and pools that grew past their initial size release operation
+ * IDs that remain unused for an idle period (see
+ * hg_init_info::bulk_op_pool_max). Memory that is internally used by NA
+ * plugins for NA operation IDs is not accounted for in the returned size.
+ *
+ * \param context [IN]          pointer to HG context
+ * \param stats [OUT]           pointer to returned statistics
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_op_pool_get_stats(
+    hg_context_t *context, struct hg_bulk_op_pool_stats *stats);
+
+/**
+ * Create a pool of count buffers of block_size bytes. Buffers are allocated
+ * and registered at once and each buffer is exposed through its own bulk
+ * handle, so that handles retrieved from the pool can be used for transfers
+ * without any further allocation or registration. Handles can be retrieved
+ * and returned concurrently without locking.
+ *
+ * \param hg_class [IN]         pointer to HG class
+ * \param block_size [IN]       size of buffers
+ * \param count [IN]            number of buffers
+ * \param flags [IN]            permission flag:
+ *                                - HG_BULK_READWRITE
+ *                                - HG_BULK_READ_ONLY
+ *                                - HG_BULK_WRITE_ONLY
+ * \param pool [OUT]            pointer to returned pool
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_pool_create(hg_class_t *hg_class, hg_size_t block_size,
+    hg_uint32_t count, hg_uint8_t flags, hg_bulk_pool_t *pool);
+
+/**
+ * Destroy a pool, all the handles must have been returned to the pool.
+ *
+ * \param pool [IN/OUT]         pool
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_pool_destroy(hg_bulk_pool_t pool);
+
+/**
+ * Retrieve a handle from the pool, its buffer can be accessed using
+ * HG_Bulk_access(). The handle must be returned with HG_Bulk_pool_put() and
+ * not freed with HG_Bulk_free().
+ *
+ * \param pool [IN/OUT]         pool
+ * \param handle [OUT]          pointer to returned abstract bulk handle
+ *
+ * \return HG_SUCCESS, HG_AGAIN if all the buffers are in use, or
+ *         corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_pool_get(hg_bulk_pool_t pool, hg_bulk_t *handle);
+
+/**
+ * Return a handle to the pool once the transfers and references that use it
+ * have completed.
+ *
+ * \param pool [IN/OUT]         pool
+ * \param handle [IN]           abstract bulk handle
+ *
+ * \return HG_SUCCESS, HG_INVALID_ARG if the handle does not belong to the pool
+ *         or was already returned, or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+HG_Bulk_pool_put(hg_bulk_pool_t pool, hg_bulk_t handle);
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -323,6 +641,8 @@ struct hg_bulk_desc_info {
     hg_size_t len;             /* Size of region */
     hg_uint32_t segment_count; /* Segment count */
     hg_uint8_t flags;          /* Flags of operation access */
+    hg_uint8_t vector_count;   /* Vector count (if strided) */
+    hg_uint8_t ext_flags;      /* Extended flags */
 };
 
 /*---------------------------------------------------------------------------*/
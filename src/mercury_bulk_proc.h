@@ -13,10 +13,35 @@
 
 #include "mercury_bulk.h"
 
+#include "mercury_atomic.h"
+
 /*************************************/
 /* Public Type and Struct Definition */
 /*************************************/
 
+/* Maximum number of write-only handles returned inline in a response */
+#define HG_BULK_EAGER_WRITE_MAX 8
+
+/* Per-class eager bulk state */
+struct hg_bulk_eager_class {
+    hg_atomic_int64_t inlined_count; /* Handles whose data was inlined */
+    hg_atomic_int64_t rma_count;     /* Handles left for RMA */
+    hg_atomic_int32_t rtt;           /* Smoothed RPC round-trip time (us) */
+    hg_atomic_int32_t threshold;     /* Inline threshold (bytes) */
+};
+
+/* Eager bulk state of an RPC handle, shared by its input and output procs */
+struct hg_bulk_eager_info {
+    struct hg_bulk_eager_class *eager_class;     /* Class state */
+    hg_bulk_t handles[HG_BULK_EAGER_WRITE_MAX]; /* Handles inlined in resp */
+    /* Handles pulled in compressed form and their compressed copies */
+    hg_bulk_t compress_handles[HG_BULK_EAGER_WRITE_MAX];
+    hg_bulk_t compress_copies[HG_BULK_EAGER_WRITE_MAX];
+    hg_size_t size_left;        /* Response space left for inlined data */
+    hg_uint32_t count;          /* Number of handles */
+    hg_uint32_t compress_count; /* Number of compressed copies */
+};
+
 /*****************/
 /* Public Macros */
 /*****************/
@@ -25,6 +50,16 @@
 #define HG_BULK_EAGER (1 << 2) /* embeds data along descriptor */
 #define HG_BULK_SM    (1 << 3) /* bulk transfer through shared-memory */
 
+/* Serialize flag, data pushed by the target is returned in the response */
+#define HG_BULK_EAGER_WRITE (1 << 8)
+
+/* Serialize flag, checksums of data are sent along with the descriptor */
+#define HG_BULK_CHECKSUM (1 << 10)
+
+/* Size of response entry header for data of a write-only handle */
+#define HG_BULK_EAGER_WRITE_ENTRY_SIZE                                         \
+    (sizeof(hg_uint32_t) + 2 * sizeof(hg_size_t))
+
 /*********************/
 /* Public Prototypes */
 /*********************/
@@ -52,6 +87,93 @@ HG_PRIVATE void
 hg_bulk_set_serialize_cached_ptr(
     hg_bulk_t handle, void *buf, na_size_t buf_size);
 
+/**
+ * Check whether data of handle is embedded along its descriptor when
+ * serialized with HG_BULK_EAGER.
+ */
+HG_PRIVATE hg_bool_t
+hg_bulk_is_eager(hg_bulk_t handle);
+
+/**
+ * Reserve response space for data pushed to a local write-only handle.
+ * Returns HG_TRUE if the handle was added to the list of inlined handles.
+ */
+HG_PRIVATE hg_bool_t
+hg_bulk_eager_write_reserve(
+    struct hg_bulk_eager_info *eager_info, hg_bulk_t handle);
+
+/**
+ * Attach staging buffer to a deserialized handle whose data is to be
+ * returned in the response (no-op if the origin did not request it).
+ */
+HG_PRIVATE hg_return_t
+hg_bulk_eager_write_attach(
+    struct hg_bulk_eager_info *eager_info, hg_bulk_t handle);
+
+/**
+ * Encode data pushed to attached handles and release them.
+ */
+HG_PRIVATE hg_return_t
+hg_bulk_eager_write_encode(struct hg_bulk_eager_info *eager_info, void *buf,
+    hg_size_t buf_size, hg_size_t *size_ptr);
+
+/**
+ * Decode data returned in the response into reserved handles.
+ */
+HG_PRIVATE hg_return_t
+hg_bulk_eager_write_decode(struct hg_bulk_eager_info *eager_info,
+    const void *buf, hg_size_t buf_size);
+
+/**
+ * Stage data pushed from a local handle to an attached handle so that it is
+ * returned in the response. Returns HG_FALSE if the data must go through RMA.
+ */
+HG_PRIVATE hg_bool_t
+hg_bulk_eager_write_push(hg_bulk_t origin_handle, hg_size_t origin_offset,
+    hg_bulk_t local_handle, hg_size_t local_offset, hg_size_t size);
+
+/**
+ * Check whether pushing data to origin_addr places all of it at the origin
+ * before the transfer call returns (local copy or single round of puts on an
+ * NA class whose puts are synchronous, see NA_Put_is_sync()). A message sent
+ * afterwards is then guaranteed to be received after the data has landed.
+ */
+HG_PRIVATE hg_bool_t
+hg_bulk_push_is_sync(hg_addr_t origin_addr, hg_bulk_t origin_handle,
+    hg_size_t origin_offset, hg_bulk_t local_handle, hg_size_t local_offset,
+    hg_size_t size);
+
+/**
+ * Make a compressed copy of the data of a local read-only handle that the
+ * target can pull instead. The copy is kept by the handle and reused by the
+ * next RPC once released. Returns HG_BULK_NULL if the data is too small or
+ * does not compress, which is remembered by the handle. If flags request
+ * checksums, blocks are checksummed in the same pass as they are compressed.
+ */
+HG_PRIVATE hg_bulk_t
+hg_bulk_compress_attach(struct hg_bulk_eager_info *eager_info,
+    hg_bulk_t handle, unsigned long flags);
+
+/**
+ * Get size required to serialize handle along with its compressed copy.
+ */
+HG_PRIVATE hg_size_t
+hg_bulk_compress_get_serialize_size(
+    hg_bulk_t handle, unsigned long flags, hg_bulk_t compressed);
+
+/**
+ * Serialize handle along with its compressed copy.
+ */
+HG_PRIVATE hg_return_t
+hg_bulk_compress_serialize(void *buf, hg_size_t buf_size, unsigned long flags,
+    hg_bulk_t handle, hg_bulk_t compressed);
+
+/**
+ * Release reserved or attached handles and compressed copies.
+ */
+HG_PRIVATE void
+hg_bulk_eager_write_release(struct hg_bulk_eager_info *eager_info);
+
 #ifdef __cplusplus
 }
 #endif
@@ -46,6 +46,7 @@
 #define HG_CORE_POST_INIT          (256)
 #define HG_CORE_POST_INCR          (256)
 #define HG_CORE_BULK_OP_INIT_COUNT (256)
+#define HG_CORE_BULK_OP_WINDOW     (64)
 
 /* Timeout on finalize */
 #define HG_CORE_CLEANUP_TIMEOUT (1000)
@@ -133,7 +134,12 @@ struct hg_core_private_class {
 #ifdef NA_HAS_SM
     na_sm_id_t host_id; /* Host ID for local identification */
 #endif
-    hg_hash_table_t *func_map; /* Function map */
+    hg_hash_table_t *func_map;                /* Function map */
+    struct hg_bulk_reg_cache *bulk_reg_cache; /* Registration cache */
+#ifdef NA_HAS_SM
+    struct hg_bulk_reg_cache *bulk_reg_sm_cache; /* SM registration cache */
+#endif
+    struct hg_bulk_desc_cache *bulk_desc_cache; /* Descriptor cache */
     hg_return_t (*more_data_acquire)(hg_core_handle_t, hg_op_t,
         hg_return_t (*done_callback)(hg_core_handle_t)); /* more_data_acquire */
     void (*more_data_release)(hg_core_handle_t);         /* more_data_release */
@@ -145,8 +151,11 @@ struct hg_core_private_class {
     na_uint32_t progress_mode;      /* NA progress mode */
     hg_uint32_t request_post_init;  /* Init count of posted requests */
     hg_uint32_t request_post_incr;  /* Incr count of posted requests */
+    hg_uint32_t bulk_op_window;     /* Max NA ops in flight per bulk op */
+    hg_uint32_t bulk_op_pool_max;   /* Max number of op IDs per context */
     hg_bool_t na_ext_init;          /* NA externally initialized */
     hg_bool_t loopback;             /* Able to self forward */
+    hg_bool_t mem_copy_init;        /* Copy engine initialized */
 #ifdef HG_HAS_COLLECT_STATS
     hg_bool_t stats; /* (Debug) Print stats at exit */
 #endif
@@ -204,7 +213,8 @@ struct hg_core_private_addr {
     na_size_t na_sm_addr_serialize_size; /* Cached serialization size */
     na_sm_id_t host_id;                  /* NA SM Host ID */
 #endif
-    hg_atomic_int32_t ref_count; /* Reference count */
+    hg_atomic_int32_t ref_count;     /* Reference count */
+    hg_atomic_int32_t bulk_compress; /* Target pulls compressed bulk data */
 };
 
 /* HG core op type */
@@ -883,6 +893,10 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
             hg_core_class->request_post_init = hg_init_info->request_post_init;
             hg_core_class->request_post_incr = hg_init_info->request_post_incr;
         }
+        hg_core_class->bulk_op_window = (hg_init_info->bulk_op_window > 0)
+                                            ? hg_init_info->bulk_op_window
+                                            : HG_CORE_BULK_OP_WINDOW;
+        hg_core_class->bulk_op_pool_max = hg_init_info->bulk_op_pool_max;
         hg_core_class->progress_mode = hg_init_info->na_init_info.progress_mode;
 #ifdef NA_HAS_SM
         auto_sm = hg_init_info->auto_sm;
@@ -904,6 +918,7 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
     } else {
         hg_core_class->request_post_init = HG_CORE_POST_INIT;
         hg_core_class->request_post_incr = HG_CORE_POST_INCR;
+        hg_core_class->bulk_op_window = HG_CORE_BULK_OP_WINDOW;
         hg_core_class->loopback = HG_TRUE;
     }
 
@@ -965,6 +980,38 @@ hg_core_init(const char *na_info_string, hg_bool_t na_listen,
     }
 #endif
 
+    /* Create bulk registration caches */
+    if (hg_init_info && hg_init_info->bulk_reg_cache_size > 0) {
+        ret = hg_bulk_reg_cache_create(hg_core_class->core_class.na_class,
+            hg_init_info->bulk_reg_cache_size, &hg_core_class->bulk_reg_cache);
+        HG_CHECK_HG_ERROR(error, ret, "Could not create registration cache");
+
+#ifdef NA_HAS_SM
+        if (auto_sm) {
+            ret = hg_bulk_reg_cache_create(
+                hg_core_class->core_class.na_sm_class,
+                hg_init_info->bulk_reg_cache_size,
+                &hg_core_class->bulk_reg_sm_cache);
+            HG_CHECK_HG_ERROR(
+                error, ret, "Could not create SM registration cache");
+        }
+#endif
+    }
+
+    /* Create cache of remote bulk descriptors */
+    if (hg_init_info && hg_init_info->bulk_desc_cache_count > 0) {
+        ret = hg_bulk_desc_cache_create(hg_init_info->bulk_desc_cache_count,
+            &hg_core_class->bulk_desc_cache);
+        HG_CHECK_HG_ERROR(error, ret, "Could not create descriptor cache");
+    }
+
+    /* Initialize copy engine used for local transfers */
+    HG_CHECK_ERROR(hg_mem_copy_init(hg_init_info
+                                        ? hg_init_info->copy_thread_count
+                                        : 0) != HG_UTIL_SUCCESS,
+        error, ret, HG_NOMEM, "Could not initialize copy engine");
+    hg_core_class->mem_copy_init = HG_TRUE;
+
     /* Initialize atomic for tags */
     hg_atomic_init32(&hg_core_class->request_tag, 0);
 
@@ -1001,7 +1048,7 @@ static hg_return_t
 hg_core_finalize(struct hg_core_private_class *hg_core_class)
 {
     hg_util_int32_t n_addrs, n_contexts;
-    hg_return_t ret = HG_SUCCESS;
+    hg_return_t ret = HG_SUCCESS, hg_ret;
     na_return_t na_ret;
 
     if (!hg_core_class)
@@ -1016,6 +1063,44 @@ hg_core_finalize(struct hg_core_private_class *hg_core_class)
     HG_CHECK_ERROR(n_addrs != 0, done, ret, HG_BUSY,
         "HG addrs must be freed before finalizing HG (%d remaining)", n_addrs);
 
+    /* Check caches before tearing anything down so that finalize can be
+     * called again once bulk handles are freed */
+    HG_CHECK_ERROR(hg_core_class->bulk_reg_cache &&
+                       hg_bulk_reg_cache_in_use(hg_core_class->bulk_reg_cache),
+        done, ret, HG_BUSY,
+        "Bulk handles must be freed before finalizing HG");
+#ifdef NA_HAS_SM
+    HG_CHECK_ERROR(hg_core_class->bulk_reg_sm_cache &&
+                       hg_bulk_reg_cache_in_use(
+                           hg_core_class->bulk_reg_sm_cache),
+        done, ret, HG_BUSY,
+        "Bulk handles must be freed before finalizing HG (SM)");
+#endif
+
+    /* Release cached descriptors and registrations before finalizing NA,
+     * caches are always destroyed past this point so keep going on error
+     * and return the first one */
+    if (hg_core_class->bulk_desc_cache) {
+        hg_ret = hg_bulk_desc_cache_destroy(hg_core_class->bulk_desc_cache);
+        if (hg_ret != HG_SUCCESS && ret == HG_SUCCESS)
+            ret = hg_ret;
+        hg_core_class->bulk_desc_cache = NULL;
+    }
+    if (hg_core_class->bulk_reg_cache) {
+        hg_ret = hg_bulk_reg_cache_destroy(hg_core_class->bulk_reg_cache);
+        if (hg_ret != HG_SUCCESS && ret == HG_SUCCESS)
+            ret = hg_ret;
+        hg_core_class->bulk_reg_cache = NULL;
+    }
+#ifdef NA_HAS_SM
+    if (hg_core_class->bulk_reg_sm_cache) {
+        hg_ret = hg_bulk_reg_cache_destroy(hg_core_class->bulk_reg_sm_cache);
+        if (hg_ret != HG_SUCCESS && ret == HG_SUCCESS)
+            ret = hg_ret;
+        hg_core_class->bulk_reg_sm_cache = NULL;
+    }
+#endif
+
     /* Delete function map */
     if (hg_core_class->func_map)
         hg_hash_table_free(hg_core_class->func_map);
@@ -1044,6 +1129,12 @@ hg_core_finalize(struct hg_core_private_class *hg_core_class)
         "Could not finalize NA SM interface (%s)", NA_Error_to_string(na_ret));
 #endif
 
+    if (hg_core_class->mem_copy_init) {
+        int rc = hg_mem_copy_finalize();
+        HG_CHECK_ERROR(rc != HG_UTIL_SUCCESS, done, ret, HG_FAULT,
+            "Could not finalize copy engine");
+    }
+
     /* Free HG class */
     free(hg_core_class);
 
@@ -1057,6 +1148,7 @@ hg_core_context_create(hg_core_class_t *hg_core_class, hg_uint8_t id,
     struct hg_core_private_context **context_ptr)
 {
     struct hg_core_private_context *context = NULL;
+    hg_uint32_t bulk_op_pool_max;
     hg_return_t ret = HG_SUCCESS;
     int na_poll_fd;
 
@@ -1162,8 +1254,12 @@ hg_core_context_create(hg_core_class_t *hg_core_class, hg_uint8_t id,
     context->core_context.id = id;
 
     /* Create pool of bulk op IDs */
+    bulk_op_pool_max = HG_CORE_CONTEXT_CLASS(context)->bulk_op_pool_max;
     ret = hg_bulk_op_pool_create((hg_core_context_t *) context,
-        HG_CORE_BULK_OP_INIT_COUNT, &context->hg_bulk_op_pool);
+        (bulk_op_pool_max > 0 && bulk_op_pool_max < HG_CORE_BULK_OP_INIT_COUNT)
+            ? bulk_op_pool_max
+            : HG_CORE_BULK_OP_INIT_COUNT,
+        bulk_op_pool_max, &context->hg_bulk_op_pool);
     HG_CHECK_HG_ERROR(error, ret, "Could not create bulk op pool");
 
     /* Increment context count of parent class */
@@ -1525,6 +1621,54 @@ hg_core_context_get_bulk_op_pool(struct hg_core_context *core_context)
     return ((struct hg_core_private_context *) core_context)->hg_bulk_op_pool;
 }
 
+/*---------------------------------------------------------------------------*/
+struct hg_bulk_reg_cache *
+hg_core_class_get_bulk_reg_cache(
+    struct hg_core_class *core_class, na_class_t *na_class)
+{
+    struct hg_core_private_class *hg_core_class =
+        (struct hg_core_private_class *) core_class;
+
+#ifdef NA_HAS_SM
+    if (na_class == core_class->na_sm_class)
+        return hg_core_class->bulk_reg_sm_cache;
+#else
+    (void) na_class;
+#endif
+
+    return hg_core_class->bulk_reg_cache;
+}
+
+/*---------------------------------------------------------------------------*/
+struct hg_bulk_desc_cache *
+hg_core_class_get_bulk_desc_cache(struct hg_core_class *core_class)
+{
+    return ((struct hg_core_private_class *) core_class)->bulk_desc_cache;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_uint32_t
+hg_core_class_get_bulk_op_window(struct hg_core_class *core_class)
+{
+    return ((struct hg_core_private_class *) core_class)->bulk_op_window;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_bool_t
+hg_core_addr_get_bulk_compress(struct hg_core_addr *core_addr)
+{
+    return (hg_bool_t) hg_atomic_get32(
+        &((struct hg_core_private_addr *) core_addr)->bulk_compress);
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_core_addr_set_bulk_compress(struct hg_core_addr *core_addr)
+{
+    hg_atomic_set32(
+        &((struct hg_core_private_addr *) core_addr)->bulk_compress, 1);
+}
+
 /*---------------------------------------------------------------------------*/
 static hg_return_t
 hg_core_addr_lookup(struct hg_core_private_class *hg_core_class,
@@ -1639,6 +1783,7 @@ hg_core_addr_create(struct hg_core_private_class *hg_core_class)
 #endif
     hg_core_addr->core_addr.is_self = HG_FALSE;
     hg_atomic_init32(&hg_core_addr->ref_count, 1);
+    hg_atomic_init32(&hg_core_addr->bulk_compress, 0);
 
     /* Increment N addrs from HG class */
     hg_atomic_incr32(&hg_core_class->n_addrs);
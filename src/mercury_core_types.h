@@ -69,6 +69,66 @@ struct hg_init_info {
     /* (Debug) Print stats at exit.
      * Default is: false */
     hg_bool_t stats;
+
+    /* Controls the maximum amount of memory (in bytes) that can be kept
+     * registered by the bulk registration cache. When non-zero, handles
+     * created with HG_Bulk_create() on user buffers re-use previous
+     * registrations of the same address range, and registrations are only
+     * released when evicted. Memory that is freed or unmapped while cached must
+     * be invalidated using HG_Bulk_reg_cache_invalidate(). A value of zero
+     * disables the cache.
+     * Default value is: 0 */
+    hg_size_t bulk_reg_cache_size;
+
+    /* Controls the maximum number of NA operations that a single bulk transfer
+     * keeps in flight. Transfers that require more operations (e.g., handles
+     * made of many segments) issue remaining operations as earlier ones
+     * complete, re-using the same NA operation IDs. A value of zero is
+     * equivalent to using the internal default value.
+     * Default value is: 64 */
+    hg_uint32_t bulk_op_window;
+
+    /* Controls the number of helper threads that are used to split large
+     * memory copies of bulk transfers between local handles (see
+     * hg_mem_copy()). This setting is process-wide: helper threads are shared
+     * by all the HG classes of a process and the first class initialized with
+     * a non-zero value sets their number, values passed by other classes are
+     * ignored until all classes are finalized. A value of zero disables them.
+     * Default value is: 0 */
+    hg_uint32_t copy_thread_count;
+
+    /* Controls the maximum number of remote bulk descriptors kept by the bulk
+     * descriptor cache. When non-zero, deserializing a descriptor that was
+     * already received (e.g., a persistent buffer that clients repeatedly
+     * expose) returns a reference to the previously deserialized handle
+     * instead of decoding it again. Least recently used descriptors are
+     * evicted once the limit is reached. A value of zero disables the cache.
+     * Default value is: 0 */
+    hg_uint32_t bulk_desc_cache_count;
+
+    /* Controls the maximum number of bulk op IDs that each context keeps in
+     * its pool. Pools start with a small number of op IDs and grow on demand;
+     * once the limit is reached, additional transfers use op IDs that are
+     * released on completion. Op IDs that remained unused for an idle period
+     * are also released so that pools shrink back after bursts of transfers.
+     * A value of zero does not limit the size of the pool.
+     * Default value is: 0 */
+    hg_uint32_t bulk_op_pool_max;
+
+    /* Compress large read-only bulk data sent to targets that also enable
+     * this option. Data is compressed by blocks when the RPC is forwarded and
+     * targets pull and decompress blocks as they arrive. Blocks that do not
+     * compress are sent as is, transfers over shared-memory, to self and
+     * of data that does not compress are not affected.
+     * Default is: false */
+    hg_bool_t bulk_compress;
+
+    /* Send CRC32C checksums of read-only bulk data along with RPCs. Targets
+     * pulling that data verify each chunk as it arrives and complete the
+     * transfer with HG_CHECKSUM_ERROR if data does not match. Data that is
+     * sent eagerly is not checksummed.
+     * Default is: false */
+    hg_bool_t bulk_checksum;
 };
 
 /* Error return codes:
@@ -150,7 +210,7 @@ typedef enum {
 #define HG_INIT_INFO_INITIALIZER                                               \
     {                                                                          \
         NA_INIT_INFO_INITIALIZER, NULL, 0, 0, HG_FALSE, HG_FALSE, HG_FALSE,    \
-            HG_FALSE                                                           \
+            HG_FALSE, 0, 0, 0, 0, 0, HG_FALSE, HG_FALSE                        \
     }
 
 #endif /* MERCURY_CORE_TYPES_H */
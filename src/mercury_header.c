@@ -117,12 +117,24 @@ hg_header_proc(
 #ifdef HG_HAS_CHECKSUMS
     /* Checksum of user payload */
     HG_HEADER_PROC_TYPE(buf_ptr, header_hash->payload, hg_uint32_t, op);
-#else
-    (void) hg_header;
-    (void) buf_ptr;
-    (void) op;
 #endif
 
+    if (hg_header->op == HG_INPUT) {
+        /* Size of output landing buffer descriptor */
+        HG_HEADER_PROC_TYPE(
+            buf_ptr, hg_header->msg.input.landing_size, hg_uint32_t, op);
+    } else {
+        /* Size of bulk data returned inline */
+        HG_HEADER_PROC_TYPE(
+            buf_ptr, hg_header->msg.output.eager_size, hg_uint32_t, op);
+        /* Size of payload pushed to output landing buffer */
+        HG_HEADER_PROC_TYPE(
+            buf_ptr, hg_header->msg.output.landing_size, hg_uint32_t, op);
+        /* Target capabilities */
+        HG_HEADER_PROC_TYPE(
+            buf_ptr, hg_header->msg.output.flags, hg_uint32_t, op);
+    }
+
 done:
     return ret;
 }
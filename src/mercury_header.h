@@ -32,18 +32,19 @@ struct hg_header_hash {
 struct hg_header_input {
 #ifdef HG_HAS_CHECKSUMS
     struct hg_header_hash hash; /* Hash */
-#else
-    hg_uint32_t pad;
 #endif
-    /* 160 bits here */
+    hg_uint32_t landing_size; /* Size of output landing descriptor */
+    /* 64/32 bits here */
 };
 
 struct hg_header_output {
 #ifdef HG_HAS_CHECKSUMS
     struct hg_header_hash hash; /* Hash */
 #endif
-    hg_uint32_t pad;
-    /* 128/64 bits here */
+    hg_uint32_t eager_size;   /* Size of bulk data returned ahead of payload */
+    hg_uint32_t landing_size; /* Size of payload pushed to landing buffer */
+    hg_uint32_t flags;        /* Target capabilities */
+    /* 128/96 bits here */
 };
 #if defined(__GNUC__) || defined(_WIN32)
 #    pragma pack(pop)
@@ -62,6 +63,9 @@ struct hg_header {
 /* Public Macros */
 /*****************/
 
+/* Output header flags */
+#define HG_HEADER_BULK_COMPRESS (1 << 0) /* Target pulls compressed data */
+
 /*********************/
 /* Public Prototypes */
 /*********************/
@@ -18,6 +18,7 @@
 
 #ifdef HG_HAS_BOOST
 #    include <boost/preprocessor.hpp>
+#    include <stddef.h>
 
 /**
  * The purpose of these macros is to facilitate generation of encoding/decoding
@@ -27,6 +28,9 @@
  *   - MERCURY_REGISTER
  *   - MERCURY_GEN_PROC
  *   - MERCURY_GEN_STRUCT_PROC
+ * Procs generated for structs that are only made of fixed-width integers
+ * copy the struct as a whole when its layout matches the field sequence,
+ * hg_proc_array_of_<struct_type_name>() procs are also generated for arrays.
  */
 
 /****************/
@@ -57,18 +61,134 @@
             return ret;                                                        \
         }
 
+/* Fixed-width integer types that are encoded as is (in XDR mode, only 32-bit
+ * and 64-bit types have the same size on the wire) */
+#    define HG_GEN_POD_PROBE ~, 1
+#    ifndef HG_HAS_XDR
+#        define HG_GEN_POD_hg_int8_t   HG_GEN_POD_PROBE
+#        define HG_GEN_POD_hg_uint8_t  HG_GEN_POD_PROBE
+#        define HG_GEN_POD_hg_int16_t  HG_GEN_POD_PROBE
+#        define HG_GEN_POD_hg_uint16_t HG_GEN_POD_PROBE
+#        define HG_GEN_POD_hg_bool_t   HG_GEN_POD_PROBE
+#        define HG_GEN_POD_int8_t      HG_GEN_POD_PROBE
+#        define HG_GEN_POD_uint8_t     HG_GEN_POD_PROBE
+#        define HG_GEN_POD_int16_t     HG_GEN_POD_PROBE
+#        define HG_GEN_POD_uint16_t    HG_GEN_POD_PROBE
+#    endif
+#    define HG_GEN_POD_hg_int32_t  HG_GEN_POD_PROBE
+#    define HG_GEN_POD_hg_uint32_t HG_GEN_POD_PROBE
+#    define HG_GEN_POD_hg_int64_t  HG_GEN_POD_PROBE
+#    define HG_GEN_POD_hg_uint64_t HG_GEN_POD_PROBE
+#    define HG_GEN_POD_hg_ptr_t    HG_GEN_POD_PROBE
+#    define HG_GEN_POD_hg_size_t   HG_GEN_POD_PROBE
+#    define HG_GEN_POD_int32_t     HG_GEN_POD_PROBE
+#    define HG_GEN_POD_uint32_t    HG_GEN_POD_PROBE
+#    define HG_GEN_POD_int64_t     HG_GEN_POD_PROBE
+#    define HG_GEN_POD_uint64_t    HG_GEN_POD_PROBE
+
+/* Expand to 1 if type is one of the above types, 0 otherwise */
+#    define HG_GEN_POD_CHECK_N(x, n, ...) n
+#    define HG_GEN_POD_CHECK(...)         HG_GEN_POD_CHECK_N(__VA_ARGS__, 0, ~)
+#    define HG_GEN_IS_POD_TYPE(type)                                           \
+        HG_GEN_POD_CHECK(BOOST_PP_CAT(HG_GEN_POD_, type))
+
+/* Expand to 1 if all fields are fixed-width integers, 0 otherwise */
+#    define HG_GEN_POD_FIELD(s, state, field)                                  \
+        BOOST_PP_AND(state, HG_GEN_IS_POD_TYPE(HG_GEN_GET_TYPE(field)))
+#    define HG_GEN_IS_POD(fields)                                              \
+        BOOST_PP_SEQ_FOLD_LEFT(HG_GEN_POD_FIELD, 1, fields)
+
+/* Check at compile time that struct has no padding and that its fields are
+ * laid out in the order of the field sequence (requires hg_gen_pod_layout_t
+ * to be defined from the field sequence) */
+#    define HG_GEN_POD_SIZE(r, data, field) +sizeof(HG_GEN_GET_TYPE(field))
+#    define HG_GEN_POD_OFFSET(r, struct_type_name, field)                      \
+        &&offsetof(struct_type_name, HG_GEN_GET_NAME(field)) ==                \
+            offsetof(hg_gen_pod_layout_t, HG_GEN_GET_NAME(field))
+#    define HG_GEN_POD_LAYOUT(struct_type_name, fields)                        \
+        (sizeof(struct_type_name) == sizeof(hg_gen_pod_layout_t) &&            \
+            sizeof(hg_gen_pod_layout_t) ==                                     \
+                (0 BOOST_PP_SEQ_FOR_EACH(HG_GEN_POD_SIZE, , fields))           \
+                    BOOST_PP_SEQ_FOR_EACH(                                     \
+                        HG_GEN_POD_OFFSET, struct_type_name, fields))
+#    define HG_GEN_POD_LAYOUT_TYPE(fields)                                     \
+        typedef struct {                                                       \
+            BOOST_PP_SEQ_FOR_EACH(HG_GEN_STRUCT_FIELD, , fields)               \
+        } hg_gen_pod_layout_t;
+
+/* Generate byte order conversion for struct (XDR only) */
+#    ifdef HG_HAS_XDR
+#        define HG_GEN_POD_SWAP(r, struct_type_name, field)                    \
+            hg_proc_pod_swap((char *) pod + offsetof(struct_type_name,         \
+                                                HG_GEN_GET_NAME(field)),       \
+                sizeof(HG_GEN_GET_TYPE(field)));
+#        define HG_GEN_POD_SWAP_PROC(struct_type_name, fields)                 \
+            static HG_INLINE void BOOST_PP_CAT(                                \
+                hg_proc_pod_swap_, struct_type_name)(void *pod)                \
+            {                                                                  \
+                BOOST_PP_SEQ_FOR_EACH(HG_GEN_POD_SWAP, struct_type_name, fields) \
+            }
+#        define HG_GEN_POD_SWAP_CB(struct_type_name)                           \
+            BOOST_PP_CAT(hg_proc_pod_swap_, struct_type_name)
+#    else
+#        define HG_GEN_POD_SWAP_PROC(struct_type_name, fields)
+#        define HG_GEN_POD_SWAP_CB(struct_type_name) NULL
+#    endif
+
+/* Generate proc for array of struct */
+#    define HG_GEN_ARRAY_PROC(struct_type_name, fields)                        \
+        static HG_INLINE hg_return_t BOOST_PP_CAT(                             \
+            hg_proc_array_of_, struct_type_name)(                              \
+            hg_proc_t proc, void *data, hg_size_t count)                       \
+        {                                                                      \
+            hg_return_t ret = HG_SUCCESS;                                      \
+            hg_size_t i;                                                       \
+                                                                               \
+            BOOST_PP_IIF(HG_GEN_IS_POD(fields), HG_GEN_POD_COPY,               \
+                BOOST_PP_TUPLE_EAT(3))(struct_type_name, fields, count)        \
+                                                                               \
+            for (i = 0; i < count; i++) {                                      \
+                ret = BOOST_PP_CAT(hg_proc_, struct_type_name)(                \
+                    proc, (struct_type_name *) data + i);                      \
+                if (unlikely(ret != HG_SUCCESS)) {                             \
+                    return ret;                                                \
+                }                                                              \
+            }                                                                  \
+                                                                               \
+            return ret;                                                        \
+        }
+
+/* Copy count structs at once if layout matches and integers are encoded
+ * with their fixed width */
+#    define HG_GEN_POD_COPY(struct_type_name, fields, count)                   \
+        {                                                                      \
+            HG_GEN_POD_LAYOUT_TYPE(fields)                                     \
+                                                                               \
+            if (HG_GEN_POD_LAYOUT(struct_type_name, fields) &&                 \
+                !(hg_proc_get_flags(proc) & HG_PROC_VARINT))                   \
+                return hg_proc_array_of_pod(proc, data, count,                 \
+                    sizeof(struct_type_name),                                  \
+                    HG_GEN_POD_SWAP_CB(struct_type_name));                     \
+        }
+
 /* Generate proc for struct */
 #    define HG_GEN_STRUCT_PROC(struct_type_name, fields)                       \
+        BOOST_PP_IIF(HG_GEN_IS_POD(fields), HG_GEN_POD_SWAP_PROC,              \
+            BOOST_PP_TUPLE_EAT(2))(struct_type_name, fields)                   \
         static HG_INLINE hg_return_t BOOST_PP_CAT(hg_proc_, struct_type_name)( \
             hg_proc_t proc, void *data)                                        \
         {                                                                      \
             hg_return_t ret = HG_SUCCESS;                                      \
             struct_type_name *struct_data = (struct_type_name *) data;         \
                                                                                \
+            BOOST_PP_IIF(HG_GEN_IS_POD(fields), HG_GEN_POD_COPY,               \
+                BOOST_PP_TUPLE_EAT(3))(struct_type_name, fields, 1)            \
+                                                                               \
             BOOST_PP_SEQ_FOR_EACH(HG_GEN_PROC, struct_data, fields)            \
                                                                                \
             return ret;                                                        \
-        }
+        }                                                                      \
+        HG_GEN_ARRAY_PROC(struct_type_name, fields)
 
 /*****************/
 /* Public Macros */
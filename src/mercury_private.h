@@ -41,6 +41,8 @@ struct hg_completion_entry {
 };
 
 struct hg_bulk_op_pool;
+struct hg_bulk_reg_cache;
+struct hg_bulk_desc_cache;
 
 /*****************/
 /* Public Macros */
@@ -60,6 +62,37 @@ extern "C" {
 HG_PRIVATE struct hg_bulk_op_pool *
 hg_core_context_get_bulk_op_pool(struct hg_core_context *core_context);
 
+/**
+ * Get bulk registration cache associated to NA class (NULL if disabled).
+ */
+HG_PRIVATE struct hg_bulk_reg_cache *
+hg_core_class_get_bulk_reg_cache(
+    struct hg_core_class *core_class, na_class_t *na_class);
+
+/**
+ * Get cache of remote bulk descriptors (NULL if disabled).
+ */
+HG_PRIVATE struct hg_bulk_desc_cache *
+hg_core_class_get_bulk_desc_cache(struct hg_core_class *core_class);
+
+/**
+ * Get max number of NA operations in flight per bulk transfer.
+ */
+HG_PRIVATE hg_uint32_t
+hg_core_class_get_bulk_op_window(struct hg_core_class *core_class);
+
+/**
+ * Check whether target at address pulls compressed bulk data.
+ */
+HG_PRIVATE hg_bool_t
+hg_core_addr_get_bulk_compress(struct hg_core_addr *core_addr);
+
+/**
+ * Record that target at address pulls compressed bulk data.
+ */
+HG_PRIVATE void
+hg_core_addr_set_bulk_compress(struct hg_core_addr *core_addr);
+
 /**
  * Add entry to completion queue.
  */
@@ -78,7 +111,7 @@ hg_bulk_trigger_entry(struct hg_bulk_op_id *hg_bulk_op_id);
  */
 HG_PRIVATE hg_return_t
 hg_bulk_op_pool_create(hg_core_context_t *core_context, unsigned int init_count,
-    struct hg_bulk_op_pool **hg_bulk_op_pool_ptr);
+    unsigned int max_count, struct hg_bulk_op_pool **hg_bulk_op_pool_ptr);
 
 /**
  * Destroy pool of bulk op IDs.
@@ -86,6 +119,38 @@ hg_bulk_op_pool_create(hg_core_context_t *core_context, unsigned int init_count,
 HG_PRIVATE hg_return_t
 hg_bulk_op_pool_destroy(struct hg_bulk_op_pool *hg_bulk_op_pool);
 
+/**
+ * Create cache of memory registrations for NA class.
+ */
+HG_PRIVATE hg_return_t
+hg_bulk_reg_cache_create(na_class_t *na_class, hg_size_t max_size,
+    struct hg_bulk_reg_cache **hg_bulk_reg_cache_ptr);
+
+/**
+ * Destroy cache of memory registrations.
+ */
+HG_PRIVATE hg_return_t
+hg_bulk_reg_cache_destroy(struct hg_bulk_reg_cache *hg_bulk_reg_cache);
+
+/**
+ * Check whether cached registrations are still used by bulk handles.
+ */
+HG_PRIVATE hg_bool_t
+hg_bulk_reg_cache_in_use(struct hg_bulk_reg_cache *hg_bulk_reg_cache);
+
+/**
+ * Create cache of remote bulk descriptors.
+ */
+HG_PRIVATE hg_return_t
+hg_bulk_desc_cache_create(hg_uint32_t max_count,
+    struct hg_bulk_desc_cache **hg_bulk_desc_cache_ptr);
+
+/**
+ * Destroy cache of remote bulk descriptors.
+ */
+HG_PRIVATE hg_return_t
+hg_bulk_desc_cache_destroy(struct hg_bulk_desc_cache *hg_bulk_desc_cache);
+
 #ifdef __cplusplus
 }
 #endif
@@ -16,18 +16,96 @@
 #    include <mchecksum.h>
 #endif
 
+/* Vectorized byte swapping, x86 kernels are selected at run time */
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#    include <immintrin.h>
+#    define HG_PROC_SWAP_X86
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#    include <arm_neon.h>
+#    define HG_PROC_SWAP_NEON
+#endif
+
 /****************/
 /* Local Macros */
 /****************/
 
+/* Arena allocation alignment and default block size */
+#define HG_PROC_ARENA_ALIGN      16
+#define HG_PROC_ARENA_BLOCK_SIZE 4096
+
+/* Align size to arena alignment */
+#define HG_PROC_ARENA_ALIGN_SIZE(size)                                         \
+    (((size) + HG_PROC_ARENA_ALIGN - 1) & ~((hg_size_t) HG_PROC_ARENA_ALIGN - 1))
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
 
+/* HG proc arena block (data follows header) */
+struct hg_proc_arena_block {
+    struct hg_proc_arena_block *next; /* Next (older) block */
+    hg_size_t size;                   /* Usable size */
+    hg_size_t used;                   /* Used size */
+};
+
+/* Byte shuffle masks reversing each 32-bit / 64-bit lane */
+#define HG_PROC_SWAP32_MASK                                                    \
+    3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12
+#define HG_PROC_SWAP64_MASK                                                    \
+    7, 6, 5, 4, 3, 2, 1, 0, 15, 14, 13, 12, 11, 10, 9, 8
+
+/* Size of block header, preserves alignment of data that follows */
+#define HG_PROC_ARENA_HEADER_SIZE                                              \
+    HG_PROC_ARENA_ALIGN_SIZE(sizeof(struct hg_proc_arena_block))
+
 /********************/
 /* Local Prototypes */
 /********************/
 
+/**
+ * Allocate new arena block.
+ */
+static struct hg_proc_arena_block *
+hg_proc_arena_block_alloc(hg_size_t size);
+
+/**
+ * Free all arena blocks.
+ */
+static void
+hg_proc_arena_free(struct hg_proc_arena_block *block);
+
+/**
+ * Swap byte order of count elements of elt_size bytes, scalar version.
+ */
+static void
+hg_proc_array_swap_scalar(
+    char *dst, const char *src, hg_size_t count, hg_size_t elt_size);
+
+#ifdef HG_PROC_SWAP_X86
+/**
+ * Swap byte order using SSSE3 (16 bytes per iteration).
+ */
+static void
+hg_proc_array_swap_ssse3(
+    char *dst, const char *src, hg_size_t count, hg_size_t elt_size);
+
+/**
+ * Swap byte order using AVX2 (32 bytes per iteration).
+ */
+static void
+hg_proc_array_swap_avx2(
+    char *dst, const char *src, hg_size_t count, hg_size_t elt_size);
+#endif
+
+#ifdef HG_PROC_SWAP_NEON
+/**
+ * Swap byte order using NEON (16 bytes per iteration).
+ */
+static void
+hg_proc_array_swap_neon(
+    char *dst, const char *src, hg_size_t count, hg_size_t elt_size);
+#endif
+
 /*******************/
 /* Local Variables */
 /*******************/
@@ -147,6 +225,9 @@ hg_proc_free(hg_proc_t proc)
     if (hg_proc->extra_buf.buf && hg_proc->extra_buf.is_mine)
         hg_mem_aligned_free(hg_proc->extra_buf.buf);
 
+    /* Free arena */
+    hg_proc_arena_free(hg_proc->arena);
+
     /* Free proc */
     free(hg_proc);
 
@@ -330,6 +411,242 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static struct hg_proc_arena_block *
+hg_proc_arena_block_alloc(hg_size_t size)
+{
+    struct hg_proc_arena_block *block;
+
+    block = (struct hg_proc_arena_block *) hg_mem_aligned_alloc(
+        HG_PROC_ARENA_ALIGN, (size_t) (HG_PROC_ARENA_HEADER_SIZE + size));
+    HG_CHECK_ERROR_NORET(
+        block == NULL, done, "Could not allocate arena block");
+
+    block->next = NULL;
+    block->size = size;
+    block->used = 0;
+
+done:
+    return block;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_proc_arena_free(struct hg_proc_arena_block *block)
+{
+    while (block) {
+        struct hg_proc_arena_block *next = block->next;
+
+        hg_mem_aligned_free(block);
+        block = next;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+void *
+hg_proc_alloc(hg_proc_t proc, hg_size_t size)
+{
+    struct hg_proc *hg_proc = (struct hg_proc *) proc;
+    struct hg_proc_arena_block *block;
+    void *ptr = NULL;
+
+    HG_CHECK_ERROR_NORET(proc == HG_PROC_NULL, done, "Proc is not initialized");
+
+    size = HG_PROC_ARENA_ALIGN_SIZE(size);
+    block = hg_proc->arena;
+
+    /* Add a new block if current one is exhausted, previous blocks are kept
+     * until the next arena reset */
+    if (!block || (block->size - block->used) < size) {
+        hg_size_t block_size = (block) ? block->size * 2
+                                       : HG_PROC_ARENA_BLOCK_SIZE -
+                                             HG_PROC_ARENA_HEADER_SIZE;
+        struct hg_proc_arena_block *new_block;
+
+        if (block_size < size)
+            block_size = size;
+
+        new_block = hg_proc_arena_block_alloc(block_size);
+        HG_CHECK_ERROR_NORET(
+            new_block == NULL, done, "Could not grow proc arena");
+
+        new_block->next = block;
+        hg_proc->arena = block = new_block;
+    }
+
+    ptr = (char *) block + HG_PROC_ARENA_HEADER_SIZE + block->used;
+    block->used += size;
+
+done:
+    return ptr;
+}
+
+/*---------------------------------------------------------------------------*/
+hg_return_t
+hg_proc_arena_reset(hg_proc_t proc)
+{
+    struct hg_proc *hg_proc = (struct hg_proc *) proc;
+    hg_return_t ret = HG_SUCCESS;
+
+    HG_CHECK_ERROR(proc == HG_PROC_NULL, done, ret, HG_INVALID_ARG,
+        "Proc is not initialized");
+
+    if (!hg_proc->arena)
+        goto done;
+
+    /* Arena had to grow, replace all blocks by a single one large enough to
+     * satisfy the same amount of allocations next time */
+    if (hg_proc->arena->next) {
+        struct hg_proc_arena_block *block;
+        hg_size_t total_size = 0;
+
+        for (block = hg_proc->arena; block; block = block->next)
+            total_size += block->size;
+
+        hg_proc_arena_free(hg_proc->arena);
+        hg_proc->arena = hg_proc_arena_block_alloc(total_size);
+        HG_CHECK_ERROR(hg_proc->arena == NULL, done, ret, HG_NOMEM,
+            "Could not allocate arena block");
+    } else
+        hg_proc->arena->used = 0;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_proc_array_swap_scalar(
+    char *dst, const char *src, hg_size_t count, hg_size_t elt_size)
+{
+    hg_size_t i;
+
+    if (elt_size == sizeof(hg_uint32_t)) {
+        for (i = 0; i < count; i++) {
+            hg_uint32_t value;
+
+            memcpy(&value, src + i * sizeof(value), sizeof(value));
+#if defined(__GNUC__)
+            value = __builtin_bswap32(value);
+#else
+            value = ((value & 0x000000ffU) << 24) |
+                    ((value & 0x0000ff00U) << 8) |
+                    ((value & 0x00ff0000U) >> 8) | ((value & 0xff000000U) >> 24);
+#endif
+            memcpy(dst + i * sizeof(value), &value, sizeof(value));
+        }
+    } else {
+        for (i = 0; i < count; i++) {
+            hg_uint64_t value;
+
+            memcpy(&value, src + i * sizeof(value), sizeof(value));
+#if defined(__GNUC__)
+            value = __builtin_bswap64(value);
+#else
+            value = ((value & 0x00000000000000ffULL) << 56) |
+                    ((value & 0x000000000000ff00ULL) << 40) |
+                    ((value & 0x0000000000ff0000ULL) << 24) |
+                    ((value & 0x00000000ff000000ULL) << 8) |
+                    ((value & 0x000000ff00000000ULL) >> 8) |
+                    ((value & 0x0000ff0000000000ULL) >> 24) |
+                    ((value & 0x00ff000000000000ULL) >> 40) |
+                    ((value & 0xff00000000000000ULL) >> 56);
+#endif
+            memcpy(dst + i * sizeof(value), &value, sizeof(value));
+        }
+    }
+}
+
+#ifdef HG_PROC_SWAP_X86
+/*---------------------------------------------------------------------------*/
+__attribute__((target("ssse3"))) static void
+hg_proc_array_swap_ssse3(
+    char *dst, const char *src, hg_size_t count, hg_size_t elt_size)
+{
+    const __m128i mask = (elt_size == sizeof(hg_uint32_t))
+                             ? _mm_setr_epi8(HG_PROC_SWAP32_MASK)
+                             : _mm_setr_epi8(HG_PROC_SWAP64_MASK);
+    hg_size_t i, n = (count * elt_size) / sizeof(__m128i);
+
+    /* Buffers may not be aligned */
+    for (i = 0; i < n; i++) {
+        __m128i v = _mm_loadu_si128((const __m128i *) src + i);
+        _mm_storeu_si128((__m128i *) dst + i, _mm_shuffle_epi8(v, mask));
+    }
+
+    n = n * sizeof(__m128i) / elt_size;
+    hg_proc_array_swap_scalar(
+        dst + n * elt_size, src + n * elt_size, count - n, elt_size);
+}
+
+/*---------------------------------------------------------------------------*/
+__attribute__((target("avx2"))) static void
+hg_proc_array_swap_avx2(
+    char *dst, const char *src, hg_size_t count, hg_size_t elt_size)
+{
+    const __m256i mask =
+        (elt_size == sizeof(hg_uint32_t))
+            ? _mm256_setr_epi8(HG_PROC_SWAP32_MASK, HG_PROC_SWAP32_MASK)
+            : _mm256_setr_epi8(HG_PROC_SWAP64_MASK, HG_PROC_SWAP64_MASK);
+    hg_size_t i, n = (count * elt_size) / sizeof(__m256i);
+
+    /* Buffers may not be aligned */
+    for (i = 0; i < n; i++) {
+        __m256i v = _mm256_loadu_si256((const __m256i *) src + i);
+        _mm256_storeu_si256((__m256i *) dst + i, _mm256_shuffle_epi8(v, mask));
+    }
+
+    n = n * sizeof(__m256i) / elt_size;
+    hg_proc_array_swap_scalar(
+        dst + n * elt_size, src + n * elt_size, count - n, elt_size);
+}
+#endif
+
+#ifdef HG_PROC_SWAP_NEON
+/*---------------------------------------------------------------------------*/
+static void
+hg_proc_array_swap_neon(
+    char *dst, const char *src, hg_size_t count, hg_size_t elt_size)
+{
+    hg_size_t i, n = (count * elt_size) / sizeof(uint8x16_t);
+
+    for (i = 0; i < n; i++) {
+        uint8x16_t v = vld1q_u8((const uint8_t *) src + i * sizeof(v));
+        vst1q_u8((uint8_t *) dst + i * sizeof(v),
+            (elt_size == sizeof(hg_uint32_t)) ? vrev32q_u8(v) : vrev64q_u8(v));
+    }
+
+    n = n * sizeof(uint8x16_t) / elt_size;
+    hg_proc_array_swap_scalar(
+        dst + n * elt_size, src + n * elt_size, count - n, elt_size);
+}
+#endif
+
+/*---------------------------------------------------------------------------*/
+void
+hg_proc_array_swap(
+    void *dst, const void *src, hg_size_t count, hg_size_t elt_size)
+{
+#if defined(__BYTE_ORDER__) && (__BYTE_ORDER__ == __ORDER_BIG_ENDIAN__)
+    /* Already in network byte order */
+    (void) elt_size;
+    memmove(dst, src, (size_t) (count * elt_size));
+#elif defined(HG_PROC_SWAP_X86)
+    if (__builtin_cpu_supports("avx2"))
+        hg_proc_array_swap_avx2((char *) dst, (const char *) src, count, elt_size);
+    else if (__builtin_cpu_supports("ssse3"))
+        hg_proc_array_swap_ssse3(
+            (char *) dst, (const char *) src, count, elt_size);
+    else
+        hg_proc_array_swap_scalar(
+            (char *) dst, (const char *) src, count, elt_size);
+#elif defined(HG_PROC_SWAP_NEON)
+    hg_proc_array_swap_neon((char *) dst, (const char *) src, count, elt_size);
+#else
+    hg_proc_array_swap_scalar((char *) dst, (const char *) src, count, elt_size);
+#endif
+}
+
 /*---------------------------------------------------------------------------*/
 hg_return_t
 hg_proc_set_extra_buf_is_mine(hg_proc_t proc, hg_bool_t theirs)
@@ -13,6 +13,7 @@
 
 #include "mercury_types.h"
 
+#include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 #ifdef HG_HAS_XDR
@@ -45,6 +46,15 @@
  */
 typedef enum { HG_CRC16, HG_CRC32, HG_CRC64, HG_NOHASH } hg_proc_hash_t;
 
+/**
+ * Callback converting the fields of a fixed-layout element from/to network
+ * byte order (XDR only).
+ */
+typedef void (*hg_proc_pod_swap_cb_t)(void *pod);
+
+/* Eager bulk state of an RPC handle (see mercury_bulk_proc.h) */
+struct hg_bulk_eager_info;
+
 /*****************/
 /* Public Macros */
 /*****************/
@@ -61,6 +71,15 @@ typedef enum { HG_CRC16, HG_CRC32, HG_CRC64, HG_NOHASH } hg_proc_hash_t;
  */
 #define HG_PROC_SM         (1 << 0)
 #define HG_PROC_BULK_EAGER (1 << 1)
+#define HG_PROC_VIEW       (1 << 2) /* Decode byte arrays as buffer views */
+#define HG_PROC_ARENA      (1 << 3) /* Decode allocations from proc arena */
+#define HG_PROC_VARINT     (1 << 4) /* Encode 32/64-bit integers as varints */
+#define HG_PROC_BULK_EAGER_WRITE                                               \
+    (1 << 5) /* Return data of write-only handles in response */
+#define HG_PROC_BULK_COMPRESS                                                  \
+    (1 << 6) /* Let target pull compressed copies of bulk data */
+#define HG_PROC_BULK_CHECKSUM                                                  \
+    (1 << 7) /* Let target verify bulk data against checksums */
 
 /* Branch predictor hints */
 #ifndef _WIN32
@@ -307,6 +326,26 @@ hg_proc_set_flags(hg_proc_t proc, hg_uint8_t flags);
 static HG_INLINE hg_uint8_t
 hg_proc_get_flags(hg_proc_t proc);
 
+/**
+ * Associate eager bulk state of an RPC handle to the processor. Unlike flags,
+ * the eager bulk state is preserved by hg_proc_reset().
+ *
+ * \param proc [IN]             abstract processor object
+ * \param bulk_eager [IN]       pointer to eager bulk state
+ */
+static HG_INLINE void
+hg_proc_set_bulk_eager(hg_proc_t proc, struct hg_bulk_eager_info *bulk_eager);
+
+/**
+ * Get the eager bulk state associated to the processor.
+ *
+ * \param proc [IN]             abstract processor object
+ *
+ * \return Pointer to eager bulk state or NULL
+ */
+static HG_INLINE struct hg_bulk_eager_info *
+hg_proc_get_bulk_eager(hg_proc_t proc);
+
 /**
  * Get buffer size available for processing.
  *
@@ -373,6 +412,48 @@ hg_proc_save_ptr(hg_proc_t proc, hg_size_t data_size);
 HG_PUBLIC hg_return_t
 hg_proc_restore_ptr(hg_proc_t proc, void *data, hg_size_t data_size);
 
+/**
+ * Allocate size bytes from the arena attached to the processor. This is
+ * intended to be used by proc callbacks when decoding variable-length data.
+ * Memory does not need to be freed individually, it remains valid until
+ * hg_proc_arena_reset() is called (i.e., until HG_Free_input() or
+ * HG_Free_output() is called when used within an RPC).
+ *
+ * \param proc [IN/OUT]         abstract processor object
+ * \param size [IN]             size of allocation
+ *
+ * \return Pointer to allocated memory or NULL in case of failure
+ */
+HG_PUBLIC void *
+hg_proc_alloc(hg_proc_t proc, hg_size_t size);
+
+/**
+ * Release at once all the memory allocated with hg_proc_alloc(). The arena
+ * memory itself is retained for subsequent allocations.
+ *
+ * \param proc [IN/OUT]         abstract processor object
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+HG_PUBLIC hg_return_t
+hg_proc_arena_reset(hg_proc_t proc);
+
+/**
+ * Copy count elements of elt_size bytes (4 or 8) from src to dst, reversing
+ * the byte order of each element if host is little endian. Vectorized
+ * kernels are used when supported by the CPU. dst and src may be identical
+ * but must not otherwise overlap, they do not need to be aligned.
+ * This is used by array procs to convert from/to XDR network byte order.
+ *
+ * \param dst [OUT]             pointer to destination
+ * \param src [IN]              pointer to source
+ * \param count [IN]            number of elements
+ * \param elt_size [IN]         size of one element
+ */
+HG_PUBLIC void
+hg_proc_array_swap(
+    void *dst, const void *src, hg_size_t count, hg_size_t elt_size);
+
 #ifdef HG_HAS_XDR
 /**
  * Get pointer to current XDR stream (for manual encoding).
@@ -560,6 +641,90 @@ hg_proc_hg_uint64_t(hg_proc_t proc, void *data);
 static HG_INLINE hg_return_t
 hg_proc_bytes(hg_proc_t proc, void *data, hg_size_t data_size);
 
+/**
+ * Generic processing routine for encoding stream of bytes that may be
+ * decoded without copy. When decoding with the HG_PROC_VIEW flag set, data
+ * is set to point directly into the proc buffer and remains valid for as long
+ * as that buffer (i.e., until HG_Free_input()/HG_Free_output() is called),
+ * otherwise data is allocated (from the proc arena if the HG_PROC_ARENA flag
+ * is set) and must be released using HG_FREE.
+ * Encoded data is identical to hg_proc_bytes().
+ *
+ * \param proc [IN/OUT]         abstract processor object
+ * \param data [IN/OUT]         pointer to data pointer
+ * \param data_size [IN]        data size
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+static HG_INLINE hg_return_t
+hg_proc_bytes_view(hg_proc_t proc, void **data, hg_size_t data_size);
+
+/**
+ * Generic processing routine for an array of count fixed-layout elements of
+ * pod_size bytes each. Elements must only be made of fixed-width integers
+ * and contain no padding, in which case the array is encoded/decoded with a
+ * single copy. In XDR mode, swap_cb is called on each element once copied
+ * to convert it from/to network byte order. Note that the HG_PROC_VARINT
+ * flag is ignored, callers must process elements individually when it is set.
+ *
+ * \param proc [IN/OUT]         abstract processor object
+ * \param data [IN/OUT]         pointer to array
+ * \param count [IN]            number of elements
+ * \param pod_size [IN]         size of one element
+ * \param swap_cb [IN]          byte order conversion callback (XDR only)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+static HG_INLINE hg_return_t
+hg_proc_array_of_pod(hg_proc_t proc, void *data, hg_size_t count,
+    hg_size_t pod_size, hg_proc_pod_swap_cb_t swap_cb);
+
+/**
+ * Generic processing routine for an array of count 32-bit or 64-bit integers
+ * of int_size bytes each, set is_signed for signed types. Encoded data is
+ * identical to processing each element with hg_proc_hg_(u)int32_t() or
+ * hg_proc_hg_(u)int64_t(), but the proc buffer is only checked and updated
+ * once for the entire array, including when the HG_PROC_VARINT flag is set.
+ *
+ * \param proc [IN/OUT]         abstract processor object
+ * \param data [IN/OUT]         pointer to array
+ * \param count [IN]            number of elements
+ * \param int_size [IN]         size of one element (4 or 8)
+ * \param is_signed [IN]        signed integer type
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+static HG_INLINE hg_return_t
+hg_proc_array_of_int(hg_proc_t proc, void *data, hg_size_t count,
+    hg_size_t int_size, hg_bool_t is_signed);
+
+/**
+ * Generic processing routine for an array of count float or double values
+ * of float_size bytes each. Values are copied as is, in XDR mode they are
+ * converted to network byte order, which is identical to xdr_float() /
+ * xdr_double() on IEEE 754 hosts.
+ *
+ * \param proc [IN/OUT]         abstract processor object
+ * \param data [IN/OUT]         pointer to array
+ * \param count [IN]            number of elements
+ * \param float_size [IN]       size of one element (4 or 8)
+ *
+ * \return HG_SUCCESS or corresponding HG error code
+ */
+static HG_INLINE hg_return_t
+hg_proc_array_of_float(
+    hg_proc_t proc, void *data, hg_size_t count, hg_size_t float_size);
+
+/**
+ * Reverse byte order of a fixed-width integer of size bytes located at ptr
+ * if host is little endian. ptr does not need to be aligned.
+ *
+ * \param ptr [IN/OUT]          pointer to integer
+ * \param size [IN]             integer size
+ */
+static HG_INLINE void
+hg_proc_pod_swap(void *ptr, hg_size_t size);
+
 /**
  * For convenience map stdint types to hg types
  */
@@ -610,6 +775,8 @@ struct hg_proc {
     struct hg_proc_buf extra_buf;
     hg_class_t *hg_class; /* HG class */
     struct hg_proc_buf *current_buf;
+    struct hg_proc_arena_block *arena; /* Arena blocks for decoded data */
+    struct hg_bulk_eager_info *bulk_eager; /* Eager bulk state */
 #ifdef HG_HAS_CHECKSUMS
     void *checksum;       /* Checksum */
     void *checksum_hash;  /* Base checksum buf */
@@ -647,6 +814,20 @@ hg_proc_get_flags(hg_proc_t proc)
     return ((struct hg_proc *) proc)->flags;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_proc_set_bulk_eager(hg_proc_t proc, struct hg_bulk_eager_info *bulk_eager)
+{
+    ((struct hg_proc *) proc)->bulk_eager = bulk_eager;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE struct hg_bulk_eager_info *
+hg_proc_get_bulk_eager(hg_proc_t proc)
+{
+    return ((struct hg_proc *) proc)->bulk_eager;
+}
+
 /*---------------------------------------------------------------------------*/
 static HG_INLINE hg_size_t
 hg_proc_get_size(hg_proc_t proc)
@@ -693,6 +874,161 @@ hg_proc_get_extra_size(hg_proc_t proc)
     return ((struct hg_proc *) proc)->extra_buf.size;
 }
 
+#ifndef HG_HAS_XDR
+/* Maximum encoded size of a 64-bit varint */
+#    define HG_PROC_VARINT_MAX_SIZE 10
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_size_t
+hg_proc_varint_size(hg_uint64_t value)
+{
+#    if defined(__GNUC__)
+    /* Number of significant bits rounded up to 7-bit groups */
+    return (hg_size_t)((64 - __builtin_clzll(value | 1) + 6) / 7);
+#    else
+    hg_size_t size = 1;
+
+    while (value >= 0x80) {
+        value >>= 7;
+        size++;
+    }
+
+    return size;
+#    endif
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_size_t
+hg_proc_varint_encode(hg_uint64_t value, hg_uint8_t *buf)
+{
+    hg_size_t size = 0;
+
+    if (likely(value < 0x80)) {
+        buf[0] = (hg_uint8_t) value;
+        return 1;
+    }
+
+    while (value >= 0x80) {
+        buf[size++] = (hg_uint8_t)(value | 0x80);
+        value >>= 7;
+    }
+    buf[size++] = (hg_uint8_t) value;
+
+    return size;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_size_t
+hg_proc_varint_decode(const hg_uint8_t *buf, hg_size_t buf_size,
+    hg_uint64_t *value)
+{
+    hg_uint64_t result = 0;
+    hg_size_t i, max_size = (buf_size < HG_PROC_VARINT_MAX_SIZE)
+                                ? buf_size
+                                : HG_PROC_VARINT_MAX_SIZE;
+
+    if (likely(max_size > 0 && buf[0] < 0x80)) {
+        *value = buf[0];
+        return 1;
+    }
+
+    for (i = 0; i < max_size; i++) {
+        result |= (hg_uint64_t)(buf[i] & 0x7f) << (7 * i);
+        if (!(buf[i] & 0x80)) {
+            /* Last byte of a 64-bit value only holds one bit */
+            if (unlikely(i == HG_PROC_VARINT_MAX_SIZE - 1 && buf[i] > 1))
+                break;
+            *value = result;
+            return i + 1;
+        }
+    }
+
+    /* Truncated or malformed */
+    return 0;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_uint64_t
+hg_proc_varint_load(const void *data, hg_size_t int_size, hg_bool_t is_signed)
+{
+    if (int_size == sizeof(hg_uint32_t)) {
+        hg_uint32_t value = *(const hg_uint32_t *) data;
+
+        /* Zigzag encoding keeps small negative values small */
+        return is_signed ? (hg_uint64_t)((value << 1) ^ (0U - (value >> 31)))
+                         : (hg_uint64_t) value;
+    } else {
+        hg_uint64_t value = *(const hg_uint64_t *) data;
+
+        return is_signed ? (value << 1) ^ ((hg_uint64_t) 0 - (value >> 63))
+                         : value;
+    }
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_proc_varint_store(
+    void *data, hg_size_t int_size, hg_bool_t is_signed, hg_uint64_t value)
+{
+    if (int_size == sizeof(hg_uint32_t)) {
+        hg_uint32_t value32 = (hg_uint32_t) value;
+
+        if (unlikely(value > 0xffffffff))
+            return HG_PROTOCOL_ERROR;
+        *(hg_uint32_t *) data =
+            is_signed ? (value32 >> 1) ^ (0U - (value32 & 1)) : value32;
+    } else
+        *(hg_uint64_t *) data =
+            is_signed ? (value >> 1) ^ ((hg_uint64_t) 0 - (value & 1)) : value;
+
+    return HG_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_proc_varint(hg_proc_t proc, void *data, hg_size_t int_size,
+    hg_bool_t is_signed)
+{
+    hg_uint64_t value = 0;
+    hg_size_t size;
+    hg_return_t ret = HG_SUCCESS;
+
+    switch (hg_proc_get_op(proc)) {
+        case HG_ENCODE:
+            value = hg_proc_varint_load(data, int_size, is_signed);
+            size = hg_proc_varint_size(value);
+            HG_PROC_CHECK_SIZE(proc, size, done, ret);
+            hg_proc_varint_encode(value,
+                (hg_uint8_t *) ((struct hg_proc *) proc)->current_buf->buf_ptr);
+            break;
+        case HG_DECODE:
+            size = hg_proc_varint_decode(
+                (const hg_uint8_t *) ((struct hg_proc *) proc)
+                    ->current_buf->buf_ptr,
+                ((struct hg_proc *) proc)->current_buf->size_left, &value);
+            if (unlikely(size == 0)) {
+                ret = HG_PROTOCOL_ERROR;
+                goto done;
+            }
+            ret = hg_proc_varint_store(data, int_size, is_signed, value);
+            if (unlikely(ret != HG_SUCCESS))
+                goto done;
+            break;
+        case HG_FREE:
+            goto done;
+        default:
+            ret = HG_INVALID_ARG;
+            goto done;
+    }
+
+    HG_PROC_UPDATE(proc, size);
+    HG_PROC_CHECKSUM_UPDATE(proc, data, int_size);
+
+done:
+    return ret;
+}
+#endif
+
 /*---------------------------------------------------------------------------*/
 static HG_INLINE hg_return_t
 hg_proc_hg_int8_t(hg_proc_t proc, void *data)
@@ -747,6 +1083,11 @@ hg_proc_hg_int32_t(hg_proc_t proc, void *data)
 {
     hg_return_t ret = HG_SUCCESS;
 
+#ifndef HG_HAS_XDR
+    if (hg_proc_get_flags(proc) & HG_PROC_VARINT)
+        return hg_proc_varint(proc, data, sizeof(hg_int32_t), HG_TRUE);
+#endif
+
     HG_PROC_TYPE(proc, hg_int32_t, data, done, ret);
 
 done:
@@ -759,6 +1100,11 @@ hg_proc_hg_uint32_t(hg_proc_t proc, void *data)
 {
     hg_return_t ret = HG_SUCCESS;
 
+#ifndef HG_HAS_XDR
+    if (hg_proc_get_flags(proc) & HG_PROC_VARINT)
+        return hg_proc_varint(proc, data, sizeof(hg_uint32_t), HG_FALSE);
+#endif
+
     HG_PROC_TYPE(proc, hg_uint32_t, data, done, ret);
 
 done:
@@ -771,6 +1117,11 @@ hg_proc_hg_int64_t(hg_proc_t proc, void *data)
 {
     hg_return_t ret = HG_SUCCESS;
 
+#ifndef HG_HAS_XDR
+    if (hg_proc_get_flags(proc) & HG_PROC_VARINT)
+        return hg_proc_varint(proc, data, sizeof(hg_int64_t), HG_TRUE);
+#endif
+
     HG_PROC_TYPE(proc, hg_int64_t, data, done, ret);
 
 done:
@@ -783,6 +1134,11 @@ hg_proc_hg_uint64_t(hg_proc_t proc, void *data)
 {
     hg_return_t ret = HG_SUCCESS;
 
+#ifndef HG_HAS_XDR
+    if (hg_proc_get_flags(proc) & HG_PROC_VARINT)
+        return hg_proc_varint(proc, data, sizeof(hg_uint64_t), HG_FALSE);
+#endif
+
     HG_PROC_TYPE(proc, hg_uint64_t, data, done, ret);
 
 done:
@@ -801,6 +1157,260 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_proc_bytes_view(hg_proc_t proc, void **data, hg_size_t data_size)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    switch (hg_proc_get_op(proc)) {
+        case HG_ENCODE:
+            ret = hg_proc_bytes(proc, *data, data_size);
+            break;
+        case HG_DECODE:
+#ifndef HG_HAS_XDR
+            if (hg_proc_get_flags(proc) & HG_PROC_VIEW) {
+                /* Data must be entirely contained within the buffer */
+                if (unlikely(hg_proc_get_size_left(proc) < data_size)) {
+                    ret = HG_OVERFLOW;
+                    break;
+                }
+                *data = ((struct hg_proc *) proc)->current_buf->buf_ptr;
+                HG_PROC_UPDATE(proc, data_size);
+                HG_PROC_CHECKSUM_UPDATE(proc, *data, data_size);
+                break;
+            }
+#endif
+            if (hg_proc_get_flags(proc) & HG_PROC_ARENA)
+                *data = hg_proc_alloc(proc, data_size);
+            else
+                *data = malloc(data_size);
+            if (*data == NULL) {
+                ret = HG_NOMEM;
+                break;
+            }
+            ret = hg_proc_bytes(proc, *data, data_size);
+            if (ret != HG_SUCCESS) {
+                if (!(hg_proc_get_flags(proc) & HG_PROC_ARENA))
+                    free(*data);
+                *data = NULL;
+            }
+            break;
+        case HG_FREE:
+            if (!(hg_proc_get_flags(proc) & (HG_PROC_VIEW | HG_PROC_ARENA)))
+                free(*data);
+            *data = NULL;
+            break;
+        default:
+            ret = HG_INVALID_ARG;
+            break;
+    }
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_proc_array_of_pod(hg_proc_t proc, void *data, hg_size_t count,
+    hg_size_t pod_size, hg_proc_pod_swap_cb_t swap_cb)
+{
+    hg_size_t data_size;
+    hg_return_t ret = HG_SUCCESS;
+#ifdef HG_HAS_XDR
+    char *buf_ptr;
+    hg_size_t i;
+#endif
+
+    /* Total size must be addressable, a decoded count may be anything */
+    if (unlikely(pod_size != 0 && count > (hg_size_t) SIZE_MAX / pod_size)) {
+        ret = HG_OVERFLOW;
+        goto done;
+    }
+    data_size = count * pod_size;
+
+#ifdef HG_HAS_XDR
+    if (hg_proc_get_op(proc) == HG_FREE || data_size == 0)
+        goto done;
+
+    HG_PROC_CHECK_SIZE(proc, data_size, done, ret);
+
+    /* Reserve data_size and keep XDR stream position in sync */
+    buf_ptr = (char *) hg_proc_save_ptr(proc, data_size);
+    if (hg_proc_get_op(proc) == HG_ENCODE) {
+        memcpy(buf_ptr, data, (size_t) data_size);
+        if (swap_cb)
+            for (i = 0; i < count; i++)
+                swap_cb(buf_ptr + i * pod_size);
+    } else {
+        memcpy(data, buf_ptr, (size_t) data_size);
+        if (swap_cb)
+            for (i = 0; i < count; i++)
+                swap_cb((char *) data + i * pod_size);
+    }
+    HG_PROC_CHECKSUM_UPDATE(proc, data, data_size);
+#else
+    (void) swap_cb;
+
+    HG_PROC_BYTES(proc, data, data_size, done, ret);
+#endif
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+#ifdef HG_HAS_XDR
+static HG_INLINE hg_return_t
+hg_proc_array_xdr(
+    hg_proc_t proc, void *data, hg_size_t count, hg_size_t elt_size)
+{
+    hg_size_t data_size = count * elt_size;
+    void *buf_ptr;
+    hg_return_t ret = HG_SUCCESS;
+
+    if (hg_proc_get_op(proc) == HG_FREE || data_size == 0)
+        goto done;
+
+    HG_PROC_CHECK_SIZE(proc, data_size, done, ret);
+
+    /* Reserve data_size and keep XDR stream position in sync */
+    buf_ptr = hg_proc_save_ptr(proc, data_size);
+    if (hg_proc_get_op(proc) == HG_ENCODE)
+        hg_proc_array_swap(buf_ptr, data, count, elt_size);
+    else
+        hg_proc_array_swap(data, buf_ptr, count, elt_size);
+    HG_PROC_CHECKSUM_UPDATE(proc, data, data_size);
+
+done:
+    return ret;
+}
+#endif
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_proc_array_of_int(hg_proc_t proc, void *data, hg_size_t count,
+    hg_size_t int_size, hg_bool_t is_signed)
+{
+    hg_return_t ret = HG_SUCCESS;
+#ifndef HG_HAS_XDR
+    hg_uint8_t *buf_ptr;
+    hg_size_t i, size = 0, len;
+    hg_uint64_t value = 0;
+#endif
+
+    if (unlikely(int_size != sizeof(hg_uint32_t) &&
+                 int_size != sizeof(hg_uint64_t))) {
+        ret = HG_INVALID_ARG;
+        goto done;
+    }
+
+#ifdef HG_HAS_XDR
+    (void) is_signed;
+
+    ret = hg_proc_array_xdr(proc, data, count, int_size);
+#else
+    if (!(hg_proc_get_flags(proc) & HG_PROC_VARINT)) {
+        ret = hg_proc_array_of_pod(proc, data, count, int_size, NULL);
+        goto done;
+    }
+
+    switch (hg_proc_get_op(proc)) {
+        case HG_ENCODE:
+            /* Buffer is only checked once, encoded size must be computed
+             * first if the worst case does not fit */
+            if (((struct hg_proc *) proc)->current_buf->size_left /
+                    HG_PROC_VARINT_MAX_SIZE <
+                count) {
+                for (i = 0; i < count; i++)
+                    size += hg_proc_varint_size(
+                        hg_proc_varint_load((const char *) data + i * int_size,
+                            int_size, is_signed));
+                HG_PROC_CHECK_SIZE(proc, size, done, ret);
+            }
+
+            buf_ptr =
+                (hg_uint8_t *) ((struct hg_proc *) proc)->current_buf->buf_ptr;
+            for (i = 0, size = 0; i < count; i++)
+                size += hg_proc_varint_encode(
+                    hg_proc_varint_load(
+                        (const char *) data + i * int_size, int_size, is_signed),
+                    buf_ptr + size);
+            break;
+        case HG_DECODE:
+            buf_ptr =
+                (hg_uint8_t *) ((struct hg_proc *) proc)->current_buf->buf_ptr;
+            for (i = 0; i < count; i++) {
+                len = hg_proc_varint_decode(buf_ptr,
+                    ((struct hg_proc *) proc)->current_buf->size_left - size,
+                    &value);
+                if (unlikely(len == 0)) {
+                    ret = HG_PROTOCOL_ERROR;
+                    goto done;
+                }
+                ret = hg_proc_varint_store(
+                    (char *) data + i * int_size, int_size, is_signed, value);
+                if (unlikely(ret != HG_SUCCESS))
+                    goto done;
+                buf_ptr += len;
+                size += len;
+            }
+            break;
+        case HG_FREE:
+            goto done;
+        default:
+            ret = HG_INVALID_ARG;
+            goto done;
+    }
+
+    HG_PROC_UPDATE(proc, size);
+    HG_PROC_CHECKSUM_UPDATE(proc, data, count * int_size);
+#endif
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE hg_return_t
+hg_proc_array_of_float(
+    hg_proc_t proc, void *data, hg_size_t count, hg_size_t float_size)
+{
+    hg_return_t ret = HG_SUCCESS;
+
+    if (unlikely(float_size != sizeof(float) && float_size != sizeof(double))) {
+        ret = HG_INVALID_ARG;
+        goto done;
+    }
+
+#ifdef HG_HAS_XDR
+    ret = hg_proc_array_xdr(proc, data, count, float_size);
+#else
+    ret = hg_proc_array_of_pod(proc, data, count, float_size, NULL);
+#endif
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_INLINE void
+hg_proc_pod_swap(void *ptr, hg_size_t size)
+{
+#if !defined(__BYTE_ORDER__) || (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+    unsigned char *bytes = (unsigned char *) ptr, tmp;
+    hg_size_t i;
+
+    for (i = 0; i < size / 2; i++) {
+        tmp = bytes[i];
+        bytes[i] = bytes[size - 1 - i];
+        bytes[size - 1 - i] = tmp;
+    }
+#else
+    (void) ptr;
+    (void) size;
+#endif
+}
+
 #ifdef __cplusplus
 }
 #endif
@@ -39,8 +39,12 @@ hg_proc_hg_bulk_t(hg_proc_t proc, void *data)
 
     switch (hg_proc_get_op(proc)) {
         case HG_ENCODE: {
-            hg_uint8_t flags = 0;
-            hg_bool_t use_eager = HG_FALSE;
+            struct hg_bulk_eager_info *eager_info =
+                hg_proc_get_bulk_eager(proc);
+            hg_bulk_t compressed = HG_BULK_NULL;
+            unsigned long flags = 0;
+            hg_bool_t use_eager = HG_FALSE, below_threshold = HG_TRUE;
+            hg_size_t len;
 
             HG_LOG_DEBUG("HG_ENCODE");
 
@@ -58,8 +62,22 @@ hg_proc_hg_bulk_t(hg_proc_t proc, void *data)
                 flags |= HG_BULK_SM;
 #endif
 
+            /* Checksums of data are sent along with the descriptor */
+            if (hg_proc_get_flags(proc) & HG_PROC_BULK_CHECKSUM)
+                flags |= HG_BULK_CHECKSUM;
+
+            /* Within RPCs, only inline data below the class threshold */
+            len = HG_Bulk_get_size(*bulk_ptr);
+            if (eager_info) {
+                hg_util_int32_t threshold =
+                    hg_atomic_get32(&eager_info->eager_class->threshold);
+
+                below_threshold = (len <= (hg_size_t) threshold);
+            }
+
             /* Try to make everything fit in an eager buffer */
-            if (hg_proc_get_flags(proc) & HG_PROC_BULK_EAGER) {
+            if ((hg_proc_get_flags(proc) & HG_PROC_BULK_EAGER) &&
+                below_threshold) {
                 HG_LOG_DEBUG(
                     "Proc size left is %zu bytes", hg_proc_get_size_left(proc));
                 buf_size = HG_Bulk_get_serialize_size(
@@ -75,13 +93,55 @@ hg_proc_hg_bulk_t(hg_proc_t proc, void *data)
             } else /* We must recompute the serialize size without eager flag */
                 buf_size = HG_Bulk_get_serialize_size(*bulk_ptr, flags);
 
+            /* Data pushed by the target to write-only handles can be returned
+             * along with the response instead */
+            if ((hg_proc_get_flags(proc) & HG_PROC_BULK_EAGER_WRITE) &&
+                eager_info && below_threshold &&
+                hg_bulk_eager_write_reserve(eager_info, *bulk_ptr)) {
+                HG_LOG_DEBUG("HG_BULK_EAGER_WRITE flag set");
+                flags |= HG_BULK_EAGER_WRITE;
+            }
+
+            /* Data that is not inlined may be pulled in compressed form */
+            if ((hg_proc_get_flags(proc) & HG_PROC_BULK_COMPRESS) &&
+                eager_info && !(flags & HG_BULK_EAGER_WRITE) &&
+                !((flags & HG_BULK_EAGER) && hg_bulk_is_eager(*bulk_ptr))) {
+                compressed =
+                    hg_bulk_compress_attach(eager_info, *bulk_ptr, flags);
+                if (compressed != HG_BULK_NULL) {
+                    HG_LOG_DEBUG("Attaching compressed copy of handle");
+                    buf_size = hg_bulk_compress_get_serialize_size(
+                        *bulk_ptr, flags, compressed);
+                }
+            }
+
+            /* Account inlined and RMA transfers */
+            if (eager_info) {
+                struct hg_bulk_eager_class *eager_class =
+                    eager_info->eager_class;
+
+                if ((flags & HG_BULK_EAGER_WRITE) ||
+                    ((flags & HG_BULK_EAGER) && hg_bulk_is_eager(*bulk_ptr)))
+                    hg_atomic_incr64(&eager_class->inlined_count);
+                else
+                    hg_atomic_incr64(&eager_class->rma_count);
+            }
+
             HG_LOG_DEBUG("Serialize size for bulk handle is %zu", buf_size);
 
             /* Encode size */
             ret = hg_proc_uint64_t(proc, &buf_size);
             HG_CHECK_HG_ERROR(done, ret, "Could not encode serialize size");
 
-            if (buf_size == hg_bulk_get_serialize_cached_size(*bulk_ptr)) {
+            if (compressed != HG_BULK_NULL) {
+                buf = hg_proc_save_ptr(proc, buf_size);
+                ret = hg_bulk_compress_serialize(
+                    buf, buf_size, flags, *bulk_ptr, compressed);
+                HG_CHECK_HG_ERROR(done, ret, "Could not serialize handle");
+                hg_proc_restore_ptr(proc, buf, buf_size);
+            } else if (!(flags & (HG_BULK_EAGER_WRITE | HG_BULK_CHECKSUM)) &&
+                       buf_size ==
+                           hg_bulk_get_serialize_cached_size(*bulk_ptr)) {
                 HG_LOG_DEBUG("Using cached pointer to serialized handle");
                 void *cached_ptr = hg_bulk_get_serialize_cached_ptr(*bulk_ptr);
                 hg_proc_bytes(proc, cached_ptr, buf_size);
@@ -112,6 +172,15 @@ hg_proc_hg_bulk_t(hg_proc_t proc, void *data)
             ret = HG_Bulk_deserialize(hg_class, bulk_ptr, buf, buf_size);
             HG_CHECK_HG_ERROR(done, ret, "Could not deserialize handle");
 
+            /* Data pushed to the handle may have to be returned along with
+             * the response */
+            if ((hg_proc_get_flags(proc) & HG_PROC_BULK_EAGER_WRITE) &&
+                hg_proc_get_bulk_eager(proc)) {
+                ret = hg_bulk_eager_write_attach(
+                    hg_proc_get_bulk_eager(proc), *bulk_ptr);
+                HG_CHECK_HG_ERROR(done, ret, "Could not attach handle");
+            }
+
             /* Cache serialize ptr to buf */
             HG_LOG_DEBUG("Caching pointer to serialized bulk handle (%p, %llu)",
                 buf, buf_size);
@@ -34,6 +34,14 @@ struct hg_info {
     hg_uint8_t context_id; /* Context ID at target/origin */
 };
 
+/* Eager bulk statistics */
+struct hg_bulk_eager_stats {
+    hg_uint64_t inlined; /* Bulk handles whose data was inlined in RPCs */
+    hg_uint64_t rma;     /* Bulk handles left for RMA transfers */
+    hg_size_t threshold; /* Current inline threshold (bytes) */
+    hg_uint32_t rtt;     /* Smoothed RPC round-trip time (us) */
+};
+
 /**
  * Bulk transfer operators.
  */
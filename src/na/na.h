@@ -774,6 +774,19 @@ NA_Get(na_class_t *na_class, na_context_t *context, na_cb_t callback, void *arg,
     na_size_t data_size, na_addr_t remote_addr, na_uint8_t remote_id,
     na_op_id_t *op_id);
 
+/**
+ * Test whether NA_Put() writes all of its data to remote memory before it
+ * returns. In that case, a message sent after NA_Put() returns is received
+ * after the data has landed, even though completion of the put is still only
+ * reported through its callback.
+ *
+ * \param na_class [IN]         pointer to NA class
+ *
+ * eturn NA_TRUE if puts complete synchronously or NA_FALSE if not
+ */
+static NA_INLINE na_bool_t
+NA_Put_is_sync(const na_class_t *na_class) NA_WARN_UNUSED_RESULT;
+
 /**
  * Retrieve file descriptor from NA plugin when supported. The descriptor
  * can be used by upper layers for manual polling through the usual
@@ -969,6 +982,7 @@ struct na_class_ops {
         na_offset_t local_offset, na_mem_handle_t remote_mem_handle,
         na_offset_t remote_offset, na_size_t length, na_addr_t remote_addr,
         na_uint8_t remote_id, na_op_id_t *op_id);
+    na_bool_t (*put_is_sync)(const na_class_t *na_class);
     int (*na_poll_get_fd)(na_class_t *na_class, na_context_t *context);
     na_bool_t (*na_poll_try_wait)(na_class_t *na_class, na_context_t *context);
     na_return_t (*progress)(
@@ -1139,6 +1153,15 @@ NA_Get(na_class_t *na_class, na_context_t *context, na_cb_t callback, void *arg,
         data_size, remote_addr, remote_id, op_id);
 }
 
+/*---------------------------------------------------------------------------*/
+static NA_INLINE na_bool_t
+NA_Put_is_sync(const na_class_t *na_class)
+{
+    return (na_class->ops->put_is_sync)
+               ? na_class->ops->put_is_sync(na_class)
+               : NA_FALSE;
+}
+
 /*---------------------------------------------------------------------------*/
 static NA_INLINE int
 NA_Poll_get_fd(na_class_t *na_class, na_context_t *context)
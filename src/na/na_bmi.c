@@ -488,6 +488,7 @@ const struct na_class_ops NA_PLUGIN_OPS(bmi) = {
     na_bmi_mem_handle_deserialize,        /* mem_handle_deserialize */
     na_bmi_put,                           /* put */
     na_bmi_get,                           /* get */
+    NULL,                                 /* put_is_sync */
     NULL,                                 /* poll_get_fd */
     NULL,                                 /* poll_try_wait */
     na_bmi_progress,                      /* progress */
@@ -405,6 +405,7 @@ const struct na_class_ops NA_PLUGIN_OPS(cci) = {
     na_cci_mem_handle_deserialize,        /* mem_handle_deserialize */
     na_cci_put,                           /* put */
     na_cci_get,                           /* get */
+    NULL,                                 /* put_is_sync */
     na_cci_poll_get_fd,                   /* poll_get_fd */
     NULL,                                 /* poll_try_wait */
     na_cci_progress,                      /* progress */
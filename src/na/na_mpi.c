@@ -435,6 +435,7 @@ const struct na_class_ops NA_PLUGIN_OPS(mpi) = {
     na_mpi_mem_handle_deserialize,        /* mem_handle_deserialize */
     na_mpi_put,                           /* put */
     na_mpi_get,                           /* get */
+    NULL,                                 /* put_is_sync */
     NULL,                                 /* poll_get_fd */
     NULL,                                 /* poll_try_wait */
     na_mpi_progress,                      /* progress */
@@ -1063,6 +1063,7 @@ const struct na_class_ops NA_PLUGIN_OPS(ofi) = {
     na_ofi_mem_handle_deserialize,         /* mem_handle_deserialize */
     na_ofi_put,                            /* put */
     na_ofi_get,                            /* get */
+    NULL,                                  /* put_is_sync */
     na_ofi_poll_get_fd,                    /* poll_get_fd */
     na_ofi_poll_try_wait,                  /* poll_try_wait */
     na_ofi_progress,                       /* progress */
@@ -20,6 +20,7 @@
 #include "mercury_mem.h"
 #include "mercury_poll.h"
 #include "mercury_queue.h"
+#include "mercury_thread.h"
 #include "mercury_thread_rwlock.h"
 #include "mercury_thread_spin.h"
 #include "mercury_time.h"
@@ -72,12 +73,25 @@
 /* Max filename length used for shared files */
 #define NA_SM_MAX_FILENAME 64
 
-/* Max number of shared-memory buffers (reserved by 64-bit atomic integer) */
+/* Default number of shared-memory buffers */
 #define NA_SM_NUM_BUFS 64
 
-/* Size of shared-memory buffer */
+/* Max number of shared-memory buffers (reserved by 512-bit bitmask) */
+#define NA_SM_MAX_BUFS 512
+
+/* Default size of shared-memory buffer */
 #define NA_SM_COPY_BUF_SIZE NA_SM_PAGE_SIZE
 
+/* Default size of msgs that do not fit into a buffer and are pulled by the
+ * receiver (rendezvous) */
+#define NA_SM_RDV_MSG_SIZE (1 << 16)
+
+/* Max size of msgs (must fit into msg header) */
+#define NA_SM_MAX_MSG_SIZE (1 << 20)
+
+/* Max depth of msg queues */
+#define NA_SM_MAX_QUEUE_DEPTH 4096
+
 /* Max number of fds used for cleanup */
 #define NA_SM_CLEANUP_NFDS 16
 
@@ -89,10 +103,6 @@
 #define NA_SM_ADDR_CMD_PUSHED (1 << 1)
 #define NA_SM_ADDR_RESOLVED   (1 << 2)
 
-/* Msg sizes */
-#define NA_SM_UNEXPECTED_SIZE NA_SM_COPY_BUF_SIZE
-#define NA_SM_EXPECTED_SIZE   NA_SM_UNEXPECTED_SIZE
-
 /* Max tag */
 #define NA_SM_MAX_TAG NA_TAG_MAX
 
@@ -106,6 +116,7 @@
 #define NA_SM_OP_COMPLETED (1 << 0)
 #define NA_SM_OP_CANCELED  (1 << 1)
 #define NA_SM_OP_QUEUED    (1 << 2)
+#define NA_SM_OP_ERRORED   (1 << 3)
 
 /* Private data access */
 #define NA_SM_CLASS(na_class) ((struct na_sm_class *) (na_class->plugin_class))
@@ -134,6 +145,10 @@
 #define NA_SM_IOV(x)                                                           \
     ((x)->info.iovcnt > NA_SM_IOV_STATIC_MAX) ? (x)->iov.d : (x)->iov.s
 
+/* Round up to multiple of alignment (power of 2) */
+#define NA_SM_ALIGN(x, align)                                                  \
+    (((na_size_t) (x) + (na_size_t) (align) -1) & ~((na_size_t) (align) -1))
+
 /************************************/
 /* Local Type and Struct Definition */
 /************************************/
@@ -142,13 +157,21 @@
 typedef union {
     struct {
         unsigned int tag : 32;      /* Message tag : UINT MAX */
-        unsigned int buf_size : 16; /* Buffer length: 4KB MAX */
-        unsigned int buf_idx : 8;   /* Index reserved: 64 MAX */
-        unsigned int type : 8;      /* Message type */
+        unsigned int buf_size : 21; /* Buffer length: 1MB MAX */
+        unsigned int buf_idx : 9;   /* Index reserved: 512 MAX */
+        unsigned int type : 2;      /* Message type */
     } hdr;
     na_uint64_t val;
 } na_sm_msg_hdr_t;
 
+/* Msg types (msgs larger than buffers only carry the address of the sender's
+ * buffer and must be acknowledged once the receiver has pulled them) */
+typedef enum {
+    NA_SM_MSG_UNEXPECTED = 1,
+    NA_SM_MSG_EXPECTED,
+    NA_SM_MSG_ACK
+} na_sm_msg_type_t;
+
 /* Make sure this is cache-line aligned */
 typedef union {
     hg_atomic_int64_t val;
@@ -160,14 +183,31 @@ typedef union {
     char pad[NA_SM_CACHE_LINE_SIZE];
 } na_sm_cacheline_atomic_int256_t;
 
-/* Msg buffers (page aligned) */
+typedef union {
+    hg_atomic_int64_t val[NA_SM_MAX_BUFS / 64];
+    char pad[NA_SM_CACHE_LINE_SIZE];
+} na_sm_cacheline_atomic_int512_t;
+
+/* Region layout attributes */
+struct na_sm_region_attr {
+    na_size_t buf_size;      /* Size of msg buffers */
+    na_uint32_t buf_count;   /* Number of msg buffers */
+    na_uint32_t queue_depth; /* Depth of msg queues */
+    na_size_t max_msg_size;  /* Max size of msgs */
+};
+
+/* Msg buffers (locks and page-aligned buffers are placed after queue pairs,
+ * offsets are relative to the pool, which starts the region, so that they are
+ * valid in every process) */
 struct na_sm_copy_buf {
-    hg_thread_spin_t buf_locks[NA_SM_NUM_BUFS];    /* Locks on buffers */
-    char buf[NA_SM_NUM_BUFS][NA_SM_COPY_BUF_SIZE]; /* Array of buffers */
-    na_sm_cacheline_atomic_int64_t available;      /* Available bitmask */
+    na_sm_cacheline_atomic_int512_t available; /* Available bitmask */
+    na_uint64_t locks_offset;                  /* Offset of buffer locks */
+    na_uint64_t bufs_offset;                   /* Offset of buffers */
+    na_uint64_t buf_size;                      /* Size of buffers */
+    na_uint32_t buf_count;                     /* Number of buffers */
 };
 
-/* Msg queue (allocate queue's flexible array member statically) */
+/* Msg queue (queue's flexible array member is sized at region creation) */
 struct na_sm_msg_queue {
     hg_atomic_int32_t prod_head;
     hg_atomic_int32_t prod_tail;
@@ -179,14 +219,8 @@ struct na_sm_msg_queue {
     hg_atomic_int32_t cons_tail;
     unsigned int cons_size;
     unsigned int cons_mask;
-    hg_atomic_int64_t ring[NA_SM_NUM_BUFS]
-        __attribute__((aligned(HG_MEM_CACHE_LINE_SIZE)));
-};
-
-/* Shared queue pair */
-struct na_sm_queue_pair {
-    struct na_sm_msg_queue tx_queue; /* Send queue */
-    struct na_sm_msg_queue rx_queue; /* Recv queue */
+    hg_atomic_int32_t cons_waiting; /* Consumer may block, notify on push */
+    hg_atomic_int64_t ring[] __attribute__((aligned(HG_MEM_CACHE_LINE_SIZE)));
 };
 
 /* Cmd values */
@@ -221,13 +255,18 @@ struct na_sm_cmd_queue {
         __attribute__((aligned(HG_MEM_CACHE_LINE_SIZE)));
 };
 
-/* Shared region */
+/* Shared region (followed by NA_SM_MAX_PEERS pairs of tx / rx msg queues
+ * and msg buffers, sized by the process that creates the region) */
 struct na_sm_region {
-    struct na_sm_copy_buf copy_bufs; /* Pool of msg buffers */
-    struct na_sm_queue_pair queue_pairs[NA_SM_MAX_PEERS]
-        __attribute__((aligned(NA_SM_PAGE_SIZE))); /* Msg queue pairs */
-    struct na_sm_cmd_queue cmd_queue;              /* Cmd queue */
-    na_sm_cacheline_atomic_int256_t available;     /* Available pairs */
+    struct na_sm_copy_buf copy_bufs;           /* Pool of msg buffers (first) */
+    struct na_sm_cmd_queue cmd_queue;          /* Cmd queue */
+    na_sm_cacheline_atomic_int256_t available; /* Available pairs */
+    na_sm_cacheline_atomic_int256_t pending;   /* Pairs with msgs for owner */
+    na_sm_cacheline_atomic_int64_t waiting;    /* Owner may block */
+    na_uint64_t size;                          /* Size of region */
+    na_uint64_t queue_pairs_offset;            /* Offset of msg queue pairs */
+    na_uint64_t queue_size;                    /* Size of msg queues */
+    na_uint64_t max_msg_size;                  /* Max size of msgs */
 };
 
 /* Poll type */
@@ -255,9 +294,11 @@ struct na_sm_addr {
     na_bool_t unexpected;               /* Unexpected address */
 };
 
-/* Address list */
+/* Address list (addresses of peers that use a queue pair of the local region
+ * are indexed by pair so that only pairs with pending msgs are polled) */
 struct na_sm_addr_list {
     HG_LIST_HEAD(na_sm_addr) list;
+    struct na_sm_addr *pair_addrs[NA_SM_MAX_PEERS];
     hg_thread_spin_t lock;
 };
 
@@ -277,6 +318,7 @@ struct na_sm_lookup_args {
 struct na_sm_mem_desc_info {
     unsigned long iovcnt; /* Segment count */
     size_t len;           /* Size of region */
+    size_t stride;        /* Stride between segments of same size (or 0) */
     na_uint8_t flags;     /* Flag of operation access */
 };
 
@@ -301,6 +343,7 @@ struct na_sm_msg_info {
     size_t buf_size;
     na_size_t actual_buf_size;
     na_tag_t tag;
+    unsigned int buf_idx; /* Buffer reserved until rendezvous is acked */
 };
 
 /* Unexpected msg info */
@@ -318,6 +361,19 @@ struct na_sm_unexpected_msg_queue {
     hg_thread_spin_t lock;
 };
 
+/* Ack info (acks are only kept when the queue to the sender is full) */
+struct na_sm_ack_info {
+    HG_QUEUE_ENTRY(na_sm_ack_info) entry;
+    struct na_sm_addr *na_sm_addr;
+    na_sm_msg_hdr_t msg_hdr;
+};
+
+/* Ack queue */
+struct na_sm_ack_queue {
+    HG_QUEUE_HEAD(na_sm_ack_info) queue;
+    hg_thread_spin_t lock;
+};
+
 /* Operation ID */
 struct na_sm_op_id {
     struct na_cb_completion_data completion_data; /* Completion data */
@@ -345,7 +401,11 @@ struct na_sm_endpoint {
     struct na_sm_op_queue unexpected_op_queue; /* Unexpected op queue */
     struct na_sm_op_queue expected_op_queue;   /* Expected op queue */
     struct na_sm_op_queue retry_op_queue;      /* Retry op queue */
+    struct na_sm_op_queue rdv_op_queue;        /* Rendezvous op queue */
+    struct na_sm_ack_queue ack_queue;          /* Ack retry queue */
     struct na_sm_addr_list poll_addr_list;     /* List of addresses to poll */
+    struct na_sm_region_attr region_attr;      /* Layout of shared regions */
+    na_size_t max_msg_size;                    /* Max size of msgs */
     struct na_sm_addr *source_addr;            /* Source addr */
     hg_poll_set_t *poll_set;                   /* Poll set */
     int sock;                                  /* Sock fd */
@@ -414,7 +474,7 @@ na_sm_shm_cleanup(
  * Initialize queue.
  */
 static void
-na_sm_msg_queue_init(struct na_sm_msg_queue *na_sm_queue);
+na_sm_msg_queue_init(struct na_sm_msg_queue *na_sm_queue, unsigned int count);
 
 /**
  * Multi-producer enqueue.
@@ -488,11 +548,13 @@ static na_return_t
 na_sm_string_to_addr(const char *str, pid_t *pid, na_uint8_t *id);
 
 /**
- * Open shared-memory region.
+ * Open shared-memory region. Region is created with the layout described by
+ * region_attr, or opened with the layout of its creator if region_attr is
+ * NULL.
  */
 static na_return_t
 na_sm_region_open(const char *username, pid_t pid, na_uint8_t id,
-    na_bool_t create, struct na_sm_region **region);
+    const struct na_sm_region_attr *region_attr, struct na_sm_region **region);
 
 /**
  * Close shared-memory region.
@@ -501,6 +563,13 @@ static na_return_t
 na_sm_region_close(const char *username, pid_t pid, na_uint8_t id,
     na_bool_t remove, struct na_sm_region *region);
 
+/**
+ * Get tx or rx msg queue of queue pair.
+ */
+static NA_INLINE struct na_sm_msg_queue *
+na_sm_region_queue(
+    struct na_sm_region *na_sm_region, na_uint8_t index, na_bool_t rx);
+
 /**
  * Open UNIX domain socket.
  */
@@ -578,7 +647,7 @@ na_sm_poll_deregister(hg_poll_set_t *poll_set, int fd);
 static na_return_t
 na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *username,
     pid_t pid, na_uint8_t id, na_bool_t listen, na_bool_t no_wait,
-    na_uint32_t nofile_max);
+    na_uint32_t nofile_max, const struct na_sm_region_attr *region_attr);
 
 /**
  * Close shared-memory endpoint.
@@ -599,6 +668,13 @@ na_sm_queue_pair_reserve(struct na_sm_region *na_sm_region, na_uint8_t *index);
 static NA_INLINE void
 na_sm_queue_pair_release(struct na_sm_region *na_sm_region, na_uint8_t index);
 
+/**
+ * Flag queue pair as having msgs for the owner of the region.
+ */
+static NA_INLINE void
+na_sm_queue_pair_set_pending(
+    struct na_sm_region *na_sm_region, na_uint8_t index);
+
 /**
  * Lookup addr key from map.
  */
@@ -633,6 +709,13 @@ static na_return_t
 na_sm_addr_destroy(struct na_sm_endpoint *na_sm_endpoint, const char *username,
     struct na_sm_addr *na_sm_addr);
 
+/**
+ * Remove address from addresses to poll.
+ */
+static void
+na_sm_poll_addr_remove(
+    struct na_sm_addr_list *poll_addr_list, struct na_sm_addr *na_sm_addr);
+
 /**
  * Resolve address.
  */
@@ -694,6 +777,43 @@ na_sm_buf_copy_from(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index,
 static NA_INLINE void
 na_sm_op_retry(na_class_t *na_class, struct na_sm_op_id *na_sm_op_id);
 
+/**
+ * Copy msg to reserved buffer and post it to tx queue. Msgs larger than
+ * buffers only pass the address of the msg and wait in the rendezvous queue.
+ */
+static na_bool_t
+na_sm_msg_post(struct na_sm_endpoint *na_sm_endpoint,
+    struct na_sm_op_id *na_sm_op_id, unsigned int buf_idx);
+
+/**
+ * Copy received msg to dest, msgs larger than buffers are pulled from the
+ * sender and acked. Buffer is released or msg acked even if copy fails.
+ */
+static na_return_t
+na_sm_msg_copy_from(struct na_sm_ack_queue *ack_queue,
+    struct na_sm_addr *poll_addr, na_sm_msg_hdr_t msg_hdr, void *dest,
+    na_size_t dest_size);
+
+/**
+ * Release buffer or ack msg that cannot be received.
+ */
+static na_return_t
+na_sm_msg_drop(struct na_sm_ack_queue *ack_queue, struct na_sm_addr *poll_addr,
+    na_sm_msg_hdr_t msg_hdr);
+
+/**
+ * Post ack of pulled msg, keep it for retry if queue is full.
+ */
+static na_return_t
+na_sm_msg_ack(struct na_sm_ack_queue *ack_queue, struct na_sm_addr *poll_addr,
+    na_sm_msg_hdr_t msg_hdr);
+
+/**
+ * Flag pushed msg for remote and notify it, only if it is blocked waiting.
+ */
+static NA_INLINE na_return_t
+na_sm_msg_notify(struct na_sm_addr *na_sm_addr);
+
 /**
  * Get IOV index and offset pair from an absolute offset.
  */
@@ -731,6 +851,19 @@ static na_return_t
 na_sm_poll(struct na_sm_endpoint *na_sm_endpoint, const char *username,
     na_bool_t *progressed_ptr);
 
+/**
+ * Progress queue pairs of the local region that peers flagged.
+ */
+static na_return_t
+na_sm_progress_pending(
+    struct na_sm_endpoint *na_sm_endpoint, na_bool_t *progressed_ptr);
+
+/**
+ * Ask peers to notify before blocking, return false if msgs already arrived.
+ */
+static na_bool_t
+na_sm_poll_set_waiting(struct na_sm_endpoint *na_sm_endpoint);
+
 /**
  * Progress on endpoint sock.
  */
@@ -777,15 +910,30 @@ na_sm_progress_rx_queue(struct na_sm_endpoint *na_sm_endpoint,
 static na_return_t
 na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
     struct na_sm_addr *poll_addr, na_sm_msg_hdr_t msg_hdr,
-    struct na_sm_unexpected_msg_queue *unexpected_msg_queue);
+    struct na_sm_unexpected_msg_queue *unexpected_msg_queue,
+    struct na_sm_ack_queue *ack_queue);
 
 /**
  * Process expected messages.
  */
 static na_return_t
 na_sm_process_expected(struct na_sm_op_queue *expected_op_queue,
+    struct na_sm_addr *poll_addr, na_sm_msg_hdr_t msg_hdr,
+    struct na_sm_ack_queue *ack_queue);
+
+/**
+ * Process ack of msg pulled by receiver.
+ */
+static na_return_t
+na_sm_process_ack(struct na_sm_op_queue *rdv_op_queue,
     struct na_sm_addr *poll_addr, na_sm_msg_hdr_t msg_hdr);
 
+/**
+ * Process acks that could not be posted.
+ */
+static na_return_t
+na_sm_process_acks(struct na_sm_ack_queue *ack_queue);
+
 /**
  * Process retries.
  */
@@ -972,6 +1120,10 @@ na_sm_get(na_class_t *na_class, na_context_t *context, na_cb_t callback,
     na_size_t length, na_addr_t remote_addr, na_uint8_t remote_id,
     na_op_id_t *op_id);
 
+/* put_is_sync */
+static NA_INLINE na_bool_t
+na_sm_put_is_sync(const na_class_t *na_class);
+
 /* poll_get_fd */
 static NA_INLINE int
 na_sm_poll_get_fd(na_class_t *na_class, na_context_t *context);
@@ -1042,6 +1194,7 @@ const struct na_class_ops NA_PLUGIN_OPS(sm) = {
     na_sm_mem_handle_deserialize,        /* mem_handle_deserialize */
     na_sm_put,                           /* put */
     na_sm_get,                           /* get */
+    na_sm_put_is_sync,                   /* put_is_sync */
     na_sm_poll_get_fd,                   /* poll_get_fd */
     na_sm_poll_try_wait,                 /* poll_try_wait */
     na_sm_progress,                      /* progress */
@@ -1324,11 +1477,10 @@ na_sm_shm_cleanup(const char *fpath, const struct stat NA_UNUSED *sb,
 
 /*---------------------------------------------------------------------------*/
 static void
-na_sm_msg_queue_init(struct na_sm_msg_queue *na_sm_queue)
+na_sm_msg_queue_init(struct na_sm_msg_queue *na_sm_queue, unsigned int count)
 {
     struct hg_atomic_queue *hg_atomic_queue =
         (struct hg_atomic_queue *) na_sm_queue;
-    unsigned int count = NA_SM_NUM_BUFS;
 
     hg_atomic_queue->prod_size = hg_atomic_queue->cons_size = count;
     hg_atomic_queue->prod_mask = hg_atomic_queue->cons_mask = count - 1;
@@ -1336,6 +1488,9 @@ na_sm_msg_queue_init(struct na_sm_msg_queue *na_sm_queue)
     hg_atomic_init32(&hg_atomic_queue->cons_head, 0);
     hg_atomic_init32(&hg_atomic_queue->prod_tail, 0);
     hg_atomic_init32(&hg_atomic_queue->cons_tail, 0);
+
+    /* Notify until the consumer has started polling */
+    hg_atomic_init32(&na_sm_queue->cons_waiting, 1);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -1468,10 +1623,13 @@ done:
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_region_open(const char *username, pid_t pid, na_uint8_t id,
-    na_bool_t create, struct na_sm_region **region)
+    const struct na_sm_region_attr *region_attr, struct na_sm_region **region)
 {
     char shm_name[NA_SM_MAX_FILENAME] = {'\0'};
     struct na_sm_region *na_sm_region = NULL;
+    na_size_t hdr_size =
+        NA_SM_ALIGN(sizeof(struct na_sm_region), NA_SM_PAGE_SIZE);
+    na_size_t queue_size = 0, locks_offset = 0, bufs_offset = 0, size;
     na_return_t ret = NA_SUCCESS;
     int rc;
 
@@ -1481,34 +1639,86 @@ na_sm_region_open(const char *username, pid_t pid, na_uint8_t id,
     NA_CHECK_ERROR(rc < 0 || rc > NA_SM_MAX_FILENAME, done, ret, NA_OVERFLOW,
         "NA_SM_GEN_SHM_NAME() failed, rc: %d", rc);
 
+    if (region_attr) {
+        /* Queue pairs follow the header, then buffer locks and buffers */
+        queue_size = NA_SM_ALIGN(sizeof(struct na_sm_msg_queue) +
+                                     region_attr->queue_depth *
+                                         sizeof(hg_atomic_int64_t),
+            NA_SM_CACHE_LINE_SIZE);
+        locks_offset = hdr_size + NA_SM_MAX_PEERS * 2 * queue_size;
+        bufs_offset = NA_SM_ALIGN(
+            locks_offset + region_attr->buf_count * sizeof(hg_thread_spin_t),
+            NA_SM_PAGE_SIZE);
+        size = NA_SM_ALIGN(
+            bufs_offset + region_attr->buf_count * region_attr->buf_size,
+            NA_SM_PAGE_SIZE);
+    } else {
+        /* Map header first to get size of region chosen by its creator */
+        NA_LOG_DEBUG("shm_map() %s (header)", shm_name);
+        na_sm_region = (struct na_sm_region *) na_sm_shm_map(
+            shm_name, hdr_size, NA_FALSE);
+        NA_CHECK_ERROR(na_sm_region == NULL, done, ret, NA_NODEV,
+            "Could not map SM region header (%s)", shm_name);
+        size = (na_size_t) na_sm_region->size;
+        ret = na_sm_shm_unmap(NULL, na_sm_region, hdr_size);
+        NA_CHECK_NA_ERROR(done, ret, "Could not unmap SM region header");
+        NA_CHECK_ERROR(size < hdr_size, done, ret, NA_PROTOCOL_ERROR,
+            "Invalid SM region size (%zu)", size);
+    }
+
     /* Open SHM object */
-    NA_LOG_DEBUG("shm_map() %s", shm_name);
+    NA_LOG_DEBUG("shm_map() %s (%zu bytes)", shm_name, size);
     na_sm_region = (struct na_sm_region *) na_sm_shm_map(
-        shm_name, sizeof(struct na_sm_region), create);
+        shm_name, size, region_attr != NULL);
     NA_CHECK_ERROR(na_sm_region == NULL, done, ret, NA_NODEV,
         "Could not map new SM region (%s)", shm_name);
 
-    if (create) {
-        int i;
+    if (region_attr) {
+        hg_thread_spin_t *buf_locks =
+            (hg_thread_spin_t *) ((char *) na_sm_region + locks_offset);
+        unsigned int i;
+
+        /* Save layout */
+        na_sm_region->size = size;
+        na_sm_region->queue_pairs_offset = hdr_size;
+        na_sm_region->queue_size = queue_size;
+        na_sm_region->copy_bufs.locks_offset = locks_offset;
+        na_sm_region->copy_bufs.bufs_offset = bufs_offset;
+        na_sm_region->copy_bufs.buf_size = region_attr->buf_size;
+        na_sm_region->copy_bufs.buf_count = region_attr->buf_count;
+        na_sm_region->max_msg_size = region_attr->max_msg_size;
 
         /* Initialize copy buf (all buffers are available by default) */
-        hg_atomic_init64(
-            &na_sm_region->copy_bufs.available.val, ~((hg_util_int64_t) 0));
-        memset(&na_sm_region->copy_bufs.buf, 0,
-            sizeof(na_sm_region->copy_bufs.buf));
+        for (i = 0; i < NA_SM_MAX_BUFS / 64; i++) {
+            hg_util_int64_t bits = 0;
+
+            if (region_attr->buf_count >= (i + 1) * 64)
+                bits = ~((hg_util_int64_t) 0);
+            else if (region_attr->buf_count > i * 64)
+                bits = (hg_util_int64_t) (
+                    (1ULL << (region_attr->buf_count - i * 64)) - 1);
+            hg_atomic_init64(&na_sm_region->copy_bufs.available.val[i], bits);
+        }
 
         /* Initialize locks */
-        for (i = 0; i < NA_SM_NUM_BUFS; i++)
-            hg_thread_spin_init(&na_sm_region->copy_bufs.buf_locks[i]);
+        for (i = 0; i < region_attr->buf_count; i++)
+            hg_thread_spin_init(&buf_locks[i]);
 
         /* Initialize queue pairs */
-        for (i = 0; i < 4; i++)
+        for (i = 0; i < 4; i++) {
             hg_atomic_init64(
                 &na_sm_region->available.val[i], ~((hg_util_int64_t) 0));
+            hg_atomic_init64(&na_sm_region->pending.val[i], 0);
+        }
+        hg_atomic_init64(&na_sm_region->waiting.val, 1);
 
         for (i = 0; i < NA_SM_MAX_PEERS; i++) {
-            na_sm_msg_queue_init(&na_sm_region->queue_pairs[i].rx_queue);
-            na_sm_msg_queue_init(&na_sm_region->queue_pairs[i].tx_queue);
+            na_sm_msg_queue_init(
+                na_sm_region_queue(na_sm_region, (na_uint8_t) i, NA_TRUE),
+                region_attr->queue_depth);
+            na_sm_msg_queue_init(
+                na_sm_region_queue(na_sm_region, (na_uint8_t) i, NA_FALSE),
+                region_attr->queue_depth);
         }
 
         /* Initialize command queue */
@@ -1539,7 +1749,7 @@ na_sm_region_close(const char *username, pid_t pid, na_uint8_t id,
     }
 
     NA_LOG_DEBUG("shm_unmap() %s", shm_name_ptr);
-    ret = na_sm_shm_unmap(shm_name_ptr, region, sizeof(struct na_sm_region));
+    ret = na_sm_shm_unmap(shm_name_ptr, region, (na_size_t) region->size);
     NA_CHECK_NA_ERROR(
         done, ret, "Could not unmap SM region (%s)", shm_name_ptr);
 
@@ -1547,6 +1757,19 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static NA_INLINE struct na_sm_msg_queue *
+na_sm_region_queue(
+    struct na_sm_region *na_sm_region, na_uint8_t index, na_bool_t rx)
+{
+    /* Queue pairs are laid out as tx, rx */
+    na_uint64_t queue_index = 2 * (na_uint64_t) index + (rx ? 1 : 0);
+
+    return (struct na_sm_msg_queue *) ((char *) na_sm_region +
+                                       na_sm_region->queue_pairs_offset +
+                                       queue_index * na_sm_region->queue_size);
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_sock_open(
@@ -1928,7 +2151,7 @@ done:
 static na_return_t
 na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *username,
     pid_t pid, na_uint8_t id, na_bool_t listen, na_bool_t no_wait,
-    na_uint32_t nofile_max)
+    na_uint32_t nofile_max, const struct na_sm_region_attr *region_attr)
 {
     struct na_sm_region *shared_region = NULL;
     na_uint8_t queue_pair_idx = 0;
@@ -1936,8 +2159,9 @@ na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *username,
     int tx_notify = -1;
     na_return_t ret = NA_SUCCESS, err_ret;
 
-    /* Save listen state */
+    /* Save listen state and region layout */
     na_sm_endpoint->listen = listen;
+    na_sm_endpoint->region_attr = *region_attr;
 
     /* Initialize queues */
     HG_QUEUE_INIT(&na_sm_endpoint->unexpected_msg_queue.queue);
@@ -1952,6 +2176,12 @@ na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *username,
     HG_QUEUE_INIT(&na_sm_endpoint->retry_op_queue.queue);
     hg_thread_spin_init(&na_sm_endpoint->retry_op_queue.lock);
 
+    HG_QUEUE_INIT(&na_sm_endpoint->rdv_op_queue.queue);
+    hg_thread_spin_init(&na_sm_endpoint->rdv_op_queue.lock);
+
+    HG_QUEUE_INIT(&na_sm_endpoint->ack_queue.queue);
+    hg_thread_spin_init(&na_sm_endpoint->ack_queue.lock);
+
     /* Initialize number of fds */
     hg_atomic_init32(&na_sm_endpoint->nofile, 0);
     na_sm_endpoint->nofile_max = nofile_max;
@@ -1959,6 +2189,8 @@ na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *username,
     /* Initialize poll addr list */
     HG_LIST_INIT(&na_sm_endpoint->poll_addr_list.list);
     hg_thread_spin_init(&na_sm_endpoint->poll_addr_list.lock);
+    memset(na_sm_endpoint->poll_addr_list.pair_addrs, 0,
+        sizeof(na_sm_endpoint->poll_addr_list.pair_addrs));
 
     /* Create addr hash-table */
     na_sm_endpoint->addr_map.map =
@@ -1971,7 +2203,8 @@ na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *username,
 
     if (listen) {
         /* If we're listening, create a new shm region */
-        ret = na_sm_region_open(username, pid, id, NA_TRUE, &shared_region);
+        ret = na_sm_region_open(
+            username, pid, id, region_attr, &shared_region);
         NA_CHECK_NA_ERROR(error, ret, "Could not open shared-memory region");
 
         /* Reserve queue pair for loopback */
@@ -2021,9 +2254,9 @@ na_sm_endpoint_open(struct na_sm_endpoint *na_sm_endpoint, const char *username,
         na_sm_endpoint->source_addr->shared_region = shared_region;
 
         na_sm_endpoint->source_addr->tx_queue =
-            &shared_region->queue_pairs[queue_pair_idx].tx_queue;
+            na_sm_region_queue(shared_region, queue_pair_idx, NA_FALSE);
         na_sm_endpoint->source_addr->rx_queue =
-            &shared_region->queue_pairs[queue_pair_idx].rx_queue;
+            na_sm_region_queue(shared_region, queue_pair_idx, NA_TRUE);
     }
 
     /* Add source tx notify to poll set for local notifications */
@@ -2074,6 +2307,8 @@ error:
     hg_thread_spin_destroy(&na_sm_endpoint->unexpected_op_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->expected_op_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->retry_op_queue.lock);
+    hg_thread_spin_destroy(&na_sm_endpoint->rdv_op_queue.lock);
+    hg_thread_spin_destroy(&na_sm_endpoint->ack_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->poll_addr_list.lock);
 
     return ret;
@@ -2085,8 +2320,21 @@ na_sm_endpoint_close(
     struct na_sm_endpoint *na_sm_endpoint, const char *username)
 {
     struct na_sm_addr *source_addr = na_sm_endpoint->source_addr;
+    struct na_sm_ack_info *na_sm_ack_info;
     na_return_t ret = NA_SUCCESS;
     na_bool_t empty;
+    unsigned int i;
+
+    /* Drop acks that could not be posted, peers are going away */
+    hg_thread_spin_lock(&na_sm_endpoint->ack_queue.lock);
+    na_sm_ack_info = HG_QUEUE_FIRST(&na_sm_endpoint->ack_queue.queue);
+    while (na_sm_ack_info) {
+        struct na_sm_ack_info *next = HG_QUEUE_NEXT(na_sm_ack_info, entry);
+        free(na_sm_ack_info);
+        na_sm_ack_info = next;
+    }
+    HG_QUEUE_INIT(&na_sm_endpoint->ack_queue.queue);
+    hg_thread_spin_unlock(&na_sm_endpoint->ack_queue.lock);
 
     /* Check that poll addr list is empty */
     hg_thread_spin_lock(&na_sm_endpoint->poll_addr_list.lock);
@@ -2115,6 +2363,21 @@ na_sm_endpoint_close(
     NA_CHECK_ERROR(empty == NA_FALSE, done, ret, NA_BUSY,
         "Poll addr list should be empty");
 
+    /* Destroy remaining addresses of local queue pairs */
+    hg_thread_spin_lock(&na_sm_endpoint->poll_addr_list.lock);
+    for (i = 0; i < NA_SM_MAX_PEERS; i++) {
+        struct na_sm_addr *na_sm_addr =
+            na_sm_endpoint->poll_addr_list.pair_addrs[i];
+
+        if (!na_sm_addr)
+            continue;
+        na_sm_endpoint->poll_addr_list.pair_addrs[i] = NULL;
+
+        ret = na_sm_addr_destroy(na_sm_endpoint, username, na_sm_addr);
+        NA_CHECK_NA_ERROR(done, ret, "Could not remove address");
+    }
+    hg_thread_spin_unlock(&na_sm_endpoint->poll_addr_list.lock);
+
     /* Check that unexpected message queue is empty */
     hg_thread_spin_lock(&na_sm_endpoint->unexpected_msg_queue.lock);
     empty = HG_QUEUE_IS_EMPTY(&na_sm_endpoint->unexpected_msg_queue.queue);
@@ -2143,6 +2406,13 @@ na_sm_endpoint_close(
     NA_CHECK_ERROR(empty == NA_FALSE, done, ret, NA_BUSY,
         "Retry op queue should be empty");
 
+    /* Check that rendezvous op queue is empty */
+    hg_thread_spin_lock(&na_sm_endpoint->rdv_op_queue.lock);
+    empty = HG_QUEUE_IS_EMPTY(&na_sm_endpoint->rdv_op_queue.queue);
+    hg_thread_spin_unlock(&na_sm_endpoint->rdv_op_queue.lock);
+    NA_CHECK_ERROR(empty == NA_FALSE, done, ret, NA_BUSY,
+        "Rendezvous op queue should be empty");
+
     if (source_addr) {
         if (source_addr->shared_region) {
             na_sm_queue_pair_release(
@@ -2206,6 +2476,8 @@ na_sm_endpoint_close(
     hg_thread_spin_destroy(&na_sm_endpoint->unexpected_op_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->expected_op_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->retry_op_queue.lock);
+    hg_thread_spin_destroy(&na_sm_endpoint->rdv_op_queue.lock);
+    hg_thread_spin_destroy(&na_sm_endpoint->ack_queue.lock);
     hg_thread_spin_destroy(&na_sm_endpoint->poll_addr_list.lock);
 
 done:
@@ -2267,6 +2539,15 @@ na_sm_queue_pair_release(struct na_sm_region *na_sm_region, na_uint8_t index)
     NA_LOG_DEBUG("Released pair index %u", index);
 }
 
+/*---------------------------------------------------------------------------*/
+static NA_INLINE void
+na_sm_queue_pair_set_pending(
+    struct na_sm_region *na_sm_region, na_uint8_t index)
+{
+    /* Atomic OR also orders the msg push before the flag */
+    hg_atomic_or64(&na_sm_region->pending.val[index / 64], 1LL << index % 64);
+}
+
 /*---------------------------------------------------------------------------*/
 static NA_INLINE struct na_sm_addr *
 na_sm_addr_map_lookup(struct na_sm_map *na_sm_map, na_uint64_t key)
@@ -2413,6 +2694,22 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static void
+na_sm_poll_addr_remove(
+    struct na_sm_addr_list *poll_addr_list, struct na_sm_addr *na_sm_addr)
+{
+    hg_thread_spin_lock(&poll_addr_list->lock);
+    if (na_sm_addr->unexpected) {
+        /* Pair may already be used by a new address */
+        if (poll_addr_list->pair_addrs[na_sm_addr->queue_pair_idx] ==
+            na_sm_addr)
+            poll_addr_list->pair_addrs[na_sm_addr->queue_pair_idx] = NULL;
+    } else
+        HG_LIST_REMOVE(na_sm_addr, entry);
+    hg_thread_spin_unlock(&poll_addr_list->lock);
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_addr_resolve(struct na_sm_endpoint *na_sm_endpoint, const char *username,
@@ -2425,8 +2722,26 @@ na_sm_addr_resolve(struct na_sm_endpoint *na_sm_endpoint, const char *username,
     /* Open shm region */
     if (!na_sm_addr->shared_region) {
         ret = na_sm_region_open(username, na_sm_addr->pid, na_sm_addr->id,
-            NA_FALSE, &na_sm_addr->shared_region);
+            NULL, &na_sm_addr->shared_region);
         NA_CHECK_NA_ERROR(error, ret, "Could not open shared-memory region");
+
+        /* Messages of either side must fit into buffers of the other */
+        NA_CHECK_ERROR(na_sm_addr->shared_region->copy_bufs.buf_size !=
+                           na_sm_endpoint->region_attr.buf_size,
+            error, ret, NA_PROTOCOL_ERROR,
+            "Msg buffer size of %d/%" SCNu8 " (%" PRIu64
+            ") does not match local msg buffer size (%zu)",
+            na_sm_addr->pid, na_sm_addr->id,
+            na_sm_addr->shared_region->copy_bufs.buf_size,
+            na_sm_endpoint->region_attr.buf_size);
+        NA_CHECK_ERROR(na_sm_addr->shared_region->max_msg_size !=
+                           na_sm_endpoint->region_attr.max_msg_size,
+            error, ret, NA_PROTOCOL_ERROR,
+            "Max msg size of %d/%" SCNu8 " (%" PRIu64
+            ") does not match local max msg size (%zu)",
+            na_sm_addr->pid, na_sm_addr->id,
+            na_sm_addr->shared_region->max_msg_size,
+            na_sm_endpoint->region_attr.max_msg_size);
     }
 
     /* Reserve queue pair */
@@ -2436,12 +2751,10 @@ na_sm_addr_resolve(struct na_sm_endpoint *na_sm_endpoint, const char *username,
         NA_CHECK_NA_ERROR(error, ret, "Could not reserve queue pair");
         hg_atomic_or32(&na_sm_addr->status, NA_SM_ADDR_RESERVED);
 
-        na_sm_addr->tx_queue =
-            &na_sm_addr->shared_region->queue_pairs[na_sm_addr->queue_pair_idx]
-                 .tx_queue;
-        na_sm_addr->rx_queue =
-            &na_sm_addr->shared_region->queue_pairs[na_sm_addr->queue_pair_idx]
-                 .rx_queue;
+        na_sm_addr->tx_queue = na_sm_region_queue(
+            na_sm_addr->shared_region, na_sm_addr->queue_pair_idx, NA_FALSE);
+        na_sm_addr->rx_queue = na_sm_region_queue(
+            na_sm_addr->shared_region, na_sm_addr->queue_pair_idx, NA_TRUE);
     }
 
     /* Fill cmd header */
@@ -2504,6 +2817,9 @@ na_sm_addr_resolve(struct na_sm_endpoint *na_sm_endpoint, const char *username,
 
     hg_atomic_or32(&na_sm_addr->status, NA_SM_ADDR_RESOLVED);
 
+    /* Queue pair may be reused, wake up on first msg if already blocked */
+    hg_atomic_set32(&na_sm_addr->rx_queue->cons_waiting, 1);
+
     /* Add address to list of addresses to poll */
     hg_thread_spin_lock(&na_sm_endpoint->poll_addr_list.lock);
     HG_LIST_INSERT_HEAD(
@@ -2762,38 +3078,44 @@ done:
 static NA_INLINE na_return_t
 na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int *index)
 {
-    hg_util_int64_t bits = 1LL;
-    unsigned int i = 0;
+    unsigned int j = 0, word_count = (na_sm_copy_buf->buf_count + 63) / 64;
 
     do {
-        hg_util_int64_t available =
-            hg_atomic_get64(&na_sm_copy_buf->available.val);
-        if (!available) {
-            /* Nothing available */
-            break;
-        }
-        if ((available & bits) != bits) {
-            /* Already reserved */
-            hg_atomic_fence();
-            i++;
-            bits <<= 1;
-            continue;
-        }
+        hg_util_int64_t bits = 1LL;
+        unsigned int i = 0;
 
-        if (hg_atomic_cas64(
-                &na_sm_copy_buf->available.val, available, available & ~bits)) {
+        do {
+            hg_util_int64_t available =
+                hg_atomic_get64(&na_sm_copy_buf->available.val[j]);
+            if (!available) {
+                /* Nothing available in this word */
+                j++;
+                break;
+            }
+            if ((available & bits) != bits) {
+                /* Already reserved */
+                hg_atomic_fence();
+                i++;
+                bits <<= 1;
+                continue;
+            }
+
+            if (hg_atomic_cas64(&na_sm_copy_buf->available.val[j], available,
+                    available & ~bits)) {
 #ifdef NA_HAS_DEBUG
-            char buf[65] = {'\0'};
-            available = hg_atomic_get64(&na_sm_copy_buf->available.val);
-            NA_LOG_DEBUG("Reserved bit index %u\n### Available: %s", i,
-                lltoa((hg_util_uint64_t) available, buf, 2));
+                char buf[65] = {'\0'};
+                available = hg_atomic_get64(&na_sm_copy_buf->available.val[j]);
+                NA_LOG_DEBUG("Reserved bit index %u\n### Available: %s",
+                    (i + (j * 64)),
+                    lltoa((hg_util_uint64_t) available, buf, 2));
 #endif
-            *index = i;
-            return NA_SUCCESS;
-        }
-        /* Can't use atomic XOR directly, if there is a race and the cas
-         * fails, we should be able to pick the next one available */
-    } while (i < NA_SM_NUM_BUFS);
+                *index = i + (j * 64);
+                return NA_SUCCESS;
+            }
+            /* Can't use atomic XOR directly, if there is a race and the cas
+             * fails, we should be able to pick the next one available */
+        } while (i < 64);
+    } while (j < word_count);
 
     return NA_AGAIN;
 }
@@ -2802,7 +3124,8 @@ na_sm_buf_reserve(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int *index)
 static NA_INLINE void
 na_sm_buf_release(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index)
 {
-    hg_atomic_or64(&na_sm_copy_buf->available.val, 1LL << index);
+    hg_atomic_or64(
+        &na_sm_copy_buf->available.val[index / 64], 1LL << index % 64);
     NA_LOG_DEBUG("Released bit index %u", index);
 }
 
@@ -2811,9 +3134,16 @@ static NA_INLINE void
 na_sm_buf_copy_to(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index,
     const void *src, size_t n)
 {
-    hg_thread_spin_lock(&na_sm_copy_buf->buf_locks[index]);
-    memcpy(na_sm_copy_buf->buf[index], src, n);
-    hg_thread_spin_unlock(&na_sm_copy_buf->buf_locks[index]);
+    hg_thread_spin_t *buf_lock =
+        (hg_thread_spin_t *) ((char *) na_sm_copy_buf +
+                              na_sm_copy_buf->locks_offset) +
+        index;
+    char *buf = (char *) na_sm_copy_buf + na_sm_copy_buf->bufs_offset +
+                index * na_sm_copy_buf->buf_size;
+
+    hg_thread_spin_lock(buf_lock);
+    hg_mem_copy(buf, src, n);
+    hg_thread_spin_unlock(buf_lock);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2821,9 +3151,17 @@ static NA_INLINE void
 na_sm_buf_copy_from(struct na_sm_copy_buf *na_sm_copy_buf, unsigned int index,
     void *dest, size_t n)
 {
-    hg_thread_spin_lock(&na_sm_copy_buf->buf_locks[index]);
-    memcpy(dest, na_sm_copy_buf->buf[index], n);
-    hg_thread_spin_unlock(&na_sm_copy_buf->buf_locks[index]);
+    hg_thread_spin_t *buf_lock =
+        (hg_thread_spin_t *) ((char *) na_sm_copy_buf +
+                              na_sm_copy_buf->locks_offset) +
+        index;
+    const char *buf = (const char *) na_sm_copy_buf +
+                      na_sm_copy_buf->bufs_offset +
+                      index * na_sm_copy_buf->buf_size;
+
+    hg_thread_spin_lock(buf_lock);
+    hg_mem_copy(dest, buf, n);
+    hg_thread_spin_unlock(buf_lock);
 }
 
 /*---------------------------------------------------------------------------*/
@@ -2842,6 +3180,200 @@ na_sm_op_retry(na_class_t *na_class, struct na_sm_op_id *na_sm_op_id)
     hg_thread_spin_unlock(&retry_op_queue->lock);
 }
 
+/*---------------------------------------------------------------------------*/
+static na_bool_t
+na_sm_msg_post(struct na_sm_endpoint *na_sm_endpoint,
+    struct na_sm_op_id *na_sm_op_id, unsigned int buf_idx)
+{
+    struct na_sm_addr *na_sm_addr = na_sm_op_id->na_sm_addr;
+    struct na_sm_copy_buf *na_sm_copy_buf =
+        &na_sm_addr->shared_region->copy_bufs;
+    struct na_sm_op_queue *rdv_op_queue = &na_sm_endpoint->rdv_op_queue;
+    na_bool_t rdv = (na_sm_op_id->info.msg.buf_size > na_sm_copy_buf->buf_size);
+    na_sm_msg_hdr_t msg_hdr;
+    na_bool_t rc;
+
+    if (rdv) {
+        /* Receiver pulls msg from our address space and acks it, the ack
+         * may be processed as soon as the msg is posted */
+        na_sm_buf_copy_to(na_sm_copy_buf, buf_idx,
+            &na_sm_op_id->info.msg.buf.const_ptr,
+            sizeof(na_sm_op_id->info.msg.buf.const_ptr));
+        na_sm_op_id->info.msg.buf_idx = buf_idx;
+
+        hg_thread_spin_lock(&rdv_op_queue->lock);
+        HG_QUEUE_PUSH_TAIL(&rdv_op_queue->queue, na_sm_op_id, entry);
+        hg_thread_spin_unlock(&rdv_op_queue->lock);
+    } else
+        na_sm_buf_copy_to(na_sm_copy_buf, buf_idx,
+            na_sm_op_id->info.msg.buf.const_ptr,
+            na_sm_op_id->info.msg.buf_size);
+
+    /* Post message to queue */
+    msg_hdr.hdr.type = (na_sm_op_id->completion_data.callback_info.type ==
+                           NA_CB_SEND_UNEXPECTED)
+                           ? NA_SM_MSG_UNEXPECTED
+                           : NA_SM_MSG_EXPECTED;
+    msg_hdr.hdr.buf_idx = buf_idx & 0x1ff;
+    msg_hdr.hdr.buf_size = na_sm_op_id->info.msg.buf_size & 0x1fffff;
+    msg_hdr.hdr.tag = na_sm_op_id->info.msg.tag;
+
+    rc = na_sm_msg_queue_push(na_sm_addr->tx_queue, msg_hdr);
+    if (unlikely(rc == NA_FALSE) && rdv) {
+        hg_thread_spin_lock(&rdv_op_queue->lock);
+        HG_QUEUE_REMOVE(
+            &rdv_op_queue->queue, na_sm_op_id, na_sm_op_id, entry);
+        hg_thread_spin_unlock(&rdv_op_queue->lock);
+    }
+
+    return rc;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_msg_copy_from(struct na_sm_ack_queue *ack_queue,
+    struct na_sm_addr *poll_addr, na_sm_msg_hdr_t msg_hdr, void *dest,
+    na_size_t dest_size)
+{
+    struct na_sm_copy_buf *na_sm_copy_buf =
+        &poll_addr->shared_region->copy_bufs;
+    struct iovec local_iov, remote_iov;
+    na_return_t ret = NA_SUCCESS, ack_ret;
+
+    if (msg_hdr.hdr.buf_size <= na_sm_copy_buf->buf_size) {
+        /* Copy buffer */
+        if (likely(msg_hdr.hdr.buf_size <= dest_size))
+            na_sm_buf_copy_from(na_sm_copy_buf, msg_hdr.hdr.buf_idx, dest,
+                msg_hdr.hdr.buf_size);
+        else {
+            NA_LOG_ERROR("Msg of %zu bytes exceeds buffer size (%zu)",
+                (size_t) msg_hdr.hdr.buf_size, dest_size);
+            ret = NA_MSGSIZE;
+        }
+
+        /* Always release buffer */
+        na_sm_buf_release(na_sm_copy_buf, msg_hdr.hdr.buf_idx);
+
+        return ret;
+    }
+
+    /* Buffer holds the address of the msg, it is released by the sender once
+     * the msg is acked */
+    na_sm_buf_copy_from(na_sm_copy_buf, msg_hdr.hdr.buf_idx,
+        &remote_iov.iov_base, sizeof(remote_iov.iov_base));
+    remote_iov.iov_len = msg_hdr.hdr.buf_size;
+    local_iov.iov_base = dest;
+    local_iov.iov_len = msg_hdr.hdr.buf_size;
+
+    NA_CHECK_ERROR(local_iov.iov_len > dest_size, ack, ret, NA_MSGSIZE,
+        "Msg of %zu bytes exceeds buffer size (%zu)", local_iov.iov_len,
+        dest_size);
+
+#ifdef NA_SM_HAS_CMA
+    {
+        ssize_t nread = process_vm_readv(
+            poll_addr->pid, &local_iov, 1, &remote_iov, 1, 0);
+        NA_CHECK_ERROR(nread < 0, ack, ret, na_sm_errno_to_na(errno),
+            "process_vm_readv() failed (%s)", strerror(errno));
+        NA_CHECK_ERROR((size_t) nread != local_iov.iov_len, ack, ret,
+            NA_MSGSIZE, "Read %zd bytes, was expecting %zu bytes", nread,
+            local_iov.iov_len);
+    }
+#else
+    NA_GOTO_ERROR(
+        ack, ret, NA_OPNOTSUPPORTED, "Not implemented for this platform");
+#endif
+
+ack:
+    /* Always ack so that the sender can complete */
+    ack_ret = na_sm_msg_ack(ack_queue, poll_addr, msg_hdr);
+    NA_CHECK_NA_ERROR(done, ack_ret, "Could not ack msg");
+
+done:
+    return (ret != NA_SUCCESS) ? ret : ack_ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_msg_drop(struct na_sm_ack_queue *ack_queue, struct na_sm_addr *poll_addr,
+    na_sm_msg_hdr_t msg_hdr)
+{
+    struct na_sm_copy_buf *na_sm_copy_buf =
+        &poll_addr->shared_region->copy_bufs;
+
+    /* Sender waits for an ack before releasing buffer of pulled msgs */
+    if (msg_hdr.hdr.buf_size > na_sm_copy_buf->buf_size)
+        return na_sm_msg_ack(ack_queue, poll_addr, msg_hdr);
+
+    na_sm_buf_release(na_sm_copy_buf, msg_hdr.hdr.buf_idx);
+
+    return NA_SUCCESS;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_msg_ack(struct na_sm_ack_queue *ack_queue, struct na_sm_addr *poll_addr,
+    na_sm_msg_hdr_t msg_hdr)
+{
+    struct na_sm_ack_info *na_sm_ack_info = NULL;
+    na_return_t ret = NA_SUCCESS;
+
+    /* Ack refers to the buffer index reserved by the sender */
+    msg_hdr.hdr.type = NA_SM_MSG_ACK;
+
+    if (likely(na_sm_msg_queue_push(poll_addr->tx_queue, msg_hdr))) {
+        ret = na_sm_msg_notify(poll_addr);
+        NA_CHECK_NA_ERROR(done, ret, "Could not send ack notification");
+        goto done;
+    }
+
+    /* Queue is full, keep ack until the sender has consumed messages */
+    na_sm_ack_info =
+        (struct na_sm_ack_info *) malloc(sizeof(struct na_sm_ack_info));
+    NA_CHECK_ERROR(na_sm_ack_info == NULL, done, ret, NA_NOMEM,
+        "Could not allocate ack info");
+    na_sm_ack_info->na_sm_addr = poll_addr;
+    na_sm_ack_info->msg_hdr = msg_hdr;
+
+    hg_thread_spin_lock(&ack_queue->lock);
+    HG_QUEUE_PUSH_TAIL(&ack_queue->queue, na_sm_ack_info, entry);
+    hg_thread_spin_unlock(&ack_queue->lock);
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static NA_INLINE na_return_t
+na_sm_msg_notify(struct na_sm_addr *na_sm_addr)
+{
+    na_bool_t waiting;
+
+    /* Owner of the region only polls the queue pairs that are flagged */
+    if (!na_sm_addr->unexpected)
+        na_sm_queue_pair_set_pending(
+            na_sm_addr->shared_region, na_sm_addr->queue_pair_idx);
+
+    /* Notifications are disabled */
+    if (na_sm_addr->tx_notify <= 0)
+        return NA_SUCCESS;
+
+    /* Order push before reading the flag, remote sets the flag before
+     * checking its queues, so either it sees the msg or we see the flag */
+    hg_atomic_fence();
+
+    /* Remote is busy polling and will find the msg without a syscall */
+    if (na_sm_addr->unexpected)
+        waiting = hg_atomic_cas32(&na_sm_addr->tx_queue->cons_waiting, 1, 0);
+    else
+        waiting =
+            hg_atomic_cas64(&na_sm_addr->shared_region->waiting.val, 1, 0);
+    if (!waiting)
+        return NA_SUCCESS;
+
+    return na_sm_event_set(na_sm_addr->tx_notify);
+}
+
 /*---------------------------------------------------------------------------*/
 static NA_INLINE void
 na_sm_iov_get_index_offset(const struct iovec *iov, unsigned long iovcnt,
@@ -2993,13 +3525,27 @@ na_sm_poll(struct na_sm_endpoint *na_sm_endpoint, const char *username,
     na_bool_t progressed = NA_FALSE;
     na_return_t ret = NA_SUCCESS;
 
-    /* Check whether something is in one of the rx queues */
+    /* Only visit queue pairs of the local region that have msgs (if
+     * listening) */
+    if (na_sm_endpoint->source_addr->shared_region) {
+        na_bool_t progressed_pending = NA_FALSE;
+
+        ret = na_sm_progress_pending(na_sm_endpoint, &progressed_pending);
+        NA_CHECK_NA_ERROR(done, ret, "Could not progress pending queue pairs");
+        progressed |= progressed_pending;
+    }
+
+    /* Check whether something is in one of the rx queues of remote regions */
     hg_thread_spin_lock(&poll_addr_list->lock);
     HG_LIST_FOREACH (poll_addr, &poll_addr_list->list, entry) {
         na_bool_t progressed_rx = NA_FALSE;
 
         hg_thread_spin_unlock(&poll_addr_list->lock);
 
+        /* Busy polling, peers do not need to notify */
+        if (hg_atomic_get32(&poll_addr->rx_queue->cons_waiting))
+            hg_atomic_set32(&poll_addr->rx_queue->cons_waiting, 0);
+
         ret =
             na_sm_progress_rx_queue(na_sm_endpoint, poll_addr, &progressed_rx);
         NA_CHECK_NA_ERROR(done, ret, "Could not progress rx queue");
@@ -3009,8 +3555,10 @@ na_sm_poll(struct na_sm_endpoint *na_sm_endpoint, const char *username,
     }
     hg_thread_spin_unlock(&poll_addr_list->lock);
 
-    /* Look for message in cmd queue (if listening) */
-    if (na_sm_endpoint->source_addr->shared_region) {
+    /* Look for message in cmd queue (if listening), cmds are received
+     * through the sock when waiting */
+    if (na_sm_endpoint->source_addr->shared_region &&
+        !na_sm_endpoint->poll_set) {
         na_bool_t progressed_cmd = NA_FALSE;
 
         ret =
@@ -3025,6 +3573,104 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_progress_pending(
+    struct na_sm_endpoint *na_sm_endpoint, na_bool_t *progressed_ptr)
+{
+    struct na_sm_region *na_sm_region =
+        na_sm_endpoint->source_addr->shared_region;
+    struct na_sm_addr_list *poll_addr_list = &na_sm_endpoint->poll_addr_list;
+    na_bool_t progressed = NA_FALSE;
+    na_return_t ret = NA_SUCCESS;
+    unsigned int j;
+
+    /* Busy polling, peers do not need to notify */
+    if (hg_atomic_get64(&na_sm_region->waiting.val))
+        hg_atomic_set64(&na_sm_region->waiting.val, 0);
+
+    for (j = 0; j < 4; j++) {
+        hg_util_uint64_t pending;
+        unsigned int i;
+
+        if (!hg_atomic_get64(&na_sm_region->pending.val[j]))
+            continue;
+
+        /* Take flags, peers flag pairs again on their next push */
+        pending = (hg_util_uint64_t) hg_atomic_and64(
+            &na_sm_region->pending.val[j], 0);
+
+        for (i = 0; pending; i++, pending >>= 1) {
+            na_uint8_t index = (na_uint8_t) (i + (j * 64));
+            struct na_sm_addr *poll_addr;
+            na_bool_t progressed_rx = NA_FALSE;
+
+            if (!(pending & 1))
+                continue;
+
+            hg_thread_spin_lock(&poll_addr_list->lock);
+            poll_addr = poll_addr_list->pair_addrs[index];
+            hg_thread_spin_unlock(&poll_addr_list->lock);
+
+            /* Pair is flagged again once its address is known */
+            if (!poll_addr)
+                continue;
+
+            ret = na_sm_progress_rx_queue(
+                na_sm_endpoint, poll_addr, &progressed_rx);
+            NA_CHECK_NA_ERROR(done, ret, "Could not progress rx queue");
+            progressed |= progressed_rx;
+
+            /* Keep pair flagged if more msgs are queued */
+            if (!na_sm_msg_queue_is_empty(poll_addr->rx_queue))
+                na_sm_queue_pair_set_pending(na_sm_region, index);
+        }
+    }
+
+    *progressed_ptr = progressed;
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_bool_t
+na_sm_poll_set_waiting(struct na_sm_endpoint *na_sm_endpoint)
+{
+    struct na_sm_region *na_sm_region =
+        na_sm_endpoint->source_addr->shared_region;
+    struct na_sm_addr_list *poll_addr_list = &na_sm_endpoint->poll_addr_list;
+    struct na_sm_addr *poll_addr;
+    na_bool_t empty = NA_TRUE;
+    unsigned int i;
+
+    /* Queue pairs of the local region share a single flag */
+    if (na_sm_region)
+        hg_atomic_set64(&na_sm_region->waiting.val, 1);
+
+    hg_thread_spin_lock(&poll_addr_list->lock);
+    HG_LIST_FOREACH (poll_addr, &poll_addr_list->list, entry)
+        hg_atomic_set32(&poll_addr->rx_queue->cons_waiting, 1);
+
+    /* Order flags before checking queues (see na_sm_msg_notify()) */
+    hg_atomic_fence();
+
+    HG_LIST_FOREACH (poll_addr, &poll_addr_list->list, entry) {
+        if (!na_sm_msg_queue_is_empty(poll_addr->rx_queue)) {
+            empty = NA_FALSE;
+            break;
+        }
+    }
+    hg_thread_spin_unlock(&poll_addr_list->lock);
+
+    /* Peers flag pairs before reading the flag */
+    for (i = 0; na_sm_region && empty && i < 4; i++)
+        if (hg_atomic_get64(&na_sm_region->pending.val[i]))
+            empty = NA_FALSE;
+
+    return empty;
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_progress_sock(struct na_sm_endpoint *na_sm_endpoint, const char *username,
@@ -3104,14 +3750,10 @@ na_sm_process_cmd(struct na_sm_endpoint *na_sm_endpoint, const char *username,
             na_sm_addr->queue_pair_idx = cmd_hdr.hdr.pair_idx;
 
             /* Invert queues so that local rx is remote tx */
-            na_sm_addr->tx_queue =
-                &na_sm_addr->shared_region
-                     ->queue_pairs[na_sm_addr->queue_pair_idx]
-                     .rx_queue;
-            na_sm_addr->rx_queue =
-                &na_sm_addr->shared_region
-                     ->queue_pairs[na_sm_addr->queue_pair_idx]
-                     .tx_queue;
+            na_sm_addr->tx_queue = na_sm_region_queue(
+                na_sm_addr->shared_region, na_sm_addr->queue_pair_idx, NA_TRUE);
+            na_sm_addr->rx_queue = na_sm_region_queue(na_sm_addr->shared_region,
+                na_sm_addr->queue_pair_idx, NA_FALSE);
 
             /* Invert descriptors so that local rx is remote tx */
             na_sm_addr->tx_notify = rx_notify;
@@ -3131,28 +3773,29 @@ na_sm_process_cmd(struct na_sm_endpoint *na_sm_endpoint, const char *username,
             /* Unexpected addresses are always resolved */
             hg_atomic_or32(&na_sm_addr->status, NA_SM_ADDR_RESOLVED);
 
-            /* Add address to list of addresses to poll */
+            /* Add address to addresses to poll, a previous address of that
+             * pair that is still referenced no longer receives msgs */
             hg_thread_spin_lock(&na_sm_endpoint->poll_addr_list.lock);
-            HG_LIST_INSERT_HEAD(
-                &na_sm_endpoint->poll_addr_list.list, na_sm_addr, entry);
+            na_sm_endpoint->poll_addr_list
+                .pair_addrs[na_sm_addr->queue_pair_idx] = na_sm_addr;
             hg_thread_spin_unlock(&na_sm_endpoint->poll_addr_list.lock);
+
+            /* Msgs may have been pushed before the pair was known */
+            na_sm_queue_pair_set_pending(
+                na_sm_addr->shared_region, na_sm_addr->queue_pair_idx);
             break;
         }
         case NA_SM_RELEASED: {
             struct na_sm_addr *na_sm_addr = NULL;
             na_bool_t found = NA_FALSE;
 
-            /* Find address from list of addresses to poll */
+            /* Find address from addresses to poll */
             hg_thread_spin_lock(&na_sm_endpoint->poll_addr_list.lock);
-            HG_LIST_FOREACH (
-                na_sm_addr, &na_sm_endpoint->poll_addr_list.list, entry) {
-                if ((na_sm_addr->queue_pair_idx == cmd_hdr.hdr.pair_idx) &&
-                    (na_sm_addr->pid == (pid_t) cmd_hdr.hdr.pid) &&
-                    (na_sm_addr->id == cmd_hdr.hdr.id)) {
-                    found = NA_TRUE;
-                    break;
-                }
-            }
+            na_sm_addr =
+                na_sm_endpoint->poll_addr_list.pair_addrs[cmd_hdr.hdr.pair_idx];
+            if (na_sm_addr && (na_sm_addr->pid == (pid_t) cmd_hdr.hdr.pid) &&
+                (na_sm_addr->id == cmd_hdr.hdr.id))
+                found = NA_TRUE;
             hg_thread_spin_unlock(&na_sm_endpoint->poll_addr_list.lock);
 
             if (!found) {
@@ -3170,10 +3813,8 @@ na_sm_process_cmd(struct na_sm_endpoint *na_sm_endpoint, const char *username,
             NA_LOG_DEBUG("Freeing addr for PID=%d, ID=%d", na_sm_addr->pid,
                 na_sm_addr->id);
 
-            /* Remove address from list of addresses to poll */
-            hg_thread_spin_lock(&na_sm_endpoint->poll_addr_list.lock);
-            HG_LIST_REMOVE(na_sm_addr, entry);
-            hg_thread_spin_unlock(&na_sm_endpoint->poll_addr_list.lock);
+            /* Remove address from addresses to poll */
+            na_sm_poll_addr_remove(&na_sm_endpoint->poll_addr_list, na_sm_addr);
 
             /* Destroy source address */
             ret = na_sm_addr_destroy(na_sm_endpoint, username, na_sm_addr);
@@ -3245,18 +3886,24 @@ na_sm_progress_rx_queue(struct na_sm_endpoint *na_sm_endpoint,
 
     /* Process expected and unexpected messages */
     switch (msg_hdr.hdr.type) {
-        case NA_CB_SEND_UNEXPECTED:
+        case NA_SM_MSG_UNEXPECTED:
             ret = na_sm_process_unexpected(&na_sm_endpoint->unexpected_op_queue,
-                poll_addr, msg_hdr, &na_sm_endpoint->unexpected_msg_queue);
+                poll_addr, msg_hdr, &na_sm_endpoint->unexpected_msg_queue,
+                &na_sm_endpoint->ack_queue);
             NA_CHECK_NA_ERROR(
                 done, ret, "Could not make progress on unexpected msg");
             break;
-        case NA_CB_SEND_EXPECTED:
-            ret = na_sm_process_expected(
-                &na_sm_endpoint->expected_op_queue, poll_addr, msg_hdr);
+        case NA_SM_MSG_EXPECTED:
+            ret = na_sm_process_expected(&na_sm_endpoint->expected_op_queue,
+                poll_addr, msg_hdr, &na_sm_endpoint->ack_queue);
             NA_CHECK_NA_ERROR(
                 done, ret, "Could not make progress on expected msg");
             break;
+        case NA_SM_MSG_ACK:
+            ret = na_sm_process_ack(
+                &na_sm_endpoint->rdv_op_queue, poll_addr, msg_hdr);
+            NA_CHECK_NA_ERROR(done, ret, "Could not make progress on ack");
+            break;
         default:
             NA_GOTO_ERROR(
                 done, ret, NA_INVALID_ARG, "Unknown type of operation");
@@ -3272,7 +3919,8 @@ done:
 static na_return_t
 na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
     struct na_sm_addr *poll_addr, na_sm_msg_hdr_t msg_hdr,
-    struct na_sm_unexpected_msg_queue *unexpected_msg_queue)
+    struct na_sm_unexpected_msg_queue *unexpected_msg_queue,
+    struct na_sm_ack_queue *ack_queue)
 {
     struct na_sm_unexpected_info *na_sm_unexpected_info = NULL;
     struct na_sm_op_id *na_sm_op_id = NULL;
@@ -3297,14 +3945,14 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
             (na_size_t) msg_hdr.hdr.buf_size;
         na_sm_op_id->info.msg.tag = (na_tag_t) msg_hdr.hdr.tag;
 
-        /* Copy buffer */
-        na_sm_buf_copy_from(&poll_addr->shared_region->copy_bufs,
-            msg_hdr.hdr.buf_idx, na_sm_op_id->info.msg.buf.ptr,
-            msg_hdr.hdr.buf_size);
-
-        /* Release buffer */
-        na_sm_buf_release(
-            &poll_addr->shared_region->copy_bufs, msg_hdr.hdr.buf_idx);
+        /* Copy and release buffer, op is completed with error on failure */
+        ret = na_sm_msg_copy_from(ack_queue, poll_addr, msg_hdr,
+            na_sm_op_id->info.msg.buf.ptr, na_sm_op_id->info.msg.buf_size);
+        if (unlikely(ret != NA_SUCCESS)) {
+            NA_LOG_ERROR("Could not copy msg (%s)", NA_Error_to_string(ret));
+            na_sm_op_id->completion_data.callback_info.ret = ret;
+            hg_atomic_or32(&na_sm_op_id->status, NA_SM_OP_ERRORED);
+        }
 
         /* Complete operation (no need to notify) */
         ret = na_sm_complete(na_sm_op_id, 0);
@@ -3326,14 +3974,10 @@ na_sm_process_unexpected(struct na_sm_op_queue *unexpected_op_queue,
         NA_CHECK_ERROR(na_sm_unexpected_info->buf == NULL, error, ret, NA_NOMEM,
             "Could not allocate na_sm_unexpected_info buf");
 
-        /* Copy buffer */
-        na_sm_buf_copy_from(&poll_addr->shared_region->copy_bufs,
-            msg_hdr.hdr.buf_idx, na_sm_unexpected_info->buf,
-            msg_hdr.hdr.buf_size);
-
-        /* Release buffer */
-        na_sm_buf_release(
-            &poll_addr->shared_region->copy_bufs, msg_hdr.hdr.buf_idx);
+        /* Copy and release buffer */
+        ret = na_sm_msg_copy_from(ack_queue, poll_addr, msg_hdr,
+            na_sm_unexpected_info->buf, na_sm_unexpected_info->buf_size);
+        NA_CHECK_NA_ERROR(error, ret, "Could not copy msg");
 
         /* Otherwise push the unexpected message into our unexpected queue so
          * that we can treat it later when a recv_unexpected is posted */
@@ -3347,6 +3991,7 @@ done:
     return ret;
 
 error:
+    free(na_sm_unexpected_info->buf);
     free(na_sm_unexpected_info);
     return ret;
 }
@@ -3354,7 +3999,8 @@ error:
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_process_expected(struct na_sm_op_queue *expected_op_queue,
-    struct na_sm_addr *poll_addr, na_sm_msg_hdr_t msg_hdr)
+    struct na_sm_addr *poll_addr, na_sm_msg_hdr_t msg_hdr,
+    struct na_sm_ack_queue *ack_queue)
 {
     struct na_sm_op_id *na_sm_op_id = NULL;
     na_return_t ret = NA_SUCCESS;
@@ -3374,18 +4020,59 @@ na_sm_process_expected(struct na_sm_op_queue *expected_op_queue,
     }
     hg_thread_spin_unlock(&expected_op_queue->lock);
 
-    NA_CHECK_ERROR(
-        na_sm_op_id == NULL, done, ret, NA_INVALID_ARG, "Invalid operation ID");
+    if (unlikely(na_sm_op_id == NULL)) {
+        /* Release msg so that the sender does not wait on it */
+        ret = na_sm_msg_drop(ack_queue, poll_addr, msg_hdr);
+        NA_CHECK_NA_ERROR(done, ret, "Could not drop msg");
+        NA_GOTO_ERROR(done, ret, NA_INVALID_ARG, "Invalid operation ID");
+    }
     /* Cannot have an already completed operation ID, TODO add sanity check */
 
     na_sm_op_id->info.msg.actual_buf_size = msg_hdr.hdr.buf_size;
 
-    /* Copy buffer */
-    na_sm_buf_copy_from(&poll_addr->shared_region->copy_bufs,
-        msg_hdr.hdr.buf_idx, na_sm_op_id->info.msg.buf.ptr,
-        msg_hdr.hdr.buf_size);
+    /* Copy and release buffer, op is completed with error on failure */
+    ret = na_sm_msg_copy_from(ack_queue, poll_addr, msg_hdr,
+        na_sm_op_id->info.msg.buf.ptr, na_sm_op_id->info.msg.buf_size);
+    if (unlikely(ret != NA_SUCCESS)) {
+        NA_LOG_ERROR("Could not copy msg (%s)", NA_Error_to_string(ret));
+        na_sm_op_id->completion_data.callback_info.ret = ret;
+        hg_atomic_or32(&na_sm_op_id->status, NA_SM_OP_ERRORED);
+    }
 
-    /* Release buffer */
+    /* Complete operation */
+    ret = na_sm_complete(na_sm_op_id, 0);
+    NA_CHECK_NA_ERROR(done, ret, "Could not complete operation");
+
+done:
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_process_ack(struct na_sm_op_queue *rdv_op_queue,
+    struct na_sm_addr *poll_addr, na_sm_msg_hdr_t msg_hdr)
+{
+    struct na_sm_op_id *na_sm_op_id = NULL;
+    na_return_t ret = NA_SUCCESS;
+
+    NA_LOG_DEBUG("Processing ack");
+
+    /* Match op that reserved buffer */
+    hg_thread_spin_lock(&rdv_op_queue->lock);
+    HG_QUEUE_FOREACH (na_sm_op_id, &rdv_op_queue->queue, entry) {
+        if (na_sm_op_id->na_sm_addr == poll_addr &&
+            na_sm_op_id->info.msg.buf_idx == msg_hdr.hdr.buf_idx) {
+            HG_QUEUE_REMOVE(
+                &rdv_op_queue->queue, na_sm_op_id, na_sm_op_id, entry);
+            break;
+        }
+    }
+    hg_thread_spin_unlock(&rdv_op_queue->lock);
+
+    NA_CHECK_ERROR(
+        na_sm_op_id == NULL, done, ret, NA_INVALID_ARG, "Invalid operation ID");
+
+    /* Receiver no longer needs the buffer */
     na_sm_buf_release(
         &poll_addr->shared_region->copy_bufs, msg_hdr.hdr.buf_idx);
 
@@ -3397,6 +4084,44 @@ done:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static na_return_t
+na_sm_process_acks(struct na_sm_ack_queue *ack_queue)
+{
+    struct na_sm_ack_info *na_sm_ack_info = NULL;
+    na_return_t ret = NA_SUCCESS;
+
+    do {
+        struct na_sm_addr *na_sm_addr;
+
+        hg_thread_spin_lock(&ack_queue->lock);
+        na_sm_ack_info = HG_QUEUE_FIRST(&ack_queue->queue);
+        if (na_sm_ack_info)
+            HG_QUEUE_POP_HEAD(&ack_queue->queue, entry);
+        hg_thread_spin_unlock(&ack_queue->lock);
+
+        if (!na_sm_ack_info)
+            break;
+
+        na_sm_addr = na_sm_ack_info->na_sm_addr;
+        if (unlikely(!na_sm_msg_queue_push(
+                na_sm_addr->tx_queue, na_sm_ack_info->msg_hdr))) {
+            /* Queue is still full, put ack back in front of the others */
+            hg_thread_spin_lock(&ack_queue->lock);
+            HG_QUEUE_PUSH_HEAD(&ack_queue->queue, na_sm_ack_info, entry);
+            hg_thread_spin_unlock(&ack_queue->lock);
+            break;
+        }
+        free(na_sm_ack_info);
+
+        ret = na_sm_msg_notify(na_sm_addr);
+        NA_CHECK_NA_ERROR(done, ret, "Could not send ack notification");
+    } while (1);
+
+done:
+    return ret;
+}
+
 /*---------------------------------------------------------------------------*/
 static na_return_t
 na_sm_process_retries(
@@ -3408,8 +4133,7 @@ na_sm_process_retries(
     na_return_t ret = NA_SUCCESS;
 
     do {
-        na_sm_msg_hdr_t msg_hdr;
-        na_bool_t rc;
+        na_bool_t rc, rdv;
 
         hg_thread_spin_lock(&retry_op_queue->lock);
         na_sm_op_id = HG_QUEUE_FIRST(&retry_op_queue->queue);
@@ -3453,32 +4177,43 @@ na_sm_process_retries(
 
         hg_thread_spin_unlock(&retry_op_queue->lock);
 
-        /* Copy buffer */
-        na_sm_buf_copy_to(&na_sm_op_id->na_sm_addr->shared_region->copy_bufs,
-            buf_idx, na_sm_op_id->info.msg.buf.const_ptr,
-            na_sm_op_id->info.msg.buf_size);
-
-        /* Post message to queue */
-        msg_hdr.hdr.type = na_sm_op_id->completion_data.callback_info.type;
-        msg_hdr.hdr.buf_idx = buf_idx & 0xff;
-        msg_hdr.hdr.buf_size = na_sm_op_id->info.msg.buf_size & 0xffff;
-        msg_hdr.hdr.tag = na_sm_op_id->info.msg.tag;
+        /* Copy buffer and post message to queue */
+        rdv = (na_sm_op_id->info.msg.buf_size >
+               na_sm_op_id->na_sm_addr->shared_region->copy_bufs.buf_size);
+        rc = na_sm_msg_post(na_sm_endpoint, na_sm_op_id, buf_idx);
+        if (unlikely(rc == NA_FALSE)) {
+            /* Queue is full, put op back in front of the others */
+            na_sm_buf_release(
+                &na_sm_op_id->na_sm_addr->shared_region->copy_bufs, buf_idx);
 
-        rc = na_sm_msg_queue_push(na_sm_op_id->na_sm_addr->tx_queue, msg_hdr);
-        NA_CHECK_ERROR(rc == NA_FALSE, error, ret, NA_AGAIN, "Full queue");
+            hg_thread_spin_lock(&retry_op_queue->lock);
+            if (hg_atomic_get32(&na_sm_op_id->status) & NA_SM_OP_CANCELED) {
+                hg_thread_spin_unlock(&retry_op_queue->lock);
+                ret = na_sm_complete(na_sm_op_id, 0);
+                NA_CHECK_NA_ERROR(done, ret, "Could not complete operation");
+                continue;
+            }
+            HG_QUEUE_PUSH_HEAD(&retry_op_queue->queue, na_sm_op_id, entry);
+            hg_atomic_or32(&na_sm_op_id->status, NA_SM_OP_QUEUED);
+            hg_thread_spin_unlock(&retry_op_queue->lock);
 
-        /* Notify remote if notifications are enabled */
-        if (na_sm_op_id->na_sm_addr->tx_notify > 0) {
-            ret = na_sm_event_set(na_sm_op_id->na_sm_addr->tx_notify);
-            NA_CHECK_NA_ERROR(
-                error, ret, "Could not send completion notification");
+            return NA_SUCCESS;
         }
 
+        ret = na_sm_msg_notify(na_sm_op_id->na_sm_addr);
+        NA_CHECK_NA_ERROR(
+            error, ret, "Could not send completion notification");
+
+        /* Msgs pulled by the receiver complete once acked */
+        if (rdv)
+            continue;
+
         /* Immediate completion, add directly to completion queue. */
         ret = na_sm_complete(na_sm_op_id, 0);
         NA_CHECK_NA_ERROR(error, ret, "Could not complete operation");
     } while (1);
 
+done:
     return ret;
 
 error:
@@ -3510,6 +4245,9 @@ na_sm_complete(struct na_sm_op_id *na_sm_op_id, int notify)
          * accordingly */
         NA_LOG_DEBUG("Operation ID %p was canceled", na_sm_op_id);
         callback_info->ret = NA_CANCELED;
+    } else if (status & NA_SM_OP_ERRORED) {
+        /* Callback ret was set when the error was detected */
+        NA_LOG_DEBUG("Operation ID %p is errored", na_sm_op_id);
     } else
         callback_info->ret = NA_SUCCESS;
 
@@ -3602,6 +4340,10 @@ na_sm_initialize(na_class_t *na_class, const struct na_info NA_UNUSED *na_info,
     struct rlimit rlimit;
     na_bool_t no_wait = NA_FALSE;
     na_uint8_t context_max = 1; /* Default */
+    struct na_sm_region_attr region_attr = {
+        NA_SM_COPY_BUF_SIZE, NA_SM_NUM_BUFS, NA_SM_NUM_BUFS, 0}; /* Default */
+    na_size_t max_msg_size = 0;
+    na_bool_t rdv = NA_FALSE;
     na_return_t ret = NA_SUCCESS;
     int rc;
 
@@ -3612,8 +4354,47 @@ na_sm_initialize(na_class_t *na_class, const struct na_info NA_UNUSED *na_info,
             no_wait = NA_TRUE;
         /* Max contexts */
         context_max = na_info->na_init_info->max_contexts;
+        /* Layout of shared region */
+        max_msg_size = na_info->na_init_info->max_msg_size;
+        if (na_info->na_init_info->msg_buf_count)
+            region_attr.buf_count = na_info->na_init_info->msg_buf_count;
+        if (na_info->na_init_info->msg_queue_depth)
+            region_attr.queue_depth = na_info->na_init_info->msg_queue_depth;
     }
 
+#ifdef NA_SM_HAS_CMA
+    /* Msgs that do not fit into a buffer are pulled by the receiver, this
+     * requires cross-memory attach to be allowed */
+    rdv = (na_sm_get_ptrace_scope_value() == 0);
+#endif
+    if (!max_msg_size)
+        max_msg_size = rdv ? NA_SM_RDV_MSG_SIZE : NA_SM_COPY_BUF_SIZE;
+    NA_CHECK_ERROR(max_msg_size > NA_SM_MAX_MSG_SIZE, error, ret,
+        NA_INVALID_ARG, "Max msg size cannot exceed %d bytes",
+        NA_SM_MAX_MSG_SIZE);
+    region_attr.buf_size = NA_SM_ALIGN(
+        (rdv && max_msg_size > NA_SM_COPY_BUF_SIZE) ? NA_SM_COPY_BUF_SIZE
+                                                    : max_msg_size,
+        NA_SM_CACHE_LINE_SIZE);
+    region_attr.max_msg_size = max_msg_size;
+
+    NA_CHECK_ERROR(region_attr.buf_count > NA_SM_MAX_BUFS, error, ret,
+        NA_INVALID_ARG, "Number of msg buffers cannot exceed %d",
+        NA_SM_MAX_BUFS);
+    NA_CHECK_ERROR(region_attr.queue_depth > NA_SM_MAX_QUEUE_DEPTH, error, ret,
+        NA_INVALID_ARG, "Depth of msg queues cannot exceed %d",
+        NA_SM_MAX_QUEUE_DEPTH);
+
+    /* Queues are indexed by mask, round depth up to a power of two (cannot
+     * exceed NA_SM_MAX_QUEUE_DEPTH, which is one) */
+    region_attr.queue_depth--;
+    region_attr.queue_depth |= region_attr.queue_depth >> 1;
+    region_attr.queue_depth |= region_attr.queue_depth >> 2;
+    region_attr.queue_depth |= region_attr.queue_depth >> 4;
+    region_attr.queue_depth |= region_attr.queue_depth >> 8;
+    region_attr.queue_depth |= region_attr.queue_depth >> 16;
+    region_attr.queue_depth++;
+
     /* Get PID */
     pid = getpid();
 
@@ -3649,6 +4430,7 @@ na_sm_initialize(na_class_t *na_class, const struct na_info NA_UNUSED *na_info,
     NA_SM_CLASS(na_class)->iov_max = 1;
 #endif
     NA_SM_CLASS(na_class)->context_max = context_max;
+    NA_SM_CLASS(na_class)->endpoint.max_msg_size = max_msg_size;
 
     /* Copy username */
     NA_SM_CLASS(na_class)->username = strdup(username);
@@ -3660,7 +4442,8 @@ na_sm_initialize(na_class_t *na_class, const struct na_info NA_UNUSED *na_info,
 
     /* Open endpoint */
     ret = na_sm_endpoint_open(&NA_SM_CLASS(na_class)->endpoint, username, pid,
-        id & 0xff, listen, no_wait, (na_uint32_t) rlimit.rlim_cur);
+        id & 0xff, listen, no_wait, (na_uint32_t) rlimit.rlim_cur,
+        &region_attr);
     NA_CHECK_NA_ERROR(
         error, ret, "Could not open endpoint for PID=%d, ID=%u", pid, id);
 
@@ -3859,10 +4642,8 @@ na_sm_addr_free(na_class_t *na_class, na_addr_t addr)
     NA_LOG_DEBUG(
         "Freeing addr for PID=%d, ID=%d", na_sm_addr->pid, na_sm_addr->id);
 
-    /* Remove address from list of addresses to poll */
-    hg_thread_spin_lock(&na_sm_endpoint->poll_addr_list.lock);
-    HG_LIST_REMOVE(na_sm_addr, entry);
-    hg_thread_spin_unlock(&na_sm_endpoint->poll_addr_list.lock);
+    /* Remove address from addresses to poll */
+    na_sm_poll_addr_remove(&na_sm_endpoint->poll_addr_list, na_sm_addr);
 
     ret = na_sm_addr_destroy(
         na_sm_endpoint, NA_SM_CLASS(na_class)->username, na_sm_addr);
@@ -4026,16 +4807,16 @@ done:
 
 /*---------------------------------------------------------------------------*/
 static NA_INLINE na_size_t
-na_sm_msg_get_max_unexpected_size(const na_class_t NA_UNUSED *na_class)
+na_sm_msg_get_max_unexpected_size(const na_class_t *na_class)
 {
-    return NA_SM_UNEXPECTED_SIZE;
+    return NA_SM_CLASS(na_class)->endpoint.max_msg_size;
 }
 
 /*---------------------------------------------------------------------------*/
 static NA_INLINE na_size_t
-na_sm_msg_get_max_expected_size(const na_class_t NA_UNUSED *na_class)
+na_sm_msg_get_max_expected_size(const na_class_t *na_class)
 {
-    return NA_SM_EXPECTED_SIZE;
+    return NA_SM_CLASS(na_class)->endpoint.max_msg_size;
 }
 
 /*---------------------------------------------------------------------------*/
@@ -4055,13 +4836,13 @@ na_sm_msg_send_unexpected(na_class_t *na_class, na_context_t *context,
     struct na_sm_op_id *na_sm_op_id = (struct na_sm_op_id *) op_id;
     struct na_sm_addr *na_sm_addr = (struct na_sm_addr *) dest_addr;
     unsigned int buf_idx;
-    na_bool_t reserved = NA_FALSE;
-    na_sm_msg_hdr_t msg_hdr;
+    na_bool_t reserved = NA_FALSE, rdv;
     na_return_t ret = NA_SUCCESS;
     na_bool_t rc;
 
-    NA_CHECK_ERROR(buf_size > NA_SM_UNEXPECTED_SIZE, done, ret, NA_OVERFLOW,
-        "Exceeds unexpected size, %d", buf_size);
+    NA_CHECK_ERROR(
+        buf_size > NA_SM_CLASS(na_class)->endpoint.max_msg_size, done,
+        ret, NA_OVERFLOW, "Exceeds unexpected size, %d", buf_size);
 
     /* Check op_id */
     NA_CHECK_ERROR(
@@ -4106,24 +4887,22 @@ na_sm_msg_send_unexpected(na_class_t *na_class, na_context_t *context,
     /* Successfully reserved a buffer */
     reserved = NA_TRUE;
 
-    /* Reservation succeeded, copy buffer */
-    na_sm_buf_copy_to(
-        &na_sm_addr->shared_region->copy_bufs, buf_idx, buf, buf_size);
-
-    /* Post message to queue */
-    msg_hdr.hdr.type = na_sm_op_id->completion_data.callback_info.type;
-    msg_hdr.hdr.buf_idx = buf_idx & 0xff;
-    msg_hdr.hdr.buf_size = buf_size & 0xffff;
-    msg_hdr.hdr.tag = tag;
+    /* Reservation succeeded, copy buffer and post message to queue */
+    rdv = (buf_size > na_sm_addr->shared_region->copy_bufs.buf_size);
+    rc = na_sm_msg_post(&NA_SM_CLASS(na_class)->endpoint, na_sm_op_id, buf_idx);
+    if (unlikely(rc == NA_FALSE)) {
+        /* Queue is full, retry once the peer has consumed messages */
+        na_sm_buf_release(&na_sm_addr->shared_region->copy_bufs, buf_idx);
+        na_sm_op_retry(na_class, na_sm_op_id);
+        return NA_SUCCESS;
+    }
 
-    rc = na_sm_msg_queue_push(na_sm_addr->tx_queue, msg_hdr);
-    NA_CHECK_ERROR(rc == NA_FALSE, error, ret, NA_AGAIN, "Full queue");
+    ret = na_sm_msg_notify(na_sm_addr);
+    NA_CHECK_NA_ERROR(error, ret, "Could not send completion notification");
 
-    /* Notify remote if notifications are enabled */
-    if (na_sm_addr->tx_notify > 0) {
-        ret = na_sm_event_set(na_sm_addr->tx_notify);
-        NA_CHECK_NA_ERROR(error, ret, "Could not send completion notification");
-    }
+    /* Msgs pulled by the receiver complete once acked */
+    if (rdv)
+        return NA_SUCCESS;
 
     /* Immediate completion, add directly to completion queue. */
     ret = na_sm_complete(
@@ -4154,8 +4933,9 @@ na_sm_msg_recv_unexpected(na_class_t *na_class, na_context_t *context,
     struct na_sm_op_id *na_sm_op_id = (struct na_sm_op_id *) op_id;
     na_return_t ret = NA_SUCCESS;
 
-    NA_CHECK_ERROR(buf_size > NA_SM_UNEXPECTED_SIZE, done, ret, NA_OVERFLOW,
-        "Exceeds unexpected size, %d", buf_size);
+    NA_CHECK_ERROR(
+        buf_size > NA_SM_CLASS(na_class)->endpoint.max_msg_size, done,
+        ret, NA_OVERFLOW, "Exceeds unexpected size, %d", buf_size);
 
     /* Check op_id */
     NA_CHECK_ERROR(
@@ -4229,13 +5009,13 @@ na_sm_msg_send_expected(na_class_t *na_class, na_context_t *context,
     struct na_sm_op_id *na_sm_op_id = (struct na_sm_op_id *) op_id;
     struct na_sm_addr *na_sm_addr = (struct na_sm_addr *) dest_addr;
     unsigned int buf_idx;
-    na_bool_t reserved = NA_FALSE;
-    na_sm_msg_hdr_t msg_hdr;
+    na_bool_t reserved = NA_FALSE, rdv;
     na_return_t ret = NA_SUCCESS;
     na_bool_t rc;
 
-    NA_CHECK_ERROR(buf_size > NA_SM_EXPECTED_SIZE, done, ret, NA_OVERFLOW,
-        "Exceeds expected size, %d", buf_size);
+    NA_CHECK_ERROR(
+        buf_size > NA_SM_CLASS(na_class)->endpoint.max_msg_size, done,
+        ret, NA_OVERFLOW, "Exceeds expected size, %d", buf_size);
 
     /* Check op_id */
     NA_CHECK_ERROR(
@@ -4280,24 +5060,22 @@ na_sm_msg_send_expected(na_class_t *na_class, na_context_t *context,
     /* Successfully reserved a buffer */
     reserved = NA_TRUE;
 
-    /* Reservation succeeded, copy buffer */
-    na_sm_buf_copy_to(
-        &na_sm_addr->shared_region->copy_bufs, buf_idx, buf, buf_size);
-
-    /* Post message to queue */
-    msg_hdr.hdr.type = na_sm_op_id->completion_data.callback_info.type;
-    msg_hdr.hdr.buf_idx = buf_idx & 0xff;
-    msg_hdr.hdr.buf_size = buf_size & 0xffff;
-    msg_hdr.hdr.tag = tag;
+    /* Reservation succeeded, copy buffer and post message to queue */
+    rdv = (buf_size > na_sm_addr->shared_region->copy_bufs.buf_size);
+    rc = na_sm_msg_post(&NA_SM_CLASS(na_class)->endpoint, na_sm_op_id, buf_idx);
+    if (unlikely(rc == NA_FALSE)) {
+        /* Queue is full, retry once the peer has consumed messages */
+        na_sm_buf_release(&na_sm_addr->shared_region->copy_bufs, buf_idx);
+        na_sm_op_retry(na_class, na_sm_op_id);
+        return NA_SUCCESS;
+    }
 
-    rc = na_sm_msg_queue_push(na_sm_addr->tx_queue, msg_hdr);
-    NA_CHECK_ERROR(rc == NA_FALSE, error, ret, NA_AGAIN, "Full queue");
+    ret = na_sm_msg_notify(na_sm_addr);
+    NA_CHECK_NA_ERROR(error, ret, "Could not send completion notification");
 
-    /* Notify remote if notifications are enabled */
-    if (na_sm_addr->tx_notify > 0) {
-        ret = na_sm_event_set(na_sm_addr->tx_notify);
-        NA_CHECK_NA_ERROR(error, ret, "Could not send completion notification");
-    }
+    /* Msgs pulled by the receiver complete once acked */
+    if (rdv)
+        return NA_SUCCESS;
 
     /* Immediate completion, add directly to completion queue. */
     ret = na_sm_complete(
@@ -4329,8 +5107,9 @@ na_sm_msg_recv_expected(na_class_t *na_class, na_context_t *context,
     struct na_sm_addr *na_sm_addr = (struct na_sm_addr *) source_addr;
     na_return_t ret = NA_SUCCESS;
 
-    NA_CHECK_ERROR(buf_size > NA_SM_EXPECTED_SIZE, done, ret, NA_OVERFLOW,
-        "Exceeds expected size, %d", buf_size);
+    NA_CHECK_ERROR(
+        buf_size > NA_SM_CLASS(na_class)->endpoint.max_msg_size, done,
+        ret, NA_OVERFLOW, "Exceeds expected size, %d", buf_size);
 
     /* Check op_id */
     NA_CHECK_ERROR(
@@ -4435,6 +5214,22 @@ na_sm_mem_handle_create_segments(na_class_t *na_class,
     na_sm_mem_handle->info.iovcnt = segment_count;
     na_sm_mem_handle->info.flags = flags & 0xff;
 
+    /* Segments of same size that are evenly spaced (e.g., column of an
+     * array) only need the first segment to be serialized */
+    if (segment_count > 1 && iov[1].iov_base > iov[0].iov_base) {
+        na_sm_mem_handle->info.stride =
+            (size_t) ((char *) iov[1].iov_base - (char *) iov[0].iov_base);
+        for (i = 1; i < segment_count; i++) {
+            if (iov[i].iov_len != iov[0].iov_len ||
+                (char *) iov[i].iov_base !=
+                    (char *) iov[i - 1].iov_base +
+                        na_sm_mem_handle->info.stride) {
+                na_sm_mem_handle->info.stride = 0;
+                break;
+            }
+        }
+    }
+
     *mem_handle = (na_mem_handle_t) na_sm_mem_handle;
 
     return ret;
@@ -4480,7 +5275,9 @@ na_sm_mem_handle_get_serialize_size(
         (struct na_sm_mem_handle *) mem_handle;
 
     return sizeof(na_sm_mem_handle->info) +
-           na_sm_mem_handle->info.iovcnt * sizeof(struct iovec);
+           ((na_sm_mem_handle->info.stride > 0)
+                   ? sizeof(struct iovec)
+                   : na_sm_mem_handle->info.iovcnt * sizeof(struct iovec));
 }
 
 /*---------------------------------------------------------------------------*/
@@ -4491,6 +5288,9 @@ na_sm_mem_handle_serialize(na_class_t NA_UNUSED *na_class, void *buf,
     struct na_sm_mem_handle *na_sm_mem_handle =
         (struct na_sm_mem_handle *) mem_handle;
     struct iovec *iov = NA_SM_IOV(na_sm_mem_handle);
+    unsigned long iovcnt = (na_sm_mem_handle->info.stride > 0)
+                               ? 1
+                               : na_sm_mem_handle->info.iovcnt;
     char *buf_ptr = (char *) buf;
     na_size_t buf_size_left = buf_size;
     na_return_t ret = NA_SUCCESS;
@@ -4499,9 +5299,9 @@ na_sm_mem_handle_serialize(na_class_t NA_UNUSED *na_class, void *buf,
     NA_ENCODE(done, ret, buf_ptr, buf_size_left, &na_sm_mem_handle->info,
         struct na_sm_mem_desc_info);
 
-    /* IOV */
+    /* IOV (strided IOVs are expanded when deserialized) */
     NA_ENCODE_ARRAY(done, ret, buf_ptr, buf_size_left, iov, struct iovec,
-        na_sm_mem_handle->info.iovcnt);
+        iovcnt);
 
 done:
     return ret;
@@ -4540,8 +5340,18 @@ na_sm_mem_handle_deserialize(na_class_t NA_UNUSED *na_class,
     } else
         iov = na_sm_mem_handle->iov.s;
 
-    NA_DECODE_ARRAY(error, ret, buf_ptr, buf_size_left, iov, struct iovec,
-        na_sm_mem_handle->info.iovcnt);
+    if (na_sm_mem_handle->info.stride > 0) {
+        unsigned long i;
+
+        NA_DECODE(error, ret, buf_ptr, buf_size_left, iov, struct iovec);
+        for (i = 1; i < na_sm_mem_handle->info.iovcnt; i++) {
+            iov[i].iov_base =
+                (char *) iov[i - 1].iov_base + na_sm_mem_handle->info.stride;
+            iov[i].iov_len = iov[0].iov_len;
+        }
+    } else
+        NA_DECODE_ARRAY(error, ret, buf_ptr, buf_size_left, iov, struct iovec,
+            na_sm_mem_handle->info.iovcnt);
 
     *mem_handle = (na_mem_handle_t) na_sm_mem_handle;
 
@@ -4925,6 +5735,18 @@ error:
     return ret;
 }
 
+/*---------------------------------------------------------------------------*/
+static NA_INLINE na_bool_t
+na_sm_put_is_sync(const na_class_t NA_UNUSED *na_class)
+{
+#if defined(NA_SM_HAS_CMA) || defined(__APPLE__)
+    /* Remote memory is written by the calling process */
+    return NA_TRUE;
+#else
+    return NA_FALSE;
+#endif
+}
+
 /*---------------------------------------------------------------------------*/
 static NA_INLINE int
 na_sm_poll_get_fd(na_class_t *na_class, na_context_t NA_UNUSED *context)
@@ -4946,18 +5768,12 @@ static NA_INLINE na_bool_t
 na_sm_poll_try_wait(na_class_t *na_class, na_context_t NA_UNUSED *context)
 {
     struct na_sm_endpoint *na_sm_endpoint = &NA_SM_CLASS(na_class)->endpoint;
-    struct na_sm_addr *na_sm_addr;
     na_bool_t empty = NA_FALSE;
 
-    /* Check whether something is in one of the rx queues */
-    hg_thread_spin_lock(&na_sm_endpoint->poll_addr_list.lock);
-    HG_LIST_FOREACH (na_sm_addr, &na_sm_endpoint->poll_addr_list.list, entry) {
-        if (!na_sm_msg_queue_is_empty(na_sm_addr->rx_queue)) {
-            hg_thread_spin_unlock(&na_sm_endpoint->poll_addr_list.lock);
-            return NA_FALSE;
-        }
-    }
-    hg_thread_spin_unlock(&na_sm_endpoint->poll_addr_list.lock);
+    /* Check whether something is in one of the rx queues, peers must
+     * notify from now on as the caller may block */
+    if (!na_sm_poll_set_waiting(na_sm_endpoint))
+        return NA_FALSE;
 
     /* Check whether something is in the retry queue */
     hg_thread_spin_lock(&na_sm_endpoint->retry_op_queue.lock);
@@ -4966,6 +5782,13 @@ na_sm_poll_try_wait(na_class_t *na_class, na_context_t NA_UNUSED *context)
     if (!empty)
         return NA_FALSE;
 
+    /* Check whether acks are waiting to be posted */
+    hg_thread_spin_lock(&na_sm_endpoint->ack_queue.lock);
+    empty = HG_QUEUE_IS_EMPTY(&na_sm_endpoint->ack_queue.queue);
+    hg_thread_spin_unlock(&na_sm_endpoint->ack_queue.lock);
+    if (!empty)
+        return NA_FALSE;
+
     return NA_TRUE;
 }
 
@@ -4978,6 +5801,7 @@ na_sm_progress(
     const char *username = NA_SM_CLASS(na_class)->username;
     double remaining =
         timeout / 1000.0; /* Convert timeout in ms into seconds */
+    na_bool_t retry_empty;
     na_return_t ret;
 
     do {
@@ -4987,23 +5811,33 @@ na_sm_progress(
         if (timeout)
             hg_time_get_current_ms(&t1);
 
-        if (na_sm_endpoint->poll_set) {
+        /* Make non-blocking progress, peers do not notify while we poll */
+        ret = na_sm_poll(na_sm_endpoint, username, &progressed);
+        NA_CHECK_NA_ERROR(
+            error, ret, "Could not make non-blocking progress on context");
+
+        if (!progressed && na_sm_endpoint->poll_set) {
+            unsigned int poll_timeout = 0;
+
+            /* Do not block if msgs arrived before peers could notify */
+            if (na_sm_poll_set_waiting(na_sm_endpoint))
+                poll_timeout = (unsigned int) (remaining * 1000.0);
+
             /* Make blocking progress */
-            ret = na_sm_poll_wait(context, na_sm_endpoint, username,
-                (unsigned int) (remaining * 1000.0), &progressed);
+            ret = na_sm_poll_wait(
+                context, na_sm_endpoint, username, poll_timeout, &progressed);
             NA_CHECK_NA_ERROR(
                 error, ret, "Could not make blocking progress on context");
-        } else {
-            /* Make non-blocking progress */
-            ret = na_sm_poll(na_sm_endpoint, username, &progressed);
-            NA_CHECK_NA_ERROR(
-                error, ret, "Could not make non-blocking progress on context");
         }
 
         /* Process retries */
         ret = na_sm_process_retries(na_sm_endpoint, username);
         NA_CHECK_NA_ERROR(error, ret, "Could not process retried msgs");
 
+        /* Process acks */
+        ret = na_sm_process_acks(&na_sm_endpoint->ack_queue);
+        NA_CHECK_NA_ERROR(error, ret, "Could not process acks");
+
         if (progressed)
             return NA_SUCCESS;
 
@@ -5013,6 +5847,18 @@ na_sm_progress(
         }
     } while ((int) (remaining * 1000.0) > 0);
 
+    /* Peers do not notify when they drain a full queue or release buffers,
+     * let them run if sends or acks are waiting to be retried */
+    hg_thread_spin_lock(&na_sm_endpoint->retry_op_queue.lock);
+    retry_empty = HG_QUEUE_IS_EMPTY(&na_sm_endpoint->retry_op_queue.queue);
+    hg_thread_spin_unlock(&na_sm_endpoint->retry_op_queue.lock);
+    hg_thread_spin_lock(&na_sm_endpoint->ack_queue.lock);
+    if (!HG_QUEUE_IS_EMPTY(&na_sm_endpoint->ack_queue.queue))
+        retry_empty = NA_FALSE;
+    hg_thread_spin_unlock(&na_sm_endpoint->ack_queue.lock);
+    if (!retry_empty)
+        hg_thread_yield();
+
     return NA_TIMEOUT;
 
 error:
@@ -5046,7 +5892,9 @@ na_sm_cancel(
             break;
         case NA_CB_SEND_UNEXPECTED:
         case NA_CB_SEND_EXPECTED:
-            /* Must remove op_id from retry op queue */
+            /* Must remove op_id from retry op queue, posted msgs that are
+             * pulled by the receiver keep their buffer and complete as
+             * canceled once acked */
             op_queue = &NA_SM_CLASS(na_class)->endpoint.retry_op_queue;
             break;
         case NA_CB_PUT:
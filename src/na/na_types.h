@@ -31,10 +31,14 @@ typedef na_uint64_t na_offset_t;               /* Offset */
 
 /* Init info */
 struct na_init_info {
-    const char *ip_subnet;     /* Preferred IP subnet */
-    const char *auth_key;      /* Authorization key */
-    na_uint32_t progress_mode; /* Progress mode */
-    na_uint8_t max_contexts;   /* Max contexts */
+    const char *ip_subnet;       /* Preferred IP subnet */
+    const char *auth_key;        /* Authorization key */
+    na_uint32_t progress_mode;   /* Progress mode */
+    na_uint8_t max_contexts;     /* Max contexts */
+    na_size_t max_msg_size;      /* Max msg size (0 for plugin default) */
+    na_uint32_t msg_buf_count;   /* Number of msg buffers (0 for default) */
+    na_uint32_t msg_queue_depth; /* Depth of msg queues (0 for default),
+                                  * rounded up to a power of two */
 };
 
 /* Segment */
@@ -135,7 +139,7 @@ typedef int (*na_cb_t)(const struct na_cb_info *callback_info);
 /* NA init info initializer */
 #define NA_INIT_INFO_INITIALIZER                                               \
     {                                                                          \
-        NULL, NULL, 0, 1                                                       \
+        NULL, NULL, 0, 1, 0, 0, 0                                              \
     }
 
 #endif /* NA_TYPES_H */
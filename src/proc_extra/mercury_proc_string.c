@@ -33,6 +33,7 @@ hg_proc_hg_string_object_t(hg_proc_t proc, void *string)
     hg_uint64_t string_len = 0;
     hg_return_t ret = HG_SUCCESS;
     hg_string_object_t *strobj = (hg_string_object_t *) string;
+    hg_bool_t view = HG_FALSE, arena = HG_FALSE;
 
     switch (hg_proc_get_op(proc)) {
         case HG_ENCODE:
@@ -59,31 +60,40 @@ hg_proc_hg_string_object_t(hg_proc_t proc, void *string)
             if (ret != HG_SUCCESS)
                 goto done;
             if (string_len) {
-                strobj->data = (char *) malloc(string_len);
-                if (strobj->data == NULL) {
-                    ret = HG_NOMEM;
-                    goto done;
-                }
-                ret = hg_proc_bytes(proc, strobj->data, string_len);
-                if (ret != HG_SUCCESS) {
-                    free(strobj->data);
-                    strobj->data = NULL;
-                    goto done;
+#ifndef HG_HAS_XDR
+                /* Const strings can be borrowed from the proc buffer */
+                view = strobj->is_const &&
+                       (hg_proc_get_flags(proc) & HG_PROC_VIEW);
+#endif
+                arena = (hg_proc_get_flags(proc) & HG_PROC_ARENA) != 0;
+                if (view)
+                    ret = hg_proc_bytes_view(proc, (void **) &strobj->data,
+                        (hg_size_t) string_len);
+                else {
+                    if (arena)
+                        strobj->data = (char *) hg_proc_alloc(
+                            proc, (hg_size_t) string_len);
+                    else
+                        strobj->data = (char *) malloc(string_len);
+                    if (strobj->data == NULL) {
+                        ret = HG_NOMEM;
+                        goto done;
+                    }
+                    ret = hg_proc_bytes(proc, strobj->data, string_len);
                 }
+                if (ret != HG_SUCCESS)
+                    goto error;
                 ret =
                     hg_proc_hg_uint8_t(proc, (hg_uint8_t *) &strobj->is_const);
-                if (ret != HG_SUCCESS) {
-                    free(strobj->data);
-                    strobj->data = NULL;
-                    goto done;
-                }
+                if (ret != HG_SUCCESS)
+                    goto error;
                 ret =
                     hg_proc_hg_uint8_t(proc, (hg_uint8_t *) &strobj->is_owned);
-                if (ret != HG_SUCCESS) {
-                    free(strobj->data);
-                    strobj->data = NULL;
-                    goto done;
-                }
+                if (ret != HG_SUCCESS)
+                    goto error;
+                /* Views and arena allocations are never owned */
+                if (view || arena)
+                    strobj->is_owned = 0;
             } else
                 strobj->data = NULL;
             break;
@@ -98,4 +108,10 @@ hg_proc_hg_string_object_t(hg_proc_t proc, void *string)
 
 done:
     return ret;
+
+error:
+    if (!view && !arena)
+        free(strobj->data);
+    strobj->data = NULL;
+    return ret;
 }
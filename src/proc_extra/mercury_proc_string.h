@@ -59,6 +59,10 @@ hg_proc_hg_string_t(hg_proc_t proc, void *data);
 
 /**
  * Generic processing routine.
+ * When decoding with the HG_PROC_VIEW flag set, a string object that was
+ * initialized as const is not copied but points directly into the proc buffer.
+ * When decoding with the HG_PROC_ARENA flag set, string data is allocated
+ * from the proc arena. In both cases, the string object is not owned.
  *
  * \param proc [IN/OUT]         abstract processor object
  * \param string [IN/OUT]       pointer to string
@@ -89,6 +93,7 @@ hg_proc_hg_const_string_t(hg_proc_t proc, void *data)
             hg_string_object_free(&string);
             break;
         case HG_DECODE:
+            hg_string_object_init_const_char(&string, NULL, 0);
             ret = hg_proc_hg_string_object_t(proc, &string);
             if (ret != HG_SUCCESS)
                 goto done;
@@ -96,7 +101,9 @@ hg_proc_hg_const_string_t(hg_proc_t proc, void *data)
             hg_string_object_free(&string);
             break;
         case HG_FREE:
-            hg_string_object_init_const_char(&string, *strdata, 1);
+            /* Views and arena allocations must not be freed */
+            hg_string_object_init_const_char(&string, *strdata,
+                !(hg_proc_get_flags(proc) & (HG_PROC_VIEW | HG_PROC_ARENA)));
             ret = hg_proc_hg_string_object_t(proc, &string);
             if (ret != HG_SUCCESS)
                 goto done;
@@ -126,6 +133,7 @@ hg_proc_hg_string_t(hg_proc_t proc, void *data)
             hg_string_object_free(&string);
             break;
         case HG_DECODE:
+            hg_string_object_init_char(&string, NULL, 0);
             ret = hg_proc_hg_string_object_t(proc, &string);
             if (ret != HG_SUCCESS)
                 goto done;
@@ -133,7 +141,9 @@ hg_proc_hg_string_t(hg_proc_t proc, void *data)
             hg_string_object_free(&string);
             break;
         case HG_FREE:
-            hg_string_object_init_char(&string, *strdata, 1);
+            /* Arena allocations must not be freed */
+            hg_string_object_init_char(
+                &string, *strdata, !(hg_proc_get_flags(proc) & HG_PROC_ARENA));
             ret = hg_proc_hg_string_object_t(proc, &string);
             if (ret != HG_SUCCESS)
                 goto done;
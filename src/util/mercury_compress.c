@@ -0,0 +1,263 @@
+/*
+ * Copyright (C) 2013-2020 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#include "mercury_compress.h"
+
+#include <stdint.h>
+#include <string.h>
+
+/****************/
+/* Local Macros */
+/****************/
+
+/* Sequence layout: token (literal length << 4 | match length - MIN_MATCH),
+ * extra literal length bytes, literals, 16-bit little-endian offset,
+ * extra match length bytes. The last sequence only has literals. */
+#define HG_COMPRESS_MIN_MATCH     4
+#define HG_COMPRESS_RUN_MASK      15
+#define HG_COMPRESS_MAX_OFFSET    65535
+#define HG_COMPRESS_LAST_LITERALS 5  /* Trailing bytes always literals */
+#define HG_COMPRESS_MF_LIMIT      12 /* No match starts in trailing bytes */
+#define HG_COMPRESS_HASH_LOG      12
+#define HG_COMPRESS_SKIP_TRIGGER  6 /* Speed up on incompressible data */
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/**
+ * Read 32-bit word.
+ */
+static HG_UTIL_INLINE uint32_t
+hg_compress_read32(const unsigned char *p);
+
+/**
+ * Hash 32-bit word.
+ */
+static HG_UTIL_INLINE uint32_t
+hg_compress_hash(uint32_t v);
+
+/**
+ * Encode length extension.
+ */
+static HG_UTIL_INLINE unsigned char *
+hg_compress_put_len(unsigned char *op, const unsigned char *oend, size_t len);
+
+/**
+ * Decode length extension.
+ */
+static HG_UTIL_INLINE const unsigned char *
+hg_compress_get_len(
+    const unsigned char *ip, const unsigned char *iend, size_t *len);
+
+/*---------------------------------------------------------------------------*/
+static HG_UTIL_INLINE uint32_t
+hg_compress_read32(const unsigned char *p)
+{
+    uint32_t v;
+
+    memcpy(&v, p, sizeof(v));
+
+    return v;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_UTIL_INLINE uint32_t
+hg_compress_hash(uint32_t v)
+{
+    return (v * 2654435761U) >> (32 - HG_COMPRESS_HASH_LOG);
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_UTIL_INLINE unsigned char *
+hg_compress_put_len(unsigned char *op, const unsigned char *oend, size_t len)
+{
+    for (; len >= 255; len -= 255) {
+        if (op >= oend)
+            return NULL;
+        *op++ = 255;
+    }
+    if (op >= oend)
+        return NULL;
+    *op++ = (unsigned char) len;
+
+    return op;
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_UTIL_INLINE const unsigned char *
+hg_compress_get_len(
+    const unsigned char *ip, const unsigned char *iend, size_t *len)
+{
+    unsigned char b;
+
+    do {
+        if (ip >= iend)
+            return NULL;
+        b = *ip++;
+        *len += b;
+    } while (b == 255);
+
+    return ip;
+}
+
+/*---------------------------------------------------------------------------*/
+size_t
+hg_compress(const void *src, size_t src_size, void *dst, size_t dst_size)
+{
+    uint32_t table[1 << HG_COMPRESS_HASH_LOG];
+    const unsigned char *base = (const unsigned char *) src;
+    const unsigned char *ip = base, *anchor = base;
+    const unsigned char *iend = base + src_size;
+    unsigned char *op = (unsigned char *) dst;
+    const unsigned char *oend = op + dst_size;
+    size_t literal_len;
+
+    if (src_size > HG_COMPRESS_MF_LIMIT) {
+        const unsigned char *mf_limit = iend - HG_COMPRESS_MF_LIMIT;
+        const unsigned char *match_limit = iend - HG_COMPRESS_LAST_LITERALS;
+        unsigned int misses = 0;
+
+        memset(table, 0, sizeof(table));
+        ip++;
+
+        while (ip < mf_limit) {
+            uint32_t seq = hg_compress_read32(ip);
+            uint32_t h = hg_compress_hash(seq);
+            const unsigned char *ref = base + table[h];
+            const unsigned char *m, *r;
+            unsigned char *token;
+            size_t match_len;
+
+            table[h] = (uint32_t) (ip - base);
+            if ((size_t) (ip - ref) > HG_COMPRESS_MAX_OFFSET ||
+                hg_compress_read32(ref) != seq) {
+                ip += 1 + (misses++ >> HG_COMPRESS_SKIP_TRIGGER);
+                continue;
+            }
+            misses = 0;
+
+            /* Extend match forward */
+            m = ip + HG_COMPRESS_MIN_MATCH;
+            r = ref + HG_COMPRESS_MIN_MATCH;
+            while (m < match_limit && *m == *r) {
+                m++;
+                r++;
+            }
+            match_len = (size_t) (m - ip) - HG_COMPRESS_MIN_MATCH;
+            literal_len = (size_t) (ip - anchor);
+
+            /* Token, literals and offset must fit */
+            if ((size_t) (oend - op) < 1 + literal_len + 2)
+                return 0;
+            token = op++;
+            if (literal_len >= HG_COMPRESS_RUN_MASK) {
+                *token = HG_COMPRESS_RUN_MASK << 4;
+                op = hg_compress_put_len(
+                    op, oend, literal_len - HG_COMPRESS_RUN_MASK);
+                if (op == NULL || (size_t) (oend - op) < literal_len + 2)
+                    return 0;
+            } else
+                *token = (unsigned char) (literal_len << 4);
+            memcpy(op, anchor, literal_len);
+            op += literal_len;
+            *op++ = (unsigned char) ((ip - ref) & 0xff);
+            *op++ = (unsigned char) ((ip - ref) >> 8);
+            if (match_len >= HG_COMPRESS_RUN_MASK) {
+                *token |= HG_COMPRESS_RUN_MASK;
+                op = hg_compress_put_len(
+                    op, oend, match_len - HG_COMPRESS_RUN_MASK);
+                if (op == NULL)
+                    return 0;
+            } else
+                *token |= (unsigned char) match_len;
+
+            ip = anchor = m;
+        }
+    }
+
+    /* Last literals */
+    literal_len = (size_t) (iend - anchor);
+    if (op >= oend)
+        return 0;
+    if (literal_len >= HG_COMPRESS_RUN_MASK) {
+        *op++ = HG_COMPRESS_RUN_MASK << 4;
+        op = hg_compress_put_len(op, oend, literal_len - HG_COMPRESS_RUN_MASK);
+        if (op == NULL)
+            return 0;
+    } else
+        *op++ = (unsigned char) (literal_len << 4);
+    if ((size_t) (oend - op) < literal_len)
+        return 0;
+    memcpy(op, anchor, literal_len);
+    op += literal_len;
+
+    return (size_t) (op - (unsigned char *) dst);
+}
+
+/*---------------------------------------------------------------------------*/
+int
+hg_decompress(const void *src, size_t src_size, void *dst, size_t dst_size)
+{
+    const unsigned char *ip = (const unsigned char *) src;
+    const unsigned char *iend = ip + src_size;
+    unsigned char *op = (unsigned char *) dst;
+    unsigned char *oend = op + dst_size;
+
+    while (ip < iend) {
+        unsigned char token = *ip++;
+        size_t len = (size_t) (token >> 4), offset;
+        const unsigned char *ref;
+
+        /* Literals */
+        if (len == HG_COMPRESS_RUN_MASK) {
+            ip = hg_compress_get_len(ip, iend, &len);
+            if (ip == NULL)
+                return HG_UTIL_FAIL;
+        }
+        if (len > (size_t) (iend - ip) || len > (size_t) (oend - op))
+            return HG_UTIL_FAIL;
+        memcpy(op, ip, len);
+        op += len;
+        ip += len;
+
+        /* Last sequence has no match */
+        if (ip == iend)
+            break;
+
+        /* Match */
+        if (iend - ip < 2)
+            return HG_UTIL_FAIL;
+        offset = (size_t) ip[0] | ((size_t) ip[1] << 8);
+        ip += 2;
+        if (offset == 0 || offset > (size_t) (op - (unsigned char *) dst))
+            return HG_UTIL_FAIL;
+        len = (size_t) (token & HG_COMPRESS_RUN_MASK);
+        if (len == HG_COMPRESS_RUN_MASK) {
+            ip = hg_compress_get_len(ip, iend, &len);
+            if (ip == NULL)
+                return HG_UTIL_FAIL;
+        }
+        len += HG_COMPRESS_MIN_MATCH;
+        if (len > (size_t) (oend - op))
+            return HG_UTIL_FAIL;
+
+        /* Overlapping copy repeats the last offset bytes */
+        ref = op - offset;
+        if (offset >= len) {
+            memcpy(op, ref, len);
+            op += len;
+        } else
+            while (len-- > 0)
+                *op++ = *ref++;
+    }
+
+    return (op == oend) ? HG_UTIL_SUCCESS : HG_UTIL_FAIL;
+}
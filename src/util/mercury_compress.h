@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2013-2020 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#ifndef MERCURY_COMPRESS_H
+#define MERCURY_COMPRESS_H
+
+#include "mercury_util_config.h"
+
+#include <stddef.h>
+
+/*****************/
+/* Public Macros */
+/*****************/
+
+/* Worst-case size of compressing n bytes */
+#define HG_COMPRESS_BOUND(n) ((n) + (n) / 255 + 16)
+
+/*********************/
+/* Public Prototypes */
+/*********************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Compress src_size bytes from src into dst using a fast LZ77-class codec.
+ * Output is a sequence of literal runs and back-references into the last 64 KiB
+ * of uncompressed data, no dictionary or framing is stored so the uncompressed
+ * size must be known when decompressing. Compression gives up as soon as
+ * dst_size bytes would be exceeded, passing HG_COMPRESS_BOUND(src_size) bytes
+ * guarantees success.
+ *
+ * \param src [IN]              pointer to uncompressed data
+ * \param src_size [IN]         size of uncompressed data
+ * \param dst [OUT]             pointer to destination buffer
+ * \param dst_size [IN]         size of destination buffer
+ *
+ * \return size of compressed data, or 0 if it does not fit into dst
+ */
+HG_UTIL_PUBLIC size_t
+hg_compress(const void *src, size_t src_size, void *dst, size_t dst_size);
+
+/**
+ * Decompress src_size bytes of data produced by hg_compress() into dst. Input
+ * is not trusted, every length and back-reference is checked so that neither
+ * buffer is overrun.
+ *
+ * \param src [IN]              pointer to compressed data
+ * \param src_size [IN]         size of compressed data
+ * \param dst [OUT]             pointer to destination buffer
+ * \param dst_size [IN]         exact size of uncompressed data
+ *
+ * \return Non-negative on success or negative if the data is corrupted or does
+ * not decompress to exactly dst_size bytes
+ */
+HG_UTIL_PUBLIC int
+hg_decompress(const void *src, size_t src_size, void *dst, size_t dst_size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MERCURY_COMPRESS_H */
@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2013-2020 Argonne National Laboratory, Department of Energy,
+ *                    UChicago Argonne, LLC and The HDF Group.
+ * All rights reserved.
+ *
+ * The full copyright notice, including terms governing use, modification,
+ * and redistribution, is contained in the COPYING file that can be
+ * found at the root of the source code distribution tree.
+ */
+
+#ifndef MERCURY_CRC32C_H
+#define MERCURY_CRC32C_H
+
+#include "mercury_util_config.h"
+
+#include <stddef.h>
+
+/*********************/
+/* Public Prototypes */
+/*********************/
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * Update CRC32C (Castagnoli) checksum crc with size bytes from buf. Passing 0
+ * as crc starts a new checksum and checksums can be computed incrementally,
+ * updating the result of a previous call with the data that follows. Uses the
+ * CRC32 instructions of the CPU when they are available.
+ *
+ * \param crc [IN]              checksum of preceding data (0 if none)
+ * \param buf [IN]              pointer to data
+ * \param size [IN]             size of data
+ *
+ * \return updated checksum
+ */
+HG_UTIL_PUBLIC hg_util_uint32_t
+hg_crc32c(hg_util_uint32_t crc, const void *buf, size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* MERCURY_CRC32C_H */
@@ -10,6 +10,9 @@
 
 #include "mercury_mem.h"
 
+#include "mercury_thread_condition.h"
+#include "mercury_thread_mutex.h"
+#include "mercury_thread_pool.h"
 #include "mercury_util_error.h"
 
 #ifdef _WIN32
@@ -23,7 +26,108 @@
 #    include <sys/types.h>
 #    include <unistd.h>
 #endif
+#include <stdint.h>
 #include <stdlib.h>
+#include <string.h>
+#if defined(__SSE2__)
+#    include <emmintrin.h>
+#    define HG_MEM_COPY_HAS_NT
+#endif
+
+/************************************/
+/* Local Type and Struct Definition */
+/************************************/
+
+/* Completion of a copy split across helper threads */
+struct hg_mem_copy_sync {
+    hg_thread_mutex_t mutex;
+    hg_thread_cond_t cond;
+    unsigned int pending;
+};
+
+/* Part of a copy run by a helper thread */
+struct hg_mem_copy_chunk {
+    struct hg_thread_work work;
+    struct hg_mem_copy_sync *sync;
+    char *dest;
+    const char *src;
+    size_t n;
+};
+
+/********************/
+/* Local Prototypes */
+/********************/
+
+/**
+ * Copy using non-temporal stores if supported.
+ */
+static void
+hg_mem_copy_nt(char *dest, const char *src, size_t n);
+
+/**
+ * Copy chunk from a helper thread.
+ */
+static HG_THREAD_RETURN_TYPE
+hg_mem_copy_worker(void *args);
+
+/*******************/
+/* Local Variables */
+/*******************/
+
+/* Helper threads shared by all copies */
+static hg_thread_pool_t *hg_mem_copy_pool_g = NULL;
+static unsigned int hg_mem_copy_thread_count_g = 0;
+static unsigned int hg_mem_copy_refcount_g = 0;
+static hg_thread_mutex_t hg_mem_copy_mutex_g = HG_THREAD_MUTEX_INITIALIZER;
+
+/*---------------------------------------------------------------------------*/
+static void
+hg_mem_copy_nt(char *dest, const char *src, size_t n)
+{
+#ifdef HG_MEM_COPY_HAS_NT
+    size_t head = (size_t) (-(uintptr_t) dest & 15);
+
+    /* Streaming stores require aligned destinations */
+    memcpy(dest, src, head);
+    dest += head;
+    src += head;
+    n -= head;
+
+    for (; n >= 64; n -= 64, dest += 64, src += 64) {
+        __m128i x0 = _mm_loadu_si128((const __m128i *) src);
+        __m128i x1 = _mm_loadu_si128((const __m128i *) (src + 16));
+        __m128i x2 = _mm_loadu_si128((const __m128i *) (src + 32));
+        __m128i x3 = _mm_loadu_si128((const __m128i *) (src + 48));
+
+        _mm_stream_si128((__m128i *) dest, x0);
+        _mm_stream_si128((__m128i *) (dest + 16), x1);
+        _mm_stream_si128((__m128i *) (dest + 32), x2);
+        _mm_stream_si128((__m128i *) (dest + 48), x3);
+    }
+
+    /* Make streaming stores visible before returning */
+    _mm_sfence();
+#endif
+    memcpy(dest, src, n);
+}
+
+/*---------------------------------------------------------------------------*/
+static HG_THREAD_RETURN_TYPE
+hg_mem_copy_worker(void *args)
+{
+    hg_thread_ret_t ret = 0;
+    struct hg_mem_copy_chunk *chunk = (struct hg_mem_copy_chunk *) args;
+    struct hg_mem_copy_sync *sync = chunk->sync;
+
+    hg_mem_copy_nt(chunk->dest, chunk->src, chunk->n);
+
+    hg_thread_mutex_lock(&sync->mutex);
+    if (--sync->pending == 0)
+        hg_thread_cond_signal(&sync->cond);
+    hg_thread_mutex_unlock(&sync->mutex);
+
+    return ret;
+}
 
 /*---------------------------------------------------------------------------*/
 long
@@ -177,3 +281,117 @@ hg_mem_shm_unmap(const char *name, void *mem_ptr, size_t size)
 done:
     return ret;
 }
+
+/*---------------------------------------------------------------------------*/
+int
+hg_mem_copy_init(unsigned int thread_count)
+{
+    int ret = HG_UTIL_SUCCESS;
+
+    hg_thread_mutex_lock(&hg_mem_copy_mutex_g);
+
+    if (thread_count > HG_MEM_COPY_THREAD_MAX)
+        thread_count = HG_MEM_COPY_THREAD_MAX;
+
+    if (thread_count > 0 && !hg_mem_copy_pool_g) {
+        int rc = hg_thread_pool_init(thread_count, &hg_mem_copy_pool_g);
+        HG_UTIL_CHECK_ERROR(rc != HG_UTIL_SUCCESS, unlock, ret, HG_UTIL_FAIL,
+            "Could not create copy thread pool");
+        hg_mem_copy_thread_count_g = thread_count;
+    }
+    hg_mem_copy_refcount_g++;
+
+unlock:
+    hg_thread_mutex_unlock(&hg_mem_copy_mutex_g);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+int
+hg_mem_copy_finalize(void)
+{
+    int ret = HG_UTIL_SUCCESS;
+
+    hg_thread_mutex_lock(&hg_mem_copy_mutex_g);
+
+    HG_UTIL_CHECK_ERROR(hg_mem_copy_refcount_g == 0, unlock, ret, HG_UTIL_FAIL,
+        "Copy engine was not initialized");
+
+    if (--hg_mem_copy_refcount_g == 0 && hg_mem_copy_pool_g) {
+        int rc = hg_thread_pool_destroy(hg_mem_copy_pool_g);
+        HG_UTIL_CHECK_ERROR(rc != HG_UTIL_SUCCESS, unlock, ret, HG_UTIL_FAIL,
+            "Could not destroy copy thread pool");
+        hg_mem_copy_pool_g = NULL;
+        hg_mem_copy_thread_count_g = 0;
+    }
+
+unlock:
+    hg_thread_mutex_unlock(&hg_mem_copy_mutex_g);
+
+    return ret;
+}
+
+/*---------------------------------------------------------------------------*/
+void
+hg_mem_copy(void *dest, const void *src, size_t n)
+{
+    struct hg_mem_copy_chunk chunks[HG_MEM_COPY_THREAD_MAX];
+    struct hg_mem_copy_sync sync;
+    hg_thread_pool_t *pool = hg_mem_copy_pool_g;
+    size_t chunk_size, n_left = n;
+    unsigned int chunk_count, i;
+
+    if (n < HG_MEM_COPY_NT_THRESHOLD) {
+        memcpy(dest, src, n);
+        return;
+    }
+
+    if (!pool || n < HG_MEM_COPY_PARALLEL_THRESHOLD) {
+        hg_mem_copy_nt((char *) dest, (const char *) src, n);
+        return;
+    }
+
+    /* Chunks are cache-aligned and large enough to amortize the hand-off, the
+     * calling thread copies the first one */
+    chunk_count = (unsigned int) (n / HG_MEM_COPY_NT_THRESHOLD);
+    if (chunk_count > hg_mem_copy_thread_count_g + 1)
+        chunk_count = hg_mem_copy_thread_count_g + 1;
+    chunk_size = (n / chunk_count + HG_MEM_CACHE_LINE_SIZE - 1) &
+                 ~((size_t) HG_MEM_CACHE_LINE_SIZE - 1);
+
+    hg_thread_mutex_init(&sync.mutex);
+    hg_thread_cond_init(&sync.cond);
+    sync.pending = 0;
+
+    for (i = 1; i < chunk_count && n_left > chunk_size; i++) {
+        struct hg_mem_copy_chunk *chunk = &chunks[i - 1];
+        size_t offset = i * chunk_size;
+
+        chunk->sync = &sync;
+        chunk->dest = (char *) dest + offset;
+        chunk->src = (const char *) src + offset;
+        chunk->n = (n - offset < chunk_size) ? n - offset : chunk_size;
+        chunk->work.func = hg_mem_copy_worker;
+        chunk->work.args = chunk;
+        n_left -= chunk->n;
+
+        hg_thread_mutex_lock(&sync.mutex);
+        sync.pending++;
+        hg_thread_mutex_unlock(&sync.mutex);
+        if (hg_thread_pool_post(pool, &chunk->work) != HG_UTIL_SUCCESS) {
+            /* Copy it here if it cannot be handed off */
+            hg_mem_copy_worker(chunk);
+        }
+    }
+
+    hg_mem_copy_nt((char *) dest, (const char *) src, n_left);
+
+    hg_thread_mutex_lock(&sync.mutex);
+    while (sync.pending > 0)
+        hg_thread_cond_wait(&sync.cond, &sync.mutex);
+    hg_thread_mutex_unlock(&sync.mutex);
+
+    hg_thread_cond_destroy(&sync.cond);
+    hg_thread_mutex_destroy(&sync.mutex);
+}
@@ -24,6 +24,15 @@
 #define HG_MEM_CACHE_LINE_SIZE 64
 #define HG_MEM_PAGE_SIZE       4096
 
+/* Copies of at least this size bypass the cache using non-temporal stores */
+#define HG_MEM_COPY_NT_THRESHOLD (1 << 20)
+
+/* Copies of at least this size are split across copy helper threads */
+#define HG_MEM_COPY_PARALLEL_THRESHOLD (1 << 22)
+
+/* Max number of copy helper threads */
+#define HG_MEM_COPY_THREAD_MAX 16
+
 /*********************/
 /* Public Prototypes */
 /*********************/
@@ -85,6 +94,45 @@ hg_mem_shm_map(const char *name, size_t size, hg_util_bool_t create);
 HG_UTIL_PUBLIC int
 hg_mem_shm_unmap(const char *name, void *mem_ptr, size_t size);
 
+/**
+ * Initialize the memory copy engine used by hg_mem_copy(). The engine is
+ * process-wide and calls are reference counted, the first call that requests
+ * a non-zero number of threads starts thread_count (at most
+ * HG_MEM_COPY_THREAD_MAX) helper threads that are shared by all subsequent
+ * copies, until the matching last call to hg_mem_copy_finalize(). The
+ * thread_count of later calls is ignored while threads are running.
+ *
+ * \param thread_count [IN]     number of helper threads
+ *
+ * \return Non-negative on success or negative on failure
+ */
+HG_UTIL_PUBLIC int
+hg_mem_copy_init(unsigned int thread_count);
+
+/**
+ * Finalize the memory copy engine. No copy must be in progress when the last
+ * reference is released.
+ *
+ * \return Non-negative on success or negative on failure
+ */
+HG_UTIL_PUBLIC int
+hg_mem_copy_finalize(void);
+
+/**
+ * Copy n bytes from src to dest, memory areas must not overlap. Copies of at
+ * least HG_MEM_COPY_NT_THRESHOLD bytes use non-temporal stores when supported
+ * so that they do not evict the cache, and copies of at least
+ * HG_MEM_COPY_PARALLEL_THRESHOLD bytes are split across helper threads if
+ * hg_mem_copy_init() was called with a non-zero number of threads. Smaller
+ * copies are equivalent to memcpy().
+ *
+ * \param dest [IN/OUT]         pointer to destination
+ * \param src [IN]              pointer to source
+ * \param n [IN]                number of bytes to copy
+ */
+HG_UTIL_PUBLIC void
+hg_mem_copy(void *dest, const void *src, size_t n);
+
 #ifdef __cplusplus
 }
 #endif
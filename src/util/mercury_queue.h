@@ -88,6 +88,13 @@
         (head_ptr)->tail = &(entry_ptr)->entry_field_name.next;                \
     } while (/*CONSTCOND*/ 0)
 
+#define HG_QUEUE_PUSH_HEAD(head_ptr, entry_ptr, entry_field_name)              \
+    do {                                                                       \
+        if (((entry_ptr)->entry_field_name.next = (head_ptr)->head) == NULL)   \
+            (head_ptr)->tail = &(entry_ptr)->entry_field_name.next;            \
+        (head_ptr)->head = (entry_ptr);                                        \
+    } while (/*CONSTCOND*/ 0)
+
 /* TODO would be nice to not have any condition */
 #define HG_QUEUE_POP_HEAD(head_ptr, entry_field_name)                          \
     do {                                                                       \